@@ -0,0 +1,14 @@
+//  Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <tbb/parallel_for.h>
+
+int main()
+{
+   // The parallel algorithms of libstdc++ are built on TBB, and need to link against it:
+   int n = 0;
+   tbb::parallel_for(0, 1, [&n](int i) { n += i; });
+   return n;
+}
@@ -121,6 +121,121 @@ struct type_at<fvar<RealType, Order>, Depth> {
 template <typename RealType, size_t Depth>
 using get_type_at = typename type_at<RealType, Depth>::type;
 
+// Kernels for truncated Taylor series arithmetic on coefficient arrays of equal length.  Each
+// coefficient of a product is accumulated in the same order as by std::inner_product, so results
+// are unchanged.  Orders up to max_unrolled_order are unrolled completely at compile time, which
+// removes all loop overhead and leaves straight line code the compiler can schedule and vectorize
+// (as SLP) freely: this is much faster for the low orders which are most often used.
+#ifndef BOOST_MATH_AUTODIFF_MAX_UNROLLED_ORDER
+#define BOOST_MATH_AUTODIFF_MAX_UNROLLED_ORDER 4
+#endif
+constexpr size_t max_unrolled_order = BOOST_MATH_AUTODIFF_MAX_UNROLLED_ORDER;
+
+// a[0] * b[I] + a[1] * b[I - 1] + ... + a[K] * b[I - K]
+template <size_t I, size_t K>
+struct truncated_product_term {
+  template <typename R, typename A, typename B>
+  static R sum(A const& a, B const& b) {
+    return truncated_product_term<I, K - 1>::template sum<R>(a, b) + a[K] * b[I - K];
+  }
+};
+
+template <size_t I>
+struct truncated_product_term<I, 0> {
+  template <typename R, typename A, typename B>
+  static R sum(A const& a, B const& b) {
+    return R(a[0] * b[I]);
+  }
+};
+
+template <typename R, size_t N, typename A, typename B, size_t... Is>
+void truncated_multiply(std::array<R, N>& r, A const& a, B const& b, std::index_sequence<Is...>) {
+  r = {{truncated_product_term<Is, Is>::template sum<R>(a, b)...}};
+}
+
+// r = a * b, r may be the same as a or b.
+template <typename R, size_t N, typename A, typename B>
+void truncated_multiply(std::array<R, N>& r, std::array<A, N> const& a, std::array<B, N> const& b) {
+  BOOST_IF_CONSTEXPR (N <= max_unrolled_order + 1)
+    truncated_multiply(r, a, b, std::make_index_sequence<N>{});
+  else {
+    // Descending, so that r may be the same as a or b:
+    for (size_t i = N; i-- != 0;) {
+      R sum = a[0] * b[i];
+      for (size_t k = 1; k <= i; ++k)
+        sum += a[k] * b[i - k];
+      r[i] = sum;
+    }
+  }
+}
+
+template <typename R, size_t N, typename A, typename E, size_t... Is>
+void truncated_multiply_by_epsilon(std::array<R, N>& r, A const& a, E const& e, std::index_sequence<Is...>) {
+  r = {{R(0), truncated_product_term<Is + 1, Is>::template sum<R>(a, e)...}};
+}
+
+// r = a * e where e[0] == 0, r may be the same as a or e.
+template <typename R, size_t N, typename A, typename E>
+void truncated_multiply_by_epsilon(std::array<R, N>& r, std::array<A, N> const& a, std::array<E, N> const& e) {
+  BOOST_IF_CONSTEXPR (N <= max_unrolled_order + 1)
+    truncated_multiply_by_epsilon(r, a, e, std::make_index_sequence<N - 1>{});
+  else {
+    for (size_t i = N; --i != 0;) {
+      R sum = a[0] * e[i];
+      for (size_t k = 1; k < i; ++k)
+        sum += a[k] * e[i - k];
+      r[i] = sum;
+    }
+    r[0] = 0;
+  }
+}
+
+template <typename R, typename A, typename E>
+void truncated_multiply_by_epsilon(std::array<R, 0>&, std::array<A, 0> const&, std::array<E, 0> const&) {}
+
+// b[1] * r[I - 1] + b[2] * r[I - 2] + ... + b[K] * r[I - K]
+template <size_t I, size_t K>
+struct truncated_quotient_term {
+  template <typename R, typename B, typename Q>
+  static R sum(B const& b, Q const& r) {
+    return truncated_quotient_term<I, K - 1>::template sum<R>(b, r) + b[K] * r[I - K];
+  }
+};
+
+template <size_t I>
+struct truncated_quotient_term<I, 1> {
+  template <typename R, typename B, typename Q>
+  static R sum(B const& b, Q const& r) {
+    return R(b[1] * r[I - 1]);
+  }
+};
+
+template <size_t I, size_t N>
+struct truncated_quotient {
+  template <typename R, typename A, typename B>
+  static void apply(std::array<R, N>& r, A const& a, B const& b) {
+    r[I] = (a[I] - truncated_quotient_term<I, I>::template sum<R>(b, r)) / b[0];
+    truncated_quotient<I + 1, N>::apply(r, a, b);
+  }
+};
+
+template <size_t N>
+struct truncated_quotient<N, N> {
+  template <typename R, typename A, typename B>
+  static void apply(std::array<R, N>&, A const&, B const&) {}
+};
+
+// r = a / b for orders up to max_unrolled_order, r may be the same as a but not b.
+template <typename R, size_t N, typename A, typename B>
+void truncated_divide(std::array<R, N>& r, std::array<A, N> const& a, std::array<B, N> const& b) {
+  static_assert(N <= max_unrolled_order + 1, "Only low orders are unrolled.");
+  r[0] = a[0] / b[0];
+  truncated_quotient<1, N>::apply(r, a, b);
+}
+
+template <typename R, typename A, typename B>
+void truncated_divide(std::array<R, 0>&, std::array<A, 0> const&, std::array<B, 0> const&) {}
+
 // Satisfies Boost's Conceptual Requirements for Real Number Types.
 // https://www.boost.org/libs/math/doc/html/math_toolkit/real_concepts.html
 template <typename RealType, size_t Order>
@@ -387,6 +502,9 @@ class fvar {
 
   fvar& multiply_assign_by_root_type(bool is_root, root_type const&);
 
+  // *this *= epsilon, where epsilon is an fvar whose root is zero, as in apply_coefficients().
+  fvar& multiply_assign_by_epsilon(fvar const& epsilon);
+
   template <typename RealType2, size_t Orders2>
   friend class fvar;
 
@@ -725,6 +843,11 @@ template <typename RealType2, size_t Order2>
 fvar<RealType, Order>& fvar<RealType, Order>::operator*=(fvar<RealType2, Order2> const& cr) {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+  if constexpr (Order == Order2)
+    truncated_multiply(v, v, cr.v);
+  else
+#endif
   BOOST_IF_CONSTEXPR (Order <= Order2)
     for (size_t i = 0, j = Order; i <= Order; ++i, --j)
       v[j] = std::inner_product(v.cbegin(), v.cend() - diff_t(i), cr.v.crbegin() + diff_t(i), zero);
@@ -747,6 +870,14 @@ template <typename RealType2, size_t Order2>
 fvar<RealType, Order>& fvar<RealType, Order>::operator/=(fvar<RealType2, Order2> const& cr) {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   RealType const zero(0);
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+  if constexpr (Order == Order2 && Order <= max_unrolled_order) {
+    std::array<RealType, Order + 1> quotient;  // cr may be *this.
+    truncated_divide(quotient, v, cr.v);
+    v = quotient;
+    return *this;
+  }
+#endif
   v.front() /= cr.v.front();
   BOOST_IF_CONSTEXPR (Order < Order2)
     for (size_t i = 1, j = Order2 - 1, k = Order; i <= Order; ++i, --j, --k)
@@ -847,6 +978,11 @@ promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::o
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
   promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+  if constexpr (Order == Order2)
+    truncated_multiply(retval.v, cr.v, v);  // Same summation order as below.
+  else
+#endif
   BOOST_IF_CONSTEXPR (Order < Order2)
     for (size_t i = 0, j = Order, k = Order2; i <= Order2; ++i, j && --j, --k)
       retval.v[i] = std::inner_product(v.cbegin(), v.cend() - diff_t(j), cr.v.crbegin() + diff_t(k), zero);
@@ -876,6 +1012,12 @@ promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::o
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
   promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+  if constexpr (Order == Order2 && Order <= max_unrolled_order) {
+    truncated_divide(retval.v, v, cr.v);
+    return retval;
+  }
+#endif
   retval.v.front() = v.front() / cr.v.front();
   BOOST_IF_CONSTEXPR (Order < Order2) {
     for (size_t i = 1, j = Order2 - 1; i <= Order; ++i, --j)
@@ -1056,7 +1198,7 @@ fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients(size_t const ord
 #endif
   fvar<RealType, Order> accumulator = f(i);
   while (i--)
-    (accumulator *= epsilon) += f(i);
+    accumulator.multiply_assign_by_epsilon(epsilon) += f(i);
   return accumulator;
 }
 
@@ -1148,7 +1290,7 @@ fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives(size_t const orde
 #endif
   fvar<RealType, Order> accumulator = f(i) / factorial<root_type>(static_cast<unsigned>(i));
   while (i--)
-    (accumulator *= epsilon) += f(i) / factorial<root_type>(static_cast<unsigned>(i));
+    accumulator.multiply_assign_by_epsilon(epsilon) += f(i) / factorial<root_type>(static_cast<unsigned>(i));
   return accumulator;
 }
 
@@ -1325,6 +1467,17 @@ fvar<RealType, Order> fvar<RealType, Order>::inverse_apply() const {
   return apply_derivatives_nonhorner(order_sum, [&derivatives](size_t j) { return derivatives[j]; });
 }
 
+template <typename RealType, size_t Order>
+fvar<RealType, Order>& fvar<RealType, Order>::multiply_assign_by_epsilon(fvar const& epsilon) {
+  // When RealType is itself an fvar, only the root of epsilon.v.front() is zero.
+  BOOST_IF_CONSTEXPR (is_fvar<RealType>::value)
+    return *this *= epsilon;
+  else {
+    truncated_multiply_by_epsilon(v, v, epsilon.v);
+    return *this;
+  }
+}
+
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 template <typename RealType, size_t Order>
 fvar<RealType, Order>& fvar<RealType, Order>::multiply_assign_by_root_type(bool is_root,
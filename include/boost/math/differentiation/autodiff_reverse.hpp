@@ -0,0 +1,692 @@
+//  Copyright the Boost.Math authors, 2020
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/acosh.hpp>
+#include <boost/math/special_functions/asinh.hpp>
+#include <boost/math/special_functions/atanh.hpp>
+#include <boost/math/special_functions/cbrt.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/expm1.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/lambert_w.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/tools/config.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace math {
+namespace differentiation {
+// Reverse mode (adjoint) automatic differentiation: operations on rvar<RealType> record the
+// local partial derivatives of each result on a tape, and a single backward sweep over the tape
+// then yields the derivatives of one output with respect to every input.
+namespace reverse_mode {
+
+template <typename RealType>
+class rvar;
+
+template <typename RealType>
+class gradient_tape;
+
+template <typename RealType>
+gradient_tape<RealType>& get_active_tape();
+
+namespace detail {
+
+// One recorded operation: the tape indices of up to two arguments, and the partial
+// derivatives of the result with respect to each of them.
+template <typename RealType>
+struct tape_node {
+  std::size_t arg[2];
+  RealType partial[2];
+  unsigned arity;
+};
+
+struct rvar_access;
+
+}  // namespace detail
+
+// The tape on which rvar operations are recorded.  Nodes are allocated from fixed size blocks
+// which are retained when the tape is rewound or cleared, so once a computation has been
+// recorded once, recording it again allocates no memory.
+template <typename RealType>
+class gradient_tape {
+ public:
+  using position = std::size_t;
+
+  gradient_tape() : m_size(0) {}
+  gradient_tape(gradient_tape const&) = delete;
+  gradient_tape& operator=(gradient_tape const&) = delete;
+
+  // Number of nodes currently recorded.
+  std::size_t size() const { return m_size; }
+
+  // Marks the current end of the tape: variables created before a checkpoint remain valid
+  // after rewinding to it, so the independent variables of an objective function need be
+  // created only once, and each evaluation of the objective rewound afterwards.
+  position checkpoint() const { return m_size; }
+
+  // Discards every node recorded after the checkpoint p, rvars created since then must not be
+  // used again.  Memory is retained for reuse.
+  void rewind(position p) {
+    BOOST_ASSERT(p <= m_size);
+    m_size = p;
+    if (m_adjoints.size() > p)
+      m_adjoints.resize(p);
+  }
+
+  void clear() { rewind(0); }
+
+  // Releases the memory held by nodes beyond the current end of the tape.
+  void shrink_to_fit() {
+    m_blocks.resize((m_size + block_mask) >> block_shift);
+    m_adjoints.shrink_to_fit();
+  }
+
+  // Computes the derivatives of y with respect to every variable recorded before it, which
+  // are then available from rvar::adjoint().  Adjoints from any previous sweep are discarded.
+  void backward(rvar<RealType> const& y);
+
+  // The derivative, computed by the last call to backward(), of its output with respect to x.
+  RealType adjoint(rvar<RealType> const& x) const;
+
+ private:
+  friend struct detail::rvar_access;
+
+  static constexpr std::size_t block_shift = 12;
+  static constexpr std::size_t block_size = std::size_t(1) << block_shift;
+  static constexpr std::size_t block_mask = block_size - 1;
+
+  detail::tape_node<RealType>& node(std::size_t i) { return m_blocks[i >> block_shift][i & block_mask]; }
+
+  std::size_t push(unsigned arity,
+                   std::size_t a0,
+                   RealType const& d0,
+                   std::size_t a1,
+                   RealType const& d1) {
+    if (m_size == (m_blocks.size() << block_shift))
+      m_blocks.emplace_back(new detail::tape_node<RealType>[block_size]);
+    detail::tape_node<RealType>& n = node(m_size);
+    n.arity = arity;
+    n.arg[0] = a0;
+    n.arg[1] = a1;
+    n.partial[0] = d0;
+    n.partial[1] = d1;
+    return m_size++;
+  }
+
+  std::vector<std::unique_ptr<detail::tape_node<RealType>[]>> m_blocks;
+  std::size_t m_size;
+  std::vector<RealType> m_adjoints;
+};
+
+// The tape used by rvar<RealType> operations in the current thread.
+template <typename RealType>
+gradient_tape<RealType>& get_active_tape() {
+  static BOOST_MATH_THREAD_LOCAL gradient_tape<RealType> tape;
+  return tape;
+}
+
+// A reverse mode autodiff variable: its value, and the index of the tape node which computed
+// it.  Constants are not recorded on the tape at all, so converting a number to an rvar gives a
+// constant: use make_rvar() to create the independent variables.
+template <typename RealType>
+class rvar {
+ public:
+  using value_type = RealType;
+
+  rvar() : m_value(0), m_index(constant_index) {}
+
+  // A constant, with zero derivative.
+  rvar(value_type const& ca) : m_value(ca), m_index(constant_index) {}
+
+  template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  rvar(T const& ca) : m_value(static_cast<value_type>(ca)), m_index(constant_index) {}
+
+  value_type const& value() const { return m_value; }
+  explicit operator value_type() const { return m_value; }
+
+  bool is_constant() const { return m_index == constant_index; }
+
+  // The derivative of the output of the last backward() sweep with respect to this variable.
+  value_type adjoint() const { return get_active_tape<RealType>().adjoint(*this); }
+
+  // Computes the derivatives of this with respect to every variable it depends upon.
+  void backward() const { get_active_tape<RealType>().backward(*this); }
+
+  rvar& operator+=(rvar const& cr) { return *this = *this + cr; }
+  rvar& operator-=(rvar const& cr) { return *this = *this - cr; }
+  rvar& operator*=(rvar const& cr) { return *this = *this * cr; }
+  rvar& operator/=(rvar const& cr) { return *this = *this / cr; }
+
+  rvar operator-() const;
+  rvar const& operator+() const { return *this; }
+
+ private:
+  friend struct detail::rvar_access;
+
+  static constexpr std::size_t constant_index = ~std::size_t(0);
+
+  rvar(value_type const& value, std::size_t index) : m_value(value), m_index(index) {}
+
+  value_type m_value;
+  std::size_t m_index;
+};
+
+namespace detail {
+
+struct rvar_access {
+  template <typename RealType>
+  static rvar<RealType> variable(RealType const& value) {
+    return rvar<RealType>(value, get_active_tape<RealType>().push(0, 0, 0, 0, 0));
+  }
+
+  template <typename RealType>
+  static rvar<RealType> unary(rvar<RealType> const& x, RealType const& value, RealType const& dx) {
+    if (x.is_constant())
+      return rvar<RealType>(value);
+    return rvar<RealType>(value, get_active_tape<RealType>().push(1, x.m_index, dx, 0, 0));
+  }
+
+  template <typename RealType>
+  static rvar<RealType> binary(rvar<RealType> const& x,
+                               rvar<RealType> const& y,
+                               RealType const& value,
+                               RealType const& dx,
+                               RealType const& dy) {
+    if (x.is_constant())
+      return unary(y, value, dy);
+    if (y.is_constant())
+      return unary(x, value, dx);
+    return rvar<RealType>(value, get_active_tape<RealType>().push(2, x.m_index, dx, y.m_index, dy));
+  }
+
+  template <typename RealType>
+  static std::size_t index(rvar<RealType> const& x) {
+    return x.m_index;
+  }
+};
+
+}  // namespace detail
+
+// Creates an independent variable with value ca, recorded on the active tape.
+template <typename RealType>
+rvar<RealType> make_rvar(RealType const& ca) {
+  return detail::rvar_access::variable(ca);
+}
+
+// Extension points for functions not overloaded here: the result of a function f(x) with
+// value f(x.value()) and derivative f'(x.value()), and similarly for functions of two variables.
+template <typename RealType>
+rvar<RealType> apply_derivative(rvar<RealType> const& x,
+                                typename rvar<RealType>::value_type const& value,
+                                typename rvar<RealType>::value_type const& dx) {
+  return detail::rvar_access::unary(x, value, dx);
+}
+
+template <typename RealType>
+rvar<RealType> apply_derivatives(rvar<RealType> const& x,
+                                 rvar<RealType> const& y,
+                                 typename rvar<RealType>::value_type const& value,
+                                 typename rvar<RealType>::value_type const& dx,
+                                 typename rvar<RealType>::value_type const& dy) {
+  return detail::rvar_access::binary(x, y, value, dx, dy);
+}
+
+template <typename RealType>
+void gradient_tape<RealType>::backward(rvar<RealType> const& y) {
+  m_adjoints.assign(m_size, RealType(0));
+  if (y.is_constant())
+    return;
+  std::size_t const end = detail::rvar_access::index(y) + 1;
+  BOOST_ASSERT(end <= m_size);
+  m_adjoints[end - 1] = 1;
+  for (std::size_t i = end; i-- != 0;) {
+    RealType const a = m_adjoints[i];
+    if (a == 0)
+      continue;
+    detail::tape_node<RealType> const& n = node(i);
+    if (n.arity > 0)
+      m_adjoints[n.arg[0]] += a * n.partial[0];
+    if (n.arity > 1)
+      m_adjoints[n.arg[1]] += a * n.partial[1];
+  }
+}
+
+template <typename RealType>
+RealType gradient_tape<RealType>::adjoint(rvar<RealType> const& x) const {
+  if (x.is_constant())
+    return 0;
+  std::size_t const i = detail::rvar_access::index(x);
+  // Variables recorded after the last backward sweep do not influence its output:
+  return i < m_adjoints.size() ? m_adjoints[i] : RealType(0);
+}
+
+template <typename RealType>
+rvar<RealType> rvar<RealType>::operator-() const {
+  return detail::rvar_access::unary(*this, -m_value, value_type(-1));
+}
+
+// Arithmetic operators.
+
+template <typename RealType>
+rvar<RealType> operator+(rvar<RealType> const& x, rvar<RealType> const& y) {
+  return detail::rvar_access::binary(x, y, x.value() + y.value(), RealType(1), RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator+(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {
+  return detail::rvar_access::unary(x, x.value() + ca, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator+(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, ca + x.value(), RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(rvar<RealType> const& x, rvar<RealType> const& y) {
+  return detail::rvar_access::binary(x, y, x.value() - y.value(), RealType(1), RealType(-1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {
+  return detail::rvar_access::unary(x, x.value() - ca, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, ca - x.value(), RealType(-1));
+}
+
+template <typename RealType>
+rvar<RealType> operator*(rvar<RealType> const& x, rvar<RealType> const& y) {
+  return detail::rvar_access::binary(x, y, x.value() * y.value(), y.value(), x.value());
+}
+
+template <typename RealType>
+rvar<RealType> operator*(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {
+  return detail::rvar_access::unary(x, x.value() * ca, ca);
+}
+
+template <typename RealType>
+rvar<RealType> operator*(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, ca * x.value(), ca);
+}
+
+template <typename RealType>
+rvar<RealType> operator/(rvar<RealType> const& x, rvar<RealType> const& y) {
+  RealType const value = x.value() / y.value();
+  RealType const inv = 1 / y.value();
+  return detail::rvar_access::binary(x, y, value, inv, -value * inv);
+}
+
+template <typename RealType>
+rvar<RealType> operator/(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {
+  return detail::rvar_access::unary(x, x.value() / ca, 1 / ca);
+}
+
+template <typename RealType>
+rvar<RealType> operator/(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  RealType const value = ca / x.value();
+  return detail::rvar_access::unary(x, value, -value / x.value());
+}
+
+// Comparison operators compare values.
+
+#define BOOST_MATH_RVAR_COMPARISON(op)                                                           \
+  template <typename RealType>                                                                   \
+  bool operator op(rvar<RealType> const& x, rvar<RealType> const& y) {                           \
+    return x.value() op y.value();                                                               \
+  }                                                                                              \
+  template <typename RealType>                                                                   \
+  bool operator op(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {     \
+    return x.value() op ca;                                                                      \
+  }                                                                                              \
+  template <typename RealType>                                                                   \
+  bool operator op(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {     \
+    return ca op x.value();                                                                      \
+  }
+
+BOOST_MATH_RVAR_COMPARISON(==)
+BOOST_MATH_RVAR_COMPARISON(!=)
+BOOST_MATH_RVAR_COMPARISON(<)
+BOOST_MATH_RVAR_COMPARISON(<=)
+BOOST_MATH_RVAR_COMPARISON(>)
+BOOST_MATH_RVAR_COMPARISON(>=)
+
+#undef BOOST_MATH_RVAR_COMPARISON
+
+template <typename RealType>
+std::ostream& operator<<(std::ostream& out, rvar<RealType> const& x) {
+  return out << x.value();
+}
+
+// Standard library functions, found by argument dependent lookup.  Functions which are piecewise
+// constant return constants, and at the points where a function is not differentiable the
+// derivative matches that used by the forward mode fvar.
+
+template <typename RealType>
+rvar<RealType> fabs(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const& v = x.value();
+  return detail::rvar_access::unary(x, fabs(v), v < 0 ? RealType(-1) : v > 0 ? RealType(1) : RealType(0));
+}
+
+template <typename RealType>
+rvar<RealType> abs(rvar<RealType> const& x) {
+  return fabs(x);
+}
+
+template <typename RealType>
+rvar<RealType> ceil(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return rvar<RealType>(ceil(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> floor(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return rvar<RealType>(floor(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> trunc(rvar<RealType> const& x) {
+  return rvar<RealType>(boost::math::trunc(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> round(rvar<RealType> const& x) {
+  return rvar<RealType>(boost::math::round(x.value()));
+}
+
+template <typename RealType>
+int itrunc(rvar<RealType> const& x) {
+  return boost::math::itrunc(x.value());
+}
+
+template <typename RealType>
+long long lltrunc(rvar<RealType> const& x) {
+  return boost::math::lltrunc(x.value());
+}
+
+template <typename RealType>
+int iround(rvar<RealType> const& x) {
+  return boost::math::iround(x.value());
+}
+
+template <typename RealType>
+long lround(rvar<RealType> const& x) {
+  return boost::math::lround(x.value());
+}
+
+template <typename RealType>
+long long llround(rvar<RealType> const& x) {
+  return boost::math::llround(x.value());
+}
+
+template <typename RealType>
+rvar<RealType> exp(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const value = exp(x.value());
+  return detail::rvar_access::unary(x, value, value);
+}
+
+template <typename RealType>
+rvar<RealType> expm1(rvar<RealType> const& x) {
+  RealType const value = boost::math::expm1(x.value());
+  return detail::rvar_access::unary(x, value, value + 1);
+}
+
+template <typename RealType>
+rvar<RealType> log(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, log(x.value()), 1 / x.value());
+}
+
+template <typename RealType>
+rvar<RealType> log1p(rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, boost::math::log1p(x.value()), 1 / (1 + x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> log10(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(
+      x, log10(x.value()), 1 / (x.value() * constants::ln_ten<RealType>()));
+}
+
+template <typename RealType>
+rvar<RealType> sqrt(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const value = sqrt(x.value());
+  return detail::rvar_access::unary(x, value, 1 / (2 * value));
+}
+
+template <typename RealType>
+rvar<RealType> cbrt(rvar<RealType> const& x) {
+  RealType const value = boost::math::cbrt(x.value());
+  return detail::rvar_access::unary(x, value, 1 / (3 * value * value));
+}
+
+template <typename RealType>
+rvar<RealType> pow(rvar<RealType> const& x, rvar<RealType> const& y) {
+  BOOST_MATH_STD_USING
+  RealType const value = pow(x.value(), y.value());
+  RealType const dx = y.value() == 0 ? RealType(0) : y.value() * pow(x.value(), y.value() - 1);
+  RealType const dy = x.value() > 0 ? value * log(x.value()) : RealType(0);
+  return detail::rvar_access::binary(x, y, value, dx, dy);
+}
+
+template <typename RealType>
+rvar<RealType> pow(rvar<RealType> const& x, typename rvar<RealType>::value_type const& ca) {
+  BOOST_MATH_STD_USING
+  RealType const dx = ca == 0 ? RealType(0) : ca * pow(x.value(), ca - 1);
+  return detail::rvar_access::unary(x, pow(x.value(), ca), dx);
+}
+
+template <typename RealType>
+rvar<RealType> pow(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const value = pow(ca, x.value());
+  return detail::rvar_access::unary(x, value, ca > 0 ? value * log(ca) : RealType(0));
+}
+
+template <typename RealType>
+rvar<RealType> frexp(rvar<RealType> const& x, int* exponent) {
+  BOOST_MATH_STD_USING
+  RealType const value = frexp(x.value(), exponent);
+  return detail::rvar_access::unary(x, value, ldexp(RealType(1), -*exponent));
+}
+
+template <typename RealType>
+rvar<RealType> ldexp(rvar<RealType> const& x, int exponent) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, ldexp(x.value(), exponent), ldexp(RealType(1), exponent));
+}
+
+template <typename RealType>
+rvar<RealType> fmod(rvar<RealType> const& x, rvar<RealType> const& y) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::binary(x,
+                                     y,
+                                     fmod(x.value(), y.value()),
+                                     RealType(1),
+                                     -boost::math::trunc(x.value() / y.value()));
+}
+
+template <typename RealType>
+rvar<RealType> cos(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, cos(x.value()), -sin(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> sin(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, sin(x.value()), cos(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> tan(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const value = tan(x.value());
+  return detail::rvar_access::unary(x, value, 1 + value * value);
+}
+
+template <typename RealType>
+rvar<RealType> asin(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, asin(x.value()), 1 / sqrt(1 - x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> acos(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, acos(x.value()), -1 / sqrt(1 - x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> atan(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, atan(x.value()), 1 / (1 + x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> atan2(rvar<RealType> const& y, rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const r2 = x.value() * x.value() + y.value() * y.value();
+  return detail::rvar_access::binary(y, x, atan2(y.value(), x.value()), x.value() / r2, -y.value() / r2);
+}
+
+template <typename RealType>
+rvar<RealType> atan2(rvar<RealType> const& y, typename rvar<RealType>::value_type const& ca) {
+  BOOST_MATH_STD_USING
+  RealType const r2 = ca * ca + y.value() * y.value();
+  return detail::rvar_access::unary(y, atan2(y.value(), ca), ca / r2);
+}
+
+template <typename RealType>
+rvar<RealType> atan2(typename rvar<RealType>::value_type const& ca, rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const r2 = x.value() * x.value() + ca * ca;
+  return detail::rvar_access::unary(x, atan2(ca, x.value()), -ca / r2);
+}
+
+template <typename RealType>
+rvar<RealType> cosh(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, cosh(x.value()), sinh(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> sinh(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, sinh(x.value()), cosh(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> tanh(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  RealType const value = tanh(x.value());
+  return detail::rvar_access::unary(x, value, 1 - value * value);
+}
+
+template <typename RealType>
+rvar<RealType> acosh(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(
+      x, boost::math::acosh(x.value()), 1 / sqrt((x.value() - 1) * (x.value() + 1)));
+}
+
+template <typename RealType>
+rvar<RealType> asinh(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(x, boost::math::asinh(x.value()), 1 / sqrt(x.value() * x.value() + 1));
+}
+
+template <typename RealType>
+rvar<RealType> atanh(rvar<RealType> const& x) {
+  return detail::rvar_access::unary(
+      x, boost::math::atanh(x.value()), 1 / ((1 - x.value()) * (1 + x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> erf(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(
+      x, boost::math::erf(x.value()), constants::two_div_root_pi<RealType>() * exp(-x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> erfc(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  return detail::rvar_access::unary(
+      x, boost::math::erfc(x.value()), -constants::two_div_root_pi<RealType>() * exp(-x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> lgamma(rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, boost::math::lgamma(x.value()), boost::math::digamma(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> tgamma(rvar<RealType> const& x) {
+  RealType const value = boost::math::tgamma(x.value());
+  return detail::rvar_access::unary(x, value, value * boost::math::digamma(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> digamma(rvar<RealType> const& x) {
+  return detail::rvar_access::unary(x, boost::math::digamma(x.value()), boost::math::trigamma(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> lambert_w0(rvar<RealType> const& x) {
+  RealType const value = boost::math::lambert_w0(x.value());
+  RealType const dx = x.value() == 0 ? RealType(1) : value / (x.value() * (1 + value));
+  return detail::rvar_access::unary(x, value, dx);
+}
+
+template <typename RealType>
+rvar<RealType> sinc(rvar<RealType> const& x) {
+  BOOST_MATH_STD_USING
+  if (x.value() == 0)
+    return detail::rvar_access::unary(x, RealType(1), RealType(0));
+  RealType const value = sin(x.value()) / x.value();
+  return detail::rvar_access::unary(x, value, (cos(x.value()) - value) / x.value());
+}
+
+}  // namespace reverse_mode
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+namespace std {
+
+// boost::math::tools::digits<RealType>() is handled by this std::numeric_limits<> specialization,
+// and similarly for max_value, min_value, log_max_value, log_min_value, and epsilon.
+template <typename RealType>
+class numeric_limits<boost::math::differentiation::reverse_mode::rvar<RealType>>
+    : public numeric_limits<RealType> {};
+
+}  // namespace std
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
@@ -0,0 +1,76 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
+#define BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <boost/math/special_functions/detail/batch_partition.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Array evaluation of pdf, cdf and quantile: each sets out[i] to the value
+// of the scalar function at first[i] for i in [0, last - first).
+//
+// The default just calls the scalar function for each value.  Distributions
+// specialize this to check their parameters only once, to hoist invariants
+// out of the loop, and to use the array forms of the special functions they
+// are built on.  The specializations must give the same results as the
+// scalar functions.
+//
+template <class Distribution>
+struct batch_evaluator
+{
+   typedef typename Distribution::value_type value_type;
+
+   template <class T>
+   static void pdf_n(const Distribution& dist, const T* first, const T* last, value_type* out)
+   {
+      for(; first != last; ++first, ++out)
+         *out = pdf(dist, static_cast<value_type>(*first));
+   }
+   template <class T>
+   static void cdf_n(const Distribution& dist, const T* first, const T* last, value_type* out)
+   {
+      for(; first != last; ++first, ++out)
+         *out = cdf(dist, static_cast<value_type>(*first));
+   }
+   template <class T>
+   static void quantile_n(const Distribution& dist, const T* first, const T* last, value_type* out)
+   {
+      for(; first != last; ++first, ++out)
+         *out = quantile(dist, static_cast<value_type>(*first));
+   }
+};
+
+} // namespace detail
+
+template <class Distribution, class RealType>
+inline void pdf(const Distribution& dist, const RealType* first, const RealType* last, typename Distribution::value_type* out)
+{
+   detail::batch_evaluator<Distribution>::pdf_n(dist, first, last, out);
+}
+
+template <class Distribution, class RealType>
+inline void cdf(const Distribution& dist, const RealType* first, const RealType* last, typename Distribution::value_type* out)
+{
+   detail::batch_evaluator<Distribution>::cdf_n(dist, first, last, out);
+}
+
+template <class Distribution, class RealType>
+inline void quantile(const Distribution& dist, const RealType* first, const RealType* last, typename Distribution::value_type* out)
+{
+   detail::batch_evaluator<Distribution>::quantile_n(dist, first, last, out);
+}
+
+}} // namespaces
+
+#endif // BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
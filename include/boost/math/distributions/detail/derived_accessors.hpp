@@ -29,6 +29,7 @@
 
 #include <boost/type_traits/is_same.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #ifdef BOOST_MSVC
 # pragma warning(push)
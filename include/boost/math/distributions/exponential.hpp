@@ -12,6 +12,7 @@
 #include <boost/math/special_functions/expm1.hpp>
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 #include <boost/config/no_tr1/cmath.hpp>
 
 #ifdef BOOST_MSVC
@@ -209,6 +210,93 @@ inline RealType quantile(const complemented2_type<exponential_distribution<RealT
    return result;
 }
 
+namespace detail{
+
+//
+// Array forms of pdf, cdf and quantile which check lambda only once:
+//
+template <class RealType, class Policy>
+struct batch_evaluator<exponential_distribution<RealType, Policy> >
+{
+   typedef exponential_distribution<RealType, Policy> distribution_type;
+
+   template <class T>
+   static void pdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING // for ADL of std functions
+
+      static const char* function = "boost::math::pdf(const exponential_distribution<%1%>&, %1%)";
+
+      RealType lambda = dist.lambda();
+      RealType result = 0;
+      if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(0 == detail::verify_exp_x(function, x, &result, Policy()))
+            *out = result;
+         else if((boost::math::isinf)(x))
+            *out = 0;
+         else
+            *out = lambda * exp(-lambda * x);
+      }
+   }
+
+   template <class T>
+   static void cdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::cdf(const exponential_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      RealType lambda = dist.lambda();
+      if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(0 == detail::verify_exp_x(function, x, &result, Policy()))
+            *out = result;
+         else
+            *out = -boost::math::expm1(-x * lambda, Policy());
+      }
+   }
+
+   template <class T>
+   static void quantile_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::quantile(const exponential_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      RealType lambda = dist.lambda();
+      if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      for(; first != last; ++first, ++out)
+      {
+         RealType p = static_cast<RealType>(*first);
+         if(0 == detail::check_probability(function, p, &result, Policy()))
+            *out = result;
+         else if(p == 0)
+            *out = 0;
+         else if(p == 1)
+            *out = policies::raise_overflow_error<RealType>(function, 0, Policy());
+         else
+            *out = -boost::math::log1p(-p, Policy()) / lambda;
+      }
+   }
+};
+
+} // namespace detail
+
 template <class RealType, class Policy>
 inline RealType mean(const exponential_distribution<RealType, Policy>& dist)
 {
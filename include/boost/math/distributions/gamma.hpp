@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/digamma.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
 #include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 
@@ -230,6 +231,127 @@ inline RealType quantile(const complemented2_type<gamma_distribution<RealType, P
    return result;
 }
 
+namespace detail{
+
+//
+// Array forms of pdf, cdf and quantile: the parameters are checked once,
+// and cdf and quantile use the array forms of gamma_p and gamma_p_inv,
+// which do the work depending only on the shape once.
+//
+template <class RealType, class Policy>
+struct batch_evaluator<gamma_distribution<RealType, Policy> >
+{
+   typedef gamma_distribution<RealType, Policy> distribution_type;
+
+   template <class T>
+   static void pdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::pdf(const gamma_distribution<%1%>&, %1%)";
+
+      RealType shape = dist.shape();
+      RealType scale = dist.scale();
+
+      RealType result = 0;
+      if(false == detail::check_gamma(function, scale, shape, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(false == detail::check_gamma_x(function, x, &result, Policy()))
+            *out = result;
+         else if(x == 0)
+            *out = 0;
+         else
+            *out = gamma_p_derivative(shape, x / scale, Policy()) / scale;
+      }
+   }
+
+   template <class T>
+   static void cdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::cdf(const gamma_distribution<%1%>&, %1%)";
+
+      RealType shape = dist.shape();
+      RealType scale = dist.scale();
+
+      RealType result = 0;
+      if(false == detail::check_gamma(function, scale, shape, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType z[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            // Invalid values are replaced with 0 here and reported below:
+            z[i] = (x >= 0) && (boost::math::isfinite)(x) ? RealType(x / scale) : RealType(0);
+         }
+         boost::math::gamma_p(shape, z, z + n, r, Policy());
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            if(false == detail::check_gamma_x(function, x, &result, Policy()))
+               out[i] = result;
+            else
+               out[i] = r[i];
+         }
+         first += n;
+         out += n;
+      }
+   }
+
+   template <class T>
+   static void quantile_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::quantile(const gamma_distribution<%1%>&, %1%)";
+
+      RealType shape = dist.shape();
+      RealType scale = dist.scale();
+
+      RealType result = 0;
+      if(false == detail::check_gamma(function, scale, shape, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType z[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            // Invalid probabilities, and 1, are replaced with 1/2 here and reported below:
+            z[i] = (p >= 0) && (p < 1) ? p : RealType(0.5f);
+         }
+         boost::math::gamma_p_inv(shape, z, z + n, r, Policy());
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            if(false == detail::check_probability(function, p, &result, Policy()))
+               out[i] = result;
+            else if(p == 1)
+               out[i] = policies::raise_overflow_error<RealType>(function, 0, Policy());
+            else
+               out[i] = r[i] * scale;
+         }
+         first += n;
+         out += n;
+      }
+   }
+};
+
+} // namespace detail
+
 template <class RealType, class Policy>
 inline RealType mean(const gamma_distribution<RealType, Policy>& dist)
 {
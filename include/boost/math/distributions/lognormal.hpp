@@ -14,6 +14,7 @@
 #include <boost/math/distributions/normal.hpp>
 #include <boost/math/special_functions/expm1.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 
@@ -213,6 +214,138 @@ inline RealType quantile(const complemented2_type<lognormal_distribution<RealTyp
    return exp(quantile(complement(norm, c.param)));
 }
 
+namespace detail{
+
+//
+// Array forms of pdf, cdf and quantile: the parameters are checked once,
+// and cdf and quantile forward to the array forms for the normal distribution.
+//
+template <class RealType, class Policy>
+struct batch_evaluator<lognormal_distribution<RealType, Policy> >
+{
+   typedef lognormal_distribution<RealType, Policy> distribution_type;
+
+   template <class T>
+   static void pdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      RealType mu = dist.location();
+      RealType sigma = dist.scale();
+
+      static const char* function = "boost::math::pdf(const lognormal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((0 == detail::check_scale(function, sigma, &result, Policy()))
+         || (0 == detail::check_location(function, mu, &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType variance2 = 2 * sigma * sigma;
+      RealType normalizer = sigma * sqrt(2 * constants::pi<RealType>());
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(0 == detail::check_lognormal_x(function, x, &result, Policy()))
+            *out = result;
+         else if(x == 0)
+            *out = 0;
+         else
+         {
+            RealType exponent = log(x) - mu;
+            exponent *= -exponent;
+            exponent /= variance2;
+            *out = exp(exponent) / (normalizer * x);
+         }
+      }
+   }
+
+   template <class T>
+   static void cdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      static const char* function = "boost::math::cdf(const lognormal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((0 == detail::check_scale(function, dist.scale(), &result, Policy()))
+         || (0 == detail::check_location(function, dist.location(), &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      normal_distribution<RealType, Policy> norm(dist.location(), dist.scale());
+      RealType y[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            y[i] = (x > 0) && (boost::math::isfinite)(x) ? RealType(log(x)) : RealType(0);
+         }
+         batch_evaluator<normal_distribution<RealType, Policy> >::cdf_n(norm, y, y + n, r);
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            if(0 == detail::check_lognormal_x(function, x, &result, Policy()))
+               out[i] = result;
+            else
+               out[i] = x == 0 ? RealType(0) : r[i];
+         }
+         first += n;
+         out += n;
+      }
+   }
+
+   template <class T>
+   static void quantile_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      static const char* function = "boost::math::quantile(const lognormal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((0 == detail::check_scale(function, dist.scale(), &result, Policy()))
+         || (0 == detail::check_location(function, dist.location(), &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      normal_distribution<RealType, Policy> norm(dist.location(), dist.scale());
+      RealType z[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            z[i] = (p > 0) && (p < 1) ? p : RealType(0.5f);
+         }
+         batch_evaluator<normal_distribution<RealType, Policy> >::quantile_n(norm, z, z + n, r);
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            if(0 == detail::check_probability(function, p, &result, Policy()))
+               out[i] = result;
+            else if(p == 0)
+               out[i] = 0;
+            else if(p == 1)
+               out[i] = policies::raise_overflow_error<RealType>(function, 0, Policy());
+            else
+               out[i] = exp(r[i]);
+         }
+         first += n;
+         out += n;
+      }
+   }
+};
+
+} // namespace detail
+
 template <class RealType, class Policy>
 inline RealType mean(const lognormal_distribution<RealType, Policy>& dist)
 {
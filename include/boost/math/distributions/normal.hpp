@@ -19,6 +19,7 @@
 #include <boost/math/special_functions/erf.hpp> // for erf/erfc.
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 
@@ -274,6 +275,146 @@ inline RealType quantile(const complemented2_type<normal_distribution<RealType,
    return result;
 } // quantile
 
+namespace detail{
+
+//
+// Array forms of pdf, cdf and quantile: the parameters are checked once,
+// and cdf and quantile use the array forms of erfc and erfc_inv.
+//
+template <class RealType, class Policy>
+struct batch_evaluator<normal_distribution<RealType, Policy> >
+{
+   typedef normal_distribution<RealType, Policy> distribution_type;
+
+   template <class T>
+   static void pdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      RealType sd = dist.standard_deviation();
+      RealType mean = dist.mean();
+      static const char* function = "boost::math::pdf(const normal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((false == detail::check_scale(function, sd, &result, Policy()))
+         || (false == detail::check_location(function, mean, &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType variance2 = 2 * sd * sd;
+      RealType normalizer = sd * sqrt(2 * constants::pi<RealType>());
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if((boost::math::isinf)(x))
+            *out = 0;
+         else if(false == detail::check_x(function, x, &result, Policy()))
+            *out = result;
+         else
+         {
+            RealType exponent = x - mean;
+            exponent *= -exponent;
+            exponent /= variance2;
+            *out = exp(exponent) / normalizer;
+         }
+      }
+   }
+
+   template <class T>
+   static void cdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      RealType sd = dist.standard_deviation();
+      RealType mean = dist.mean();
+      static const char* function = "boost::math::cdf(const normal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((false == detail::check_scale(function, sd, &result, Policy()))
+         || (false == detail::check_location(function, mean, &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType scale = sd * constants::root_two<RealType>();
+      RealType z[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            RealType diff = (x - mean) / scale;
+            z[i] = (boost::math::isfinite)(x) ? RealType(-diff) : RealType(0);
+         }
+         boost::math::erfc(z, z + n, r, Policy());
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType x = static_cast<RealType>(first[i]);
+            if((boost::math::isinf)(x))
+               out[i] = x < 0 ? 0 : 1;
+            else if(false == detail::check_x(function, x, &result, Policy()))
+               out[i] = result;
+            else
+               out[i] = r[i] / 2;
+         }
+         first += n;
+         out += n;
+      }
+   }
+
+   template <class T>
+   static void quantile_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+
+      RealType sd = dist.standard_deviation();
+      RealType mean = dist.mean();
+      static const char* function = "boost::math::quantile(const normal_distribution<%1%>&, %1%)";
+
+      RealType result = 0;
+      if((false == detail::check_scale(function, sd, &result, Policy()))
+         || (false == detail::check_location(function, mean, &result, Policy())))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      RealType scale = sd * constants::root_two<RealType>();
+      RealType z[batch_block_size];
+      RealType r[batch_block_size];
+      while(first != last)
+      {
+         unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            // Invalid probabilities are replaced with 1/2 here and reported below:
+            z[i] = (p >= 0) && (p <= 1) ? RealType(2 * p) : RealType(1);
+         }
+         boost::math::erfc_inv(z, z + n, r, Policy());
+         for(unsigned i = 0; i < n; ++i)
+         {
+            RealType p = static_cast<RealType>(first[i]);
+            if(false == detail::check_probability(function, p, &result, Policy()))
+               out[i] = result;
+            else
+            {
+               result = -r[i];
+               result *= scale;
+               result += mean;
+               out[i] = result;
+            }
+         }
+         first += n;
+         out += n;
+      }
+   }
+};
+
+} // namespace detail
+
 template <class RealType, class Policy>
 inline RealType mean(const normal_distribution<RealType, Policy>& dist)
 {
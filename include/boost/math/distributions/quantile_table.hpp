@@ -0,0 +1,439 @@
+//  Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_QUANTILE_TABLE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_QUANTILE_TABLE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/detail/thread_pool.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/roots.hpp>
+
+namespace boost{ namespace math{
+
+namespace detail{
+
+//
+// One half of a quantile_table: a piecewise cubic Hermite interpolant of the quantile as a
+// function of u = log(p) on [log(p_min), log(1/2)], where p is the cdf for the lower half and the
+// complement of the cdf for the upper half.  Working in log(p) keeps the tails smooth: the normal
+// quantile for example behaves like -sqrt(-2u), where as a function of p its derivatives grow
+// without bound as p -> 0.  The slopes at the knots are the exact derivatives dx/du = p / pdf(x).
+//
+template <class Distribution>
+class quantile_table_half
+{
+public:
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   // An empty table, for a quantile_table whose arguments were invalid:
+   quantile_table_half(const Distribution& dist, bool complement)
+      : m_dist(dist), m_complement(complement), m_error(0), m_guide_scale(0)
+   {
+   }
+
+   quantile_table_half(const Distribution& dist, bool complement, value_type p_min, value_type tolerance,
+                       tools::detail::thread_pool& pool)
+      : m_dist(dist), m_complement(complement), m_error(0)
+   {
+      BOOST_MATH_STD_USING
+      std::vector<knot> knots(initial_pieces + 1);
+      value_type u0 = log(p_min);
+      value_type u1 = log(value_type(0.5));
+      pool.parallel_for(knots.size(), [&](std::size_t i)
+      {
+         knot& k = knots[i];
+         k.u = i == initial_pieces ? u1 : u0 + (u1 - u0) * i / initial_pieces;
+         // Use the given end points exactly, so that the table meets the tails and the other half:
+         value_type p = i == 0 ? p_min : i == initial_pieces ? value_type(0.5) : exp(k.u);
+         k.x = m_complement ? quantile(boost::math::complement(m_dist, p)) : quantile(m_dist, p);
+         k.slope = slope(p, k.x);
+         k.residual = residual(p, k.x);
+      });
+      //
+      // Split every piece whose error is too large at its midpoint, until all are accurate enough
+      // or we run out of room.  Each round checks the new pieces in parallel, and the knots are
+      // merged in order afterwards, so the table does not depend on the number of threads.
+      //
+      std::vector<bool> settled(initial_pieces, false);
+      std::vector<value_type> errors(initial_pieces, 0);
+      for (;;)
+      {
+         std::vector<std::size_t> pending;
+         for (std::size_t i = 0; i < settled.size(); ++i)
+         {
+            if (!settled[i])
+            {
+               pending.push_back(i);
+            }
+         }
+         if (pending.empty())
+         {
+            break;
+         }
+         std::vector<knot> midpoints(pending.size());
+         std::vector<bool> split(pending.size(), false);
+         bool room = knots.size() + pending.size() <= max_pieces + 1;
+         pool.parallel_for(pending.size(), [&](std::size_t j)
+         {
+            std::size_t i = pending[j];
+            errors[i] = error(knots[i], knots[i + 1]);
+            // No amount of splitting will make the error much smaller than that of the cdf itself:
+            value_type target = (std::max)(tolerance, 2 * (std::max)(knots[i].residual, knots[i + 1].residual));
+            if (room && errors[i] > target && knots[i + 1].u - knots[i].u > 2 * tools::epsilon<value_type>() * fabs(knots[i].u))
+            {
+               midpoints[j] = midpoint(knots[i], knots[i + 1]);
+               split[j] = true;
+            }
+         });
+         std::vector<knot> new_knots;
+         std::vector<bool> new_settled;
+         std::vector<value_type> new_errors;
+         new_knots.reserve(knots.size() + pending.size());
+         for (std::size_t i = 0, j = 0; i + 1 < knots.size(); ++i)
+         {
+            new_knots.push_back(knots[i]);
+            if (j < pending.size() && pending[j] == i && split[j])
+            {
+               new_knots.push_back(midpoints[j]);
+               new_settled.insert(new_settled.end(), 2, false);
+               new_errors.insert(new_errors.end(), 2, value_type(0));
+            }
+            else
+            {
+               new_settled.push_back(true);
+               new_errors.push_back(errors[i]);
+            }
+            if (j < pending.size() && pending[j] == i)
+            {
+               ++j;
+            }
+         }
+         new_knots.push_back(knots.back());
+         knots.swap(new_knots);
+         settled.swap(new_settled);
+         errors.swap(new_errors);
+      }
+      m_error = *std::max_element(errors.begin(), errors.end());
+      //
+      // Store the pieces in power form, and a guide table giving, for equally spaced values of u,
+      // the piece they lie in: so that a lookup needs only a step or two of linear search.
+      //
+      m_u.resize(knots.size());
+      m_pieces.resize(knots.size() - 1);
+      for (std::size_t i = 0; i < knots.size(); ++i)
+      {
+         m_u[i] = knots[i].u;
+      }
+      for (std::size_t i = 0; i < m_pieces.size(); ++i)
+      {
+         hermite(knots[i], knots[i + 1], m_pieces[i].c);
+         m_pieces[i].scale = 1 / (knots[i + 1].u - knots[i].u);
+      }
+      std::size_t cells = m_pieces.size();
+      m_guide_scale = cells / (u1 - u0);
+      m_guide.resize(cells + 1);
+      for (std::size_t k = 0, i = 0; k <= cells; ++k)
+      {
+         value_type u = u0 + k / m_guide_scale;
+         while (i + 1 < m_pieces.size() && m_u[i + 1] <= u)
+         {
+            ++i;
+         }
+         m_guide[k] = i;
+      }
+   }
+
+   // Requires log(p_min) <= u <= log(1/2).
+   value_type operator()(value_type u) const
+   {
+      std::size_t i = m_guide[(std::min)(static_cast<std::size_t>((u - m_u[0]) * m_guide_scale), m_guide.size() - 1)];
+      while (i + 1 < m_pieces.size() && u >= m_u[i + 1])
+      {
+         ++i;
+      }
+      const piece& s = m_pieces[i];
+      value_type t = (u - m_u[i]) * s.scale;
+      return s.c[0] + t * (s.c[1] + t * (s.c[2] + t * s.c[3]));
+   }
+
+   value_type error() const
+   {
+      return m_error;
+   }
+
+   std::size_t size() const
+   {
+      return m_pieces.size();
+   }
+
+private:
+   struct knot
+   {
+      value_type u;
+      value_type x;
+      value_type slope;
+      value_type residual;  // The relative error in the probability of the quantile x.
+   };
+
+   struct piece
+   {
+      value_type scale;
+      value_type c[4];
+   };
+
+   static const std::size_t initial_pieces = 16;
+   static const std::size_t max_pieces = 1u << 14;
+
+   value_type slope(value_type p, value_type x) const
+   {
+      value_type d = p / pdf(m_dist, x);
+      return m_complement ? -d : d;
+   }
+
+   //
+   // The coefficients of the cubic through a and b in t = (u - a.u) / (b.u - a.u).  If the slopes
+   // would let it overshoot, they are scaled back as in Fritsch and Carlson's monotone interpolation
+   // (SIAM J. Numer. Anal. 17 (1980), 238-246) so that the table is always monotone.
+   //
+   static void hermite(const knot& a, const knot& b, value_type* c)
+   {
+      BOOST_MATH_STD_USING
+      value_type h = b.u - a.u;
+      value_type dx = b.x - a.x;
+      value_type m0 = a.slope * h;
+      value_type m1 = b.slope * h;
+      if (dx == 0)
+      {
+         m0 = m1 = 0;
+      }
+      else
+      {
+         // A zero pdf gives an infinite slope: use the secant instead.
+         value_type alpha = (boost::math::isfinite)(m0) ? (std::max)(value_type(m0 / dx), value_type(0)) : value_type(1);
+         value_type beta = (boost::math::isfinite)(m1) ? (std::max)(value_type(m1 / dx), value_type(0)) : value_type(1);
+         value_type r = alpha * alpha + beta * beta;
+         if (r > 9)
+         {
+            value_type tau = 3 / sqrt(r);
+            alpha *= tau;
+            beta *= tau;
+         }
+         m0 = alpha * dx;
+         m1 = beta * dx;
+      }
+      c[0] = a.x;
+      c[1] = m0;
+      c[2] = 3 * dx - 2 * m0 - m1;
+      c[3] = m0 + m1 - 2 * dx;
+   }
+
+   static value_type interpolate(const knot& a, const knot& b, value_type t)
+   {
+      value_type c[4];
+      hermite(a, b, c);
+      return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+   }
+
+   value_type probability(value_type x) const
+   {
+      return m_complement ? cdf(boost::math::complement(m_dist, x)) : cdf(m_dist, x);
+   }
+
+   value_type residual(value_type p, value_type x) const
+   {
+      BOOST_MATH_STD_USING
+      return fabs(probability(x) - p) / p;
+   }
+
+   //
+   // The relative error in the probability of the interpolated quantile, sampled at the midpoint, where
+   // the error of a cubic Hermite interpolant is largest, and at the quarter points:
+   //
+   value_type error(const knot& a, const knot& b) const
+   {
+      BOOST_MATH_STD_USING
+      value_type result = 0;
+      for (int k = 1; k < 4; ++k)
+      {
+         value_type t = value_type(k) / 4;
+         value_type p = exp(a.u + (b.u - a.u) * t);
+         value_type e = residual(p, interpolate(a, b, t));
+         if (!(e <= result))
+         {
+            result = e;
+         }
+      }
+      return result;
+   }
+
+   struct newton_functor
+   {
+      newton_functor(const quantile_table_half* half, value_type p) : m_half(half), m_p(p) {}
+      std::pair<value_type, value_type> operator()(value_type x) const
+      {
+         value_type d = pdf(m_half->m_dist, x);
+         return std::make_pair(m_half->probability(x) - m_p, m_half->m_complement ? value_type(-d) : d);
+      }
+      const quantile_table_half* m_half;
+      value_type m_p;
+   };
+
+   //
+   // The knot halfway between a and b, found by Newton iteration from the interpolated value,
+   // which is already close:
+   //
+   knot midpoint(const knot& a, const knot& b) const
+   {
+      BOOST_MATH_STD_USING
+      knot m;
+      m.u = (a.u + b.u) / 2;
+      value_type p = exp(m.u);
+      value_type lo = (std::min)(a.x, b.x);
+      value_type hi = (std::max)(a.x, b.x);
+      m.x = interpolate(a, b, value_type(0.5));
+      if (lo < hi)
+      {
+         boost::uintmax_t max_iter = policies::get_max_root_iterations<policy_type>();
+         m.x = tools::newton_raphson_iterate(newton_functor(this, p), (std::min)((std::max)(m.x, lo), hi), lo, hi,
+                                             policies::digits<value_type, policy_type>(), max_iter);
+      }
+      m.slope = slope(p, m.x);
+      m.residual = residual(p, m.x);
+      return m;
+   }
+
+   Distribution m_dist;
+   bool m_complement;
+   value_type m_error;
+   std::vector<value_type> m_u;
+   std::vector<piece> m_pieces;
+   std::vector<std::size_t> m_guide;
+   value_type m_guide_scale;
+};
+
+} // namespace detail
+
+//
+// A precomputed, monotone interpolant of the quantile of a distribution with fixed parameters, for
+// distributions whose quantile is found by root finding on an expensive cdf.  Construction calls
+// the cdf many times (spread over several threads), after which each quantile costs a logarithm,
+// a table lookup and a cubic.  The table is immutable once built, so may be shared between threads.
+//
+template <class Distribution>
+class quantile_table
+{
+public:
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   explicit quantile_table(const Distribution& dist,
+                           value_type tolerance = default_tolerance(),
+                           value_type tail_probability = default_tail_probability(),
+                           std::size_t threads = std::thread::hardware_concurrency())
+      : m_dist(dist), m_tail(check_arguments(tail_probability, tolerance)), m_lower(init(dist, false, m_tail, tolerance, threads)),
+        m_upper(init(dist, true, m_tail, tolerance, threads))
+   {
+   }
+
+   value_type operator()(value_type p) const
+   {
+      BOOST_MATH_STD_USING
+      // If p is in the far tails (or not a probability at all) use the distribution's own quantile:
+      if (p <= value_type(0.5))
+      {
+         return p >= m_tail ? m_lower(log(p)) : quantile(m_dist, p);
+      }
+      value_type q = 1 - p;
+      return q >= m_tail ? m_upper(log(q)) : quantile(m_dist, p);
+   }
+
+   //
+   // An estimate of the largest relative error in the probability of the tabulated quantiles: that is,
+   // of max |cdf(x) - p| / p for p <= 1/2, and |cdf(complement(x)) - (1 - p)| / (1 - p) for p > 1/2.
+   // It is the largest error found at the points sampled during construction, three in each piece,
+   // not a bound.
+   //
+   value_type estimated_probability_error() const
+   {
+      return (std::max)(m_lower.error(), m_upper.error());
+   }
+
+   value_type tail_probability() const
+   {
+      return m_tail;
+   }
+
+   std::size_t size() const
+   {
+      return m_lower.size() + m_upper.size();
+   }
+
+   const Distribution& distribution() const
+   {
+      return m_dist;
+   }
+
+   static value_type default_tolerance()
+   {
+      return (std::max)(value_type(64 * tools::epsilon<value_type>()), value_type(1e-12));
+   }
+
+   static value_type default_tail_probability()
+   {
+      return value_type(1e-10);
+   }
+
+private:
+   //
+   // Returns the tail probability if the arguments are valid.  Otherwise, if the domain error returns,
+   // returns 1, so that the table is left empty and every quantile is passed to the distribution:
+   //
+   static value_type check_arguments(value_type tail_probability, value_type tolerance)
+   {
+      static const char* function = "boost::math::quantile_table<%1%>::quantile_table";
+      if (!(tail_probability > 0 && tail_probability < value_type(0.5)))
+      {
+         policies::raise_domain_error<value_type>(function, "Tail probability must be in (0, 1/2), but got %1%.", tail_probability, policy_type());
+         return 1;
+      }
+      if (!(tolerance > 0))
+      {
+         policies::raise_domain_error<value_type>(function, "Tolerance must be positive, but got %1%.", tolerance, policy_type());
+         return 1;
+      }
+      return tail_probability;
+   }
+
+   static detail::quantile_table_half<Distribution> init(const Distribution& dist, bool complement, value_type tail_probability,
+                                                         value_type tolerance, std::size_t threads)
+   {
+      if (tail_probability == 1)
+      {
+         // The arguments were invalid:
+         return detail::quantile_table_half<Distribution>(dist, complement);
+      }
+      tools::detail::thread_pool pool((std::max)(threads, std::size_t(1)));
+      return detail::quantile_table_half<Distribution>(dist, complement, tail_probability, tolerance, pool);
+   }
+
+   Distribution m_dist;
+   value_type m_tail;
+   detail::quantile_table_half<Distribution> m_lower;
+   detail::quantile_table_half<Distribution> m_upper;
+};
+
+}} // namespaces
+
+#endif
@@ -18,6 +18,7 @@
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
 #include <boost/math/distributions/normal.hpp> 
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 
@@ -269,6 +270,134 @@ inline RealType quantile(const complemented2_type<students_t_distribution<RealTy
    return -quantile(c.dist, c.param);
 }
 
+namespace detail{
+
+//
+// Array forms of pdf, cdf and quantile: the degrees of freedom are checked once,
+// the pdf normalizer is computed once, and cdf uses ibeta_evaluator for the
+// two incomplete beta functions it may need.
+//
+template <class RealType, class Policy>
+struct batch_evaluator<students_t_distribution<RealType, Policy> >
+{
+   typedef students_t_distribution<RealType, Policy> distribution_type;
+
+   template <class T>
+   static void pdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      BOOST_MATH_STD_USING  // for ADL of std functions
+      static const char* function = "boost::math::pdf(const students_t_distribution<%1%>&, %1%)";
+
+      RealType df = dist.degrees_of_freedom();
+      RealType result = 0;
+      if(false == detail::check_df_gt0_to_inf(function, df, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      // As for the scalar function, the normal distribution is used for really big df:
+      if(df > 1 / policies::get_epsilon<RealType, Policy>())
+      {
+         batch_evaluator<normal_distribution<RealType, Policy> >::pdf_n(normal_distribution<RealType, Policy>(0, 1), first, last, out);
+         return;
+      }
+      RealType normalizer = sqrt(df) * boost::math::beta(df / 2, RealType(0.5f), Policy());
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(false == detail::check_x_not_NaN(function, x, &result, Policy()))
+         {
+            *out = result;
+            continue;
+         }
+         if((boost::math::isinf)(x))
+         {
+            *out = 0;
+            continue;
+         }
+         RealType basem1 = x * x / df;
+         if(basem1 < 0.125)
+            result = exp(-boost::math::log1p(basem1, Policy()) * (1 + df) / 2);
+         else
+            result = pow(1 / (1 + basem1), (df + 1) / 2);
+         *out = result / normalizer;
+      }
+   }
+
+   template <class T>
+   static void cdf_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::cdf(const students_t_distribution<%1%>&, %1%)";
+
+      RealType df = dist.degrees_of_freedom();
+      RealType result = 0;
+      if(false == detail::check_df_gt0_to_inf(function, df, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      normal_distribution<RealType, Policy> normal(0, 1);
+      bool use_normal = df > 1 / policies::get_epsilon<RealType, Policy>();
+      // The two incomplete beta functions used by the scalar cdf, the first for
+      // t small compared to the degrees of freedom; neither is used for really big df:
+      RealType half_df = use_normal ? RealType(1) : RealType(df / 2);
+      ibeta_evaluator<RealType, Policy> small_t(static_cast<RealType>(0.5), half_df);
+      ibeta_evaluator<RealType, Policy> large_t(half_df, static_cast<RealType>(0.5));
+      for(; first != last; ++first, ++out)
+      {
+         RealType x = static_cast<RealType>(*first);
+         if(false == detail::check_x_not_NaN(function, x, &result, Policy()))
+            *out = result;
+         else if(x == 0)
+            *out = static_cast<RealType>(0.5);
+         else if((boost::math::isinf)(x))
+            *out = x < 0 ? static_cast<RealType>(0) : static_cast<RealType>(1);
+         else if(use_normal)
+            *out = cdf(normal, x);
+         else
+         {
+            RealType x2 = x * x;
+            RealType probability;
+            if(df > 2 * x2)
+               probability = small_t.q(x2 / (df + x2)) / 2;
+            else
+               probability = large_t.p(df / (df + x2)) / 2;
+            *out = x > 0 ? 1 - probability : probability;
+         }
+      }
+   }
+
+   template <class T>
+   static void quantile_n(const distribution_type& dist, const T* first, const T* last, RealType* out)
+   {
+      static const char* function = "boost::math::quantile(const students_t_distribution<%1%>&, %1%)";
+
+      RealType df = dist.degrees_of_freedom();
+      RealType result = 0;
+      if(false == detail::check_df_gt0_to_inf(function, df, &result, Policy()))
+      {
+         std::fill(out, out + (last - first), result);
+         return;
+      }
+      for(; first != last; ++first, ++out)
+      {
+         RealType p = static_cast<RealType>(*first);
+         if(false == detail::check_probability(function, p, &result, Policy()))
+            *out = result;
+         else if(p == 0)
+            *out = -policies::raise_overflow_error<RealType>(function, 0, Policy());
+         else if(p == 1)
+            *out = policies::raise_overflow_error<RealType>(function, 0, Policy());
+         else if(p == static_cast<RealType>(0.5))
+            *out = 0;
+         else
+            *out = boost::math::detail::fast_students_t_quantile(df, p, Policy());
+      }
+   }
+};
+
+} // namespace detail
+
 //
 // Parameter estimation follows:
 //
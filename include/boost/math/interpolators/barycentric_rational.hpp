@@ -46,6 +46,15 @@ public:
 
     Real prime(Real x) const;
 
+    // Evaluates at each point of [first, last), writing the values to out.
+    // With tolerance > 0, the sums over nodes far from each point are approximated, to about this relative accuracy,
+    // in O(log(n)) operations rather than O(n). The points are shared out over up to threads threads.
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out, Real tolerance = 0, std::size_t threads = 1) const;
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out, Real tolerance = 0, std::size_t threads = 1) const;
+
     std::vector<Real>&& return_x()
     {
         return m_imp->return_x();
@@ -94,6 +103,20 @@ Real barycentric_rational<Real>::prime(Real x) const
     return m_imp->prime(x);
 }
 
+template<class Real>
+template<class InputIterator, class OutputIterator>
+void barycentric_rational<Real>::operator()(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+{
+    m_imp->operator()(first, last, out, tolerance, threads);
+}
+
+template<class Real>
+template<class InputIterator, class OutputIterator>
+void barycentric_rational<Real>::prime(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+{
+    m_imp->prime(first, last, out, tolerance, threads);
+}
+
 
 }}
 #endif
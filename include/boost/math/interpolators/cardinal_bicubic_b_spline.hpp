@@ -0,0 +1,72 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_BICUBIC_B_SPLINE_HPP
+#define BOOST_MATH_INTERPOLATORS_CARDINAL_BICUBIC_B_SPLINE_HPP
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/interpolators/detail/cardinal_tensor_cubic_b_spline_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators {
+
+template <class Real>
+class cardinal_bicubic_b_spline
+{
+public:
+    // f[i*ny + j] = f(x0 + i*hx, y0 + j*hy), for 0 <= i < nx and 0 <= j < ny.
+    // The derivatives at the edges are estimated, so at least 5 points are needed in each direction.
+    cardinal_bicubic_b_spline(const Real* const f, size_t nx, size_t ny, Real x0, Real y0, Real hx, Real hy)
+     : impl_(std::make_shared<detail::cardinal_tensor_cubic_b_spline_detail<Real, 2>>(f, std::array<size_t, 2>{{nx, ny}},
+                                                                                      std::array<Real, 2>{{x0, y0}}, std::array<Real, 2>{{hx, hy}}))
+    {}
+
+    cardinal_bicubic_b_spline(std::vector<Real> const & f, size_t nx, size_t ny, Real x0, Real y0, Real hx, Real hy)
+     : cardinal_bicubic_b_spline(data(f, nx*ny), nx, ny, x0, y0, hx, hy)
+    {}
+
+    Real operator()(Real x, Real y) const {
+        return impl_->operator()(std::array<Real, 2>{{x, y}});
+    }
+
+    std::array<Real, 2> gradient(Real x, Real y) const {
+        return impl_->gradient(std::array<Real, 2>{{x, y}});
+    }
+
+    // Evaluation at many points, each of which is indexable as p[0], p[1], as is std::array<Real, 2>:
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->operator()(first, last, out);
+    }
+
+    // Writes a std::array<Real, 2> for each point:
+    template<class InputIterator, class OutputIterator>
+    void gradient(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->gradient(first, last, out);
+    }
+
+    Real x_max() const {
+        return impl_->b()[0];
+    }
+
+    Real y_max() const {
+        return impl_->b()[1];
+    }
+
+private:
+    static const Real* data(std::vector<Real> const & f, size_t size) {
+        if (f.size() != size) {
+            throw std::logic_error("The number of values must be the product of the numbers of points in each direction.");
+        }
+        return f.data();
+    }
+
+    std::shared_ptr<detail::cardinal_tensor_cubic_b_spline_detail<Real, 2>> impl_;
+};
+
+}}}
+#endif
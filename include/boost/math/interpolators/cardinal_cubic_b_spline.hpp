@@ -47,6 +47,26 @@ public:
 
     Real double_prime(Real x) const;
 
+    // Evaluation at many points: out[i] = s(first[i]), and similarly for s' and s''.
+    // (The call operator is not overloaded for this, so that its address can still be taken.)
+    template<class InputIterator, class OutputIterator>
+    void evaluate(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        m_imp->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        m_imp->prime(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void double_prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        m_imp->double_prime(first, last, out);
+    }
+
 private:
     std::shared_ptr<detail::cardinal_cubic_b_spline_imp<Real>> m_imp;
 };
@@ -45,6 +45,17 @@ public:
        return impl_->prime(t);
     }
 
+    // Evaluation at many points: out[i] = s(first[i]), and similarly for s'.
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->prime(first, last, out);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
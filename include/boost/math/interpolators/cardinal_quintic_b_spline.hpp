@@ -50,6 +50,22 @@ public:
         return impl_->double_prime(t);
     }
 
+    // Evaluation at many points: out[i] = s(first[i]), and similarly for s' and s''.
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->prime(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void double_prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->double_prime(first, last, out);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
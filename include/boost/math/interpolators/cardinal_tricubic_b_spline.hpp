@@ -0,0 +1,78 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_TRICUBIC_B_SPLINE_HPP
+#define BOOST_MATH_INTERPOLATORS_CARDINAL_TRICUBIC_B_SPLINE_HPP
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/interpolators/detail/cardinal_tensor_cubic_b_spline_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators {
+
+template <class Real>
+class cardinal_tricubic_b_spline
+{
+public:
+    // f[(i*ny + j)*nz + k] = f(x0 + i*hx, y0 + j*hy, z0 + k*hz), for 0 <= i < nx, 0 <= j < ny and 0 <= k < nz.
+    // The derivatives at the faces are estimated, so at least 5 points are needed in each direction.
+    cardinal_tricubic_b_spline(const Real* const f, size_t nx, size_t ny, size_t nz, Real x0, Real y0, Real z0, Real hx, Real hy, Real hz)
+     : impl_(std::make_shared<detail::cardinal_tensor_cubic_b_spline_detail<Real, 3>>(f, std::array<size_t, 3>{{nx, ny, nz}},
+                                                                                      std::array<Real, 3>{{x0, y0, z0}}, std::array<Real, 3>{{hx, hy, hz}}))
+    {}
+
+    cardinal_tricubic_b_spline(std::vector<Real> const & f, size_t nx, size_t ny, size_t nz, Real x0, Real y0, Real z0, Real hx, Real hy, Real hz)
+     : cardinal_tricubic_b_spline(data(f, nx*ny*nz), nx, ny, nz, x0, y0, z0, hx, hy, hz)
+    {}
+
+    Real operator()(Real x, Real y, Real z) const {
+        return impl_->operator()(std::array<Real, 3>{{x, y, z}});
+    }
+
+    std::array<Real, 3> gradient(Real x, Real y, Real z) const {
+        return impl_->gradient(std::array<Real, 3>{{x, y, z}});
+    }
+
+    // Evaluation at many points, each of which is indexable as p[0], p[1], p[2], as is std::array<Real, 3>.
+    // Arithmetic arguments are coordinates, so that s(1, 2, 3) is a single point:
+    template<class InputIterator, class OutputIterator, class = typename std::enable_if<!std::is_arithmetic<InputIterator>::value>::type>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->operator()(first, last, out);
+    }
+
+    // Writes a std::array<Real, 3> for each point:
+    template<class InputIterator, class OutputIterator, class = typename std::enable_if<!std::is_arithmetic<InputIterator>::value>::type>
+    void gradient(InputIterator first, InputIterator last, OutputIterator out) const {
+        impl_->gradient(first, last, out);
+    }
+
+    Real x_max() const {
+        return impl_->b()[0];
+    }
+
+    Real y_max() const {
+        return impl_->b()[1];
+    }
+
+    Real z_max() const {
+        return impl_->b()[2];
+    }
+
+private:
+    static const Real* data(std::vector<Real> const & f, size_t size) {
+        if (f.size() != size) {
+            throw std::logic_error("The number of values must be the product of the numbers of points in each direction.");
+        }
+        return f.data();
+    }
+
+    std::shared_ptr<detail::cardinal_tensor_cubic_b_spline_detail<Real, 3>> impl_;
+};
+
+}}}
+#endif
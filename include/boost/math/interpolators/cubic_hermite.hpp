@@ -17,6 +17,7 @@ template<class RandomAccessContainer>
 class cubic_hermite {
 public:
     using Real = typename RandomAccessContainer::value_type;
+    using cursor_type = detail::interpolator_cursor<detail::cubic_hermite_detail<RandomAccessContainer>>;
 
     cubic_hermite(RandomAccessContainer && x, RandomAccessContainer && y, RandomAccessContainer && dydx) 
     : impl_(std::make_shared<detail::cubic_hermite_detail<RandomAccessContainer>>(std::move(x), std::move(y), std::move(dydx)))
@@ -30,6 +31,18 @@ public:
         return impl_->prime(x);
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        impl_->operator()(first, last, out);
+    }
+
+    // For evaluation at a sequence of nearby points, in particular increasing ones:
+    cursor_type cursor() const
+    {
+        return cursor_type(impl_);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite & m)
     {
         os << *m.impl_;
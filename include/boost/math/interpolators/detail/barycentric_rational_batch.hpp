@@ -0,0 +1,342 @@
+/*
+ *  Copyright the Boost.Math authors, 2020
+ *  Use, modification and distribution are subject to the
+ *  Boost Software License, Version 1.0. (See accompanying file
+ *  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_BARYCENTRIC_RATIONAL_BATCH_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_BARYCENTRIC_RATIONAL_BATCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/detail/thread_pool.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+// Batches of points are evaluated this many at a time: the loop over the nodes is the outer loop,
+// and the inner loop, over the points of the block, has no branches, so that compilers vectorize it.
+constexpr std::size_t barycentric_rational_block = 16;
+
+inline void barycentric_rational_check_tolerance(bool valid)
+{
+    if (!valid)
+    {
+        throw std::domain_error("The tolerance must be nonnegative.");
+    }
+}
+
+// Pieces of a batch shared out between threads have at least this many points:
+constexpr std::size_t barycentric_rational_chunk = barycentric_rational_block*4;
+
+// Calls serial(first', last', out') on pieces of [first, last) on up to threads threads,
+// if the input and output iterators are random access, and serial(first, last, out) otherwise.
+template<class InputIterator, class OutputIterator, class Serial>
+void barycentric_rational_parallel(InputIterator first, InputIterator last, OutputIterator out, std::size_t threads, const Serial& serial, const std::true_type&)
+{
+    tools::detail::parallel_for_range(std::distance(first, last), threads, barycentric_rational_chunk, [&](std::size_t begin, std::size_t end)
+    {
+        serial(first + begin, first + end, out + begin);
+    });
+}
+
+template<class InputIterator, class OutputIterator, class Serial>
+void barycentric_rational_parallel(InputIterator first, InputIterator last, OutputIterator out, std::size_t, const Serial& serial, const std::false_type&)
+{
+    serial(first, last, out);
+}
+
+template<class InputIterator, class OutputIterator, class Serial>
+void barycentric_rational_parallel(InputIterator first, InputIterator last, OutputIterator out, std::size_t threads, const Serial& serial)
+{
+    using std::is_base_of;
+    using std::random_access_iterator_tag;
+    std::integral_constant<bool, is_base_of<random_access_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value
+                                 && is_base_of<random_access_iterator_tag, typename std::iterator_traits<OutputIterator>::iterator_category>::value> tag;
+    barycentric_rational_parallel(first, last, out, threads, serial, tag);
+}
+
+/*
+ * The sums
+ *   sum_i w_i y_i/(x - x_i),  sum_i w_i/(x - x_i)
+ * of a barycentric rational interpolant, and the corresponding sums for its derivative, to a given tolerance,
+ * in O(log(n) log(1/tolerance)) operations rather than O(n). This is the one dimensional treecode,
+ * or fast multipole method without local expansions: the nodes are grouped into a binary tree of clusters,
+ * and for a cluster of centre c and radius rho which is far from x, the terms of the cluster are replaced by
+ *   1/(x - x_i) = sum_k (x_i - c)^k/(x - c)^(k+1),
+ * truncated after p terms, which only requires the moments sum_i w_i y_i (x_i - c)^k of the cluster.
+ * Clusters are far from x if rho < theta |x - c|, so the error in the sum over a cluster is at most
+ * (p + 1) theta^p/(1 - theta) times the sum of the magnitudes of its terms, and p is chosen to make this the tolerance.
+ * Near x the sums are over the nodes themselves, as the terms w_i/(x - x_i) there are large and cancel.
+ *
+ * The moments are scaled by the radius of the cluster, so that they can neither overflow nor underflow,
+ * and those of the larger clusters are found from those of their two halves.
+ * The values y_i may be vectors of dimension m.
+ */
+template<class Real>
+class barycentric_rational_tree
+{
+public:
+    // x(i), w(i) and y(i, j) give the nodes, weights and values, for 0 <= i < n and 0 <= j < m.
+    template<class X, class W, class Y>
+    barycentric_rational_tree(std::size_t n, std::size_t m, const X& x, const W& w, const Y& y, Real tolerance)
+        : m_x(n), m_w(n), m_y(n*m), m_m(m), m_p(1)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_x[i] = x(i);
+            m_w[i] = w(i);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                m_y[i*m + j] = y(i, j);
+            }
+        }
+        Real bound = 2*theta();
+        while (bound > tolerance*(1 - theta()) && m_p < 1000)
+        {
+            ++m_p;
+            bound *= theta();
+            bound *= Real(m_p + 1)/Real(m_p);
+        }
+        m_clusters.reserve(2*n/leaf_size + 2);
+        build(0, n);
+    }
+
+    // Sets num[j] = sum_i w_i y_ij/(x - x_i) and den = sum_i w_i/(x - x_i).
+    // If x is one of the nodes the sums are not finite.
+    void sums(Real x, Real* num, Real& den) const
+    {
+        using std::abs;
+        const std::size_t m = m_m;
+        std::fill(num, num + m, Real(0));
+        den = 0;
+        std::size_t stack[2*sizeof(std::size_t)*8];
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0)
+        {
+            const cluster& c = m_clusters[stack[--top]];
+            Real dx = x - c.center;
+            if (c.radius < theta()*abs(dx))
+            {
+                Real s = c.radius/dx;
+                const Real* moments = &m_moments[c.moments];
+                for (std::size_t j = 0; j <= m; ++j, moments += m_p)
+                {
+                    Real acc = moments[m_p - 1];
+                    for (std::size_t k = m_p - 1; k-- > 0;)
+                    {
+                        acc = acc*s + moments[k];
+                    }
+                    (j < m ? num[j] : den) += acc/dx;
+                }
+            }
+            else if (c.right == 0)
+            {
+                for (std::size_t i = c.begin; i < c.end; ++i)
+                {
+                    Real t = m_w[i]/(x - m_x[i]);
+                    den += t;
+                    for (std::size_t j = 0; j < m; ++j)
+                    {
+                        num[j] += t*m_y[i*m + j];
+                    }
+                }
+            }
+            else
+            {
+                stack[top++] = c.right;
+                stack[top++] = c.left;
+            }
+        }
+    }
+
+    // Sets num[j] = sum_i w_i (r[j] - y_ij)/(x - x_i)^2, where x is not a node.
+    // When r is the value of the interpolant at x, num[j]/den is its derivative.
+    void derivative_sums(Real x, const Real* r, Real* num) const
+    {
+        using std::abs;
+        const std::size_t m = m_m;
+        std::fill(num, num + m, Real(0));
+        std::size_t stack[2*sizeof(std::size_t)*8];
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0)
+        {
+            const cluster& c = m_clusters[stack[--top]];
+            Real dx = x - c.center;
+            if (c.radius < theta()*abs(dx))
+            {
+                // sum_i w_i/(x - x_i)^2 = sum_k (k + 1) sum_i w_i (x_i - c)^k/(x - c)^(k+2):
+                Real s = c.radius/dx;
+                const Real* moments = &m_moments[c.moments];
+                Real a = moments[m*m_p + m_p - 1]*m_p;
+                for (std::size_t k = m_p - 1; k-- > 0;)
+                {
+                    a = a*s + moments[m*m_p + k]*(k + 1);
+                }
+                for (std::size_t j = 0; j < m; ++j, moments += m_p)
+                {
+                    Real b = moments[m_p - 1]*m_p;
+                    for (std::size_t k = m_p - 1; k-- > 0;)
+                    {
+                        b = b*s + moments[k]*(k + 1);
+                    }
+                    num[j] += (r[j]*a - b)/(dx*dx);
+                }
+            }
+            else if (c.right == 0)
+            {
+                for (std::size_t i = c.begin; i < c.end; ++i)
+                {
+                    Real d = x - m_x[i];
+                    Real t = m_w[i]/d;
+                    for (std::size_t j = 0; j < m; ++j)
+                    {
+                        num[j] += t*((r[j] - m_y[i*m + j])/d);
+                    }
+                }
+            }
+            else
+            {
+                stack[top++] = c.right;
+                stack[top++] = c.left;
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t leaf_size = 32;
+
+    static Real theta()
+    {
+        return Real(1)/Real(4);
+    }
+
+    struct cluster
+    {
+        std::size_t begin;
+        std::size_t end;
+        // The indices of the two halves, or 0 for a leaf:
+        std::size_t left;
+        std::size_t right;
+        std::size_t moments;
+        Real lo;
+        Real hi;
+        Real center;
+        Real radius;
+    };
+
+    // Adds the cluster of nodes [begin, end) and its descendants, returning its index.
+    std::size_t build(std::size_t begin, std::size_t end)
+    {
+        using std::abs;
+        const std::size_t m = m_m;
+        std::size_t index = m_clusters.size();
+        m_clusters.push_back(cluster());
+        std::size_t moments = m_moments.size();
+        m_moments.resize(moments + (m + 1)*m_p, Real(0));
+        if (end - begin <= leaf_size)
+        {
+            Real lo = m_x[begin];
+            Real hi = m_x[begin];
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                lo = (std::min)(lo, m_x[i]);
+                hi = (std::max)(hi, m_x[i]);
+            }
+            Real center = lo + (hi - lo)/2;
+            Real radius = (std::max)(center - lo, hi - center);
+            Real inv_radius = radius > 0 ? 1/radius : Real(0);
+            Real* M = &m_moments[moments];
+            // Four nodes at a time, as each moment is a chain of additions:
+            for (std::size_t i = begin; i < end; i += 4)
+            {
+                std::size_t node[4];
+                Real u[4];
+                Real power[4];
+                for (std::size_t l = 0; l < 4; ++l)
+                {
+                    node[l] = (std::min)(i + l, end - 1);
+                    u[l] = (m_x[node[l]] - center)*inv_radius;
+                    power[l] = i + l < end ? m_w[node[l]] : Real(0);
+                }
+                for (std::size_t k = 0; k < m_p; ++k)
+                {
+                    for (std::size_t j = 0; j < m; ++j)
+                    {
+                        M[j*m_p + k] += (power[0]*m_y[node[0]*m + j] + power[1]*m_y[node[1]*m + j])
+                                      + (power[2]*m_y[node[2]*m + j] + power[3]*m_y[node[3]*m + j]);
+                    }
+                    M[m*m_p + k] += (power[0] + power[1]) + (power[2] + power[3]);
+                    for (std::size_t l = 0; l < 4; ++l)
+                    {
+                        power[l] *= u[l];
+                    }
+                }
+            }
+            m_clusters[index] = cluster{begin, end, 0, 0, moments, lo, hi, center, radius};
+            return index;
+        }
+
+        std::size_t mid = begin + (end - begin)/2;
+        std::size_t left = build(begin, mid);
+        std::size_t right = build(mid, end);
+        Real lo = (std::min)(m_clusters[left].lo, m_clusters[right].lo);
+        Real hi = (std::max)(m_clusters[left].hi, m_clusters[right].hi);
+        Real center = lo + (hi - lo)/2;
+        Real radius = (std::max)(center - lo, hi - center);
+        Real inv_radius = radius > 0 ? 1/radius : Real(0);
+        // With u the scaled distance from the centre of a half, the scaled distance from the centre of the whole is a u + b,
+        // with |a| + |b| <= 1. The moments of the half are multiplied by a^l, and then shifted by b, as the coefficients of
+        // a polynomial are in a Taylor shift, to give sum_l binomial(k, l) a^l b^(k-l) sum_i w_i u_i^l = sum_i w_i (a u_i + b)^k:
+        std::vector<Real> shifted(m_p);
+        for (std::size_t half : {left, right})
+        {
+            const cluster& h = m_clusters[half];
+            Real a = h.radius*inv_radius;
+            Real b = (h.center - center)*inv_radius;
+            for (std::size_t j = 0; j <= m; ++j)
+            {
+                const Real* source = &m_moments[h.moments + j*m_p];
+                Real power = 1;
+                for (std::size_t k = 0; k < m_p; ++k)
+                {
+                    shifted[k] = power*source[k];
+                    power *= a;
+                }
+                for (std::size_t l = 0; l + 1 < m_p; ++l)
+                {
+                    for (std::size_t k = m_p - 1; k > l; --k)
+                    {
+                        shifted[k] += b*shifted[k - 1];
+                    }
+                }
+                for (std::size_t k = 0; k < m_p; ++k)
+                {
+                    m_moments[moments + j*m_p + k] += shifted[k];
+                }
+            }
+        }
+        m_clusters[index] = cluster{begin, end, left, right, moments, lo, hi, center, radius};
+        return index;
+    }
+
+    std::vector<Real> m_x;
+    std::vector<Real> m_w;
+    std::vector<Real> m_y;
+    std::vector<cluster> m_clusters;
+    // The moments of each cluster: those of component j of the values, and then those of the weights alone, p of each.
+    std::vector<Real> m_moments;
+    std::size_t m_m;
+    std::size_t m_p;
+};
+
+}}}
+#endif
@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/core/demangle.hpp>
 #include <boost/assert.hpp>
+#include <boost/math/interpolators/detail/barycentric_rational_batch.hpp>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -31,6 +32,18 @@ public:
 
     Real prime(Real x) const;
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+    {
+        evaluate<false>(first, last, out, tolerance, threads);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+    {
+        evaluate<true>(first, last, out, tolerance, threads);
+    }
+
     // The barycentric weights are not really that interesting; except to the unit tests!
     Real weight(size_t i) const { return m_w[i]; }
 
@@ -48,6 +61,12 @@ private:
 
     void calculate_weights(size_t approximation_order);
 
+    template<bool derivative, class InputIterator, class OutputIterator>
+    void evaluate(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const;
+
+    template<bool derivative, std::size_t W>
+    void block(const Real (&x)[W], Real (&y)[W]) const;
+
     std::vector<Real> m_x;
     std::vector<Real> m_y;
     std::vector<Real> m_w;
@@ -211,5 +230,126 @@ Real barycentric_rational_imp<Real>::prime(Real x) const
 
     return numerator/denominator;
 }
+
+template<class Real>
+template<bool derivative, class InputIterator, class OutputIterator>
+void barycentric_rational_imp<Real>::evaluate(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+{
+    barycentric_rational_check_tolerance(tolerance >= 0);
+    if (tolerance > 0)
+    {
+        const barycentric_rational_imp& self = *this;
+        barycentric_rational_tree<Real> tree(m_x.size(), 1, [&](size_t i) { return self.m_x[i]; }, [&](size_t i) { return self.m_w[i]; },
+                                             [&](size_t i, size_t) { return self.m_y[i]; }, tolerance);
+        barycentric_rational_parallel(first, last, out, threads, [&](InputIterator f, InputIterator l, OutputIterator o)
+        {
+            for (; f != l; ++f, ++o)
+            {
+                Real x = *f;
+                Real numerator;
+                Real denominator;
+                tree.sums(x, &numerator, denominator);
+                if (!(boost::math::isfinite)(denominator))
+                {
+                    // x is a node, or so close to one that the terms overflow:
+                    *o = derivative ? self.prime(x) : self(x);
+                    continue;
+                }
+                Real y = numerator/denominator;
+                if (derivative)
+                {
+                    tree.derivative_sums(x, &y, &numerator);
+                    y = numerator/denominator;
+                }
+                *o = y;
+            }
+        });
+        return;
+    }
+
+    barycentric_rational_parallel(first, last, out, threads, [this](InputIterator f, InputIterator l, OutputIterator o)
+    {
+        constexpr std::size_t W = barycentric_rational_block;
+        Real x[W];
+        Real y[W];
+        while (f != l)
+        {
+            std::size_t m = 0;
+            for (; m < W && f != l; ++m, ++f)
+            {
+                x[m] = *f;
+            }
+            for (std::size_t k = m; k < W; ++k)
+            {
+                x[k] = x[0];
+            }
+            this->template block<derivative>(x, y);
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                *o++ = y[k];
+            }
+        }
+    });
+}
+
+// The same sums as the single point evaluation, in the same order, but for W points at a time.
+// A point which is a node makes its sums infinite, and it is then evaluated on its own.
+template<class Real>
+template<bool derivative, std::size_t W>
+void barycentric_rational_imp<Real>::block(const Real (&x)[W], Real (&y)[W]) const
+{
+    Real numerator[W];
+    Real denominator[W];
+    for (std::size_t k = 0; k < W; ++k)
+    {
+        numerator[k] = 0;
+        denominator[k] = 0;
+    }
+    for (size_t i = 0; i < m_x.size(); ++i)
+    {
+        const Real xi = m_x[i];
+        const Real wi = m_w[i];
+        const Real yi = m_y[i];
+        for (std::size_t k = 0; k < W; ++k)
+        {
+            Real t = wi/(x[k] - xi);
+            numerator[k] += t*yi;
+            denominator[k] += t;
+        }
+    }
+    for (std::size_t k = 0; k < W; ++k)
+    {
+        y[k] = numerator[k]/denominator[k];
+    }
+    if (derivative)
+    {
+        for (std::size_t k = 0; k < W; ++k)
+        {
+            numerator[k] = 0;
+        }
+        for (size_t i = 0; i < m_x.size(); ++i)
+        {
+            const Real xi = m_x[i];
+            const Real wi = m_w[i];
+            const Real yi = m_y[i];
+            for (std::size_t k = 0; k < W; ++k)
+            {
+                Real t = wi/(x[k] - xi);
+                numerator[k] += t*((y[k] - yi)/(x[k] - xi));
+            }
+        }
+        for (std::size_t k = 0; k < W; ++k)
+        {
+            y[k] = numerator[k]/denominator[k];
+        }
+    }
+    for (std::size_t k = 0; k < W; ++k)
+    {
+        if (!(boost::math::isfinite)(denominator[k]))
+        {
+            y[k] = derivative ? prime(x[k]) : this->operator()(x[k]);
+        }
+    }
+}
 }}}
 #endif
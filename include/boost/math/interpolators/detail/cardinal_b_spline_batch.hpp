@@ -0,0 +1,176 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_B_SPLINE_BATCH_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_B_SPLINE_BATCH_HPP
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <boost/math/special_functions/trunc.hpp>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+// Points are evaluated in blocks of this many. The basis weights of a block are computed together, in loops
+// over the points of the block which have no branches, and which compilers turn into vector instructions.
+constexpr std::size_t cardinal_b_spline_block = 16;
+
+// The index of the interval containing x, where floor(x) is known to be a small nonnegative integer.
+// Multiprecision and concept checking types need not convert to integers directly.
+template<class Real>
+inline std::size_t cardinal_b_spline_index(Real fl, const std::true_type&)
+{
+    return static_cast<std::size_t>(fl);
+}
+
+template<class Real>
+inline std::size_t cardinal_b_spline_index(Real fl, const std::false_type&)
+{
+    return static_cast<std::size_t>(boost::math::ltrunc(fl));
+}
+
+constexpr unsigned cardinal_b_spline_factorial(unsigned m)
+{
+    return m == 0 ? 1 : m*cardinal_b_spline_factorial(m - 1);
+}
+
+// Sets w[i][l] = (n - D)! (d/du)^D M_n(u[l] + i) for i = 0, ..., n, where M_n is the forward cardinal B-spline of degree n,
+// with support [0, n + 1]. These are the weights of the only n + 1 translates of M_n which are nonzero at u[l] in [0, 1).
+// The Cox-de Boor recurrence d M_d(x) = x M_{d-1}(x) + (d + 1 - x) M_{d-1}(x - 1) builds up the degree,
+// and M_d'(x) = M_{d-1}(x) - M_{d-1}(x - 1) the derivatives.  The factors 1/d are left out, as they are inexact;
+// the caller divides by the integer (n - D)! once instead.
+template<unsigned n, unsigned D, class Real, std::size_t W>
+void cardinal_b_spline_weights(const Real (&u)[W], Real (&w)[n + 1][W])
+{
+    static_assert(D <= n, "The derivative of a B-spline of degree n vanishes beyond order n.");
+    for (std::size_t l = 0; l < W; ++l) {
+        w[0][l] = 1;
+    }
+    for (unsigned d = 1; d <= n - D; ++d) {
+        for (std::size_t l = 0; l < W; ++l) {
+            w[d][l] = (1 - u[l])*w[d-1][l];
+        }
+        for (unsigned i = d - 1; i > 0; --i) {
+            for (std::size_t l = 0; l < W; ++l) {
+                w[i][l] = (u[l] + i)*w[i][l] + (d + 1 - i - u[l])*w[i-1][l];
+            }
+        }
+        for (std::size_t l = 0; l < W; ++l) {
+            w[0][l] = u[l]*w[0][l];
+        }
+    }
+    for (unsigned d = n - D + 1; d <= n; ++d) {
+        for (std::size_t l = 0; l < W; ++l) {
+            w[d][l] = -w[d-1][l];
+        }
+        for (unsigned i = d - 1; i > 0; --i) {
+            for (std::size_t l = 0; l < W; ++l) {
+                w[i][l] -= w[i-1][l];
+            }
+        }
+    }
+}
+
+// The evaluation of a cardinal B-spline interpolant of degree n,
+//   s(t) = constant + scale * sum_j alpha[j] (d/dx)^D M_n(x - j),  x = (t - t0)/h + shift,
+// at points t in [lo, hi] for which all the n + 1 coefficients needed are stored.
+// The interpolators use this for their scalar and batch evaluation alike, so the two do the same arithmetic,
+// and fall back to their general code for other points.
+template<unsigned n, class Real>
+class cardinal_b_spline_kernel
+{
+public:
+    cardinal_b_spline_kernel(const Real* alpha, std::size_t size, Real t0, Real inv_h, Real shift, Real lo, Real hi)
+        : m_alpha(alpha), m_size(size), m_t0(t0), m_inv_h(inv_h), m_shift(shift), m_lo(lo), m_hi(hi)
+    {}
+
+    // Evaluates at t if possible, returning false if t needs the general code.
+    template<unsigned D>
+    bool evaluate(Real t, Real constant, Real scale, Real& y) const
+    {
+        Real tt[1] = {t};
+        Real yy[1];
+        bool ok[1];
+        block<D>(tt, yy, ok, constant, scale);
+        y = yy[0];
+        return ok[0];
+    }
+
+    template<unsigned D, class InputIterator, class OutputIterator, class Fallback>
+    void evaluate(InputIterator first, InputIterator last, OutputIterator out, Real constant, Real scale, Fallback fallback) const
+    {
+        constexpr std::size_t W = cardinal_b_spline_block;
+        Real t[W];
+        Real y[W];
+        bool ok[W];
+        while (first != last) {
+            std::size_t m = 0;
+            for (; m < W && first != last; ++m, ++first) {
+                t[m] = *first;
+            }
+            for (std::size_t l = m; l < W; ++l) {
+                t[l] = t[0];
+            }
+            if (block<D>(t, y, ok, constant, scale)) {
+                for (std::size_t l = 0; l < m; ++l) {
+                    *out++ = y[l];
+                }
+            }
+            else {
+                for (std::size_t l = 0; l < m; ++l) {
+                    *out++ = ok[l] ? y[l] : fallback(t[l]);
+                }
+            }
+        }
+    }
+
+private:
+    // Evaluates at each t[l] for which ok[l] is set, which are those with x = k + u, u in [0, 1),
+    // such that all of alpha[k - n], ..., alpha[k] exist. Other points are replaced by x = n,
+    // so that every step is the same for all points, and the loops have no branches.
+    // Returns true if all the points could be evaluated.
+    template<unsigned D, std::size_t W>
+    bool block(const Real (&t)[W], Real (&y)[W], bool (&ok)[W], Real constant, Real scale) const
+    {
+        using std::floor;
+        Real u[W];
+        std::size_t k[W];
+        for (std::size_t l = 0; l < W; ++l) {
+            Real x = (t[l] - m_t0)*m_inv_h + m_shift;
+            ok[l] = t[l] >= m_lo && t[l] <= m_hi && x >= n && x < m_size;
+            x = ok[l] ? x : Real(n);
+            Real fl = floor(x);
+            k[l] = cardinal_b_spline_index(fl, std::is_arithmetic<Real>());
+            u[l] = x - fl;
+        }
+        Real w[n + 1][W];
+        cardinal_b_spline_weights<n, D>(u, w);
+        Real factorial = Real(cardinal_b_spline_factorial(n - D));
+        for (std::size_t l = 0; l < W; ++l) {
+            const Real* alpha = m_alpha + (k[l] - n);
+            Real s = alpha[0]*w[n][l];
+            for (unsigned i = 1; i <= n; ++i) {
+                s += alpha[i]*w[n - i][l];
+            }
+            y[l] = constant + s*scale/factorial;
+        }
+        bool all = true;
+        for (std::size_t l = 0; l < W; ++l) {
+            all &= ok[l];
+        }
+        return all;
+    }
+
+    const Real* m_alpha;
+    std::size_t m_size;
+    Real m_t0;
+    Real m_inv_h;
+    Real m_shift;
+    Real m_lo;
+    Real m_hi;
+};
+
+}}}}
+#endif
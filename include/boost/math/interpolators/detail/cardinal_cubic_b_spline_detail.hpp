@@ -14,6 +14,7 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_batch.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -35,7 +36,45 @@ public:
 
     Real double_prime(Real x) const;
 
+    // The coefficients c[k], k = 0, ..., length + 1, with s(x) = sum_k c[k] B3((x - a)/h + 1 - k)
+    // wherever all four B-splines which are nonzero at x have coefficients, in particular on [a, b].
+    std::vector<Real> coefficients() const
+    {
+        std::vector<Real> c(m_beta);
+        for (auto& ck : c)
+        {
+            ck += m_avg;
+        }
+        return c;
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        kernel().template evaluate<0>(first, last, out, m_avg, Real(1), [this](Real x) { return (*this)(x); });
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        kernel().template evaluate<1>(first, last, out, Real(0), m_h_inv, [this](Real x) { return this->prime(x); });
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void double_prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        kernel().template evaluate<2>(first, last, out, Real(0), m_h_inv*m_h_inv, [this](Real x) { return this->double_prime(x); });
+    }
+
 private:
+    // Evaluation in the interior, where all four B-splines which are nonzero at x have coefficients.
+    // s(x) = sum beta[k] B3(t - k), t = (x - a)/h + 1, and B3(y) = M3(y + 2) in terms of the forward B-spline.
+    cardinal_b_spline_kernel<3, Real> kernel() const
+    {
+        return cardinal_b_spline_kernel<3, Real>(m_beta.data(), m_beta.size(), m_a, m_h_inv, Real(3),
+                                                 std::numeric_limits<Real>::lowest(), (std::numeric_limits<Real>::max)());
+    }
+
     std::vector<Real> m_beta;
     Real m_h_inv;
     Real m_a;
@@ -158,9 +197,10 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     Real b1 = right_endpoint_derivative;
     if (boost::math::isnan(b1))
     {
+        // The mirror image of the forward difference above:
         size_t n = length - 1;
-        Real t0 = 4*(f[n-3] + third<Real>()*f[n - 1]);
-        Real t1 = -(25*third<Real>()*f[n - 4] + f[n])/4  - 3*f[n - 2];
+        Real t0 = -4*(f[n - 1] + third<Real>()*f[n - 3]);
+        Real t1 = (25*third<Real>()*f[n] + f[n - 4])/4  + 3*f[n - 2];
 
         b1 = m_h_inv*(t0 + t1);
     }
@@ -264,6 +304,11 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
 template<class Real>
 Real cardinal_cubic_b_spline_imp<Real>::operator()(Real x) const
 {
+    Real y;
+    if (kernel().template evaluate<0>(x, m_avg, Real(1), y))
+    {
+        return y;
+    }
     // See Kress, 8.40: Since B3 has compact support, we don't have to sum over all terms,
     // just the (at most 5) whose support overlaps the argument.
     Real z = m_avg;
@@ -288,6 +333,11 @@ Real cardinal_cubic_b_spline_imp<Real>::operator()(Real x) const
 template<class Real>
 Real cardinal_cubic_b_spline_imp<Real>::prime(Real x) const
 {
+    Real y;
+    if (kernel().template evaluate<1>(x, Real(0), m_h_inv, y))
+    {
+        return y;
+    }
     Real z = 0;
     Real t = m_h_inv*(x - m_a) + 1;
 
@@ -297,7 +347,7 @@ Real cardinal_cubic_b_spline_imp<Real>::prime(Real x) const
     using std::floor;
 
     size_t k_min = (size_t) (max)(static_cast<long>(0), boost::math::ltrunc(ceil(t - 2)));
-    size_t k_max = (size_t) (min)(static_cast<long>(m_beta.size() - 1), boost::math::ltrunc(floor(t + 2)));
+    size_t k_max = (size_t) (max)((min)(static_cast<long>(m_beta.size() - 1), boost::math::ltrunc(floor(t + 2))), (long) 0);
 
     for (size_t k = k_min; k <= k_max; ++k)
     {
@@ -309,6 +359,11 @@ Real cardinal_cubic_b_spline_imp<Real>::prime(Real x) const
 template<class Real>
 Real cardinal_cubic_b_spline_imp<Real>::double_prime(Real x) const
 {
+    Real y;
+    if (kernel().template evaluate<2>(x, Real(0), m_h_inv*m_h_inv, y))
+    {
+        return y;
+    }
     Real z = 0;
     Real t = m_h_inv*(x - m_a) + 1;
 
@@ -318,7 +373,7 @@ Real cardinal_cubic_b_spline_imp<Real>::double_prime(Real x) const
     using std::floor;
 
     size_t k_min = (size_t) (max)(static_cast<long>(0), boost::math::ltrunc(ceil(t - 2)));
-    size_t k_max = (size_t) (min)(static_cast<long>(m_beta.size() - 1), boost::math::ltrunc(floor(t + 2)));
+    size_t k_max = (size_t) (max)((min)(static_cast<long>(m_beta.size() - 1), boost::math::ltrunc(floor(t + 2))), (long) 0);
 
     for (size_t k = k_min; k <= k_max; ++k)
     {
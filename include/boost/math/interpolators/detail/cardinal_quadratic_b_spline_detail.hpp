@@ -9,6 +9,7 @@
 #include <vector>
 #include <cmath>
 #include <stdexcept>
+#include <boost/math/interpolators/detail/cardinal_b_spline_batch.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -143,6 +144,10 @@ public:
     }
 
     Real operator()(Real t) const {
+        Real s;
+        if (kernel().template evaluate<0>(t, Real(0), Real(1), s)) {
+            return s;
+        }
         if (t < m_t0 || t > m_t0 + (m_alpha.size()-2)/m_inv_h) {
             const char* err_msg = "Tried to evaluate the cardinal quadratic b-spline outside the domain of of interpolation; extrapolation does not work.";
             throw std::domain_error(err_msg);
@@ -169,6 +174,10 @@ public:
     }
 
     Real prime(Real t) const {
+        Real s;
+        if (kernel().template evaluate<1>(t, Real(0), m_inv_h, s)) {
+            return s;
+        }
         if (t < m_t0 || t > m_t0 + (m_alpha.size()-2)/m_inv_h) {
             const char* err_msg = "Tried to evaluate the cardinal quadratic b-spline outside the domain of of interpolation; extrapolation does not work.";
             throw std::domain_error(err_msg);
@@ -194,11 +203,28 @@ public:
         return y*m_inv_h;
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        kernel().template evaluate<0>(first, last, out, Real(0), Real(1), [this](Real t) { return (*this)(t); });
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        kernel().template evaluate<1>(first, last, out, Real(0), m_inv_h, [this](Real t) { return this->prime(t); });
+    }
+
     Real t_max() const {
         return m_t0 + (m_alpha.size()-3)/m_inv_h;
     }
 
 private:
+    // Evaluation where all three B-splines which are nonzero at t have coefficients.
+    // y = sum alpha[j] b2(x + 1 - j), x = (t - t0)/h, and b2(y) = M2(y + 3/2) in terms of the forward B-spline.
+    cardinal_b_spline_kernel<2, Real> kernel() const {
+        return cardinal_b_spline_kernel<2, Real>(m_alpha.data(), m_alpha.size(), m_t0, m_inv_h, Real(5)/Real(2),
+                                                 m_t0, m_t0 + (m_alpha.size()-2)/m_inv_h);
+    }
+
     std::vector<Real> m_alpha;
     Real m_inv_h;
     Real m_t0;
@@ -10,6 +10,7 @@
 #include <vector>
 #include <utility>
 #include <boost/math/special_functions/cardinal_b_spline.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_batch.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -164,6 +165,10 @@ public:
     }
 
     Real operator()(Real t) const {
+        Real y;
+        if (kernel().template evaluate<0>(t, Real(0), Real(1), y)) {
+            return y;
+        }
         using std::ceil;
         using std::floor;
         using boost::math::cardinal_b_spline;
@@ -187,6 +192,10 @@ public:
     }
 
     Real prime(Real t) const {
+        Real y;
+        if (kernel().template evaluate<1>(t, Real(0), m_inv_h, y)) {
+            return y;
+        }
         using std::ceil;
         using std::floor;
         using boost::math::cardinal_b_spline_prime;
@@ -207,6 +216,10 @@ public:
     }
 
     Real double_prime(Real t) const {
+        Real y;
+        if (kernel().template evaluate<2>(t, Real(0), m_inv_h*m_inv_h, y)) {
+            return y;
+        }
         using std::ceil;
         using std::floor;
         using boost::math::cardinal_b_spline_double_prime;
@@ -226,11 +239,33 @@ public:
     }
 
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        kernel().template evaluate<0>(first, last, out, Real(0), Real(1), [this](Real t) { return (*this)(t); });
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        kernel().template evaluate<1>(first, last, out, Real(0), m_inv_h, [this](Real t) { return this->prime(t); });
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void double_prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        kernel().template evaluate<2>(first, last, out, Real(0), m_inv_h*m_inv_h, [this](Real t) { return this->double_prime(t); });
+    }
+
     Real t_max() const {
         return m_t0 + (m_alpha.size()-5)/m_inv_h;
     }
 
 private:
+    // Evaluation where all six B-splines which are nonzero at t have coefficients.
+    // s = sum alpha[j] B5(x - j + 2), x = (t - t0)/h, and B5(y) = M5(y + 3) in terms of the forward B-spline.
+    cardinal_b_spline_kernel<5, Real> kernel() const {
+        return cardinal_b_spline_kernel<5, Real>(m_alpha.data(), m_alpha.size(), m_t0, m_inv_h, Real(5),
+                                                 m_t0, m_t0 + (m_alpha.size()-5)/m_inv_h);
+    }
+
     std::vector<Real> m_alpha;
     Real m_inv_h;
     Real m_t0;
@@ -0,0 +1,308 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TENSOR_CUBIC_B_SPLINE_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TENSOR_CUBIC_B_SPLINE_DETAIL_HPP
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_batch.hpp>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+// The tensor product of cubic B-splines on a regular grid in d dimensions,
+//   s(x) = sum_k c[k_0, ..., k_{d-1}] B3((x_0 - a_0)/h_0 + 1 - k_0) ... B3((x_{d-1} - a_{d-1})/h_{d-1} + 1 - k_{d-1}).
+// The coefficients are found by solving the one dimensional interpolation problem along each axis in turn,
+// so that s agrees with the one dimensional cubic B-spline along every grid line, endpoint derivative estimates included.
+//
+// The coefficients are stored in tiles of 4 x ... x 4, so that the 4^d of them needed at a point lie in at most 2^d tiles,
+// rather than on 4^(d-1) widely separated lines, and the offset of a coefficient is a sum of one offset per axis.
+template<class Real, std::size_t d>
+class cardinal_tensor_cubic_b_spline_detail
+{
+public:
+    using point_type = std::array<Real, d>;
+
+    // f is in C order, with the last index varying fastest: f[(i_0*n_1 + i_1)*n_2 + i_2] = f(a_0 + i_0 h_0, a_1 + i_1 h_1, a_2 + i_2 h_2).
+    cardinal_tensor_cubic_b_spline_detail(const Real* f, const std::array<std::size_t, d>& n, const point_type& a, const point_type& h)
+        : m_a(a)
+    {
+        std::size_t total = 1;
+        for (std::size_t i = 0; i < d; ++i) {
+            if (n[i] < 5) {
+                throw std::logic_error("Interpolation using a cubic b spline with derivatives estimated at the endpoints requires at least 5 points in each dimension.");
+            }
+            if (!(h[i] > 0)) {
+                throw std::logic_error("The step sizes must be strictly > 0.");
+            }
+            if ((boost::math::isnan)(a[i])) {
+                throw std::logic_error("The left endpoints cannot be NaN.");
+            }
+            m_inv_h[i] = 1/h[i];
+            m_b[i] = a[i] + (n[i] - 1)*h[i];
+            m_k_max[i] = Real(n[i] + 1);
+            total *= n[i];
+        }
+
+        std::vector<Real> c(f, f + total);
+        std::array<std::size_t, d> m = n;
+        for (std::size_t i = 0; i < d; ++i) {
+            c = solve_along(c, m, i);
+            m[i] += 2;
+        }
+
+        // Lay the coefficients out in tiles:
+        std::size_t stride = 1;
+        std::size_t tile = 1;
+        for (std::size_t i = d; i-- > 0;) {
+            m_within[i] = stride;
+            stride *= 4;
+        }
+        for (std::size_t i = d; i-- > 0;) {
+            m_tile[i] = stride*tile;
+            tile *= (m[i] + 3)/4;
+        }
+        m_c.assign(stride*tile, Real(0));
+        std::array<std::size_t, d> k{};
+        for (std::size_t j = 0; j < c.size(); ++j) {
+            std::size_t o = 0;
+            for (std::size_t i = 0; i < d; ++i) {
+                o += offset(i, k[i]);
+            }
+            m_c[o] = c[j];
+            for (std::size_t i = d; i-- > 0;) {
+                if (++k[i] < m[i]) {
+                    break;
+                }
+                k[i] = 0;
+            }
+        }
+    }
+
+    Real operator()(const point_type& x) const
+    {
+        point_type p[1] = {x};
+        Real y[1];
+        point_type g[1];
+        if (!block<false>(p, y, g)) {
+            throw_domain_error();
+        }
+        return y[0];
+    }
+
+    point_type gradient(const point_type& x) const
+    {
+        point_type p[1] = {x};
+        Real y[1];
+        point_type g[1];
+        if (!block<true>(p, y, g)) {
+            throw_domain_error();
+        }
+        return g[0];
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        evaluate<false>(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void gradient(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        evaluate<true>(first, last, out);
+    }
+
+    const point_type& a() const
+    {
+        return m_a;
+    }
+
+    const point_type& b() const
+    {
+        return m_b;
+    }
+
+private:
+    // Replaces the interpolation problem along axis i of the C order array c, of extents m, by its coefficients.
+    static std::vector<Real> solve_along(const std::vector<Real>& c, const std::array<std::size_t, d>& m, std::size_t i)
+    {
+        std::size_t outer = 1;
+        std::size_t inner = 1;
+        for (std::size_t j = 0; j < i; ++j) {
+            outer *= m[j];
+        }
+        for (std::size_t j = i + 1; j < d; ++j) {
+            inner *= m[j];
+        }
+        std::vector<Real> result(outer*(m[i] + 2)*inner);
+        std::vector<Real> line(m[i]);
+        for (std::size_t o = 0; o < outer; ++o) {
+            for (std::size_t s = 0; s < inner; ++s) {
+                for (std::size_t j = 0; j < m[i]; ++j) {
+                    line[j] = c[(o*m[i] + j)*inner + s];
+                }
+                // The step size scales out of the coefficients:
+                cardinal_cubic_b_spline_imp<Real> spline(line.begin(), line.end(), Real(0), Real(1));
+                std::vector<Real> beta = spline.coefficients();
+                for (std::size_t j = 0; j < beta.size(); ++j) {
+                    result[(o*(m[i] + 2) + j)*inner + s] = beta[j];
+                }
+            }
+        }
+        return result;
+    }
+
+    std::size_t offset(std::size_t i, std::size_t k) const
+    {
+        return (k >> 2)*m_tile[i] + (k & 3)*m_within[i];
+    }
+
+    template<bool with_gradient, class InputIterator, class OutputIterator>
+    void evaluate(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        constexpr std::size_t W = cardinal_b_spline_block;
+        point_type p[W];
+        Real y[W];
+        point_type g[W];
+        while (first != last) {
+            std::size_t m = 0;
+            for (; m < W && first != last; ++m, ++first) {
+                for (std::size_t i = 0; i < d; ++i) {
+                    p[m][i] = (*first)[i];
+                }
+            }
+            for (std::size_t l = m; l < W; ++l) {
+                p[l] = p[0];
+            }
+            if (!block<with_gradient>(p, y, g)) {
+                throw_domain_error();
+            }
+            for (std::size_t l = 0; l < m; ++l) {
+                output(out, y[l], g[l], std::integral_constant<bool, with_gradient>());
+            }
+        }
+    }
+
+    template<class OutputIterator>
+    static void output(OutputIterator& out, Real y, const point_type&, const std::false_type&)
+    {
+        *out++ = y;
+    }
+
+    template<class OutputIterator>
+    static void output(OutputIterator& out, Real, const point_type& g, const std::true_type&)
+    {
+        *out++ = g;
+    }
+
+    // Evaluates at W points at once, as in cardinal_b_spline_kernel: the weights along each axis are computed
+    // for all the points together, in loops without branches, and points outside the domain are replaced by a.
+    // Returns false if any point is outside the domain.
+    template<bool with_gradient, std::size_t W>
+    bool block(const point_type (&p)[W], Real (&y)[W], point_type (&g)[W]) const
+    {
+        using std::floor;
+        std::size_t off[d][4][W];
+        Real w[d][4][W];
+        Real dw[d][4][W];
+        bool ok = true;
+        for (std::size_t i = 0; i < d; ++i) {
+            Real u[W];
+            for (std::size_t l = 0; l < W; ++l) {
+                Real t = p[l][i];
+                bool in = t >= m_a[i] && t <= m_b[i];
+                ok &= in;
+                // x = k + u with 3 <= k <= n + 1, taking u = 1 at the right endpoint:
+                Real x = in ? (t - m_a[i])*m_inv_h[i] + 3 : Real(3);
+                Real fl = floor(x);
+                fl = fl < m_k_max[i] ? fl : m_k_max[i];
+                std::size_t k = cardinal_b_spline_index(fl, std::is_arithmetic<Real>());
+                u[l] = x - fl;
+                for (std::size_t j = 0; j < 4; ++j) {
+                    off[i][j][l] = offset(i, k - j);
+                }
+            }
+            cardinal_b_spline_weights<3, 0>(u, w[i]);
+            if (with_gradient) {
+                cardinal_b_spline_weights<3, 1>(u, dw[i]);
+            }
+        }
+        if (!ok) {
+            return false;
+        }
+        // The weights are 3! B3 and 2! B3':
+        Real scale = 1;
+        for (std::size_t i = 0; i < d; ++i) {
+            scale *= 6;
+        }
+        for (std::size_t l = 0; l < W; ++l) {
+            std::size_t o[d][4];
+            Real v[d][4];
+            for (std::size_t i = 0; i < d; ++i) {
+                for (std::size_t j = 0; j < 4; ++j) {
+                    o[i][j] = off[i][j][l];
+                    v[i][j] = w[i][j][l];
+                }
+            }
+            if (with_gradient) {
+                for (std::size_t i = 0; i < d; ++i) {
+                    Real vi[4];
+                    for (std::size_t j = 0; j < 4; ++j) {
+                        vi[j] = v[i][j];
+                        v[i][j] = dw[i][j][l];
+                    }
+                    g[l][i] = contract(o, v, 0, std::integral_constant<std::size_t, 0>())*m_inv_h[i]*3/scale;
+                    for (std::size_t j = 0; j < 4; ++j) {
+                        v[i][j] = vi[j];
+                    }
+                }
+            }
+            else {
+                y[l] = contract(o, v, 0, std::integral_constant<std::size_t, 0>())/scale;
+            }
+        }
+        return true;
+    }
+
+    // sum over j_i, ..., j_{d-1} of v[i][j_i] ... v[d-1][j_{d-1}] c[base + o[i][j_i] + ... + o[d-1][j_{d-1}]]:
+    template<std::size_t i>
+    Real contract(const std::size_t (&o)[d][4], const Real (&v)[d][4], std::size_t base, const std::integral_constant<std::size_t, i>&) const
+    {
+        std::integral_constant<std::size_t, i + 1> next;
+        Real s = v[i][0]*contract(o, v, base + o[i][0], next);
+        for (std::size_t j = 1; j < 4; ++j) {
+            s += v[i][j]*contract(o, v, base + o[i][j], next);
+        }
+        return s;
+    }
+
+    Real contract(const std::size_t (&)[d][4], const Real (&)[d][4], std::size_t base, const std::integral_constant<std::size_t, d>&) const
+    {
+        return m_c[base];
+    }
+
+    static void throw_domain_error()
+    {
+        throw std::domain_error("Tried to evaluate the cardinal cubic b-spline outside the domain of interpolation; extrapolation does not work.");
+    }
+
+    std::vector<Real> m_c;
+    point_type m_a;
+    point_type m_b;
+    point_type m_inv_h;
+    point_type m_k_max;
+    std::array<std::size_t, d> m_tile;
+    std::array<std::size_t, d> m_within;
+};
+
+}}}}
+#endif
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <sstream>
 #include <limits>
+#include <boost/math/interpolators/detail/interval_search.hpp>
 
 namespace boost {
 namespace math {
@@ -87,9 +88,37 @@ public:
         }
 
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return unchecked_evaluation(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    // As above, but searches for the interval containing x starting from the one
+    // found by the previous call, and updates hint to the new interval:
+    Real operator()(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_evaluation(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->operator()(*first, hint);
+        }
+    }
+
+    // Evaluates the interpolant on the interval x_[i] <= x < x_[i+1]:
+    inline Real unchecked_evaluation(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -119,9 +148,24 @@ public:
             return dydx_.back();
         }
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return unchecked_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    Real prime(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_prime(x, hint);
+    }
+
+    inline Real unchecked_prime(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -135,6 +179,36 @@ public:
         return s0 + 2*c2*(x-x0) + 3*c3*(x-x0)*(x-x0); 
     }
 
+    // The second derivative is discontinuous at the abscissas: this is the one of the interval
+    // x_[i] <= x < x_[i+1], and of the last interval at x_.back().
+    Real double_prime(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return unchecked_double_prime(x, x_.size() - 2);
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_double_prime(x, hint);
+    }
+
+    inline Real unchecked_double_prime(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
+        Real y0 = y_[i];
+        Real y1 = y_[i+1];
+        Real s0 = dydx_[i];
+        Real s1 = dydx_[i+1];
+        Real dx = (x1-x0);
+
+        Real d1 = (y1 - y0 - s0*dx)/(dx*dx);
+        Real d2 = (s1 - s0)/(2*dx);
+        Real c2 = 3*d1 - 2*d2;
+        Real c3 = 2*(d2 - d1)/dx;
+        return 2*c2 + 6*c3*(x-x0);
+    }
+
 
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite_detail & m)
     {
@@ -0,0 +1,113 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_INTERVAL_SEARCH_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_INTERVAL_SEARCH_HPP
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace boost {
+namespace math {
+namespace interpolators {
+namespace detail {
+
+// Returns the index i of the interval x[i] <= t < x[i+1] of the strictly increasing abscissas x,
+// given that x[0] <= t < x.back().  The search starts from the interval of the previous query,
+// hint, and gallops outwards from there, so a sequence of sorted queries walks the abscissas
+// in amortized constant time, while an unsorted one costs O(log(distance moved)) per query.
+template<class RandomAccessContainer, class Real>
+std::size_t find_interval(RandomAccessContainer const & x, Real const & t, std::size_t hint)
+{
+    std::size_t n = x.size();
+    if (hint > n - 2)
+    {
+        hint = n - 2;
+    }
+    if (t < x[hint])
+    {
+        // Gallop down until x[lo] <= t < x[hi]:
+        std::size_t hi = hint;
+        std::size_t step = 1;
+        std::size_t lo = hi > step ? hi - step : 0;
+        while (lo > 0 && t < x[lo])
+        {
+            hi = lo;
+            step *= 2;
+            lo = hi > step ? hi - step : 0;
+        }
+        auto it = std::upper_bound(x.begin() + lo, x.begin() + hi, t);
+        return std::distance(x.begin(), it) - 1;
+    }
+    if (t < x[hint + 1])
+    {
+        return hint;
+    }
+    // Gallop up until x[lo] <= t < x[hi]:
+    std::size_t lo = hint + 1;
+    std::size_t step = 1;
+    std::size_t hi = (std::min)(lo + step, n - 1);
+    while (hi < n - 1 && !(t < x[hi]))
+    {
+        lo = hi;
+        step *= 2;
+        hi = (std::min)(lo + step, n - 1);
+    }
+    auto it = std::upper_bound(x.begin() + lo, x.begin() + hi, t);
+    return std::distance(x.begin(), it) - 1;
+}
+
+template<class Real>
+void check_abscissa(Real const & x, Real const & a, Real const & b)
+{
+    if (x < a || x > b)
+    {
+        std::ostringstream oss;
+        oss.precision(std::numeric_limits<Real>::digits10+3);
+        oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
+            << a << ", " << b << "]";
+        throw std::domain_error(oss.str());
+    }
+}
+
+// Remembers the interval of the last evaluation, so that a following evaluation nearby,
+// in particular at the next of a sequence of increasing abscissas, doesn't need a binary search.
+// Each thread needs its own cursor, but many cursors may share an interpolator.
+template<class Interpolator>
+class interpolator_cursor {
+public:
+    using Real = typename Interpolator::Real;
+
+    explicit interpolator_cursor(std::shared_ptr<Interpolator> const & impl) : impl_{impl}, hint_{0} {}
+
+    Real operator()(Real x)
+    {
+        return impl_->operator()(x, hint_);
+    }
+
+    Real prime(Real x)
+    {
+        return impl_->prime(x, hint_);
+    }
+
+    Real double_prime(Real x)
+    {
+        return impl_->double_prime(x, hint_);
+    }
+
+private:
+    std::shared_ptr<Interpolator> impl_;
+    std::size_t hint_;
+};
+
+}
+}
+}
+}
+#endif
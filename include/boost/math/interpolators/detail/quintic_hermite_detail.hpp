@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
+#include <boost/math/interpolators/detail/interval_search.hpp>
 
 namespace boost {
 namespace math {
@@ -82,9 +83,36 @@ public:
         }
 
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return unchecked_evaluation(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    // As above, but searches for the interval containing x starting from the one
+    // found by the previous call, and updates hint to the new interval:
+    Real operator()(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_evaluation(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->operator()(*first, hint);
+        }
+    }
+
+    inline Real unchecked_evaluation(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real v0 = dydx_[i];
@@ -123,9 +151,24 @@ public:
         }
 
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return unchecked_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    Real prime(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_prime(x, hint);
+    }
+
+    inline Real unchecked_prime(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -159,9 +202,24 @@ public:
         }
 
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return unchecked_double_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    Real double_prime(Real x, size_t & hint) const
+    {
+        check_abscissa(x, x_[0], x_.back());
+        if (x == x_.back())
+        {
+            return d2ydx2_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_double_prime(x, hint);
+    }
+
+    inline Real unchecked_double_prime(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -12,6 +12,7 @@
 #include <utility> // for std::move
 #include <limits>
 #include <boost/assert.hpp>
+#include <boost/math/interpolators/detail/barycentric_rational_batch.hpp>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -22,18 +23,51 @@ public:
     using Real = typename TimeContainer::value_type;
     using Point = typename SpaceContainer::value_type;
 
-    vector_barycentric_rational_imp(TimeContainer&& t, SpaceContainer&& y, size_t approximation_order);
+    vector_barycentric_rational_imp(TimeContainer&& t, SpaceContainer&& y, size_t approximation_order, std::size_t threads = 1);
 
     void operator()(Point& p, Real t) const;
 
     void eval_with_prime(Point& x, Point& dxdt, Real t) const;
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+    {
+        evaluate<false>(first, last, out, tolerance, threads);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+    {
+        evaluate<true>(first, last, out, tolerance, threads);
+    }
+
+    void operator()(const Real* t, std::size_t n, Real* out, std::size_t threads) const
+    {
+        evaluate<false>(t, n, out, threads);
+    }
+
+    void prime(const Real* t, std::size_t n, Real* out, std::size_t threads) const
+    {
+        evaluate<true>(t, n, out, threads);
+    }
+
     // The barycentric weights are only interesting to the unit tests:
     Real weight(size_t i) const { return w_[i]; }
 
 private:
 
-    void calculate_weights(size_t approximation_order);
+    void calculate_weights(size_t approximation_order, std::size_t threads);
+
+    template<bool derivative, class InputIterator, class OutputIterator>
+    void evaluate(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const;
+
+    template<bool derivative>
+    void evaluate(const Real* t, std::size_t n, Real* out, std::size_t threads) const;
+
+    template<bool derivative, std::size_t W>
+    void block(const Real (&t)[W], std::size_t count, Real* out) const;
+
+    void node_prime(size_t i, Real* dxdt) const;
 
     TimeContainer t_;
     SpaceContainer y_;
@@ -41,7 +75,7 @@ private:
 };
 
 template <class TimeContainer, class SpaceContainer>
-vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::vector_barycentric_rational_imp(TimeContainer&& t, SpaceContainer&& y, size_t approximation_order)
+vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::vector_barycentric_rational_imp(TimeContainer&& t, SpaceContainer&& y, size_t approximation_order, std::size_t threads)
 {
     using std::numeric_limits;
     t_ = std::move(t);
@@ -53,49 +87,53 @@ vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::vector_barycentr
     {
         BOOST_ASSERT_MSG(t_[i] - t_[i-1] >  (numeric_limits<typename TimeContainer::value_type>::min)(), "The abscissas must be listed in strictly increasing order t[0] < t[1] < ... < t[n-1].");
     }
-    calculate_weights(approximation_order);
+    calculate_weights(approximation_order, threads);
 }
 
 
 template<class TimeContainer, class SpaceContainer>
-void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::calculate_weights(size_t approximation_order)
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::calculate_weights(size_t approximation_order, std::size_t threads)
 {
     using Real = typename TimeContainer::value_type;
     using std::abs;
     int64_t n = t_.size();
     w_.resize(n, Real(0));
-    for(int64_t k = 0; k < n; ++k)
+    // Each weight depends only on the nearby abscissas, so the weights can be shared out between threads:
+    tools::detail::parallel_for_range(n, threads, barycentric_rational_chunk, [&](std::size_t begin, std::size_t end)
     {
-        int64_t i_min = (std::max)(k - (int64_t) approximation_order, (int64_t) 0);
-        int64_t i_max = k;
-        if (k >= n - (std::ptrdiff_t)approximation_order)
+        for(int64_t k = begin; k < (int64_t) end; ++k)
         {
-            i_max = n - approximation_order - 1;
-        }
+            int64_t i_min = (std::max)(k - (int64_t) approximation_order, (int64_t) 0);
+            int64_t i_max = k;
+            if (k >= n - (std::ptrdiff_t)approximation_order)
+            {
+                i_max = n - approximation_order - 1;
+            }
 
-        for(int64_t i = i_min; i <= i_max; ++i)
-        {
-            Real inv_product = 1;
-            int64_t j_max = (std::min)(static_cast<int64_t>(i + approximation_order), static_cast<int64_t>(n - 1));
-            for(int64_t j = i; j <= j_max; ++j)
+            for(int64_t i = i_min; i <= i_max; ++i)
             {
-                if (j == k)
+                Real inv_product = 1;
+                int64_t j_max = (std::min)(static_cast<int64_t>(i + approximation_order), static_cast<int64_t>(n - 1));
+                for(int64_t j = i; j <= j_max; ++j)
                 {
-                    continue;
+                    if (j == k)
+                    {
+                        continue;
+                    }
+                    Real diff = t_[k] - t_[j];
+                    inv_product *= diff;
+                }
+                if (i % 2 == 0)
+                {
+                    w_[k] += 1/inv_product;
+                }
+                else
+                {
+                    w_[k] -= 1/inv_product;
                 }
-                Real diff = t_[k] - t_[j];
-                inv_product *= diff;
-            }
-            if (i % 2 == 0)
-            {
-                w_[k] += 1/inv_product;
-            }
-            else
-            {
-                w_[k] -= 1/inv_product;
             }
         }
-    }
+    });
 }
 
 
@@ -133,61 +171,302 @@ void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::operator()(
 template<class TimeContainer, class SpaceContainer>
 void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::eval_with_prime(typename SpaceContainer::value_type& x, typename SpaceContainer::value_type& dxdt, typename TimeContainer::value_type t) const
 {
-    using Point = typename SpaceContainer::value_type;
     using Real = typename TimeContainer::value_type;
     this->operator()(x, t);
-    Point numerator;
-    for (decltype(x.size()) i = 0; i < x.size(); ++i)
+    // The numerator is accumulated in dxdt, so that no temporary points are needed:
+    for (decltype(dxdt.size()) j = 0; j < dxdt.size(); ++j)
     {
-        numerator[i] = 0;
+        dxdt[j] = 0;
     }
     Real denominator = 0;
     for(decltype(t_.size()) i = 0; i < t_.size(); ++i)
     {
         if (t == t_[i])
         {
-            Point sum;
-            for (decltype(x.size()) i = 0; i < x.size(); ++i)
+            for (decltype(dxdt.size()) k = 0; k < dxdt.size(); ++k)
             {
-                sum[i] = 0;
+                dxdt[k] = 0;
             }
-
             for (decltype(t_.size()) j = 0; j < t_.size(); ++j)
             {
                 if (j == i)
                 {
                     continue;
                 }
-                for (decltype(sum.size()) k = 0; k < sum.size(); ++k)
+                for (decltype(dxdt.size()) k = 0; k < dxdt.size(); ++k)
                 {
-                    sum[k] += w_[j]*(y_[i][k] - y_[j][k])/(t_[i] - t_[j]);
+                    dxdt[k] += w_[j]*(y_[i][k] - y_[j][k])/(t_[i] - t_[j]);
                 }
             }
-            for (decltype(sum.size()) k = 0; k < sum.size(); ++k)
+            for (decltype(dxdt.size()) k = 0; k < dxdt.size(); ++k)
             {
-                dxdt[k] = -sum[k]/w_[i];
+                dxdt[k] = -dxdt[k]/w_[i];
             }
             return;
         }
         Real tw = w_[i]/(t - t_[i]);
-        Point diff;
-        for (decltype(diff.size()) j = 0; j < diff.size(); ++j)
+        for (decltype(dxdt.size()) j = 0; j < dxdt.size(); ++j)
         {
-            diff[j] = (x[j] - y_[i][j])/(t-t_[i]);
-        }
-        for (decltype(diff.size()) j = 0; j < diff.size(); ++j)
-        {
-            numerator[j] += tw*diff[j];
+            dxdt[j] += tw*((x[j] - y_[i][j])/(t - t_[i]));
         }
         denominator += tw;
     }
 
     for (decltype(dxdt.size()) j = 0; j < dxdt.size(); ++j)
     {
-        dxdt[j] = numerator[j]/denominator;
+        dxdt[j] /= denominator;
     }
     return;
 }
 
+template<class TimeContainer, class SpaceContainer>
+template<bool derivative, class InputIterator, class OutputIterator>
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::evaluate(InputIterator first, InputIterator last, OutputIterator out, Real tolerance, std::size_t threads) const
+{
+    barycentric_rational_check_tolerance(tolerance >= 0);
+    const std::size_t m = y_[0].size();
+    if (tolerance > 0)
+    {
+        const vector_barycentric_rational_imp& self = *this;
+        barycentric_rational_tree<Real> tree(t_.size(), m, [&](size_t i) { return self.t_[i]; }, [&](size_t i) { return self.w_[i]; },
+                                             [&](size_t i, size_t j) { return self.y_[i][j]; }, tolerance);
+        barycentric_rational_parallel(first, last, out, threads, [&](InputIterator f, InputIterator l, OutputIterator o)
+        {
+            std::vector<Real> numerator(m);
+            std::vector<Real> r(m);
+            // Copying a value gives a point of the right size, whatever the type of point:
+            Point p = self.y_[0];
+            for (; f != l; ++f, ++o)
+            {
+                Real t = *f;
+                Real denominator;
+                tree.sums(t, numerator.data(), denominator);
+                if (!(boost::math::isfinite)(denominator))
+                {
+                    if (derivative)
+                    {
+                        Point x = p;
+                        self.eval_with_prime(x, p, t);
+                    }
+                    else
+                    {
+                        self(p, t);
+                    }
+                    *o = p;
+                    continue;
+                }
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    r[j] = numerator[j]/denominator;
+                }
+                if (derivative)
+                {
+                    tree.derivative_sums(t, r.data(), numerator.data());
+                    for (std::size_t j = 0; j < m; ++j)
+                    {
+                        r[j] = numerator[j]/denominator;
+                    }
+                }
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    p[j] = r[j];
+                }
+                *o = p;
+            }
+        });
+        return;
+    }
+
+    barycentric_rational_parallel(first, last, out, threads, [&](InputIterator f, InputIterator l, OutputIterator o)
+    {
+        constexpr std::size_t W = barycentric_rational_block;
+        Real t[W];
+        std::vector<Real> v(m*W);
+        Point p = y_[0];
+        while (f != l)
+        {
+            std::size_t count = 0;
+            for (; count < W && f != l; ++count, ++f)
+            {
+                t[count] = *f;
+            }
+            for (std::size_t k = count; k < W; ++k)
+            {
+                t[k] = t[0];
+            }
+            this->template block<derivative>(t, count, v.data());
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    p[j] = v[k*m + j];
+                }
+                *o++ = p;
+            }
+        }
+    });
+}
+
+template<class TimeContainer, class SpaceContainer>
+template<bool derivative>
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::evaluate(const Real* t, std::size_t n, Real* out, std::size_t threads) const
+{
+    const std::size_t m = y_[0].size();
+    tools::detail::parallel_for_range(n, threads, barycentric_rational_chunk, [&](std::size_t begin, std::size_t end)
+    {
+        constexpr std::size_t W = barycentric_rational_block;
+        Real s[W];
+        for (std::size_t i = begin; i < end; i += W)
+        {
+            std::size_t count = (std::min)(W, end - i);
+            for (std::size_t k = 0; k < W; ++k)
+            {
+                s[k] = t[i + (k < count ? k : 0)];
+            }
+            this->template block<derivative>(s, count, out + i*m);
+        }
+    });
+}
+
+// Evaluates W points at a time, writing component j of the value, or of the derivative, at point k < count
+// to out[k*m + j].  The values are the same sums as the single point evaluation, in the same order, so they
+// are bit-identical to it.  The derivative is not: it multiplies (r - y) by 1/(t - t_i), where the single point
+// evaluation divides, so it can differ in the last bit or so of each term.
+// The components are done a few at a time, so that the sums fit in arrays on the stack,
+// and nothing is allocated.
+template<class TimeContainer, class SpaceContainer>
+template<bool derivative, std::size_t W>
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::block(const Real (&t)[W], std::size_t count, Real* out) const
+{
+    constexpr std::size_t G = 8;
+    const std::size_t m = y_[0].size();
+    Real x[W];
+    Real denominator[W];
+    Real p[G*W];
+    Real r[derivative ? G*W : 1];
+    for (std::size_t j0 = 0; j0 < m; j0 += G)
+    {
+        const std::size_t g = (std::min)(G, m - j0);
+        std::fill(p, p + g*W, Real(0));
+        for (std::size_t k = 0; k < W; ++k)
+        {
+            denominator[k] = 0;
+        }
+        for (size_t i = 0; i < t_.size(); ++i)
+        {
+            const Real ti = t_[i];
+            const Real wi = w_[i];
+            for (std::size_t k = 0; k < W; ++k)
+            {
+                x[k] = wi/(t[k] - ti);
+                denominator[k] += x[k];
+            }
+            for (std::size_t j = 0; j < g; ++j)
+            {
+                const Real yij = y_[i][j0 + j];
+                Real* pj = p + j*W;
+                for (std::size_t k = 0; k < W; ++k)
+                {
+                    pj[k] += x[k]*yij;
+                }
+            }
+        }
+        for (std::size_t j = 0; j < g; ++j)
+        {
+            for (std::size_t k = 0; k < W; ++k)
+            {
+                p[j*W + k] /= denominator[k];
+            }
+        }
+        if (derivative)
+        {
+            std::copy(p, p + g*W, r);
+            std::fill(p, p + g*W, Real(0));
+            // One division for each node and point, rather than one for each component as well:
+            Real inverse[W];
+            for (size_t i = 0; i < t_.size(); ++i)
+            {
+                const Real ti = t_[i];
+                const Real wi = w_[i];
+                for (std::size_t k = 0; k < W; ++k)
+                {
+                    inverse[k] = 1/(t[k] - ti);
+                    x[k] = wi*inverse[k];
+                }
+                for (std::size_t j = 0; j < g; ++j)
+                {
+                    const Real yij = y_[i][j0 + j];
+                    Real* pj = p + j*W;
+                    const Real* rj = r + j*W;
+                    for (std::size_t k = 0; k < W; ++k)
+                    {
+                        pj[k] += x[k]*((rj[k] - yij)*inverse[k]);
+                    }
+                }
+            }
+            for (std::size_t j = 0; j < g; ++j)
+            {
+                for (std::size_t k = 0; k < W; ++k)
+                {
+                    p[j*W + k] /= denominator[k];
+                }
+            }
+        }
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            for (std::size_t j = 0; j < g; ++j)
+            {
+                out[k*m + j0 + j] = p[j*W + k];
+            }
+        }
+    }
+    // A point which is a node makes its denominator infinite, and is done as in the single point evaluation:
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        if ((boost::math::isfinite)(denominator[k]))
+        {
+            continue;
+        }
+        size_t i = std::lower_bound(t_.begin(), t_.end(), t[k]) - t_.begin();
+        if (i == t_.size() || !(t_[i] == t[k]))
+        {
+            continue;
+        }
+        if (derivative)
+        {
+            node_prime(i, out + k*m);
+        }
+        else
+        {
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                out[k*m + j] = y_[i][j];
+            }
+        }
+    }
+}
+
+template<class TimeContainer, class SpaceContainer>
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::node_prime(size_t i, Real* dxdt) const
+{
+    const std::size_t m = y_[0].size();
+    std::fill(dxdt, dxdt + m, Real(0));
+    for (size_t j = 0; j < t_.size(); ++j)
+    {
+        if (j == i)
+        {
+            continue;
+        }
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            dxdt[k] += w_[j]*(y_[i][k] - y_[j][k])/(t_[i] - t_[j]);
+        }
+    }
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        dxdt[k] = -dxdt[k]/w_[i];
+    }
+}
+
 }}}
 #endif
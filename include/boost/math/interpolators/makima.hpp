@@ -21,6 +21,7 @@ template<class RandomAccessContainer>
 class makima {
 public:
     using Real = typename RandomAccessContainer::value_type;
+    using cursor_type = detail::interpolator_cursor<detail::cubic_hermite_detail<RandomAccessContainer>>;
 
     makima(RandomAccessContainer && x, RandomAccessContainer && y,
            Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
@@ -117,6 +118,18 @@ public:
         return impl_->prime(x);
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        impl_->operator()(first, last, out);
+    }
+
+    // For evaluation at a sequence of nearby points, in particular increasing ones:
+    cursor_type cursor() const
+    {
+        return cursor_type(impl_);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const makima & m)
     {
         os << *m.impl_;
@@ -17,6 +17,7 @@ template<class RandomAccessContainer>
 class pchip {
 public:
     using Real = typename RandomAccessContainer::value_type;
+    using cursor_type = detail::interpolator_cursor<detail::cubic_hermite_detail<RandomAccessContainer>>;
 
     pchip(RandomAccessContainer && x, RandomAccessContainer && y,
           Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
@@ -78,6 +79,18 @@ public:
         return impl_->prime(x);
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        impl_->operator()(first, last, out);
+    }
+
+    // For evaluation at a sequence of nearby points, in particular increasing ones:
+    cursor_type cursor() const
+    {
+        return cursor_type(impl_);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const pchip & m)
     {
         os << *m.impl_;
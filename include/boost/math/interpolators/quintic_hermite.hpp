@@ -20,6 +20,7 @@ template<class RandomAccessContainer>
 class quintic_hermite {
 public:
     using Real = typename RandomAccessContainer::value_type;
+    using cursor_type = detail::interpolator_cursor<detail::quintic_hermite_detail<RandomAccessContainer>>;
     quintic_hermite(RandomAccessContainer && x, RandomAccessContainer && y, RandomAccessContainer && dydx, RandomAccessContainer && d2ydx2)
      : impl_(std::make_shared<detail::quintic_hermite_detail<RandomAccessContainer>>(std::move(x), std::move(y), std::move(dydx), std::move(d2ydx2)))
     {}
@@ -39,6 +40,18 @@ public:
         return impl_->double_prime(x);
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        impl_->operator()(first, last, out);
+    }
+
+    // For evaluation at a sequence of nearby points, in particular increasing ones:
+    cursor_type cursor() const
+    {
+        return cursor_type(impl_);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const quintic_hermite & m)
     {
         os << *m.impl_;
@@ -20,6 +20,7 @@ class septic_hermite
 {
 public:
     using Real = typename RandomAccessContainer::value_type;
+    using cursor_type = detail::interpolator_cursor<detail::septic_hermite_detail<RandomAccessContainer>>;
     septic_hermite(RandomAccessContainer && x, RandomAccessContainer && y, RandomAccessContainer && dydx, 
                    RandomAccessContainer && d2ydx2, RandomAccessContainer && d3ydx3)
      : impl_(std::make_shared<detail::septic_hermite_detail<RandomAccessContainer>>(std::move(x), 
@@ -41,6 +42,18 @@ public:
         return impl_->double_prime(x);
     }
 
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        impl_->operator()(first, last, out);
+    }
+
+    // For evaluation at a sequence of nearby points, in particular increasing ones:
+    cursor_type cursor() const
+    {
+        return cursor_type(impl_);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const septic_hermite & m)
     {
         os << *m.impl_;
@@ -23,7 +23,8 @@ class vector_barycentric_rational
 public:
     using Real = typename TimeContainer::value_type;
     using Point = typename SpaceContainer::value_type;
-    vector_barycentric_rational(TimeContainer&& times, SpaceContainer&& points, size_t approximation_order = 3);
+    // The weights are computed on up to threads threads.
+    vector_barycentric_rational(TimeContainer&& times, SpaceContainer&& points, size_t approximation_order = 3, std::size_t threads = 1);
 
     void operator()(Point& x, Real t) const;
 
@@ -59,14 +60,37 @@ public:
         return {x, dxdt};
     }
 
+    // Evaluates at each time in [first, last), writing the points to out.
+    // With tolerance > 0, the sums over nodes far from each time are approximated, to about this relative accuracy,
+    // in O(log(n)) operations rather than O(n). The times are shared out over up to threads threads.
+    template<class InputIterator, class OutputIterator>
+    void operator()(InputIterator first, InputIterator last, OutputIterator out, Real tolerance = 0, std::size_t threads = 1) const {
+        m_imp->operator()(first, last, out, tolerance, threads);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    void prime(InputIterator first, InputIterator last, OutputIterator out, Real tolerance = 0, std::size_t threads = 1) const {
+        m_imp->prime(first, last, out, tolerance, threads);
+    }
+
+    // Evaluates at t[0], ..., t[n-1], writing component j of the i-th point to out[i*d + j], where d is the dimension of the points.
+    // Nothing is allocated unless threads > 1.
+    void operator()(const Real* t, std::size_t n, Real* out, std::size_t threads = 1) const {
+        m_imp->operator()(t, n, out, threads);
+    }
+
+    void prime(const Real* t, std::size_t n, Real* out, std::size_t threads = 1) const {
+        m_imp->prime(t, n, out, threads);
+    }
+
 private:
     std::shared_ptr<detail::vector_barycentric_rational_imp<TimeContainer, SpaceContainer>> m_imp;
 };
 
 
 template <class TimeContainer, class SpaceContainer>
-vector_barycentric_rational<TimeContainer, SpaceContainer>::vector_barycentric_rational(TimeContainer&& times, SpaceContainer&& points, size_t approximation_order):
- m_imp(std::make_shared<detail::vector_barycentric_rational_imp<TimeContainer, SpaceContainer>>(std::move(times), std::move(points), approximation_order))
+vector_barycentric_rational<TimeContainer, SpaceContainer>::vector_barycentric_rational(TimeContainer&& times, SpaceContainer&& points, size_t approximation_order, std::size_t threads):
+ m_imp(std::make_shared<detail::vector_barycentric_rational_imp<TimeContainer, SpaceContainer>>(std::move(times), std::move(points), approximation_order, threads))
 {
     return;
 }
@@ -8,12 +8,15 @@
 #define BOOST_MATH_QUADRATURE_DETAIL_EXP_SINH_DETAIL_HPP
 
 #include <cmath>
+#include <memory>
+#include <string>
 #include <vector>
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/next.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/quadrature/detail/node_table.hpp>
 
 namespace boost{ namespace math{ namespace quadrature { namespace detail{
 
@@ -39,6 +42,9 @@ class exp_sinh_detail
       0;
 public:
     exp_sinh_detail(size_t max_refinements);
+    explicit exp_sinh_detail(const std::string& table_file);
+
+    void save_tables(const std::string& table_file, std::size_t levels) const;
 
     template<class F>
     auto integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const;
@@ -99,7 +105,12 @@ private:
       using std::sinh;
       using std::cosh;
       using std::exp;
-      std::size_t row  = ++m_committed_refinements;
+      std::size_t row = ++m_committed_refinements;
+      if (m_table && (row < m_table->rows()))
+      {
+         m_table->read_row(row, m_abscissas[row], m_weights[row]);
+         return;
+      }
 
       Real h = ldexp(Real(1), -static_cast<int>(row));
       const Real t_max = m_t_min + m_abscissas[0].size() - 1;
@@ -132,8 +143,46 @@ private:
 #else
     mutable unsigned                  m_committed_refinements;
 #endif
+    // Rows loaded from a file by the second constructor:
+    std::shared_ptr<const node_table<Real>> m_table;
 };
 
+template<class Real, class Policy>
+exp_sinh_detail<Real, Policy>::exp_sinh_detail(const std::string& table_file)
+   : m_table(std::make_shared<node_table<Real>>(table_file, node_table_kind::exp_sinh))
+{
+   if ((m_table->parameters().size() != 1) || (m_table->scalars().size() != 1) || (m_table->rows() < 2) || (m_table->rows() > m_table->parameters()[0]))
+      BOOST_THROW_EXCEPTION(std::runtime_error("Not a valid exp_sinh node table: " + table_file));
+   m_max_refinements = static_cast<std::size_t>(m_table->parameters()[0]);
+   m_t_min = m_table->scalars()[0];
+   m_abscissas.assign(m_max_refinements, std::vector<Real>());
+   m_weights.assign(m_max_refinements, std::vector<Real>());
+   //
+   // integrate() uses the first two rows directly, the others are read when extend_refinements asks for them:
+   //
+   for (std::size_t row = 0; row < 2; ++row)
+      m_table->read_row(row, m_abscissas[row], m_weights[row]);
+   m_committed_refinements = 1;
+}
+
+template<class Real, class Policy>
+void exp_sinh_detail<Real, Policy>::save_tables(const std::string& table_file, std::size_t levels) const
+{
+   for (std::size_t row = 1; row <= (std::min)(levels, m_abscissas.size() - 1); ++row)
+      get_abscissa_row(row);
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   // Don't write a row which another thread is still filling in:
+   boost::detail::lightweight_mutex::scoped_lock guard(m_mutex);
+   std::size_t rows = m_committed_refinements.load() + 1;
+#else
+   std::size_t rows = m_committed_refinements + 1;
+#endif
+   std::vector<std::uint64_t> parameters{m_max_refinements};
+   std::vector<Real> scalars{m_t_min};
+   std::vector<std::uint64_t> tags(rows, 0);
+   save_node_table(table_file, node_table_kind::exp_sinh, parameters, scalars, m_abscissas, m_weights, tags, rows);
+}
+
 template<class Real, class Policy>
 exp_sinh_detail<Real, Policy>::exp_sinh_detail(size_t max_refinements)
    : m_abscissas(max_refinements), m_weights(max_refinements),
@@ -0,0 +1,491 @@
+//  Copyright John Maddock 2015.
+//  Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_INTEGRATE_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_INTEGRATE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/detail/thread_pool.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// The integration shared by gauss and gauss_rule, and by gauss_kronrod and gauss_kronrod_rule, which differ only
+// in where their nodes come from.  Rule is any type with members points(), abscissa() and weights(), holding the
+// nonnegative abscissas in increasing order and their weights, and for a Gauss-Kronrod rule gauss_weights() too,
+// the weights of the Gauss nodes, which are every other abscissa.  The parallel integration calls these members
+// from several threads at once.
+//
+
+//
+// The Gauss rule on [-1, 1]:
+//
+template <class Real, class Rule, class F>
+auto gauss_integrate_m1_1(const Rule& rule, F f, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   // In many math texts, K represents the field of real or complex numbers.
+   // Too bad we can't put blackboard bold into C++ source!
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   const auto& x = rule.abscissa();
+   const auto& w = rule.weights();
+   unsigned non_zero_start = 1;
+   K result = Real(0);
+   if (rule.points() & 1) {
+      result = f(Real(0)) * w[0];
+   }
+   else {
+      result = 0;
+      non_zero_start = 0;
+   }
+   Real L1 = abs(result);
+   for (unsigned i = non_zero_start; i < x.size(); ++i)
+   {
+      K fp = f(x[i]);
+      K fm = f(-x[i]);
+      result += (fp + fm) * w[i];
+      L1 += (abs(fp) + abs(fm)) * w[i];
+   }
+   if (pL1)
+      *pL1 = L1;
+   return result;
+}
+
+//
+// The Gauss rule on [a, b], either of which may be infinite:
+//
+template <class Real, class Policy, class Rule, class F>
+auto gauss_integrate(const Rule& rule, F f, Real a, Real b, Real* pL1, const char* function)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(a)) K;
+   if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+   {
+      // Infinite limits:
+      Real min_inf = -tools::max_value<Real>();
+      if ((a <= min_inf) && (b >= tools::max_value<Real>()))
+      {
+         auto u = [&](const Real& t)->K
+         {
+            Real t_sq = t*t;
+            Real inv = 1 / (1 - t_sq);
+            K res = f(t*inv)*(1 + t_sq)*inv*inv;
+            return res;
+         };
+         return gauss_integrate_m1_1(rule, u, pL1);
+      }
+
+      // Right limit is infinite:
+      if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      {
+         auto u = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z + a - 1;
+            K res = f(arg)*z*z;
+            return res;
+         };
+         K Q = Real(2) * gauss_integrate_m1_1(rule, u, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         auto v = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z - 1;
+            K res = f(b - arg) * z * z;
+            return res;
+         };
+         K Q = Real(2) * gauss_integrate_m1_1(rule, v, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (a == b)
+         {
+            return K(0);
+         }
+         if (b < a)
+         {
+            return -gauss_integrate<Real, Policy>(rule, f, b, a, pL1, function);
+         }
+         Real avg = (a + b)*constants::half<Real>();
+         Real scale = (b - a)*constants::half<Real>();
+
+         auto u = [&](Real z)->K
+         {
+            return f(avg + scale*z);
+         };
+         K Q = scale*gauss_integrate_m1_1(rule, u, pL1);
+
+         if (pL1)
+         {
+            *pL1 *= scale;
+         }
+         return Q;
+      }
+   }
+   return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+}
+
+//
+// The Gauss-Kronrod rule on [-1, 1], with the difference from the embedded Gauss rule as the error estimate:
+//
+template <class Real, class Rule, class F>
+auto gauss_kronrod_integrate_m1_1(const Rule& rule, F f, Real* error, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   const auto& x = rule.abscissa();
+   const auto& w = rule.weights();
+   const auto& g = rule.gauss_weights();
+   unsigned gauss_start = 2;
+   unsigned kronrod_start = 1;
+   unsigned gauss_order = (rule.points() - 1) / 2;
+   K kronrod_result = 0;
+   K gauss_result = 0;
+   K fp, fm;
+   if (gauss_order & 1)
+   {
+      fp = f(Real(0));
+      kronrod_result = fp * w[0];
+      gauss_result += fp * g[0];
+   }
+   else
+   {
+      fp = f(Real(0));
+      kronrod_result = fp * w[0];
+      gauss_start = 1;
+      kronrod_start = 2;
+   }
+   Real L1 = abs(kronrod_result);
+   for (unsigned i = gauss_start; i < x.size(); i += 2)
+   {
+      fp = f(x[i]);
+      fm = f(-x[i]);
+      kronrod_result += (fp + fm) * w[i];
+      L1 += (abs(fp) + abs(fm)) * w[i];
+      gauss_result += (fp + fm) * g[i / 2];
+   }
+   for (unsigned i = kronrod_start; i < x.size(); i += 2)
+   {
+      fp = f(x[i]);
+      fm = f(-x[i]);
+      kronrod_result += (fp + fm) * w[i];
+      L1 += (abs(fp) + abs(fm)) * w[i];
+   }
+   if (pL1)
+      *pL1 = L1;
+   if (error)
+      *error = (std::max)(static_cast<Real>(abs(kronrod_result - gauss_result)), static_cast<Real>(abs(kronrod_result * tools::epsilon<Real>() * Real(2))));
+   return kronrod_result;
+}
+
+template <class Real, class F>
+struct gauss_kronrod_recursive_info
+{
+   F f;
+   Real tol;
+};
+
+//
+// Bisects [a, b] wherever the error estimate on a piece exceeds both its share of abs_tol and tol relative to its integral:
+//
+template <class Real, class Rule, class F>
+auto gauss_kronrod_recursive_integrate(const Rule& rule, const gauss_kronrod_recursive_info<Real, F>* info, Real a, Real b, unsigned max_levels, Real abs_tol, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(info->f(Real(a))) K;
+   using std::abs;
+   Real error_local;
+   Real mean = (b + a) / 2;
+   Real scale = (b - a) / 2;
+   auto ff = [&](const Real& x)->K
+   {
+      return info->f(scale * x + mean);
+   };
+   K r1 = gauss_kronrod_integrate_m1_1(rule, ff, &error_local, L1);
+   K estimate = scale * r1;
+
+   K tmp = estimate * info->tol;
+   Real abs_tol1 = abs(tmp);
+   if (abs_tol == 0)
+      abs_tol = abs_tol1;
+
+   if (max_levels && (abs_tol1 < error_local) && (abs_tol < error_local))
+   {
+      Real mid = (a + b) / 2;
+      Real L1_local;
+      estimate = gauss_kronrod_recursive_integrate<Real>(rule, info, a, mid, max_levels - 1, abs_tol / 2, error, L1);
+      estimate += gauss_kronrod_recursive_integrate<Real>(rule, info, mid, b, max_levels - 1, abs_tol / 2, &error_local, &L1_local);
+      if (error)
+         *error += error_local;
+      if (L1)
+         *L1 += L1_local;
+      return estimate;
+   }
+   if(L1)
+      *L1 *= scale;
+   if (error)
+      *error = error_local;
+   return estimate;
+}
+
+template <class Real, class Rule>
+struct gauss_kronrod_recursive_integrator
+{
+   const Rule& rule;
+   unsigned max_depth;
+   Real tol;
+
+   template <class F>
+   auto operator()(const F& f, Real a, Real b, Real* error, Real* pL1) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      gauss_kronrod_recursive_info<Real, F> info = { f, tol };
+      return gauss_kronrod_recursive_integrate(rule, &info, a, b, max_depth, Real(0), error, pL1);
+   }
+};
+
+template <class Real, class K>
+struct gauss_kronrod_segment
+{
+   Real a;
+   Real b;
+   K estimate;
+   Real error;
+   Real L1;
+   unsigned depth;
+};
+
+template <class Real, class Rule, class F>
+auto gauss_kronrod_integrate_segment(const Rule& rule, const F& f, Real a, Real b, unsigned depth)->gauss_kronrod_segment<Real, decltype(std::declval<F>()(std::declval<Real>()))>
+{
+   typedef decltype(f(a)) K;
+   Real mean = (b + a) / 2;
+   Real scale = (b - a) / 2;
+   auto ff = [&](const Real& x)->K
+   {
+      return f(scale * x + mean);
+   };
+   gauss_kronrod_segment<Real, K> s;
+   s.a = a;
+   s.b = b;
+   s.depth = depth;
+   s.estimate = scale * gauss_kronrod_integrate_m1_1(rule, ff, &s.error, &s.L1);
+   s.error *= scale;
+   s.L1 *= scale;
+   return s;
+}
+
+//
+// Globally adaptive integration: the segments are kept in a heap ordered by their error estimates, and
+// on each pass the worst of them are bisected, as many as are needed to bring the total error below the
+// tolerance were their error eliminated entirely.  The integrand is evaluated on the new segments in
+// parallel.  The choice of segments depends only on the error estimates and not on the number of threads,
+// and the final sums are taken left to right, so the result is the same however many threads are used.
+//
+template <class Real, class Rule, class F>
+auto gauss_kronrod_parallel_integrate(const Rule& rule, const F& f, Real a, Real b, unsigned max_depth, Real tol, Real* error, Real* pL1, std::size_t threads)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(a)) K;
+   typedef gauss_kronrod_segment<Real, K> segment_type;
+   using std::abs;
+   auto by_error = [](const segment_type& x, const segment_type& y)
+   {
+      return (x.error < y.error) || ((x.error == y.error) && (x.a > y.a));
+   };
+   // Segments which may be bisected, as a heap, and those at the maximum depth which may not:
+   std::vector<segment_type> heap;
+   std::vector<segment_type> done;
+   std::vector<segment_type> refine;
+   std::vector<segment_type> children;
+   auto retain = [&](const segment_type& s)
+   {
+      if (s.depth < max_depth)
+      {
+         heap.push_back(s);
+         std::push_heap(heap.begin(), heap.end(), by_error);
+      }
+      else
+      {
+         done.push_back(s);
+      }
+   };
+   retain(gauss_kronrod_integrate_segment(rule, f, a, b, 0));
+   tools::detail::thread_pool pool((std::max)(threads, std::size_t(1)));
+   std::function<void(std::size_t)> bisect = [&](std::size_t i)
+   {
+      const segment_type& s = refine[i / 2];
+      Real mid = (s.a + s.b) / 2;
+      children[i] = (i & 1) ? gauss_kronrod_integrate_segment(rule, f, mid, s.b, s.depth + 1) : gauss_kronrod_integrate_segment(rule, f, s.a, mid, s.depth + 1);
+   };
+   while (!heap.empty())
+   {
+      // Recomputed on each pass rather than updated, so that no rounding error accumulates:
+      K total = K(0);
+      Real total_error = 0;
+      for (const auto& s : heap)
+      {
+         total += s.estimate;
+         total_error += s.error;
+      }
+      for (const auto& s : done)
+      {
+         total += s.estimate;
+         total_error += s.error;
+      }
+      K tmp = total * tol;
+      Real target = abs(tmp);
+      if (total_error <= target)
+      {
+         break;
+      }
+      refine.clear();
+      do
+      {
+         std::pop_heap(heap.begin(), heap.end(), by_error);
+         total_error -= heap.back().error;
+         refine.push_back(heap.back());
+         heap.pop_back();
+      } while (!heap.empty() && (total_error > target));
+      children.resize(2 * refine.size());
+      pool.parallel_for(children.size(), bisect);
+      for (const auto& s : children)
+      {
+         retain(s);
+      }
+   }
+   done.insert(done.end(), heap.begin(), heap.end());
+   std::sort(done.begin(), done.end(), [](const segment_type& x, const segment_type& y) { return x.a < y.a; });
+   K result = K(0);
+   Real total_error = 0;
+   Real L1 = 0;
+   for (const auto& s : done)
+   {
+      result += s.estimate;
+      total_error += s.error;
+      L1 += s.L1;
+   }
+   if (error)
+      *error = total_error;
+   if (pL1)
+      *pL1 = L1;
+   return result;
+}
+
+template <class Real, class Rule>
+struct gauss_kronrod_parallel_integrator
+{
+   const Rule& rule;
+   unsigned max_depth;
+   Real tol;
+   std::size_t threads;
+
+   template <class F>
+   auto operator()(const F& f, Real a, Real b, Real* error, Real* pL1) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return gauss_kronrod_parallel_integrate(rule, f, a, b, max_depth, tol, error, pL1, threads);
+   }
+};
+
+//
+// Maps infinite ranges onto [-1, 1] and hands the finite range to integrator(f, a, b, error, pL1):
+//
+template <class Real, class Policy, class F, class Integrator>
+auto gauss_kronrod_integrate_range(F f, Real a, Real b, Real* error, Real* pL1, const Integrator& integrator, const char* function)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   typedef decltype(f(a)) K;
+   if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+   {
+      // Infinite limits:
+      if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
+      {
+         auto u = [&](const Real& t)->K
+         {
+            Real t_sq = t*t;
+            Real inv = 1 / (1 - t_sq);
+            Real w = (1 + t_sq)*inv*inv;
+            Real arg = t*inv;
+            K res = f(arg)*w;
+            return res;
+         };
+         K res = integrator(u, Real(-1), Real(1), error, pL1);
+         return res;
+      }
+
+      // Right limit is infinite:
+      if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      {
+         auto u = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z + a - 1;
+            K res = f(arg)*z*z;
+            return res;
+         };
+         K Q = Real(2) * integrator(u, Real(-1), Real(1), error, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         auto v = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z - 1;
+            return f(b - arg) * z * z;
+         };
+         K Q = Real(2) * integrator(v, Real(-1), Real(1), error, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (a==b)
+         {
+            return K(0);
+         }
+         if (b < a)
+         {
+            return -integrator(f, b, a, error, pL1);
+         }
+         return integrator(f, a, b, error, pL1);
+      }
+   }
+   return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_GAUSS_INTEGRATE_HPP
@@ -0,0 +1,431 @@
+//  Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_RULE_DETAIL_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_RULE_DETAIL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/legendre_stieltjes.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/roots.hpp>
+#include <boost/math/tools/detail/thread_pool.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// P_n(cos(theta)) and its derivative with respect to theta, by Stieltjes' series
+//
+//   P_n(cos(theta)) = C_n sum_{m < M} h_m cos(a_m) / (2 sin(theta))^(m + 1/2) + R_M,
+//   a_m = (n + m + 1/2) theta - (m + 1/2) pi/2,   h_0 = 1,   h_m = h_{m-1} (m - 1/2)^2 / (m (n + m + 1/2)),
+//
+// where C_n is the scale passed in, (4/pi) prod_{j = 1}^{n} j/(j + 1/2), and |R_M| is at most 2 C_n h_M / (2 sin(theta))^(M + 1/2)
+// for 0 < theta < pi; see Szego, Orthogonal Polynomials, theorem 8.21.5, and Hale and Townsend,
+// Fast and accurate computation of Gauss-Legendre and Gauss-Jacobi quadrature nodes and weights, SIAM J. Sci. Comput. 35 (2013).
+// The terms shrink fast for large n away from the ends of the interval, so this costs O(1) rather than the O(n) of the
+// recurrence.  The terms of the derivative are larger by a factor n + m + 1/2, so the series is cut off once the bound on
+// the remainder, times (n + M + 1/2)/(n + 1/2), is below epsilon times the size of the leading term.  Returns false, leaving
+// p and dp alone, if that doesn't happen within max_terms terms, as for the few zeros within about digits/n of the ends.
+//
+template <class Real>
+bool legendre_p_stieltjes(unsigned n, const Real& theta, const Real& scale, unsigned max_terms, Real& p, Real& dp)
+{
+   using std::sin;
+   using std::cos;
+   using std::sqrt;
+   using boost::math::constants::half;
+   using boost::math::constants::quarter_pi;
+   Real s = sin(theta);
+   Real c = cos(theta);
+   Real u = 1 / (2 * s);
+   Real cot = c / s;
+   Real rho = n + half<Real>();
+   Real alpha = rho * theta - quarter_pi<Real>();
+   Real ca = cos(alpha);
+   Real sa = sin(alpha);
+   // h_m / (2 sin(theta))^(m + 1/2):
+   Real h = sqrt(u);
+   Real limit = tools::epsilon<Real>() * h / 2;
+   Real sum = 0;
+   Real dsum = 0;
+   for (unsigned m = 0; m < max_terms; ++m)
+   {
+      Real mh = m + half<Real>();
+      sum += h * ca;
+      dsum -= h * ((rho + m) * sa + mh * cot * ca);
+      Real ratio = u * mh * mh / ((m + 1) * (rho + m + 1));
+      h *= ratio;
+      if (h * (rho + m + 1) <= limit * rho)
+      {
+         p = scale * sum;
+         dp = scale * dsum;
+         return true;
+      }
+      if (ratio >= 1)
+      {
+         return false;
+      }
+      // a_{m+1} = a_m + theta - pi/2:
+      Real ca_next = ca * s + sa * c;
+      sa = sa * s - ca * c;
+      ca = ca_next;
+   }
+   return false;
+}
+
+//
+// P_n(cos(theta)) and its derivative with respect to theta by the recurrence for the differences
+//   D_{l+1} = (l D_l - (2l + 1) y P_l) / (l + 1),   P_{l+1} = P_l + D_{l+1},
+// where D_l = P_l - P_{l-1} and y = 1 - x = 2 sin^2(theta/2), which is the usual recurrence rearranged.
+// Near x = 1, where this is needed, rounding cos(theta) to x would lose about n^2 epsilon in P_n, but y is found accurately.
+//
+template <class Real>
+void legendre_p_recurrence(unsigned n, const Real& theta, Real& p, Real& dp)
+{
+   using std::sin;
+   using std::sqrt;
+   Real s = sin(theta / 2);
+   Real y = 2 * s * s;
+   Real p1 = 1 - y;
+   Real d1 = -y;
+   for (unsigned l = 1; l < n; ++l)
+   {
+      d1 = (l * d1 - (2 * l + 1) * y * p1) / (l + 1);
+      p1 += d1;
+   }
+   // (1 - x^2) P_n'(x) = n (P_{n-1}(x) - x P_n(x)), and d/dtheta = -sin(theta) d/dx:
+   p = p1;
+   // sin(theta) = 2 sin(theta/2) cos(theta/2), which saves finding another sine for multiprecision types:
+   dp = n * (d1 - y * p1) / (2 * s * sqrt(1 - s * s));
+}
+
+//
+// P_n(cos(theta)) and its derivative, by the series where that converges, and otherwise by the recurrence;
+// or, when series is false, always by the recurrence, for the zeros nearest the ends where the series is known not to converge.
+// A term of the series costs about as much as two steps of the recurrence, so the series is given up after n/2 terms.
+//
+template <class Real>
+class legendre_p_theta
+{
+public:
+   legendre_p_theta(unsigned n, bool series = true)
+      : m_n(n), m_max_terms((std::min)(unsigned(tools::digits<Real>() + 8), n / 2)), m_series(series), m_scale(1)
+   {
+      using std::sqrt;
+      using boost::math::constants::pi;
+      using boost::math::constants::half;
+      if (series)
+      {
+         m_scale = 2 / sqrt(pi<Real>()) * boost::math::tgamma_delta_ratio(Real(n + 1), half<Real>());
+      }
+   }
+   std::pair<Real, Real> operator()(const Real& theta) const
+   {
+      Real p;
+      Real dp;
+      if (!m_series || !legendre_p_stieltjes(m_n, theta, m_scale, m_max_terms, p, dp))
+      {
+         legendre_p_recurrence(m_n, theta, p, dp);
+      }
+      return std::pair<Real, Real>(p, dp);
+   }
+   bool series_converges(const Real& theta) const
+   {
+      Real p;
+      Real dp;
+      return legendre_p_stieltjes(m_n, theta, Real(1), m_max_terms, p, dp);
+   }
+private:
+   unsigned m_n;
+   unsigned m_max_terms;
+   bool m_series;
+   Real m_scale;
+};
+
+//
+// The nodes and weights of a rule, in the same form as the tables of gauss and gauss_kronrod:
+// the nonnegative abscissas in increasing order, and their weights.
+//
+template <class Real>
+struct gauss_rule_data
+{
+   std::vector<Real> abscissa;
+   std::vector<Real> weights;
+   // For a Gauss-Kronrod rule, the weights of the Gauss rule it extends, for its abscissas abscissa[gauss_start + 2i]:
+   std::vector<Real> gauss_weights;
+   std::once_flag computed;
+};
+
+//
+// The n point Gauss-Legendre rule, with its nodes as the angles theta, for the nonnegative abscissas cos(theta) in increasing order.
+// The zeros theta_k of P_n(cos(theta)) are found one at a time by Newton's method, starting from Tricomi's approximation,
+// which is within the bounds of Szego's inequalities (k - 1/4) pi / (n + 1/2) <= theta_k <= k pi / (n + 1); see legendre_p_zeros.
+// Each needs O(1) work away from the ends of the interval, and these are shared out between threads.
+//
+template <class Real>
+void gauss_legendre_theta(unsigned n, std::size_t threads, std::vector<Real>& theta, std::vector<Real>& weights)
+{
+   using std::cos;
+   using std::sin;
+   using boost::math::constants::pi;
+   using boost::math::constants::half;
+   using boost::math::constants::half_pi;
+   std::size_t size = (n + 1) / 2;
+   theta.assign(size, Real(0));
+   weights.assign(size, Real(0));
+   if (n == 0)
+   {
+      return;
+   }
+   Real rho = n + half<Real>();
+   Real correction = (1 - Real(1) / n) / (8 * Real(n) * n);
+   // Tricomi's approximation to the k th zero counted from x = 1:
+   auto approximation = [&](unsigned k, Real& lower, Real& upper) -> Real
+   {
+      lower = (k - Real(1) / 4) * pi<Real>() / rho;
+      upper = k * pi<Real>() / (n + 1);
+      Real guess = lower + correction * cos(lower) / sin(lower);
+      return (std::min)(guess, upper);
+   };
+   // The series converges more slowly closer to the ends, and not at all at the first few zeros, so rather than try it
+   // at each of those first, find the first zero it converges at by bisection:
+   legendre_p_theta<Real> recurrence(n, false);
+   unsigned first = 1;
+   unsigned last = n / 2 + 1;
+   while (first < last)
+   {
+      unsigned k = first + (last - first) / 2;
+      Real lower;
+      Real upper;
+      if (recurrence.series_converges(approximation(k, lower, upper)))
+      {
+         last = k;
+      }
+      else
+      {
+         first = k + 1;
+      }
+   }
+   legendre_p_theta<Real> series(n, first <= n / 2);
+   tools::detail::parallel_for_range(size, threads, 32, [&](std::size_t begin, std::size_t end)
+   {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+         // The zeros are counted from x = 1, and theta[i] is the size - i th:
+         unsigned k = static_cast<unsigned>(size - i);
+         const legendre_p_theta<Real>& f = (k >= first) ? series : recurrence;
+         if (2 * k == n + 1)
+         {
+            theta[i] = half_pi<Real>();
+         }
+         else
+         {
+            Real lower;
+            Real upper;
+            Real guess = approximation(k, lower, upper);
+            boost::uintmax_t iterations = policies::get_max_root_iterations<policies::policy<> >();
+            theta[i] = tools::newton_raphson_iterate(f, guess, lower, upper, tools::digits<Real>(), iterations);
+         }
+         Real dp = f(theta[i]).second;
+         weights[i] = 2 / (dp * dp);
+      }
+   });
+}
+
+//
+// The same, with the abscissas cos(theta):
+//
+template <class Real>
+void gauss_legendre_rule(unsigned n, std::size_t threads, std::vector<Real>& abscissa, std::vector<Real>& weights)
+{
+   using std::cos;
+   gauss_legendre_theta(n, threads, abscissa, weights);
+   for (std::size_t i = 0; i < abscissa.size(); ++i)
+   {
+      // The middle zero, for n odd, is exactly zero:
+      abscissa[i] = (2 * (abscissa.size() - i) == n + 1) ? Real(0) : Real(cos(abscissa[i]));
+   }
+}
+
+//
+// P_n(cos(theta)) and the Legendre-Stieltjes polynomial E_{n+1}(cos(theta)), with their derivatives with respect to theta,
+// by summing the Legendre expansion of E_{n+1} as P_0, ..., P_{n+1} are found by legendre_p_recurrence's recurrence.
+// The Gauss-Kronrod weights are sensitive to the nodes near the ends of the interval, and this finds them for the node
+// theta itself, rather than for cos(theta) rounded to Real.
+//
+template <class Real>
+class legendre_stieltjes_theta
+{
+public:
+   legendre_stieltjes_theta(unsigned n)
+      : m_n(n), m_a(boost::math::detail::legendre_stieltjes_coefficients<Real>(n + 1))
+   {
+   }
+   void operator()(const Real& theta, Real& p, Real& dp, Real& e, Real& de) const
+   {
+      using std::sin;
+      using std::sqrt;
+      Real s = sin(theta / 2);
+      Real y = 2 * s * s;
+      Real p1 = 1;
+      Real d1 = 0;
+      p = 0;
+      dp = 0;
+      e = 0;
+      de = 0;
+      // E_{n+1} has terms of degree n + 1, n - 1, ..., and a_i multiplies the term of degree 2i - 1 or 2i - 2:
+      unsigned parity = (m_n + 1) & 1;
+      for (unsigned l = 0; ; ++l)
+      {
+         // d/dtheta P_l(cos(theta)) sin(theta) = l (D_l - y P_l):
+         Real dl = l * (d1 - y * p1);
+         if ((l & 1) == parity)
+         {
+            const Real& a = m_a[(l + 2 - parity) / 2];
+            e += a * p1;
+            de += a * dl;
+         }
+         if (l == m_n)
+         {
+            p = p1;
+            dp = dl;
+         }
+         if (l == m_n + 1)
+         {
+            break;
+         }
+         d1 = (l * d1 - (2 * l + 1) * y * p1) / (l + 1);
+         p1 += d1;
+      }
+      Real sin_theta = 2 * s * sqrt(1 - s * s);
+      dp /= sin_theta;
+      de /= sin_theta;
+   }
+private:
+   unsigned m_n;
+   std::vector<Real> m_a;
+};
+
+//
+// The points = 2n + 1 point Gauss-Kronrod rule, as gauss_kronrod_detail computes it: the n Gauss nodes are
+// interlaced with the zeros of the Legendre-Stieltjes polynomial E_{n+1}, one in each gap between them, and
+// one between the last and 1.  Each of these is found by safeguarded Newton iteration in theta within its gap,
+// which costs O(n) for each evaluation of E_{n+1}, but the gaps are independent and are shared out between threads.
+//
+template <class Real>
+void gauss_kronrod_rule(unsigned points, std::size_t threads, std::vector<Real>& abscissa, std::vector<Real>& weights, std::vector<Real>& gauss_weights)
+{
+   using std::cos;
+   using std::sin;
+   using boost::math::constants::half_pi;
+   unsigned n = (points - 1) / 2;
+   std::vector<Real> gauss_theta;
+   gauss_legendre_theta(n, threads, gauss_theta, gauss_weights);
+   legendre_stieltjes_theta<Real> f(n);
+   std::size_t size = n + 1;
+   std::size_t gauss_start = (n & 1) ? 0 : 1;
+   std::vector<Real> theta(size, half_pi<Real>());
+   for (std::size_t j = 0; j < gauss_theta.size(); ++j)
+   {
+      theta[gauss_start + 2 * j] = gauss_theta[j];
+   }
+   abscissa.assign(size, Real(0));
+   weights.assign(size, Real(0));
+   tools::detail::parallel_for_range(size, threads, 32, [&](std::size_t begin, std::size_t end)
+   {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+         bool gauss = (i & 1) == gauss_start;
+         Real t = theta[i];
+         // E_{n+1} is odd for n even, and then its zero at x = 0 is abscissa[0]:
+         if (!gauss && i != 0)
+         {
+            Real upper = theta[i - 1];
+            Real lower = (i + 1 < size) ? theta[i + 1] : Real(0);
+            auto g = [&](const Real& u)
+            {
+               Real p, dp, e, de;
+               f(u, p, dp, e, de);
+               return std::pair<Real, Real>(e, de);
+            };
+            boost::uintmax_t iterations = policies::get_max_root_iterations<policies::policy<> >();
+            t = tools::newton_raphson_iterate(g, (lower + upper) / 2, lower, upper, tools::digits<Real>(), iterations);
+            abscissa[i] = cos(t);
+         }
+         else if (i != 0)
+         {
+            abscissa[i] = cos(t);
+         }
+         Real p, dp, e, de;
+         f(t, p, dp, e, de);
+         // With P_n'(x) = -dp / sin(theta) and E_{n+1}'(x) = -de / sin(theta):
+         Real q = -2 * sin(t) / (n + 1);
+         weights[i] = gauss ? Real(gauss_weights[i / 2] + q / (dp * e)) : Real(q / (p * de));
+      }
+   });
+}
+
+//
+// Computes the rule in the evaluation type for Real, which is double for float, so that the result is accurate to the last bit:
+//
+template <class Real>
+void compute_gauss_rule(unsigned points, bool kronrod, std::size_t threads, gauss_rule_data<Real>& data)
+{
+   typedef typename policies::evaluation<Real, policies::policy<> >::type working_type;
+   std::vector<working_type> abscissa;
+   std::vector<working_type> weights;
+   std::vector<working_type> gauss_weights;
+   if (kronrod)
+   {
+      gauss_kronrod_rule(points, threads, abscissa, weights, gauss_weights);
+   }
+   else
+   {
+      gauss_legendre_rule(points, threads, abscissa, weights);
+   }
+   data.abscissa.assign(abscissa.begin(), abscissa.end());
+   data.weights.assign(weights.begin(), weights.end());
+   data.gauss_weights.assign(gauss_weights.begin(), gauss_weights.end());
+}
+
+//
+// The rules already computed, for each type Real, keyed by the number of points and whether they're Gauss-Kronrod.
+// Different rules may be computed at the same time, but each is only computed once, by whichever thread asks first.
+//
+template <class Real>
+std::shared_ptr<const gauss_rule_data<Real> > gauss_rule_cache(unsigned points, bool kronrod, std::size_t threads)
+{
+   static std::mutex mutex;
+   static std::map<std::pair<unsigned, bool>, std::shared_ptr<gauss_rule_data<Real> > > rules;
+   std::shared_ptr<gauss_rule_data<Real> > data;
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      std::shared_ptr<gauss_rule_data<Real> >& entry = rules[std::make_pair(points, kronrod)];
+      if (!entry)
+      {
+         entry = std::make_shared<gauss_rule_data<Real> >();
+      }
+      data = entry;
+   }
+   std::call_once(data->computed, [&]
+   {
+      compute_gauss_rule(points, kronrod, threads, *data);
+   });
+   return data;
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_GAUSS_RULE_DETAIL_HPP
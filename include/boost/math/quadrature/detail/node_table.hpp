@@ -0,0 +1,339 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_NODE_TABLE_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_NODE_TABLE_HPP
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/tools/precision.hpp>
+#ifdef BOOST_HAS_UNISTD_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Binary files holding the abscissas and weights of the double exponential quadratures,
+// so that a process can load tables which another process has computed.
+//
+// The file starts with a header identifying the quadrature and the floating point type,
+// followed by the integer and floating point parameters of the quadrature, a directory of
+// the rows, and finally the rows themselves, each being its abscissas followed by its weights.
+// Each floating point value is stored exactly as a sign word, an exponent word, and as many
+// 32 bit words of its significand as the precision of the type requires, so that any type
+// supporting frexp and ldexp can be stored, including the multiprecision types.
+//
+// On platforms with mmap the file is mapped read only, so that the processes reading
+// the same file share one copy of it, and each row is decoded the first time it is needed.
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+enum class node_table_kind : std::uint32_t { tanh_sinh = 1, exp_sinh = 2, sinh_sinh = 3 };
+
+// A read only view of the contents of a file:
+class mapped_file
+{
+public:
+    explicit mapped_file(const std::string& path) : m_data{nullptr}, m_size{0}
+    {
+#ifdef BOOST_HAS_UNISTD_H
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unable to open quadrature node table " + path));
+        }
+        struct stat s;
+        if (::fstat(fd, &s) != 0)
+        {
+            ::close(fd);
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unable to read quadrature node table " + path));
+        }
+        m_size = static_cast<std::size_t>(s.st_size);
+        if (m_size)
+        {
+            void* p = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED)
+            {
+                BOOST_THROW_EXCEPTION(std::runtime_error("Unable to map quadrature node table " + path));
+            }
+            m_data = static_cast<const unsigned char*>(p);
+        }
+        else
+        {
+            ::close(fd);
+        }
+#else
+        std::ifstream is(path.c_str(), std::ios_base::binary);
+        if (!is)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unable to open quadrature node table " + path));
+        }
+        is.seekg(0, std::ios_base::end);
+        m_buffer.resize(static_cast<std::size_t>(is.tellg()));
+        is.seekg(0, std::ios_base::beg);
+        is.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size());
+        if (!is)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unable to read quadrature node table " + path));
+        }
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file()
+    {
+#ifdef BOOST_HAS_UNISTD_H
+        if (m_data)
+        {
+            ::munmap(const_cast<unsigned char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    const unsigned char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    const unsigned char* m_data;
+    std::size_t m_size;
+#ifndef BOOST_HAS_UNISTD_H
+    std::vector<unsigned char> m_buffer;
+#endif
+};
+
+static const char node_table_magic[8] = {'B', 'M', 'Q', 'N', 'O', 'D', 'E', 'S'};
+static const std::uint32_t node_table_version = 1;
+static const std::uint32_t node_table_byte_order = 0x01020304;
+
+// The number of 32 bit words used to store the significand of a Real:
+template<class Real>
+inline std::size_t node_table_significand_words()
+{
+    return static_cast<std::size_t>(boost::math::tools::digits<Real>() + 31) / 32;
+}
+
+template<class Real>
+void encode_node_value(const Real& x, std::uint32_t* words, std::size_t significand_words)
+{
+    using std::fabs;
+    using std::floor;
+    using std::frexp;
+    using std::ldexp;
+    if (!(boost::math::isfinite)(x))
+    {
+        BOOST_THROW_EXCEPTION(std::domain_error("Quadrature node tables can only hold finite values."));
+    }
+    int e = 0;
+    Real m = frexp(fabs(x), &e);
+    words[0] = (boost::math::signbit)(x) ? 1u : 0u;
+    std::int32_t exponent = e;
+    std::memcpy(words + 1, &exponent, sizeof(exponent));
+    for (std::size_t k = 0; k < significand_words; ++k)
+    {
+        m = ldexp(m, 32);
+        Real digit = floor(m);
+        words[2 + k] = static_cast<std::uint32_t>(boost::math::lltrunc(digit));
+        m -= digit;
+    }
+}
+
+// Every partial sum is a leading part of the significand, so the decoding is exact:
+template<class Real>
+Real decode_node_value(const std::uint32_t* words, std::size_t significand_words)
+{
+    using std::ldexp;
+    Real m = 0;
+    for (std::size_t k = significand_words; k-- > 0;)
+    {
+        m = ldexp(m + Real(words[2 + k]), -32);
+    }
+    std::int32_t exponent;
+    std::memcpy(&exponent, words + 1, sizeof(exponent));
+    Real x = ldexp(m, exponent);
+    return words[0] ? Real(-x) : x;
+}
+
+// Writes rows [0, rows) of the abscissas and weights, together with the parameters of the
+// quadrature, and the tag of each row (which the quadratures are free to use as they like):
+template<class Real>
+void save_node_table(const std::string& path, node_table_kind kind,
+                     std::vector<std::uint64_t> const & parameters,
+                     std::vector<Real> const & scalars,
+                     std::vector<std::vector<Real>> const & abscissas,
+                     std::vector<std::vector<Real>> const & weights,
+                     std::vector<std::uint64_t> const & tags,
+                     std::size_t rows)
+{
+    std::size_t const significand_words = node_table_significand_words<Real>();
+    std::size_t const value_words = significand_words + 2;
+    std::vector<std::uint32_t> header(6);
+    header[0] = node_table_version;
+    header[1] = static_cast<std::uint32_t>(kind);
+    header[2] = static_cast<std::uint32_t>(boost::math::tools::digits<Real>());
+    std::int32_t max_exponent = std::numeric_limits<Real>::max_exponent;
+    std::memcpy(&header[3], &max_exponent, sizeof(max_exponent));
+    header[4] = static_cast<std::uint32_t>(significand_words);
+    header[5] = node_table_byte_order;
+    std::vector<std::uint64_t> counts{parameters.size(), scalars.size(), rows};
+    std::vector<std::uint64_t> directory;
+    std::vector<std::uint32_t> values((scalars.size()) * value_words);
+    for (std::size_t i = 0; i < scalars.size(); ++i)
+    {
+        encode_node_value(scalars[i], &values[i * value_words], significand_words);
+    }
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        BOOST_ASSERT(abscissas[row].size() == weights[row].size());
+        directory.push_back(tags[row]);
+        directory.push_back(abscissas[row].size());
+        std::size_t offset = values.size();
+        values.resize(offset + 2 * abscissas[row].size() * value_words);
+        for (std::size_t i = 0; i < abscissas[row].size(); ++i)
+        {
+            encode_node_value(abscissas[row][i], &values[offset + i * value_words], significand_words);
+        }
+        offset += abscissas[row].size() * value_words;
+        for (std::size_t i = 0; i < weights[row].size(); ++i)
+        {
+            encode_node_value(weights[row][i], &values[offset + i * value_words], significand_words);
+        }
+    }
+    std::ofstream os(path.c_str(), std::ios_base::binary | std::ios_base::trunc);
+    os.write(node_table_magic, sizeof(node_table_magic));
+    os.write(reinterpret_cast<const char*>(header.data()), header.size() * sizeof(header[0]));
+    os.write(reinterpret_cast<const char*>(counts.data()), counts.size() * sizeof(counts[0]));
+    os.write(reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(parameters[0]));
+    os.write(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(directory[0]));
+    os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(values[0]));
+    os.close();
+    if (!os)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("Unable to write quadrature node table " + path));
+    }
+}
+
+// A table written by save_node_table, checked against the quadrature and the type reading it:
+template<class Real>
+class node_table
+{
+public:
+    node_table(const std::string& path, node_table_kind kind) : m_file(path)
+    {
+        const char* bad = "Not a quadrature node table: ";
+        const unsigned char* p = m_file.data();
+        std::size_t const header_size = sizeof(node_table_magic) + 6 * sizeof(std::uint32_t) + 3 * sizeof(std::uint64_t);
+        if (m_file.size() < header_size || std::memcmp(p, node_table_magic, sizeof(node_table_magic)) != 0)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error(bad + path));
+        }
+        p += sizeof(node_table_magic);
+        std::uint32_t header[6];
+        std::memcpy(header, p, sizeof(header));
+        p += sizeof(header);
+        if (header[5] != node_table_byte_order || header[0] != node_table_version)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("The quadrature node table " + path + " was written by an incompatible platform or version."));
+        }
+        if (header[1] != static_cast<std::uint32_t>(kind))
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("The quadrature node table " + path + " belongs to a different quadrature."));
+        }
+        std::int32_t max_exponent;
+        std::memcpy(&max_exponent, &header[3], sizeof(max_exponent));
+        m_significand_words = node_table_significand_words<Real>();
+        if (header[2] != static_cast<std::uint32_t>(boost::math::tools::digits<Real>()) || max_exponent != std::numeric_limits<Real>::max_exponent || header[4] != m_significand_words)
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error("The quadrature node table " + path + " was written for a different floating point type."));
+        }
+        std::uint64_t counts[3];
+        std::memcpy(counts, p, sizeof(counts));
+        p += sizeof(counts);
+        std::size_t const value_bytes = (m_significand_words + 2) * sizeof(std::uint32_t);
+        std::size_t const end = m_file.size();
+        auto remaining = [&]() { return end - static_cast<std::size_t>(p - m_file.data()); };
+        if (remaining() / sizeof(std::uint64_t) < counts[0] + 2 * counts[2])
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error(bad + path));
+        }
+        m_parameters.resize(counts[0]);
+        std::memcpy(m_parameters.data(), p, counts[0] * sizeof(std::uint64_t));
+        p += counts[0] * sizeof(std::uint64_t);
+        std::vector<std::uint64_t> directory(2 * counts[2]);
+        std::memcpy(directory.data(), p, directory.size() * sizeof(std::uint64_t));
+        p += directory.size() * sizeof(std::uint64_t);
+        if (remaining() / value_bytes < counts[1])
+        {
+            BOOST_THROW_EXCEPTION(std::runtime_error(bad + path));
+        }
+        std::vector<std::uint32_t> words(m_significand_words + 2);
+        for (std::uint64_t i = 0; i < counts[1]; ++i)
+        {
+            std::memcpy(words.data(), p, value_bytes);
+            m_scalars.push_back(decode_node_value<Real>(words.data(), m_significand_words));
+            p += value_bytes;
+        }
+        for (std::uint64_t row = 0; row < counts[2]; ++row)
+        {
+            std::uint64_t length = directory[2 * row + 1];
+            if (remaining() / value_bytes / 2 < length)
+            {
+                BOOST_THROW_EXCEPTION(std::runtime_error(bad + path));
+            }
+            m_tags.push_back(directory[2 * row]);
+            m_lengths.push_back(static_cast<std::size_t>(length));
+            m_offsets.push_back(static_cast<std::size_t>(p - m_file.data()));
+            p += 2 * length * value_bytes;
+        }
+    }
+
+    std::vector<std::uint64_t> const & parameters() const { return m_parameters; }
+    std::vector<Real> const & scalars() const { return m_scalars; }
+    std::size_t rows() const { return m_lengths.size(); }
+    std::uint64_t tag(std::size_t row) const { return m_tags[row]; }
+
+    void read_row(std::size_t row, std::vector<Real>& abscissas, std::vector<Real>& weights) const
+    {
+        std::size_t const value_words = m_significand_words + 2;
+        std::size_t const n = m_lengths[row];
+        std::vector<std::uint32_t> words(2 * n * value_words);
+        std::memcpy(words.data(), m_file.data() + m_offsets[row], words.size() * sizeof(std::uint32_t));
+        abscissas.resize(n);
+        weights.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            abscissas[i] = decode_node_value<Real>(&words[i * value_words], m_significand_words);
+            weights[i] = decode_node_value<Real>(&words[(n + i) * value_words], m_significand_words);
+        }
+    }
+
+private:
+    mapped_file m_file;
+    std::size_t m_significand_words;
+    std::vector<std::uint64_t> m_parameters;
+    std::vector<Real> m_scalars;
+    std::vector<std::uint64_t> m_tags;
+    std::vector<std::size_t> m_lengths;
+    std::vector<std::size_t> m_offsets;
+};
+
+}}}}
+#endif
@@ -8,12 +8,14 @@
 #define BOOST_MATH_QUADRATURE_DETAIL_SINH_SINH_DETAIL_HPP
 
 #include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/quadrature/detail/node_table.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 
@@ -41,6 +43,9 @@ class sinh_sinh_detail
       0;
 public:
     sinh_sinh_detail(size_t max_refinements);
+    explicit sinh_sinh_detail(const std::string& table_file);
+
+    void save_tables(const std::string& table_file, std::size_t levels) const;
 
     template<class F>
     auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const;
@@ -105,6 +110,11 @@ private:
       using constants::half_pi;
 
       std::size_t row = ++m_committed_refinements;
+      if (m_table && (row < m_table->rows()))
+      {
+         m_table->read_row(row, m_abscissas[row], m_weights[row]);
+         return;
+      }
 
       Real h = ldexp(Real(1), -static_cast<int>(row));
       size_t k = (size_t)boost::math::lltrunc(ceil(m_t_max / (2 * h)));
@@ -133,8 +143,46 @@ private:
 #else
    mutable unsigned                  m_committed_refinements;
 #endif
+   // Rows loaded from a file by the second constructor:
+   std::shared_ptr<const node_table<Real>> m_table;
 };
 
+template<class Real, class Policy>
+sinh_sinh_detail<Real, Policy>::sinh_sinh_detail(const std::string& table_file)
+   : m_table(std::make_shared<node_table<Real>>(table_file, node_table_kind::sinh_sinh))
+{
+   if ((m_table->parameters().size() != 1) || (m_table->scalars().size() != 1) || (m_table->rows() < 2) || (m_table->rows() > m_table->parameters()[0]))
+      BOOST_THROW_EXCEPTION(std::runtime_error("Not a valid sinh_sinh node table: " + table_file));
+   m_max_refinements = static_cast<std::size_t>(m_table->parameters()[0]);
+   m_t_max = m_table->scalars()[0];
+   m_abscissas.assign(m_max_refinements, std::vector<Real>());
+   m_weights.assign(m_max_refinements, std::vector<Real>());
+   //
+   // integrate() uses the first two rows directly, the others are read when extend_refinements asks for them:
+   //
+   for (std::size_t row = 0; row < 2; ++row)
+      m_table->read_row(row, m_abscissas[row], m_weights[row]);
+   m_committed_refinements = 1;
+}
+
+template<class Real, class Policy>
+void sinh_sinh_detail<Real, Policy>::save_tables(const std::string& table_file, std::size_t levels) const
+{
+   for (std::size_t row = 1; row <= (std::min)(levels, m_abscissas.size() - 1); ++row)
+      get_abscissa_row(row);
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   // Don't write a row which another thread is still filling in:
+   boost::detail::lightweight_mutex::scoped_lock guard(m_mutex);
+   std::size_t rows = m_committed_refinements.load() + 1;
+#else
+   std::size_t rows = m_committed_refinements + 1;
+#endif
+   std::vector<std::uint64_t> parameters{m_max_refinements};
+   std::vector<Real> scalars{m_t_max};
+   std::vector<std::uint64_t> tags(rows, 0);
+   save_node_table(table_file, node_table_kind::sinh_sinh, parameters, scalars, m_abscissas, m_weights, tags, rows);
+}
+
 template<class Real, class Policy>
 sinh_sinh_detail<Real, Policy>::sinh_sinh_detail(size_t max_refinements)
    : m_abscissas(max_refinements), m_weights(max_refinements), m_max_refinements(max_refinements)
@@ -0,0 +1,210 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_SOBOL_SEQUENCE_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_SOBOL_SEQUENCE_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+// x^k mod p over GF(2), where p has degree deg:
+inline uint64_t gf2_power_of_x(uint64_t k, uint64_t p, unsigned deg)
+{
+    auto multiply = [&](uint64_t a, uint64_t b)
+    {
+        uint64_t r = 0;
+        while (b)
+        {
+            if (b & 1)
+            {
+                r ^= a;
+            }
+            b >>= 1;
+            a <<= 1;
+            if ((a >> deg) & 1)
+            {
+                a ^= p;
+            }
+        }
+        return r;
+    };
+    uint64_t result = 1;
+    uint64_t base = (deg == 1) ? 1 : 2;
+    while (k)
+    {
+        if (k & 1)
+        {
+            result = multiply(result, base);
+        }
+        base = multiply(base, base);
+        k >>= 1;
+    }
+    return result;
+}
+
+// A polynomial over GF(2) of degree deg is primitive if x has order 2^deg - 1 modulo it.
+inline bool is_primitive_gf2_polynomial(uint64_t p, unsigned deg)
+{
+    uint64_t order = (uint64_t(1) << deg) - 1;
+    if (gf2_power_of_x(order, p, deg) != 1)
+    {
+        return false;
+    }
+    uint64_t n = order;
+    for (uint64_t q = 2; q*q <= n; ++q)
+    {
+        if (n % q == 0)
+        {
+            if (gf2_power_of_x(order/q, p, deg) == 1)
+            {
+                return false;
+            }
+            while (n % q == 0)
+            {
+                n /= q;
+            }
+        }
+    }
+    return n == 1 || gf2_power_of_x(order/n, p, deg) != 1;
+}
+
+// The direction numbers v_1, ..., v_bits of dimensions 0, ..., dimension - 1 of the Sobol' sequence,
+// as 64 bit binary fractions, so that the kth point in Gray code order is the xor of the v_j
+// for which bit j - 1 of k^(k>>1) is set.
+// The primitive polynomials are taken in order of increasing degree, and the initial direction numbers
+// of the first 21 dimensions are those of
+// S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections",
+// SIAM J. Sci. Comput. 30, 2635-2654 (2008), https://web.maths.unsw.edu.au/~fkuo/sobol/
+// Beyond that they are chosen pseudo-randomly, which gives a valid, but less uniform, sequence.
+inline std::vector<std::vector<uint64_t>> sobol_direction_numbers(std::size_t dimension, unsigned bits = 32)
+{
+    static const unsigned tabulated[][8] = {
+        {1}, {1, 3}, {1, 3, 1}, {1, 1, 1}, {1, 1, 3, 3}, {1, 3, 5, 13}, {1, 1, 5, 5, 17},
+        {1, 1, 5, 5, 5}, {1, 1, 7, 11, 19}, {1, 1, 5, 1, 1}, {1, 1, 1, 3, 11}, {1, 3, 5, 5, 31},
+        {1, 3, 3, 9, 7, 49}, {1, 1, 1, 15, 21, 21}, {1, 3, 1, 13, 27, 49}, {1, 1, 1, 15, 7, 5},
+        {1, 3, 1, 15, 13, 25}, {1, 1, 5, 5, 19, 61}, {1, 3, 7, 11, 23, 15, 103}, {1, 3, 7, 13, 13, 15, 69}
+    };
+    std::vector<std::vector<uint64_t>> v(dimension, std::vector<uint64_t>(bits));
+    if (dimension == 0)
+    {
+        return v;
+    }
+    // The first dimension is the van der Corput sequence:
+    for (unsigned k = 0; k < bits; ++k)
+    {
+        v[0][k] = uint64_t(1) << (63 - k);
+    }
+    std::mt19937_64 gen(1);
+    unsigned deg = 1;
+    uint64_t a = 0;
+    for (std::size_t j = 1; j < dimension; ++j)
+    {
+        // The next primitive polynomial x^deg + a_1 x^(deg-1) + ... + a_(deg-1) x + 1, a holding the a_i:
+        while (!is_primitive_gf2_polynomial((uint64_t(1) << deg) | (a << 1) | 1, deg))
+        {
+            if (++a == (uint64_t(1) << (deg - 1)))
+            {
+                ++deg;
+                a = 0;
+            }
+        }
+        std::vector<uint64_t> m(bits);
+        for (unsigned k = 0; k < deg && k < bits; ++k)
+        {
+            if (j - 1 < sizeof(tabulated)/sizeof(tabulated[0]))
+            {
+                m[k] = tabulated[j - 1][k];
+            }
+            else
+            {
+                m[k] = (gen() % (uint64_t(1) << (k + 1))) | 1;
+            }
+        }
+        for (unsigned k = deg; k < bits; ++k)
+        {
+            m[k] = m[k - deg] ^ (m[k - deg] << deg);
+            for (unsigned i = 1; i < deg; ++i)
+            {
+                if ((a >> (deg - 1 - i)) & 1)
+                {
+                    m[k] ^= m[k - i] << i;
+                }
+            }
+        }
+        for (unsigned k = 0; k < bits; ++k)
+        {
+            v[j][k] = m[k] << (63 - k);
+        }
+        if (++a == (uint64_t(1) << (deg - 1)))
+        {
+            ++deg;
+            a = 0;
+        }
+    }
+    return v;
+}
+
+inline bool parity(uint64_t x)
+{
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+}
+
+// Matousek's linear matrix scrambling: multiplies the digits of each direction number by a random
+// lower triangular matrix with unit diagonal, so that each digit of a point is flipped according to
+// the digits above it.  Followed by a random digital shift the points are uniformly distributed,
+// and the first 2^m of them still form a (t, m, s)-net.
+template<class RandomNumberGenerator>
+void scramble_direction_numbers(std::vector<std::vector<uint64_t>> & v, RandomNumberGenerator & gen)
+{
+    std::uniform_int_distribution<uint64_t> dis;
+    for (auto & vj : v)
+    {
+        uint64_t L[64];
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            // Row i acts on digits 0, ..., i, digit 0 being the most significant:
+            uint64_t above = (i == 0) ? 0 : (~uint64_t(0) << (64 - i));
+            L[i] = (dis(gen) & above) | (uint64_t(1) << (63 - i));
+        }
+        for (auto & d : vj)
+        {
+            uint64_t scrambled = 0;
+            for (unsigned i = 0; i < 64; ++i)
+            {
+                if (parity(L[i] & d))
+                {
+                    scrambled |= uint64_t(1) << (63 - i);
+                }
+            }
+            d = scrambled;
+        }
+    }
+}
+
+// The coordinate in (0, 1) of a point whose binary digits are word: the leading digits - 1 bits of word,
+// offset by half a unit in their last place.  (k + 1/2)*2^-bits then needs bits + 1 significant bits, so is exact,
+// and is at most 1 - 2^-(bits + 1) < 1 even when every bit of word is set.
+template<class Real>
+Real sobol_coordinate(uint64_t word)
+{
+    using std::ldexp;
+    int const bits = (std::min)(std::numeric_limits<Real>::digits - 1, 64);
+    return ldexp(static_cast<Real>(word >> (64 - bits)) + Real(0.5), -bits);
+}
+
+}}}}
+#endif
@@ -8,12 +8,15 @@
 #define BOOST_MATH_QUADRATURE_DETAIL_TANH_SINH_DETAIL_HPP
 
 #include <cmath>
+#include <memory>
+#include <string>
 #include <vector>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/next.hpp>
+#include <boost/math/quadrature/detail/node_table.hpp>
 
 namespace boost{ namespace math{ namespace quadrature { namespace detail{
 
@@ -43,6 +46,9 @@ public:
        typedef boost::integral_constant<int, initializer_selector> tag_type;
        init(min_complement, tag_type());
     }
+    explicit tanh_sinh_detail(const std::string& table_file);
+
+    void save_tables(const std::string& table_file, std::size_t levels) const;
 
     template<class F>
     decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const;
@@ -120,6 +126,12 @@ private:
 #else
       std::size_t row = m_committed_refinements;
 #endif
+      if (m_table && (row < m_table->rows()))
+      {
+         m_table->read_row(row, m_abscissas[row], m_weights[row]);
+         m_first_complements[row] = static_cast<std::size_t>(m_table->tag(row));
+         return;
+      }
       Real h = ldexp(Real(1), -static_cast<int>(row));
       std::size_t first_complement = 0;
       std::size_t n = boost::math::itrunc(ceil((m_t_max - h) / (2 * h)));
@@ -177,8 +189,49 @@ private:
    mutable unsigned                  m_committed_refinements;
 #endif
    Real m_t_max, m_t_crossover;
+   // Rows loaded from a file by the second constructor:
+   std::shared_ptr<const node_table<Real>> m_table;
 };
 
+template<class Real, class Policy>
+tanh_sinh_detail<Real, Policy>::tanh_sinh_detail(const std::string& table_file)
+   : m_table(std::make_shared<node_table<Real>>(table_file, node_table_kind::tanh_sinh))
+{
+   if ((m_table->parameters().size() != 2) || (m_table->scalars().size() != 2) || (m_table->rows() == 0) || (m_table->rows() > m_table->parameters()[0] + 1))
+      BOOST_THROW_EXCEPTION(std::runtime_error("Not a valid tanh_sinh node table: " + table_file));
+   m_max_refinements = static_cast<std::size_t>(m_table->parameters()[0]);
+   m_inital_row_length = static_cast<std::size_t>(m_table->parameters()[1]);
+   m_t_max = m_table->scalars()[0];
+   m_t_crossover = m_table->scalars()[1];
+   m_abscissas.assign(m_max_refinements + 1, std::vector<Real>());
+   m_weights.assign(m_max_refinements + 1, std::vector<Real>());
+   m_first_complements.assign(m_max_refinements + 1, 0);
+   //
+   // Only the first row is needed up front, the others are read when extend_refinements asks for them:
+   //
+   m_table->read_row(0, m_abscissas[0], m_weights[0]);
+   m_first_complements[0] = static_cast<std::size_t>(m_table->tag(0));
+   m_committed_refinements = 0;
+}
+
+template<class Real, class Policy>
+void tanh_sinh_detail<Real, Policy>::save_tables(const std::string& table_file, std::size_t levels) const
+{
+   for (std::size_t row = 1; row <= (std::min)(levels, m_max_refinements); ++row)
+      get_abscissa_row(row);
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   // Don't write a row which another thread is still filling in:
+   boost::detail::lightweight_mutex::scoped_lock guard(m_mutex);
+   std::size_t rows = m_committed_refinements.load() + 1;
+#else
+   std::size_t rows = m_committed_refinements + 1;
+#endif
+   std::vector<std::uint64_t> parameters{m_max_refinements, m_inital_row_length};
+   std::vector<Real> scalars{m_t_max, m_t_crossover};
+   std::vector<std::uint64_t> tags(m_first_complements.begin(), m_first_complements.end());
+   save_node_table(table_file, node_table_kind::tanh_sinh, parameters, scalars, m_abscissas, m_weights, tags, rows);
+}
+
 template<class Real, class Policy>
 template<class F>
 decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sinh_detail<Real, Policy>::integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
@@ -13,6 +13,7 @@
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/detail/gauss_integrate.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -1170,119 +1171,26 @@ template <class Real, unsigned N, class Policy = boost::math::policies::policy<>
 class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value>
 {
    typedef detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value> base;
+
+   // The nodes, as detail::gauss_integrate expects them:
+   struct nodes
+   {
+      static unsigned points() { return N; }
+      static decltype(base::abscissa()) abscissa() { return base::abscissa(); }
+      static decltype(base::weights()) weights() { return base::weights(); }
+   };
 public:
 
    template <class F>
    static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
    {
-     // In many math texts, K represents the field of real or complex numbers.
-     // Too bad we can't put blackboard bold into C++ source!
-      typedef decltype(f(Real(0))) K;
-      using std::abs;
-      unsigned non_zero_start = 1;
-      K result = Real(0);
-      if (N & 1) {
-         result = f(Real(0)) * base::weights()[0];
-      }
-      else {
-         result = 0;
-         non_zero_start = 0;
-      }
-      Real L1 = abs(result);
-      for (unsigned i = non_zero_start; i < base::abscissa().size(); ++i)
-      {
-         K fp = f(base::abscissa()[i]);
-         K fm = f(-base::abscissa()[i]);
-         result += (fp + fm) * base::weights()[i];
-         L1 += (abs(fp) + abs(fm)) *  base::weights()[i];
-      }
-      if (pL1)
-         *pL1 = L1;
-      return result;
+      return detail::gauss_integrate_m1_1(nodes(), f, pL1);
    }
    template <class F>
    static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
    {
-      typedef decltype(f(a)) K;
       static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
-      {
-         // Infinite limits:
-         Real min_inf = -tools::max_value<Real>();
-         if ((a <= min_inf) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               K res = f(t*inv)*(1 + t_sq)*inv*inv;
-               return res;
-            };
-            return integrate(u, pL1);
-         }
-
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            K Q = Real(2) * integrate(u, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
-
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
-         {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               K res = f(b - arg) * z * z;
-               return res;
-            };
-            K Q = Real(2) * integrate(v, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
-
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
-         {
-            if (a == b)
-            {
-               return K(0);
-            }
-            if (b < a)
-            {
-               return -integrate(f, b, a, pL1);
-            }
-            Real avg = (a + b)*constants::half<Real>();
-            Real scale = (b - a)*constants::half<Real>();
-
-            auto u = [&](Real z)->K
-            {
-               return f(avg + scale*z);
-            };
-            K Q = scale*integrate(u, pL1);
-
-            if (pL1)
-            {
-               *pL1 *= scale;
-            }
-            return Q;
-         }
-      }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+      return detail::gauss_integrate<Real, Policy>(nodes(), f, a, b, pL1, function);
    }
 };
 
@@ -13,10 +13,13 @@
 #pragma warning(disable: 4127)
 #endif
 
+#include <cstddef>
+#include <thread>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/special_functions/legendre_stieltjes.hpp>
 #include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/detail/gauss_integrate.hpp>
 
 namespace boost { namespace math{ namespace quadrature{ namespace detail{
 
@@ -1771,175 +1774,38 @@ class gauss_kronrod : public detail::gauss_kronrod_detail<Real, N, detail::gauss
 public:
   typedef Real value_type;
 private:
-   template <class F>
-   static auto integrate_non_adaptive_m1_1(F f, Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   // The nodes, as detail::gauss_integrate expects them:
+   struct nodes
    {
-      typedef decltype(f(Real(0))) K;
-      using std::abs;
-      unsigned gauss_start = 2;
-      unsigned kronrod_start = 1;
-      unsigned gauss_order = (N - 1) / 2;
-      K kronrod_result = 0;
-      K gauss_result = 0;
-      K fp, fm;
-      if (gauss_order & 1)
-      {
-         fp = f(value_type(0));
-         kronrod_result = fp * base::weights()[0];
-         gauss_result += fp * gauss<Real, (N - 1) / 2>::weights()[0];
-      }
-      else
-      {
-         fp = f(value_type(0));
-         kronrod_result = fp * base::weights()[0];
-         gauss_start = 1;
-         kronrod_start = 2;
-      }
-      Real L1 = abs(kronrod_result);
-      for (unsigned i = gauss_start; i < base::abscissa().size(); i += 2)
-      {
-         fp = f(base::abscissa()[i]);
-         fm = f(-base::abscissa()[i]);
-         kronrod_result += (fp + fm) * base::weights()[i];
-         L1 += (abs(fp) + abs(fm)) *  base::weights()[i];
-         gauss_result += (fp + fm) * gauss<Real, (N - 1) / 2>::weights()[i / 2];
-      }
-      for (unsigned i = kronrod_start; i < base::abscissa().size(); i += 2)
-      {
-         fp = f(base::abscissa()[i]);
-         fm = f(-base::abscissa()[i]);
-         kronrod_result += (fp + fm) * base::weights()[i];
-         L1 += (abs(fp) + abs(fm)) *  base::weights()[i];
-      }
-      if (pL1)
-         *pL1 = L1;
-      if (error)
-         *error = (std::max)(static_cast<Real>(abs(kronrod_result - gauss_result)), static_cast<Real>(abs(kronrod_result * tools::epsilon<Real>() * Real(2))));
-      return kronrod_result;
-   }
-
-   template <class F>
-   struct recursive_info
-   {
-      F f;
-      Real tol;
+      static unsigned points() { return N; }
+      static decltype(base::abscissa()) abscissa() { return base::abscissa(); }
+      static decltype(base::weights()) weights() { return base::weights(); }
+      static decltype(gauss<Real, (N - 1) / 2>::weights()) gauss_weights() { return gauss<Real, (N - 1) / 2>::weights(); }
    };
 
-   template <class F>
-   static auto recursive_adaptive_integrate(const recursive_info<F>* info, Real a, Real b, unsigned max_levels, Real abs_tol, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
-   {
-      typedef decltype(info->f(Real(a))) K;
-      using std::abs;
-      Real error_local;
-      Real mean = (b + a) / 2;
-      Real scale = (b - a) / 2;
-      auto ff = [&](const Real& x)->K
-      {
-         return info->f(scale * x + mean);
-      };
-      K r1 = integrate_non_adaptive_m1_1(ff, &error_local, L1);
-      K estimate = scale * r1;
-
-      K tmp = estimate * info->tol;
-      Real abs_tol1 = abs(tmp);
-      if (abs_tol == 0)
-         abs_tol = abs_tol1;
-
-      if (max_levels && (abs_tol1 < error_local) && (abs_tol < error_local))
-      {
-         Real mid = (a + b) / 2;
-         Real L1_local;
-         estimate = recursive_adaptive_integrate(info, a, mid, max_levels - 1, abs_tol / 2, error, L1);
-         estimate += recursive_adaptive_integrate(info, mid, b, max_levels - 1, abs_tol / 2, &error_local, &L1_local);
-         if (error)
-            *error += error_local;
-         if (L1)
-            *L1 += L1_local;
-         return estimate;
-      }
-      if(L1)
-         *L1 *= scale;
-      if (error)
-         *error = error_local;
-      return estimate;
-   }
-
 public:
    template <class F>
    static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
    {
-      typedef decltype(f(a)) K;
       static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
-      {
-         // Infinite limits:
-         if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               Real w = (1 + t_sq)*inv*inv;
-               Real arg = t*inv;
-               K res = f(arg)*w;
-               return res;
-            };
-            recursive_info<decltype(u)> info = { u, tol };
-            K res = recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            return res;
-         }
-
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            recursive_info<decltype(u)> info = { u, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
-
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
-         {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               return f(b - arg) * z * z;
-            };
-            recursive_info<decltype(v)> info = { v, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
+      nodes rule;
+      detail::gauss_kronrod_recursive_integrator<Real, nodes> integrator = { rule, max_depth, tol };
+      return detail::gauss_kronrod_integrate_range<Real, Policy>(f, a, b, error, pL1, integrator, function);
+   }
 
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
-         {
-            if (a==b)
-            {
-               return K(0);
-            }
-            recursive_info<F> info = { f, tol };
-            if (b < a)
-            {
-               return -recursive_adaptive_integrate(&info, b, a, max_depth, Real(0), error, pL1);
-            }
-            return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
-         }
-      }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+   //
+   // As integrate, but the subdivision is driven by the total error rather than by the error on each segment,
+   // and the integrand is evaluated on several segments at once, on up to threads threads.
+   // f must be safe to call concurrently.
+   //
+   template <class F>
+   static auto parallel_integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr,
+                                  std::size_t threads = std::thread::hardware_concurrency())->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::parallel_integrate(f, %1%, %1%)";
+      nodes rule;
+      detail::gauss_kronrod_parallel_integrator<Real, nodes> integrator = { rule, max_depth, tol, threads };
+      return detail::gauss_kronrod_integrate_range<Real, Policy>(f, a, b, error, pL1, integrator, function);
    }
 };
 
@@ -0,0 +1,148 @@
+//  Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_RULE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_RULE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/detail/gauss_rule_detail.hpp>
+#include <boost/math/quadrature/detail/gauss_integrate.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math{ namespace quadrature{
+
+//
+// The Gauss-Legendre rule with a number of points chosen at run time, as gauss is for a number fixed at compile time.
+// The rule is computed the first time it's asked for, in O(points) time, on up to threads threads, and is then shared
+// by every gauss_rule with the same Real and number of points.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_rule
+{
+public:
+   typedef Real value_type;
+
+   explicit gauss_rule(unsigned points, std::size_t threads = std::thread::hardware_concurrency())
+   {
+      static const char* function = "boost::math::quadrature::gauss_rule<%1%>::gauss_rule(unsigned)";
+      if (points == 0)
+      {
+         policies::raise_domain_error(function, "The number of points must be positive, but got %1%.", Real(points), Policy());
+         m_data = std::make_shared<detail::gauss_rule_data<Real> >();
+         m_points = 0;
+         return;
+      }
+      m_data = detail::gauss_rule_cache<Real>(points, false, threads);
+      m_points = points;
+   }
+
+   unsigned points() const { return m_points; }
+   // The nonnegative abscissas in increasing order, and their weights, as for gauss<Real, N>:
+   const std::vector<Real>& abscissa() const { return m_data->abscissa; }
+   const std::vector<Real>& weights() const { return m_data->weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_integrate_m1_1(*this, f, pL1);
+   }
+
+   template <class F>
+   auto integrate(F f, Real a, Real b, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss_rule<%1%>::integrate(f, %1%, %1%)";
+      return detail::gauss_integrate<Real, Policy>(*this, f, a, b, pL1, function);
+   }
+
+private:
+   std::shared_ptr<const detail::gauss_rule_data<Real> > m_data;
+   unsigned m_points;
+};
+
+//
+// The Gauss-Kronrod rule with an odd number of points, at least 3, chosen at run time, as gauss_kronrod is for a number
+// fixed at compile time.  The Kronrod nodes each cost O(points) to find, so the rule costs O(points^2) the first time it's
+// asked for, shared out between up to threads threads; it's then shared by every gauss_kronrod_rule with the same
+// Real and number of points.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_kronrod_rule
+{
+public:
+   typedef Real value_type;
+
+   explicit gauss_kronrod_rule(unsigned points, std::size_t threads = std::thread::hardware_concurrency())
+   {
+      static const char* function = "boost::math::quadrature::gauss_kronrod_rule<%1%>::gauss_kronrod_rule(unsigned)";
+      if ((points < 3) || !(points & 1))
+      {
+         policies::raise_domain_error(function, "The number of points must be odd and at least 3, but got %1%.", Real(points), Policy());
+         m_data = std::make_shared<detail::gauss_rule_data<Real> >();
+         m_points = 0;
+         return;
+      }
+      m_data = detail::gauss_rule_cache<Real>(points, true, threads);
+      m_points = points;
+   }
+
+   unsigned points() const { return m_points; }
+   // The nonnegative abscissas in increasing order, and their weights, as for gauss_kronrod<Real, N>; the Gauss nodes are
+   // every other one of these, starting from abscissa()[0] when (points - 1)/2 is odd, and from abscissa()[1] otherwise,
+   // and their weights in the Gauss rule are gauss_weights():
+   const std::vector<Real>& abscissa() const { return m_data->abscissa; }
+   const std::vector<Real>& weights() const { return m_data->weights; }
+   const std::vector<Real>& gauss_weights() const { return m_data->gauss_weights; }
+
+   template <class F>
+   auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      static const char* function = "boost::math::quadrature::gauss_kronrod_rule<%1%>::integrate(f, %1%, %1%)";
+      if (m_points == 0)
+      {
+         // Only when the error in the constructor was ignored:
+         return K(0);
+      }
+      detail::gauss_kronrod_recursive_integrator<Real, gauss_kronrod_rule> integrator = { *this, max_depth, tol };
+      return detail::gauss_kronrod_integrate_range<Real, Policy>(f, a, b, error, pL1, integrator, function);
+   }
+
+   //
+   // As gauss_kronrod<Real, N>::parallel_integrate: the subdivision is driven by the total error, and the integrand is
+   // evaluated on several segments at once, on up to threads threads.  f must be safe to call concurrently.
+   //
+   template <class F>
+   auto parallel_integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr,
+                           std::size_t threads = std::thread::hardware_concurrency()) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      static const char* function = "boost::math::quadrature::gauss_kronrod_rule<%1%>::parallel_integrate(f, %1%, %1%)";
+      if (m_points == 0)
+      {
+         // Only when the error in the constructor was ignored:
+         return K(0);
+      }
+      detail::gauss_kronrod_parallel_integrator<Real, gauss_kronrod_rule> integrator = { *this, max_depth, tol, threads };
+      return detail::gauss_kronrod_integrate_range<Real, Policy>(f, a, b, error, pL1, integrator, function);
+   }
+
+private:
+   std::shared_ptr<const detail::gauss_rule_data<Real> > m_data;
+   unsigned m_points;
+};
+
+} // namespace quadrature
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_RULE_HPP
@@ -19,16 +19,10 @@
 #include <chrono>
 #include <map>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_domain.hpp>
 
 namespace boost { namespace math { namespace quadrature {
 
-namespace detail {
-  enum class limit_classification {FINITE,
-                                   LOWER_BOUND_INFINITE,
-                                   UPPER_BOUND_INFINITE,
-                                   DOUBLE_INFINITE};
-}
-
 template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>>
 class naive_monte_carlo
 {
@@ -38,117 +32,23 @@ public:
                       Real error_goal,
                       bool singular = true,
                       uint64_t threads = std::thread::hardware_concurrency(),
-                      uint64_t seed = 0): m_num_threads{threads}, m_seed{seed}
+                      uint64_t seed = 0): m_num_threads{threads}, m_seed{seed},
+                                          m_domain(bounds, singular, "boost::math::quadrature::naive_monte_carlo<%1%>")
     {
         using std::numeric_limits;
-        using std::sqrt;
-        uint64_t n = bounds.size();
-        m_lbs.resize(n);
-        m_dxs.resize(n);
-        m_limit_types.resize(n);
-        m_volume = 1;
-        static const char* function = "boost::math::quadrature::naive_monte_carlo<%1%>";
-        for (uint64_t i = 0; i < n; ++i)
+        if (!m_domain.valid())
         {
-            if (bounds[i].second <= bounds[i].first)
-            {
-                boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
-                return;
-            }
-            if (bounds[i].first == -numeric_limits<Real>::infinity())
-            {
-                if (bounds[i].second == numeric_limits<Real>::infinity())
-                {
-                    m_limit_types[i] = detail::limit_classification::DOUBLE_INFINITE;
-                }
-                else
-                {
-                    m_limit_types[i] = detail::limit_classification::LOWER_BOUND_INFINITE;
-                    // Ok ok this is bad to use the second bound as the lower limit and then reflect.
-                    m_lbs[i] = bounds[i].second;
-                    m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-                }
-            }
-            else if (bounds[i].second == numeric_limits<Real>::infinity())
-            {
-                m_limit_types[i] = detail::limit_classification::UPPER_BOUND_INFINITE;
-                if (singular)
-                {
-                    // I've found that it's easier to sample on a closed set and perturb the boundary
-                    // than to try to sample very close to the boundary.
-                    m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                }
-                m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-            }
-            else
-            {
-                m_limit_types[i] = detail::limit_classification::FINITE;
-                if (singular)
-                {
-                    if (bounds[i].first == 0)
-                    {
-                        m_lbs[i] = std::numeric_limits<Real>::epsilon();
-                    }
-                    else
-                    {
-                        m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                    }
-
-                    m_dxs[i] = std::nextafter(bounds[i].second, std::numeric_limits<Real>::lowest()) - m_lbs[i];
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                    m_dxs[i] = bounds[i].second - bounds[i].first;
-                }
-                m_volume *= m_dxs[i];
-            }
+            return;
         }
 
         m_integrand = [this, &integrand](std::vector<Real> & x)->Real
         {
-            Real coeff = m_volume;
-            for (uint64_t i = 0; i < x.size(); ++i)
-            {
-                // Variable transformation are listed at:
-                // https://en.wikipedia.org/wiki/Numerical_integration
-                // However, we've made some changes to these so that we can evaluate on a compact domain.
-                if (m_limit_types[i] == detail::limit_classification::FINITE)
-                {
-                    x[i] = m_lbs[i] + x[i]*m_dxs[i];
-                }
-                else if (m_limit_types[i] == detail::limit_classification::UPPER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(1 + numeric_limits<Real>::epsilon() - t);
-                    coeff *= (z*z)*(1 + numeric_limits<Real>::epsilon());
-                    x[i] = m_lbs[i] + t*z;
-                }
-                else if (m_limit_types[i] == detail::limit_classification::LOWER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(t+sqrt((numeric_limits<Real>::min)()));
-                    coeff *= (z*z);
-                    x[i] = m_lbs[i] + (t-1)*z;
-                }
-                else
-                {
-                    Real t1 = 1/(1+numeric_limits<Real>::epsilon() - x[i]);
-                    Real t2 = 1/(x[i]+numeric_limits<Real>::epsilon());
-                    x[i] = (2*x[i]-1)*t1*t2/4;
-                    coeff *= (t1*t1+t2*t2)/4;
-                }
-            }
-            return coeff*integrand(x);
+            return m_domain(integrand, x);
         };
 
         // If we don't do a single function call in the constructor,
         // we can't do a restart.
-        std::vector<Real> x(m_lbs.size());
+        std::vector<Real> x(m_domain.dimension());
 
         // If the seed is zero, that tells us to choose a random seed for the user:
         if (seed == 0)
@@ -168,7 +68,7 @@ public:
         Real avg = 0;
         for (uint64_t i = 0; i < m_num_threads; ++i)
         {
-            for (uint64_t j = 0; j < m_lbs.size(); ++j)
+            for (uint64_t j = 0; j < m_domain.dimension(); ++j)
             {
                 x[j] = (gen()-(gen.min)())*inv_denom;
             }
@@ -370,7 +270,7 @@ private:
         using std::numeric_limits;
         try
         {
-            std::vector<Real> x(m_lbs.size());
+            std::vector<Real> x(m_domain.dimension());
             RandomNumberGenerator gen(seed);
             Real inv_denom = (Real) 1/(Real)( (gen.max)() - (gen.min)()  );
             Real M1 = m_thread_averages[thread_index].load(boost::memory_order::consume);
@@ -391,7 +291,7 @@ private:
                 int magic_calls_before_update = 2048;
                 while (j++ < magic_calls_before_update)
                 {
-                    for (uint64_t i = 0; i < m_lbs.size(); ++i)
+                    for (uint64_t i = 0; i < m_domain.dimension(); ++i)
                     {
                         x[i] = (gen() - (gen.min)())*inv_denom;
                     }
@@ -436,10 +336,7 @@ private:
     uint64_t m_seed;
     boost::atomic<Real> m_error_goal;
     boost::atomic<bool> m_done;
-    std::vector<Real> m_lbs;
-    std::vector<Real> m_dxs;
-    std::vector<detail::limit_classification> m_limit_types;
-    Real m_volume;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
     boost::atomic<uint64_t> m_total_calls;
     // I wanted these to be vectors rather than maps,
     // but you can't resize a vector of atomics.
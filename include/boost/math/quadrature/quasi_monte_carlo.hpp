@@ -0,0 +1,331 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_domain.hpp>
+#include <boost/math/quadrature/detail/sobol_sequence.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+// Randomized quasi-Monte Carlo integration: the integrand is averaged over a number of independently
+// scrambled copies of the Sobol' sequence, and the spread of the averages gives the error estimate.
+// For smooth integrands the error decreases almost as 1/N, rather than the 1/sqrt(N) of naive_monte_carlo,
+// whose interface this class shares.
+template<class Real, class F, class Policy = boost::math::policies::policy<>>
+class quasi_monte_carlo
+{
+public:
+    quasi_monte_carlo(const F& integrand,
+                      std::vector<std::pair<Real, Real>> const & bounds,
+                      Real error_goal,
+                      bool singular = true,
+                      uint64_t threads = std::thread::hardware_concurrency(),
+                      uint64_t seed = 0,
+                      uint64_t replicates = 16): m_num_threads{threads}, m_replicates{replicates},
+                                                 m_domain(bounds, singular, "boost::math::quadrature::quasi_monte_carlo<%1%>")
+    {
+        static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+        if (!m_domain.valid())
+        {
+            return;
+        }
+        if (m_replicates < 2)
+        {
+            boost::math::policies::raise_domain_error(function, "At least two replicates are required to estimate the error, but %1% were requested.\n", Real(m_replicates), Policy());
+            return;
+        }
+        m_integrand = [this, &integrand](std::vector<Real> & x)->Real
+        {
+            return m_domain(integrand, x);
+        };
+
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<uint64_t> dis;
+        auto v = detail::sobol_direction_numbers(m_domain.dimension(), max_bits);
+        m_direction_numbers.resize(m_replicates);
+        m_shifts.resize(m_replicates);
+        for (uint64_t r = 0; r < m_replicates; ++r)
+        {
+            m_direction_numbers[r] = v;
+            detail::scramble_direction_numbers(m_direction_numbers[r], gen);
+            m_shifts[r].resize(m_domain.dimension());
+            for (auto & s : m_shifts[r])
+            {
+                s = dis(gen);
+            }
+        }
+        m_sums.assign(m_replicates, Real(0));
+        m_points = 0;
+
+        m_num_threads = (std::max)(m_num_threads, (uint64_t) 1);
+        m_error_goal = error_goal; // relaxed store
+        m_start = std::chrono::system_clock::now();
+        m_done = false; // relaxed store
+        m_total_calls = 0;  // relaxed store
+        m_avg = 0;
+        m_error = (std::numeric_limits<Real>::max)();
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no worker threads yet
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &quasi_monte_carlo::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        m_done = true; // relaxed store, worker threads will get the message eventually
+    }
+
+    Real current_error_estimate() const
+    {
+        return m_error.load();
+    }
+
+    // The error decreases roughly as 1/N, so the time remaining is proportional to the ratio of the error to the goal:
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r >= 1)
+        {
+            return 1;
+        }
+        return r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_avg.load();
+    }
+
+    uint64_t calls() const
+    {
+        return m_total_calls.load();  // relaxed load
+    }
+
+private:
+
+    // The sequence is used in blocks whose size is a power of two, each replicate
+    // advancing from m_points to 2*m_points, so that each estimate is taken over a complete net.
+    // The blocks are split into chunks which are shared out between the threads, and the
+    // chunk sums are combined in order, so the result doesn't depend on the number of threads.
+    Real m_integrate()
+    {
+        using std::sqrt;
+        while (!m_done)  // relaxed load
+        {
+            if (m_points > 0 && m_error.load() <= m_error_goal.load())
+            {
+                break;
+            }
+            if (m_points == (uint64_t(1) << max_bits))
+            {
+                // The sequence is exhausted:
+                break;
+            }
+            uint64_t first = m_points;
+            uint64_t last = (m_points == 0) ? initial_points : 2*m_points;
+            uint64_t chunk_size = (std::min)(last - first, chunk_points);
+            uint64_t chunks_per_replicate = (last - first)/chunk_size;
+            std::vector<Real> chunk_sums(m_replicates*chunks_per_replicate);
+            boost::atomic<uint64_t> next_chunk(0);
+            std::exception_ptr exception;
+            std::mutex exception_mutex;
+            auto work = [&]()
+            {
+                try
+                {
+                    std::vector<Real> x(m_domain.dimension());
+                    std::vector<uint64_t> word(m_domain.dimension());
+                    uint64_t chunk;
+                    while (!m_done && (chunk = next_chunk++) < chunk_sums.size())
+                    {
+                        uint64_t r = chunk / chunks_per_replicate;
+                        uint64_t begin = first + (chunk % chunks_per_replicate)*chunk_size;
+                        chunk_sums[chunk] = m_sum(r, begin, begin + chunk_size, x, word);
+                        m_total_calls += chunk_size;
+                    }
+                }
+                catch (...)
+                {
+                    // Signal the other threads that the computation is ruined:
+                    m_done = true; // relaxed store
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            };
+            std::vector<std::thread> threads((std::min)(m_num_threads, (uint64_t) chunk_sums.size()) - 1);
+            for (auto & t : threads)
+            {
+                t = std::thread(work);
+            }
+            work();
+            std::for_each(threads.begin(), threads.end(),
+                std::mem_fn(&std::thread::join));
+            if (exception)
+            {
+                m_total_calls = m_replicates*m_points;
+                std::rethrow_exception(exception);
+            }
+            if (m_done)
+            {
+                // Cancelled: the partial block is discarded, and the estimate stands as it was.
+                m_total_calls = m_replicates*m_points;
+                break;
+            }
+            for (uint64_t r = 0; r < m_replicates; ++r)
+            {
+                for (uint64_t c = 0; c < chunks_per_replicate; ++c)
+                {
+                    m_sums[r] += chunk_sums[r*chunks_per_replicate + c];
+                }
+            }
+            m_points = last;
+
+            Real avg = 0;
+            for (auto const & s : m_sums)
+            {
+                avg += s/m_points;
+            }
+            avg /= m_replicates;
+            Real variance = 0;
+            for (auto const & s : m_sums)
+            {
+                Real d = s/m_points - avg;
+                variance += d*d;
+            }
+            variance /= (m_replicates - 1);
+            m_avg.store(avg, boost::memory_order::release);
+            m_error.store(sqrt(variance/m_replicates), boost::memory_order::release);
+        }
+        return m_avg.load(boost::memory_order::consume);
+    }
+
+    // The sum of the integrand over points [begin, end) of replicate r:
+    Real m_sum(uint64_t r, uint64_t begin, uint64_t end, std::vector<Real> & x, std::vector<uint64_t> & word) const
+    {
+        using std::isfinite;
+        auto const & v = m_direction_numbers[r];
+        uint64_t const dimension = word.size();
+        // Jump straight to point begin of the Gray code ordering:
+        uint64_t gray = begin ^ (begin >> 1);
+        for (uint64_t j = 0; j < dimension; ++j)
+        {
+            word[j] = m_shifts[r][j];
+            for (unsigned k = 0; k < max_bits; ++k)
+            {
+                if ((gray >> k) & 1)
+                {
+                    word[j] ^= v[j][k];
+                }
+            }
+        }
+        // The points lie strictly inside the unit cube:
+        Real sum = 0;
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            for (uint64_t j = 0; j < dimension; ++j)
+            {
+                x[j] = detail::sobol_coordinate<Real>(word[j]);
+            }
+            Real f = m_integrand(x);
+            if (!isfinite(f))
+            {
+                // The call to m_integrand transform x, so this error message states the correct node.
+                std::stringstream os;
+                os << "Your integrand was evaluated at {";
+                for (uint64_t j = 0; j < x.size() -1; ++j)
+                {
+                     os << x[j] << ", ";
+                }
+                os << x[x.size() -1] << "}, and returned " << f << std::endl;
+                static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+                boost::math::policies::raise_domain_error(function, os.str().c_str(), /*this is a dummy arg to make it compile*/ 7.2, Policy());
+            }
+            sum += f;
+            // The next point differs in the direction number of the lowest zero bit of i:
+            unsigned k = 0;
+            while ((i >> k) & 1)
+            {
+                ++k;
+            }
+            if (k < max_bits)
+            {
+                for (uint64_t j = 0; j < dimension; ++j)
+                {
+                    word[j] ^= v[j][k];
+                }
+            }
+        }
+        return sum;
+    }
+
+    static const constexpr unsigned max_bits = 32;
+    static const constexpr uint64_t initial_points = 256;
+    static const constexpr uint64_t chunk_points = 1024;
+
+    std::function<Real(std::vector<Real> &)> m_integrand;
+    uint64_t m_num_threads;
+    uint64_t m_replicates;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
+    // For each replicate, the scrambled direction numbers of each dimension, and the digital shift of each dimension:
+    std::vector<std::vector<std::vector<uint64_t>>> m_direction_numbers;
+    std::vector<std::vector<uint64_t>> m_shifts;
+    // For each replicate, the sum of the integrand over the first m_points points:
+    std::vector<Real> m_sums;
+    uint64_t m_points;
+    boost::atomic<Real> m_error_goal;
+    boost::atomic<bool> m_done;
+    boost::atomic<uint64_t> m_total_calls;
+    boost::atomic<Real> m_avg;
+    boost::atomic<Real> m_error;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+};
+
+}}}
+#endif
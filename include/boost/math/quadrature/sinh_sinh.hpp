@@ -18,6 +18,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <string>
 #include <boost/math/quadrature/detail/sinh_sinh_detail.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
@@ -28,6 +29,13 @@ class sinh_sinh
 public:
     sinh_sinh(size_t max_refinements = 9)
         : m_imp(std::make_shared<detail::sinh_sinh_detail<Real, Policy> >(max_refinements)) {}
+    explicit sinh_sinh(const std::string& table_file)
+        : m_imp(std::make_shared<detail::sinh_sinh_detail<Real, Policy> >(table_file)) {}
+
+    void save_tables(const std::string& table_file, std::size_t levels = 0) const
+    {
+        m_imp->save_tables(table_file, levels);
+    }
 
     template<class F>
     auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const
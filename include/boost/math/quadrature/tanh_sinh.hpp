@@ -32,6 +32,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <string>
 #include <boost/math/quadrature/detail/tanh_sinh_detail.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
@@ -42,6 +43,16 @@ class tanh_sinh
 public:
     tanh_sinh(size_t max_refinements = 15, const Real& min_complement = tools::min_value<Real>() * 4)
     : m_imp(std::make_shared<detail::tanh_sinh_detail<Real, Policy>>(max_refinements, min_complement)) {}
+    //
+    // Loads the abscissas and weights saved by save_tables, possibly by another process:
+    //
+    explicit tanh_sinh(const std::string& table_file)
+    : m_imp(std::make_shared<detail::tanh_sinh_detail<Real, Policy>>(table_file)) {}
+
+    void save_tables(const std::string& table_file, std::size_t levels = 0) const
+    {
+        m_imp->save_tables(table_file, levels);
+    }
 
     template<class F>
     auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>())) const;
@@ -16,6 +16,7 @@
 #endif
 
 #include <limits>
+#include <vector>
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/special_functions/detail/bessel_jy.hpp>
 #include <boost/math/special_functions/detail/bessel_jn.hpp>
@@ -90,7 +91,7 @@ inline T sph_bessel_j_small_z_series(unsigned v, T x, const Policy& pol)
 }
 
 template <class T, class Policy>
-T cyl_bessel_j_imp(T v, T x, const bessel_no_int_tag& t, const Policy& pol)
+T cyl_bessel_j_imp(T v, T x, const bessel_no_int_tag& t, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    BOOST_MATH_STD_USING
    static const char* function = "boost::math::bessel_j<%1%>(%1%,%1%)";
@@ -99,7 +100,7 @@ T cyl_bessel_j_imp(T v, T x, const bessel_no_int_tag& t, const Policy& pol)
       // better have integer v:
       if(floor(v) == v)
       {
-         T r = cyl_bessel_j_imp(v, T(-x), t, pol);
+         T r = cyl_bessel_j_imp(v, T(-x), t, pol, terms);
          if(iround(v, pol) & 1)
             r = -r;
          return r;
@@ -111,7 +112,7 @@ T cyl_bessel_j_imp(T v, T x, const bessel_no_int_tag& t, const Policy& pol)
    }
    
    T j, y;
-   bessel_jy(v, x, &j, &y, need_j, pol);
+   bessel_jy(v, x, &j, &y, need_j, pol, terms);
    return j;
 }
 
@@ -168,7 +169,7 @@ inline T sph_bessel_j_imp(unsigned n, T x, const Policy& pol)
 }
 
 template <class T, class Policy>
-T cyl_bessel_i_imp(T v, T x, const Policy& pol)
+T cyl_bessel_i_imp(T v, T x, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    //
    // This handles all the bessel I functions, note that we don't optimise
@@ -182,7 +183,7 @@ T cyl_bessel_i_imp(T v, T x, const Policy& pol)
       // better have integer v:
       if(floor(v) == v)
       {
-         T r = cyl_bessel_i_imp(v, T(-x), pol);
+         T r = cyl_bessel_i_imp(v, T(-x), pol, terms);
          if(iround(v, pol) & 1)
             r = -r;
          return r;
@@ -218,14 +219,14 @@ T cyl_bessel_i_imp(T v, T x, const Policy& pol)
       }
    }
    if((v > 0) && (x / v < 0.25))
-      return bessel_i_small_z_series(v, x, pol);
+      return bessel_i_small_z_series(v, x, pol, terms);
    T I, K;
-   bessel_ik(v, x, &I, &K, need_i, pol);
+   bessel_ik(v, x, &I, &K, need_i, pol, terms);
    return I;
 }
 
 template <class T, class Policy>
-inline T cyl_bessel_k_imp(T v, T x, const bessel_no_int_tag& /* t */, const Policy& pol)
+inline T cyl_bessel_k_imp(T v, T x, const bessel_no_int_tag& /* t */, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    static const char* function = "boost::math::cyl_bessel_k<%1%>(%1%,%1%)";
    BOOST_MATH_STD_USING
@@ -243,7 +244,7 @@ inline T cyl_bessel_k_imp(T v, T x, const bessel_no_int_tag& /* t */, const Poli
          "Got x = %1%, but we need x > 0", x, pol);
    }
    T I, K;
-   bessel_ik(v, x, &I, &K, need_k, pol);
+   bessel_ik(v, x, &I, &K, need_k, pol, terms);
    return K;
 }
 
@@ -265,7 +266,7 @@ inline T cyl_bessel_k_imp(int v, T x, const bessel_int_tag&, const Policy& pol)
 }
 
 template <class T, class Policy>
-inline T cyl_neumann_imp(T v, T x, const bessel_no_int_tag&, const Policy& pol)
+inline T cyl_neumann_imp(T v, T x, const bessel_no_int_tag&, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    static const char* function = "boost::math::cyl_neumann<%1%>(%1%,%1%)";
 
@@ -281,7 +282,7 @@ inline T cyl_neumann_imp(T v, T x, const bessel_no_int_tag&, const Policy& pol)
                "Got x = %1%, but result is complex for x <= 0", x, pol);
    }
    T j, y;
-   bessel_jy(v, x, &j, &y, need_y, pol);
+   bessel_jy(v, x, &j, &y, need_y, pol, terms);
    // 
    // Post evaluation check for internal overflow during evaluation,
    // can occur when x is small and v is large, in which case the result
@@ -501,6 +502,309 @@ inline T cyl_neumann_zero_imp(T v, int m, const Policy& pol)
    return yvm;
 }
 
+//
+// Array versions: the order is fixed, so the terms of the series which depend
+// only upon it are computed just once.  The integer order methods have no
+// such terms and are simply called for each x:
+//
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_j_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_no_int_tag& t, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_j<%1%>(%1%,%1%)";
+   bessel_order_terms<T> terms(v, pol);
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(cyl_bessel_j_imp(v, static_cast<T>(*first), t, pol, &terms), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_j_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_maybe_int_tag&, const Policy& pol)
+{
+   BOOST_MATH_STD_USING  // ADL of std names.
+   static const char* function = "boost::math::cyl_bessel_j<%1%>(%1%,%1%)";
+   if(first == last)
+      return;
+   int ival = detail::iconv(v, pol);
+   if((0 == v - ival))
+   {
+      for(; first != last; ++first, ++out)
+         *out = policies::checked_narrowing_cast<R, Policy>(bessel_jn(ival, static_cast<T>(*first), pol), function);
+      return;
+   }
+   cyl_bessel_j_batch_imp(v, first, last, out, bessel_no_int_tag(), pol);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_j_batch_imp(int v, const T2* first, const T2* last, R* out, const bessel_int_tag&, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_j<%1%>(%1%,%1%)";
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(bessel_jn(v, static_cast<T>(*first), pol), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_i_batch_imp(T v, const T2* first, const T2* last, R* out, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_i<%1%>(%1%,%1%)";
+   bessel_order_terms<T> terms(v, pol);
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(cyl_bessel_i_imp(v, static_cast<T>(*first), pol, &terms), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_k_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_no_int_tag& t, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_k<%1%>(%1%,%1%)";
+   bessel_order_terms<T> terms(v, pol);
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(cyl_bessel_k_imp(v, static_cast<T>(*first), t, pol, &terms), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_k_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_maybe_int_tag&, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   static const char* function = "boost::math::cyl_bessel_k<%1%>(%1%,%1%)";
+   if(first == last)
+      return;
+   if((floor(v) == v))
+   {
+      int n = itrunc(v);
+      for(; first != last; ++first, ++out)
+         *out = policies::checked_narrowing_cast<R, Policy>(bessel_kn(n, static_cast<T>(*first), pol), function);
+      return;
+   }
+   cyl_bessel_k_batch_imp(v, first, last, out, bessel_no_int_tag(), pol);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_bessel_k_batch_imp(int v, const T2* first, const T2* last, R* out, const bessel_int_tag&, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_k<%1%>(%1%,%1%)";
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(bessel_kn(v, static_cast<T>(*first), pol), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_neumann_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_no_int_tag& t, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_neumann<%1%>(%1%,%1%)";
+   bessel_order_terms<T> terms(v, pol);
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(cyl_neumann_imp(v, static_cast<T>(*first), t, pol, &terms), function);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_neumann_batch_imp(T v, const T2* first, const T2* last, R* out, const bessel_maybe_int_tag&, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   static const char* function = "boost::math::cyl_neumann<%1%>(%1%,%1%)";
+   if(first == last)
+      return;
+   if(floor(v) == v)
+   {
+      int n = itrunc(v, pol);
+      for(; first != last; ++first, ++out)
+         *out = policies::checked_narrowing_cast<R, Policy>(bessel_yn(n, static_cast<T>(*first), pol), function);
+      return;
+   }
+   cyl_neumann_batch_imp(v, first, last, out, bessel_no_int_tag(), pol);
+}
+
+template <class T, class T2, class R, class Policy>
+void cyl_neumann_batch_imp(int v, const T2* first, const T2* last, R* out, const bessel_int_tag&, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_neumann<%1%>(%1%,%1%)";
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(bessel_yn(v, static_cast<T>(*first), pol), function);
+}
+
+//
+// Sequences of orders v0, v0 + 1, ... v0 + n - 1 at fixed x, obtained by
+// recurrence from at most two evaluations of the functions above.  Only
+// v0 >= 0 and finite x > 0 take this route: everything else, and x so small
+// that 2v/x overflows, goes through the scalar functions order by order so
+// that the results and errors are exactly theirs.
+//
+template <class T>
+inline bool bessel_sequence_use_recurrence(T v0, T x, unsigned n)
+{
+   return (n > 2) && (v0 >= 0) && (x > 0) && (boost::math::isfinite)(v0) && (boost::math::isfinite)(x)
+      && (2 * (v0 + n) / tools::max_value<T>() < x);
+}
+
+//
+// Backward recurrence f[k-1] = 2(v0 + k) f[k] / x -/+ f[k+1] from f[n-1] = 1 and
+// f[n] = ratio, used for the minimal solutions J (sign = -1) and I (sign = +1).
+// When the values threaten to overflow everything computed so far is rescaled
+// by a power of 2, so the ratios between them are unaffected:
+//
+template <class T>
+void bessel_sequence_backward_recurrence(T v0, T x, unsigned n, T ratio, int sign, T* f)
+{
+   BOOST_MATH_STD_USING
+   T prev = ratio;
+   T current = 1;
+   f[n - 1] = current;
+   for(unsigned k = n - 1; k > 0; --k)
+   {
+      T fact = 2 * (v0 + k) / x;
+      if((tools::max_value<T>() - fabs(prev)) / fact < fabs(current))
+      {
+         int e;
+         frexp(current, &e);
+         T scale = ldexp(T(1), -e);
+         prev *= scale;
+         current *= scale;
+         for(unsigned j = k; j < n; ++j)
+            f[j] *= scale;
+      }
+      T next = fact * current + sign * prev;
+      prev = current;
+      current = next;
+      f[k - 1] = current;
+   }
+}
+
+template <class T, class Tag, class Policy>
+void cyl_bessel_j_sequence_imp(T v0, T x, unsigned n, T* J, const Tag& t, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   if(!bessel_sequence_use_recurrence(v0, x, n))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         J[k] = cyl_bessel_j_imp(T(v0 + k), x, t, pol);
+      return;
+   }
+   T top = v0 + (n - 1);
+   if(top < x)
+   {
+      //
+      // Every order is below x where J oscillates, and forward recurrence
+      // is as stable as backward:
+      //
+      J[0] = cyl_bessel_j_imp(v0, x, t, pol);
+      J[1] = cyl_bessel_j_imp(T(v0 + 1), x, t, pol);
+      for(unsigned k = 1; k + 1 < n; ++k)
+         J[k + 1] = 2 * (v0 + k) * J[k] / x - J[k - 1];
+      return;
+   }
+   //
+   // Miller's algorithm: J is the minimal solution as the order increases, so
+   // recur backwards from the ratio J_(top+1) / J_top given by CF1_jy, which
+   // converges rapidly as top >= x, then normalise against whichever of the
+   // first two orders is larger, as either may be close to a zero:
+   //
+   T fv;
+   int s;
+   CF1_jy(top, x, &fv, &s, pol);
+   bessel_sequence_backward_recurrence(v0, x, n, fv, -1, J);
+   unsigned k0 = fabs(J[0]) < fabs(J[1]) ? 1 : 0;
+   T Jk0 = cyl_bessel_j_imp(T(v0 + k0), x, t, pol);
+   T f0 = J[k0];
+   for(unsigned k = 0; k < n; ++k)
+      J[k] = Jk0 * (J[k] / f0);
+}
+
+template <class T, class Policy>
+void cyl_bessel_i_sequence_imp(T v0, T x, unsigned n, T* I, const Policy& pol)
+{
+   if(bessel_sequence_use_recurrence(v0, x, n))
+   {
+      //
+      // Miller's algorithm again, I is the minimal solution and decreases
+      // with the order, so normalise against the first.  When that overflows
+      // the larger orders may not, so leave them to the scalar function:
+      //
+      T I0 = cyl_bessel_i_imp(v0, x, pol);
+      if((boost::math::isfinite)(I0))
+      {
+         T fv;
+         CF1_ik(T(v0 + (n - 1)), x, &fv, pol);
+         bessel_sequence_backward_recurrence(v0, x, n, fv, 1, I);
+         T f0 = I[0];
+         for(unsigned k = 0; k < n; ++k)
+            I[k] = I0 * (I[k] / f0);
+         return;
+      }
+   }
+   for(unsigned k = 0; k < n; ++k)
+      I[k] = cyl_bessel_i_imp(T(v0 + k), x, pol);
+}
+
+//
+// Forward recurrence f[k+1] = 2(v0 + k) f[k] / x -/+ f[k-1] from f[0] and f[1],
+// for the dominant solutions Y (sign = -1) and K (sign = +1).  These grow
+// without bound as the order increases, and once they overflow so do all
+// the remaining orders, to -infinity for Y and +infinity for K:
+//
+template <class T, class Policy>
+void bessel_sequence_forward_recurrence(T v0, T x, unsigned n, int sign, T* f, const char* function, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   for(unsigned k = 1; k + 1 < n; ++k)
+   {
+      T fact = 2 * (v0 + k) / x;
+      if(!(boost::math::isfinite)(f[k]) || (tools::max_value<T>() / fact < fabs(f[k])))
+      {
+         T r = sign * policies::raise_overflow_error<T>(function, 0, pol);
+         for(; k + 1 < n; ++k)
+            f[k + 1] = r;
+         return;
+      }
+      f[k + 1] = fact * f[k] + sign * f[k - 1];
+   }
+}
+
+template <class T, class Tag, class Policy>
+void cyl_neumann_sequence_imp(T v0, T x, unsigned n, T* Y, const Tag& t, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_neumann_sequence<%1%>(%1%,%1%)";
+   if(!bessel_sequence_use_recurrence(v0, x, n))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         Y[k] = cyl_neumann_imp(T(v0 + k), x, t, pol);
+      return;
+   }
+   Y[0] = cyl_neumann_imp(v0, x, t, pol);
+   Y[1] = cyl_neumann_imp(T(v0 + 1), x, t, pol);
+   bessel_sequence_forward_recurrence(v0, x, n, -1, Y, function, pol);
+}
+
+template <class T, class Tag, class Policy>
+void cyl_bessel_k_sequence_imp(T v0, T x, unsigned n, T* K, const Tag& t, const Policy& pol)
+{
+   static const char* function = "boost::math::cyl_bessel_k_sequence<%1%>(%1%,%1%)";
+   unsigned k = 0;
+   if(bessel_sequence_use_recurrence(v0, x, n))
+   {
+      K[0] = cyl_bessel_k_imp(v0, x, t, pol);
+      K[1] = cyl_bessel_k_imp(T(v0 + 1), x, t, pol);
+      //
+      // For large x the first orders may underflow, or lose precision as
+      // denormals, while the larger orders are still representable:
+      //
+      if(K[0] >= tools::min_value<T>() / tools::epsilon<T>())
+      {
+         bessel_sequence_forward_recurrence(v0, x, n, 1, K, function, pol);
+         return;
+      }
+      k = 2;
+   }
+   for(; k < n; ++k)
+      K[k] = cyl_bessel_k_imp(T(v0 + k), x, t, pol);
+}
+
+template <class R, class T, class OutputIterator, class Policy>
+inline OutputIterator bessel_sequence_output(const std::vector<T>& values, OutputIterator out_it, const char* function, const Policy&)
+{
+   for(std::size_t k = 0; k < values.size(); ++k)
+   {
+      *out_it = policies::checked_narrowing_cast<R, Policy>(values[k], function);
+      ++out_it;
+   }
+   return out_it;
+}
+
 } // namespace detail
 
 template <class T1, class T2, class Policy>
@@ -525,6 +829,53 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_j(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline void cyl_bessel_j(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename detail::bessel_traits<T1, T2, Policy>::optimisation_tag tag_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   detail::cyl_bessel_j_batch_imp<value_type>(v, first, last, out, tag_type(), forwarding_policy());
+}
+
+template <class T1, class T2>
+inline void cyl_bessel_j(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out)
+{
+   cyl_bessel_j(v, first, last, out, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_j_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag tag_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_j_sequence_imp(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], tag_type(), forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_j_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_j_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_j_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename detail::bessel_traits<T, T, Policy>::result_type sph_bessel(unsigned v, T x, const Policy& /* pol */)
 {
@@ -567,6 +918,51 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_i(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline void cyl_bessel_i(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   detail::cyl_bessel_i_batch_imp<value_type>(v, first, last, out, forwarding_policy());
+}
+
+template <class T1, class T2>
+inline void cyl_bessel_i(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out)
+{
+   cyl_bessel_i(v, first, last, out, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_i_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_i_sequence_imp(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_i_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_i_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_i_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T1, class T2, class Policy>
 inline typename detail::bessel_traits<T1, T2, Policy>::result_type cyl_bessel_k(T1 v, T2 x, const Policy& /* pol */)
 {
@@ -589,6 +985,53 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_k(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline void cyl_bessel_k(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename detail::bessel_traits<T1, T2, Policy>::optimisation_tag128 tag_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   detail::cyl_bessel_k_batch_imp<value_type>(v, first, last, out, tag_type(), forwarding_policy());
+}
+
+template <class T1, class T2>
+inline void cyl_bessel_k(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out)
+{
+   cyl_bessel_k(v, first, last, out, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_k_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag128 tag_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_k_sequence_imp(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], tag_type(), forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_k_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_k_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_k_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T1, class T2, class Policy>
 inline typename detail::bessel_traits<T1, T2, Policy>::result_type cyl_neumann(T1 v, T2 x, const Policy& /* pol */)
 {
@@ -611,6 +1054,53 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_neumann(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline void cyl_neumann(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy& /* pol */)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename detail::bessel_traits<T1, T2, Policy>::optimisation_tag tag_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   detail::cyl_neumann_batch_imp<value_type>(v, first, last, out, tag_type(), forwarding_policy());
+}
+
+template <class T1, class T2>
+inline void cyl_neumann(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out)
+{
+   cyl_neumann(v, first, last, out, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_neumann_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag tag_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_neumann_sequence_imp(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], tag_type(), forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_neumann_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_neumann_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_neumann_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename detail::bessel_traits<T, T, Policy>::result_type sph_neumann(unsigned v, T x, const Policy& /* pol */)
 {
@@ -10,6 +10,7 @@
 #  pragma once
 #endif
 
+#include <vector>
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/special_functions/bessel.hpp>
 #include <boost/math/special_functions/detail/bessel_jy_derivatives_asym.hpp>
@@ -222,6 +223,87 @@ inline T sph_neumann_prime_imp(unsigned v, T x, const Policy& pol)
    return boost::math::detail::sph_neumann_derivative_linear(v, x, pol);
 }
 
+//
+// Sequences of derivatives for orders v0, v0 + 1, ... v0 + n - 1, from the
+// sequence of values with one more order, by J'_v = (v/x)J_v - J_(v+1) and
+// I'_v = I_(v+1) + (v/x)I_v.  Where the values are not obtained by
+// recurrence the scalar functions are used:
+//
+template <class Tag, class T, class Policy>
+void cyl_bessel_j_prime_sequence_imp(T v0, T x, unsigned n, T* Jp, const Policy& pol)
+{
+   if(!bessel_sequence_use_recurrence(v0, x, n + 1))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         Jp[k] = cyl_bessel_j_prime_imp<Tag>(T(v0 + k), x, pol);
+      return;
+   }
+   std::vector<T> J(n + 1);
+   cyl_bessel_j_sequence_imp(v0, x, n + 1, &J[0], Tag(), pol);
+   for(unsigned k = 0; k < n; ++k)
+      Jp[k] = (v0 + k) / x * J[k] - J[k + 1];
+}
+
+template <class T, class Policy>
+void cyl_bessel_i_prime_sequence_imp(T v0, T x, unsigned n, T* Ip, const Policy& pol)
+{
+   if(!bessel_sequence_use_recurrence(v0, x, n + 1))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         Ip[k] = cyl_bessel_i_prime_imp(T(v0 + k), x, pol);
+      return;
+   }
+   std::vector<T> I(n + 1);
+   cyl_bessel_i_sequence_imp(v0, x, n + 1, &I[0], pol);
+   for(unsigned k = 0; k < n; ++k)
+      Ip[k] = I[k + 1] + (v0 + k) / x * I[k];
+}
+
+template <class Tag, class T, class Policy>
+void cyl_bessel_k_prime_sequence_imp(T v0, T x, unsigned n, T* Kp, const Policy& pol)
+{
+   if(!bessel_sequence_use_recurrence(v0, x, n))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         Kp[k] = cyl_bessel_k_prime_imp<Tag>(T(v0 + k), x, pol);
+      return;
+   }
+   //
+   // K and Y grow with the order, so use K'_v = -K_(v-1) - (v/x)K_v which
+   // needs no order beyond the last, and once K_v has overflowed so has
+   // the derivative:
+   //
+   cyl_bessel_k_sequence_imp(v0, x, n, Kp, Tag(), pol);
+   T prev = Kp[0];
+   Kp[0] = v0 / x * Kp[0] - Kp[1];
+   for(unsigned k = 1; k < n; ++k)
+   {
+      T current = Kp[k];
+      Kp[k] = (boost::math::isfinite)(current) ? T(-prev - (v0 + k) / x * current) : T(-current);
+      prev = current;
+   }
+}
+
+template <class Tag, class T, class Policy>
+void cyl_neumann_prime_sequence_imp(T v0, T x, unsigned n, T* Yp, const Policy& pol)
+{
+   if(!bessel_sequence_use_recurrence(v0, x, n))
+   {
+      for(unsigned k = 0; k < n; ++k)
+         Yp[k] = cyl_neumann_prime_imp<Tag>(T(v0 + k), x, pol);
+      return;
+   }
+   cyl_neumann_sequence_imp(v0, x, n, Yp, Tag(), pol);
+   T prev = Yp[0];
+   Yp[0] = v0 / x * Yp[0] - Yp[1];
+   for(unsigned k = 1; k < n; ++k)
+   {
+      T current = Yp[k];
+      Yp[k] = (boost::math::isfinite)(current) ? T(prev - (v0 + k) / x * current) : T(-current);
+      prev = current;
+   }
+}
+
 } // namespace detail
 
 template <class T1, class T2, class Policy>
@@ -246,6 +328,31 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_j_prime(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_j_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag tag_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_j_prime_sequence_imp<tag_type>(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_j_prime_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_j_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_j_prime_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename detail::bessel_traits<T, T, Policy>::result_type sph_bessel_prime(unsigned v, T x, const Policy& /* pol */)
 {
@@ -288,6 +395,30 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_i_prime(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_i_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_i_prime_sequence_imp(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_i_prime_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_i_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_i_prime_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T1, class T2, class Policy>
 inline typename detail::bessel_traits<T1, T2, Policy>::result_type cyl_bessel_k_prime(T1 v, T2 x, const Policy& /* pol */)
 {
@@ -310,6 +441,31 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_bessel_k_prime(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_k_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag tag_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_bessel_k_prime_sequence_imp<tag_type>(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_bessel_k_prime_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_k_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_bessel_k_prime_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T1, class T2, class Policy>
 inline typename detail::bessel_traits<T1, T2, Policy>::result_type cyl_neumann_prime(T1 v, T2 x, const Policy& /* pol */)
 {
@@ -332,6 +488,31 @@ inline typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type
    return cyl_neumann_prime(v, x, policies::policy<>());
 }
 
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_neumann_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename detail::bessel_traits<value_type, value_type, Policy>::optimisation_tag tag_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> values(number_of_orders);
+   if(number_of_orders)
+      detail::cyl_neumann_prime_sequence_imp<tag_type>(static_cast<value_type>(v0), static_cast<value_type>(x), number_of_orders, &values[0], forwarding_policy());
+   return detail::bessel_sequence_output<result_type>(values, out_it, "boost::math::cyl_neumann_prime_sequence<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_neumann_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)
+{
+   return cyl_neumann_prime_sequence(v0, x, number_of_orders, out_it, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename detail::bessel_traits<T, T, Policy>::result_type sph_neumann_prime(unsigned v, T x, const Policy& /* pol */)
 {
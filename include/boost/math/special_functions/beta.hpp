@@ -191,6 +191,48 @@ T beta_imp(T a, T b, const lanczos::undefined_lanczos& l, const Policy& pol)
 
 } // template <class T>T beta_imp(T a, T b, const lanczos::undefined_lanczos& l)
 
+//
+// The parts of ibeta_power_terms and ibeta_series which depend only on a and b,
+// for use when the incomplete beta is evaluated repeatedly with the same a and b:
+//
+template <class T>
+struct ibeta_lanczos_terms
+{
+   template <class Lanczos, class Policy>
+   void init(T a_, T b_, const Lanczos&, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      a = a_;
+      b = b_;
+      T c = a + b;
+      agh = static_cast<T>(a + Lanczos::g() - 0.5f);
+      bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
+      cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
+      lanczos_ratio = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+      power_scale_b = sqrt(bgh / boost::math::constants::e<T>());
+      power_scale_a = sqrt(agh / cgh);
+      series_l1 = log(cgh / bgh) * (b - 0.5f);
+      // Only used when series_l1 is in range, but harmless otherwise:
+      if(a * b < bgh * 10)
+         series_prefix = lanczos_ratio * exp((b - 0.5f) * boost::math::log1p(a / bgh, pol));
+      else
+         series_prefix = lanczos_ratio * pow(cgh / bgh, b - 0.5f);
+      series_scale = sqrt(agh / boost::math::constants::e<T>());
+   }
+
+   T a, b;
+   T agh, bgh, cgh;
+   T lanczos_ratio;
+   T power_scale_b, power_scale_a;
+   T series_l1, series_prefix, series_scale;
+};
+
+template <class T>
+class ibeta_parameter_terms;
+
+template <class T, class Policy>
+T ibeta_power_terms_imp(T a, T b, T x, T y, T agh, T bgh, T cgh, T result, const Policy& pol, const char* function);
+
 
 //
 // Compute the leading power terms in the incomplete Beta:
@@ -236,6 +278,45 @@ T ibeta_power_terms(T a,
    result *= sqrt(bgh / boost::math::constants::e<T>());
    result *= sqrt(agh / cgh);
 
+   return ibeta_power_terms_imp(a, b, x, y, agh, bgh, cgh, result, pol, function);
+}
+//
+// As above, but with the terms which depend only on a and b precomputed:
+//
+template <class T, class Policy>
+T ibeta_power_terms(T a,
+                        T b,
+                        T x,
+                        T y,
+                        const ibeta_lanczos_terms<T>& terms,
+                        bool normalised,
+                        const Policy& pol,
+                        T prefix = 1,
+                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+{
+   BOOST_MATH_STD_USING
+
+   if(!normalised)
+   {
+      return pow(x, a) * pow(y, b);
+   }
+
+   T result = terms.lanczos_ratio;
+   result *= prefix;
+   result *= terms.power_scale_b;
+   result *= terms.power_scale_a;
+
+   return ibeta_power_terms_imp(a, b, x, y, terms.agh, terms.bgh, terms.cgh, result, pol, function);
+}
+//
+// The x dependent part of the power terms, result holds the Lanczos
+// approximation to 1/Beta(a,b) on entry:
+//
+template <class T, class Policy>
+T ibeta_power_terms_imp(T a, T b, T x, T y, T agh, T bgh, T cgh, T result, const Policy& pol, const char* function)
+{
+   BOOST_MATH_STD_USING
+
    // l1 and l2 are the base of the exponents minus one:
    T l1 = (x * b - y * agh) / agh;
    T l2 = (y * a - x * bgh) / bgh;
@@ -609,6 +690,65 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
    return result;
 }
 //
+// Incomplete Beta series again, this time with the terms which depend
+// only on a and b precomputed:
+//
+template <class T, class Policy>
+T ibeta_series(T a, T b, T x, T s0, const ibeta_lanczos_terms<T>& terms, bool normalised, T* p_derivative, T y, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+
+   T result;
+
+   BOOST_ASSERT((p_derivative == 0) || normalised);
+
+   if(normalised)
+   {
+      T l1 = terms.series_l1;
+      T l2 = log(x * terms.cgh / terms.agh) * a;
+      //
+      // Check for over/underflow in the power terms:
+      //
+      if((l1 > tools::log_min_value<T>())
+         && (l1 < tools::log_max_value<T>())
+         && (l2 > tools::log_min_value<T>())
+         && (l2 < tools::log_max_value<T>()))
+      {
+         result = terms.series_prefix;
+         result *= pow(x * terms.cgh / terms.agh, a);
+         result *= terms.series_scale;
+
+         if(p_derivative)
+         {
+            *p_derivative = result * pow(y, b);
+            BOOST_ASSERT(*p_derivative >= 0);
+         }
+      }
+      else
+      {
+         //
+         // Oh dear, we need logs, and this *will* cancel:
+         //
+         result = log(terms.lanczos_ratio) + l1 + l2 + (log(terms.agh) - 1) / 2;
+         if(p_derivative)
+            *p_derivative = exp(result + b * log(y));
+         result = exp(result);
+      }
+   }
+   else
+   {
+      // Non-normalised, just compute the power:
+      result = pow(x, a);
+   }
+   if(result < tools::min_value<T>())
+      return s0; // Safeguard: series can't cope with denorms.
+   ibeta_series_t<T> s(a, b, x, result);
+   boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+   result = boost::math::tools::sum_series(s, boost::math::policies::get_epsilon<T, Policy>(), max_iter, s0);
+   policies::check_series_iterations<T>("boost::math::ibeta<%1%>(%1%, %1%, %1%) in ibeta_series (with lanczos)", max_iter, pol);
+   return result;
+}
+//
 // Incomplete Beta series again, this time without Lanczos support:
 //
 template <class T, class Policy>
@@ -669,6 +809,17 @@ T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczo
    policies::check_series_iterations<T>("boost::math::ibeta<%1%>(%1%, %1%, %1%) in ibeta_series (without lanczos)", max_iter, pol);
    return result;
 }
+//
+// Uses the precomputed terms in cache when there are any for this a and b:
+//
+template <class T, class Lanczos, class Policy>
+inline T ibeta_series(T a, T b, T x, T s0, const Lanczos& l, bool normalised, T* p_derivative, T y, const Policy& pol, const ibeta_parameter_terms<T>* cache)
+{
+   const ibeta_lanczos_terms<T>* terms = cache ? cache->lanczos_terms(a, b) : 0;
+   if(terms)
+      return ibeta_series(a, b, x, s0, *terms, normalised, p_derivative, y, pol);
+   return ibeta_series(a, b, x, s0, l, normalised, p_derivative, y, pol);
+}
 
 //
 // Continued fraction for the incomplete beta:
@@ -703,11 +854,12 @@ private:
 // Evaluate the incomplete beta via the continued fraction representation:
 //
 template <class T, class Policy>
-inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative)
+inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative, const ibeta_parameter_terms<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
    BOOST_MATH_STD_USING
-   T result = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   const ibeta_lanczos_terms<T>* terms = cache ? cache->lanczos_terms(a, b) : 0;
+   T result = terms ? ibeta_power_terms(a, b, x, y, *terms, normalised, pol) : ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
    if(p_derivative)
    {
       *p_derivative = result;
@@ -726,13 +878,14 @@ inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised,
 // Computes the difference between ibeta(a,b,x) and ibeta(a+k,b,x):
 //
 template <class T, class Policy>
-T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative)
+T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative, const ibeta_parameter_terms<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
 
    BOOST_MATH_INSTRUMENT_VARIABLE(k);
 
-   T prefix = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   const ibeta_lanczos_terms<T>* terms = cache ? cache->lanczos_terms(a, b) : 0;
+   T prefix = terms ? ibeta_power_terms(a, b, x, y, *terms, normalised, pol) : ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
    if(p_derivative)
    {
       *p_derivative = prefix;
@@ -816,11 +969,53 @@ struct Pn_size<long double>
    BOOST_STATIC_ASSERT(::boost::math::max_factorial<long double>::value >= 100);
 };
 
+//
+// Computes p[n] from p[0]...p[n-1], see Eq 9.4:
+//
+template <class T>
+inline void beta_small_b_large_a_series_pn(T* p, unsigned n, T b)
+{
+   T bm1 = b - 1;
+   p[n] = 0;
+   T mbn = b - n;
+   unsigned tmp1 = 3;
+   for(unsigned m = 1; m < n; ++m)
+   {
+      mbn = m * b - n;
+      p[n] += mbn * p[n-m] / boost::math::unchecked_factorial<T>(tmp1);
+      tmp1 += 2;
+   }
+   p[n] /= n;
+   p[n] += bm1 / boost::math::unchecked_factorial<T>(2 * n + 1);
+}
+//
+// The parts of beta_small_b_large_a_series which depend only on a and b:
+//
+template <class T>
+struct ibeta_bgrat_terms
+{
+   template <class Policy>
+   void init(T a_, T b_, const Policy& pol)
+   {
+      a = a_;
+      b = b_;
+      delta_ratio = boost::math::tgamma_delta_ratio(a, b, pol);
+      p[0] = 1;
+      for(unsigned n = 1; n < sizeof(p)/sizeof(p[0]); ++n)
+         beta_small_b_large_a_series_pn(p, n, b);
+   }
+
+   T a, b;
+   T delta_ratio;
+   T p[ ::boost::math::detail::Pn_size<T>::value ];
+};
+
 template <class T, class Policy>
-T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& pol, bool normalised)
+T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& pol, bool normalised, const ibeta_parameter_terms<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
    BOOST_MATH_STD_USING
+   const ibeta_bgrat_terms<T>* terms = cache ? cache->bgrat_terms(a, b) : 0;
    //
    // This is DiDonato and Morris's BGRAT routine, see Eq's 9 through 9.6.
    //
@@ -841,7 +1036,7 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
       return s0;
    if(normalised)
    {
-      prefix = h / boost::math::tgamma_delta_ratio(a, b, pol);
+      prefix = h / (terms ? terms->delta_ratio : T(boost::math::tgamma_delta_ratio(a, b, pol)));
       prefix /= pow(t, b);
    }
    else
@@ -855,6 +1050,7 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
    // so no choice but to declare a big table and hope it's big enough...
    //
    T p[ ::boost::math::detail::Pn_size<T>::value ] = { 1 };  // see 9.3.
+   const T* pn = terms ? terms->p : p;
    //
    // Now an initial value for J, see 9.6:
    //
@@ -864,7 +1060,6 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
    //
    T sum = s0 + prefix * j;  // Value at N = 0
    // some variables we'll need:
-   unsigned tnp1 = 1; // 2*N+1
    T lx2 = lx / 2;
    lx2 *= lx2;
    T lxp = 1;
@@ -885,20 +1080,10 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
       }
       */
       //
-      // begin by evaluating the next Pn from Eq 9.4:
+      // begin by evaluating the next Pn from Eq 9.4, unless we have them already:
       //
-      tnp1 += 2;
-      p[n] = 0;
-      T mbn = b - n;
-      unsigned tmp1 = 3;
-      for(unsigned m = 1; m < n; ++m)
-      {
-         mbn = m * b - n;
-         p[n] += mbn * p[n-m] / boost::math::unchecked_factorial<T>(tmp1);
-         tmp1 += 2;
-      }
-      p[n] /= n;
-      p[n] += bm1 / boost::math::unchecked_factorial<T>(tnp1);
+      if(!terms)
+         beta_small_b_large_a_series_pn(p, n, b);
       //
       // Now we want Jn from Jn-1 using Eq 9.6:
       //
@@ -908,7 +1093,7 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
       //
       // pull it together with Eq 9:
       //
-      T r = prefix * p[n] * j;
+      T r = prefix * pn[n] * j;
       sum += r;
       if(r > 1)
       {
@@ -924,6 +1109,92 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
    return sum;
 } // template <class T, class Lanczos>T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Lanczos& l, bool normalised)
 
+//
+// Everything in the normalised incomplete beta which depends only on a and b:
+// ibeta_imp may swap a and b, and sidestep to other values of either, so we
+// store the terms for each pair of arguments it may pass on, and look them up
+// by value.  Pairs which are not found are simply computed as usual.
+//
+template <class T>
+class ibeta_parameter_terms
+{
+public:
+   template <class Policy>
+   ibeta_parameter_terms(T a, T b, const Policy& pol) : m_lanczos_count(0), m_bgrat_count(0)
+   {
+      BOOST_MATH_STD_USING
+      typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
+      // Invalid arguments are left to ibeta_imp to report:
+      if(!(a > 0) || !(b > 0) || !(boost::math::isfinite)(a) || !(boost::math::isfinite)(b))
+         return;
+      for(int k = 0; k < 2; ++k)
+      {
+         T p = k ? b : a;
+         T q = k ? a : b;
+         add_lanczos_terms(p, q, pol, lanczos_type());
+         T qs = q;
+         if(q > 1)
+         {
+            if(q >= 40)
+               continue;
+            // The sidestep to q - n in (0, 1] used when both arguments are > 1:
+            int n = itrunc(T(floor(q)), pol);
+            qs = q - n;
+            if(qs <= 0)
+               qs += 1;
+            add_lanczos_terms(qs, p, pol, lanczos_type());
+            add_lanczos_terms(p, qs, pol, lanczos_type());
+         }
+         // beta_small_b_large_a_series is only ever called with a >= 15:
+         if(p >= 15)
+            add_bgrat_terms(p, qs, pol);
+         add_bgrat_terms(T(p + 20), qs, pol);
+      }
+   }
+
+   const ibeta_lanczos_terms<T>* lanczos_terms(T a, T b) const
+   {
+      for(unsigned i = 0; i < m_lanczos_count; ++i)
+      {
+         if((m_lanczos[i].a == a) && (m_lanczos[i].b == b))
+            return &m_lanczos[i];
+      }
+      return 0;
+   }
+   const ibeta_bgrat_terms<T>* bgrat_terms(T a, T b) const
+   {
+      for(unsigned i = 0; i < m_bgrat_count; ++i)
+      {
+         if((m_bgrat[i].a == a) && (m_bgrat[i].b == b))
+            return &m_bgrat[i];
+      }
+      return 0;
+   }
+
+private:
+   template <class Policy, class Lanczos>
+   void add_lanczos_terms(T a, T b, const Policy& pol, const Lanczos& l)
+   {
+      if(!lanczos_terms(a, b))
+         m_lanczos[m_lanczos_count++].init(a, b, l, pol);
+   }
+   template <class Policy>
+   void add_lanczos_terms(T, T, const Policy&, const lanczos::undefined_lanczos&)
+   {
+   }
+   template <class Policy>
+   void add_bgrat_terms(T a, T b, const Policy& pol)
+   {
+      if(!bgrat_terms(a, b))
+         m_bgrat[m_bgrat_count++].init(a, b, pol);
+   }
+
+   ibeta_lanczos_terms<T> m_lanczos[6];
+   unsigned m_lanczos_count;
+   ibeta_bgrat_terms<T> m_bgrat[4];
+   unsigned m_bgrat_count;
+};
+
 //
 // For integer arguments we can relate the incomplete beta to the
 // complement of the binomial distribution cdf and use this finite sum.
@@ -990,7 +1261,7 @@ T binomial_ccdf(T n, T k, T x, T y, const Policy& pol)
 // each domain:
 //
 template <class T, class Policy>
-T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative)
+T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative, const ibeta_parameter_terms<T>* cache = 0)
 {
    static const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)";
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
@@ -1118,14 +1389,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1138,14 +1409,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1161,17 +1432,17 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract -= (normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1184,14 +1455,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1205,14 +1476,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1220,14 +1491,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(a, b, x, y, T(0), T(1), pol, normalised);
+                  fract = beta_small_b_large_a_series(a, b, x, y, T(0), T(1), pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(a, b, x, y, fract, T(1), pol, normalised);
+                  fract = -beta_small_b_large_a_series(a, b, x, y, fract, T(1), pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1243,18 +1514,18 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract -= (normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1297,14 +1568,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1324,8 +1595,8 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                prefix = 1;
             }
-            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0));
-            fract = beta_small_b_large_a_series(a,  bbar, x, y, fract, T(1), pol, normalised);
+            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0), cache);
+            fract = beta_small_b_large_a_series(a,  bbar, x, y, fract, T(1), pol, normalised, cache);
             fract /= prefix;
             BOOST_MATH_INSTRUMENT_VARIABLE(fract);
          }
@@ -1341,11 +1612,11 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                --n;
                bbar += 1;
             }
-            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0));
-            fract += ibeta_a_step(a, bbar, x, y, 20, pol, normalised, static_cast<T*>(0));
+            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0), cache);
+            fract += ibeta_a_step(a, bbar, x, y, 20, pol, normalised, static_cast<T*>(0), cache);
             if(invert)
                fract -= 1;  // Note this line would need changing if we ever enable this branch in non-normalized case
-            fract = beta_small_b_large_a_series(T(a+20),  bbar, x, y, fract, T(1), pol, normalised);
+            fract = beta_small_b_large_a_series(T(a+20),  bbar, x, y, fract, T(1), pol, normalised, cache);
             if(invert)
             {
                fract = -fract;
@@ -1355,13 +1626,13 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          }
          else
          {
-            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
             BOOST_MATH_INSTRUMENT_VARIABLE(fract);
          }
       }
       else
       {
-         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
          BOOST_MATH_INSTRUMENT_VARIABLE(fract);
       }
    }
@@ -1369,7 +1640,8 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
    {
       if(*p_derivative < 0)
       {
-         *p_derivative = ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol);
+         const ibeta_lanczos_terms<T>* terms = cache ? cache->lanczos_terms(a, b) : 0;
+         *p_derivative = terms ? ibeta_power_terms(a, b, x, y, *terms, true, pol) : ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol);
       }
       T div = y * x;
 
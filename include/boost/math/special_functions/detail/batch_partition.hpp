@@ -0,0 +1,125 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_DETAIL_BATCH_PARTITION_HPP
+#define BOOST_MATH_SF_DETAIL_BATCH_PARTITION_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cstddef>
+#include <boost/assert.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// The array overloads of the special functions process their input in
+// blocks of batch_block_size values.  Within each block the indices of the
+// arguments are grouped according to which approximation applies to them,
+// each approximation is then applied to its whole group in a tight loop
+// which contains no branches, and so can be vectorized by the compiler.
+//
+static const unsigned batch_block_size = 256;
+
+//
+// Classifier for when the groups have already been computed:
+//
+struct batch_identity
+{
+   template <class T>
+   unsigned operator()(const T& g)const
+   {
+      return static_cast<unsigned>(g);
+   }
+};
+
+template <unsigned Groups>
+class batch_partition
+{
+public:
+   //
+   // Classifier is called once for each value in [x, x + n) and must
+   // return the group (less than Groups) that value belongs to:
+   //
+   template <class T, class Classifier>
+   void assign(const T* x, unsigned n, Classifier c)
+   {
+      BOOST_ASSERT(n <= batch_block_size);
+      //
+      // Classify first, and then build the index lists, so that
+      // the classification loop is free to be vectorized:
+      //
+      unsigned char group[batch_block_size];
+      for(unsigned i = 0; i < n; ++i)
+         group[i] = static_cast<unsigned char>(c(x[i]));
+      for(unsigned g = 0; g < Groups; ++g)
+         m_size[g] = 0;
+      for(unsigned i = 0; i < n; ++i)
+      {
+         BOOST_ASSERT(group[i] < Groups);
+         m_index[group[i]][m_size[group[i]]++] = static_cast<unsigned short>(i);
+      }
+      m_count = n;
+   }
+   unsigned size(unsigned g)const
+   {
+      return m_size[g];
+   }
+   unsigned index(unsigned g, unsigned i)const
+   {
+      return m_index[g][i];
+   }
+   //
+   // True when every value in the block belongs to group g, in which
+   // case the indices are simply 0, 1, 2...
+   //
+   bool contiguous(unsigned g)const
+   {
+      return m_size[g] == m_count;
+   }
+   //
+   // Copies the values in group g into contiguous storage:
+   //
+   template <class T, class U>
+   void gather(unsigned g, const T* x, U* buf)const
+   {
+      if(contiguous(g))
+      {
+         for(unsigned i = 0; i < m_count; ++i)
+            buf[i] = static_cast<U>(x[i]);
+      }
+      else
+      {
+         for(unsigned i = 0; i < m_size[g]; ++i)
+            buf[i] = static_cast<U>(x[m_index[g][i]]);
+      }
+   }
+   //
+   // Copies contiguous results for group g back to their positions in the block:
+   //
+   template <class T, class U>
+   void scatter(unsigned g, const T* buf, U* out)const
+   {
+      if(contiguous(g))
+      {
+         for(unsigned i = 0; i < m_count; ++i)
+            out[i] = buf[i];
+      }
+      else
+      {
+         for(unsigned i = 0; i < m_size[g]; ++i)
+            out[m_index[g][i]] = buf[i];
+      }
+   }
+private:
+   unsigned short m_index[Groups][batch_block_size];
+   unsigned m_size[Groups];
+   unsigned m_count;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_SF_DETAIL_BATCH_PARTITION_HPP
@@ -13,6 +13,7 @@
 #include <boost/math/special_functions/round.hpp>
 #include <boost/math/special_functions/gamma.hpp>
 #include <boost/math/special_functions/sin_pi.hpp>
+#include <boost/math/special_functions/detail/bessel_order_terms.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/tools/config.hpp>
@@ -50,17 +51,18 @@ private:
 };
 
 template <class T, class Policy>
-inline T bessel_i_small_z_series(T v, T x, const Policy& pol)
+inline T bessel_i_small_z_series(T v, T x, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    BOOST_MATH_STD_USING
    T prefix;
+   bool cached = terms && terms->has_order(v);
    if(v < max_factorial<T>::value)
    {
-      prefix = pow(x / 2, v) / boost::math::tgamma(v + 1, pol);
+      prefix = pow(x / 2, v) / (cached ? terms->gamma_v1 : boost::math::tgamma(v + 1, pol));
    }
    else
    {
-      prefix = v * log(x / 2) - boost::math::lgamma(v + 1, pol);
+      prefix = v * log(x / 2) - (cached ? terms->gamma_v1 : boost::math::lgamma(v + 1, pol));
       prefix = exp(prefix);
    }
    if(prefix == 0)
@@ -81,7 +83,7 @@ inline T bessel_i_small_z_series(T v, T x, const Policy& pol)
 // Calculate K(v, x) and K(v+1, x) by method analogous to
 // Temme, Journal of Computational Physics, vol 21, 343 (1976)
 template <typename T, typename Policy>
-int temme_ik(T v, T x, T* K, T* K1, const Policy& pol)
+int temme_ik(T v, T x, T* K, T* K1, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
     T f, h, p, q, coef, sum, sum1, tolerance;
     T a, b, c, d, sigma, gamma1, gamma2;
@@ -97,14 +99,15 @@ int temme_ik(T v, T x, T* K, T* K1, const Policy& pol)
     BOOST_ASSERT(abs(x) <= 2);
     BOOST_ASSERT(abs(v) <= 0.5f);
 
-    T gp = boost::math::tgamma1pm1(v, pol);
-    T gm = boost::math::tgamma1pm1(-v, pol);
+    bool cached = terms && terms->has_temme_order(v);
+    T gp = cached ? terms->gp : boost::math::tgamma1pm1(v, pol);
+    T gm = cached ? terms->gm : boost::math::tgamma1pm1(-v, pol);
 
     a = log(x / 2);
     b = exp(v * a);
     sigma = -a * v;
     c = abs(v) < tools::epsilon<T>() ?
-       T(1) : T(boost::math::sin_pi(v, pol) / (v * pi<T>()));
+       T(1) : T((cached ? terms->spu : boost::math::sin_pi(v, pol)) / (v * pi<T>()));
     d = abs(sigma) < tools::epsilon<T>() ?
         T(1) : T(sinh(sigma) / sigma);
     gamma1 = abs(v) < tools::epsilon<T>() ?
@@ -298,7 +301,7 @@ enum{
 // Compute I(v, x) and K(v, x) simultaneously by Temme's method, see
 // Temme, Journal of Computational Physics, vol 19, 324 (1975)
 template <typename T, typename Policy>
-int bessel_ik(T v, T x, T* I, T* K, int kind, const Policy& pol)
+int bessel_ik(T v, T x, T* I, T* K, int kind, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
     // Kv1 = K_(v+1), fv = I_(v+1) / I_v
     // Ku1 = K_(u+1), fu = I_(u+1) / I_u
@@ -363,7 +366,7 @@ int bessel_ik(T v, T x, T* I, T* K, int kind, const Policy& pol)
     W = 1 / x;                                 // Wronskian
     if (x <= 2)                                // x in (0, 2]
     {
-        temme_ik(u, x, &Ku, &Ku1, pol);             // Temme series
+        temme_ik(u, x, &Ku, &Ku1, pol, terms);             // Temme series
     }
     else                                       // x in (2, \infty)
     {
@@ -410,7 +413,7 @@ int bessel_ik(T v, T x, T* I, T* K, int kind, const Policy& pol)
        }
        else if((v > 0) && (x / v < 0.25))
        {
-          Iv = bessel_i_small_z_series(v, x, pol);
+          Iv = bessel_i_small_z_series(v, x, pol, terms);
        }
        else
        {
@@ -17,6 +17,7 @@
 #include <boost/math/special_functions/sin_pi.hpp>
 #include <boost/math/special_functions/cos_pi.hpp>
 #include <boost/math/special_functions/detail/bessel_jy_asym.hpp>
+#include <boost/math/special_functions/detail/bessel_order_terms.hpp>
 #include <boost/math/special_functions/detail/bessel_jy_series.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/policies/error_handling.hpp>
@@ -72,7 +73,7 @@ namespace boost { namespace math {
       // Calculate Y(v, x) and Y(v+1, x) by Temme's method, see
       // Temme, Journal of Computational Physics, vol 21, 343 (1976)
       template <typename T, typename Policy>
-      int temme_jy(T v, T x, T* Y, T* Y1, const Policy& pol)
+      int temme_jy(T v, T x, T* Y, T* Y1, const Policy& pol, const bessel_order_terms<T>* terms = 0)
       {
          T g, h, p, q, f, coef, sum, sum1, tolerance;
          T a, d, e, sigma;
@@ -84,10 +85,11 @@ namespace boost { namespace math {
 
          BOOST_ASSERT(fabs(v) <= 0.5f);  // precondition for using this routine
 
-         T gp = boost::math::tgamma1pm1(v, pol);
-         T gm = boost::math::tgamma1pm1(-v, pol);
-         T spv = boost::math::sin_pi(v, pol);
-         T spv2 = boost::math::sin_pi(v/2, pol);
+         bool cached = terms && terms->has_temme_order(v);
+         T gp = cached ? terms->gp : boost::math::tgamma1pm1(v, pol);
+         T gm = cached ? terms->gm : boost::math::tgamma1pm1(-v, pol);
+         T spv = cached ? terms->spu : boost::math::sin_pi(v, pol);
+         T spv2 = cached ? terms->spu2 : boost::math::sin_pi(v/2, pol);
          T xp = pow(x/2, v);
 
          a = log(x / 2);
@@ -262,7 +264,7 @@ namespace boost { namespace math {
       // Compute J(v, x) and Y(v, x) simultaneously by Steed's method, see
       // Barnett et al, Computer Physics Communications, vol 8, 377 (1974)
       template <typename T, typename Policy>
-      int bessel_jy(T v, T x, T* J, T* Y, int kind, const Policy& pol)
+      int bessel_jy(T v, T x, T* J, T* Y, int kind, const Policy& pol, const bessel_order_terms<T>* terms = 0)
       {
          BOOST_ASSERT(x >= 0);
 
@@ -333,7 +335,7 @@ namespace boost { namespace math {
             // x - say up to x < 20 - but the first few terms are large
             // and divergent which leads to large errors :-(
             //
-            Jv = bessel_j_small_z_series(v, x, pol);
+            Jv = bessel_j_small_z_series(v, x, pol, terms);
             Yv = std::numeric_limits<T>::quiet_NaN();
          }
          else if((x < 1) && (u != 0) && (log(policies::get_epsilon<T, Policy>() / 2) > v * log((x/2) * (x/2) / v)))
@@ -343,7 +345,7 @@ namespace boost { namespace math {
             // area temme_jy may be slow to converge, if it converges at all.
             // Requires x is not an integer.
             if(kind&need_j)
-               Jv = bessel_j_small_z_series(v, x, pol);
+               Jv = bessel_j_small_z_series(v, x, pol, terms);
             else
                Jv = std::numeric_limits<T>::quiet_NaN();
             if((org_kind&need_y && (!reflect || (cp != 0))) 
@@ -360,7 +362,7 @@ namespace boost { namespace math {
             // Truncated series evaluation for small x and v an integer,
             // much quicker in this area than temme_jy below.
             if(kind&need_j)
-               Jv = bessel_j_small_z_series(v, x, pol);
+               Jv = bessel_j_small_z_series(v, x, pol, terms);
             else
                Jv = std::numeric_limits<T>::quiet_NaN();
             if((org_kind&need_y && (!reflect || (cp != 0))) 
@@ -416,7 +418,7 @@ namespace boost { namespace math {
          }
          else if (x <= 2)                           // x in (0, 2]
          {
-            if(temme_jy(u, x, &Yu, &Yu1, pol))             // Temme series
+            if(temme_jy(u, x, &Yu, &Yu1, pol, terms))             // Temme series
             {
                // domain error:
                *J = *Y = Yu;
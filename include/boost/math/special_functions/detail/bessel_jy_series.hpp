@@ -10,6 +10,8 @@
 #pragma once
 #endif
 
+#include <boost/math/special_functions/detail/bessel_order_terms.hpp>
+
 namespace boost { namespace math { namespace detail{
 
 template <class T, class Policy>
@@ -44,17 +46,18 @@ private:
 // Converges rapidly for all z << v.
 //
 template <class T, class Policy>
-inline T bessel_j_small_z_series(T v, T x, const Policy& pol)
+inline T bessel_j_small_z_series(T v, T x, const Policy& pol, const bessel_order_terms<T>* terms = 0)
 {
    BOOST_MATH_STD_USING
    T prefix;
+   bool cached = terms && terms->has_order(v);
    if(v < max_factorial<T>::value)
    {
-      prefix = pow(x / 2, v) / boost::math::tgamma(v+1, pol);
+      prefix = pow(x / 2, v) / (cached ? terms->gamma_v1 : boost::math::tgamma(v+1, pol));
    }
    else
    {
-      prefix = v * log(x / 2) - boost::math::lgamma(v+1, pol);
+      prefix = v * log(x / 2) - (cached ? terms->gamma_v1 : boost::math::lgamma(v+1, pol));
       prefix = exp(prefix);
    }
    if(0 == prefix)
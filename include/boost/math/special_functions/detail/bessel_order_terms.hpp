@@ -0,0 +1,64 @@
+//  Copyright the Boost.Math authors, 2020
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_BESSEL_ORDER_TERMS_HPP
+#define BOOST_MATH_BESSEL_ORDER_TERMS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <limits>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/sin_pi.hpp>
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+
+namespace boost { namespace math { namespace detail{
+
+//
+// The parts of the series for J, Y, I and K which depend upon the order
+// alone: the gamma function prefix of the small z series for J and I, and
+// the gamma and sine terms of Temme's series for Y and K.  When evaluating a
+// fixed order at many x these are computed once and passed down to the
+// series, each of which checks that it is being called with the order the
+// terms were computed for, and otherwise computes them afresh.
+//
+template <class T>
+struct bessel_order_terms
+{
+   template <class Policy>
+   bessel_order_terms(T order, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      v = fabs(order);
+      //
+      // Orders too large to be evaluated are rejected by the series
+      // themselves, don't raise errors here:
+      //
+      valid = (boost::math::isfinite)(v) && (v <= static_cast<T>((std::numeric_limits<int>::max)()));
+      if(!valid)
+         return;
+      // Order of the Temme series, as used by bessel_jy and bessel_ik:
+      u = v - iround(v, pol);
+      gp = boost::math::tgamma1pm1(u, pol);
+      gm = boost::math::tgamma1pm1(-u, pol);
+      spu = boost::math::sin_pi(u, pol);
+      spu2 = boost::math::sin_pi(u / 2, pol);
+      // tgamma(v + 1) where the small z series use it, otherwise lgamma(v + 1):
+      gamma_v1 = v < max_factorial<T>::value ? boost::math::tgamma(v + 1, pol) : boost::math::lgamma(v + 1, pol);
+   }
+   bool has_order(T order)const { return valid && (order == v); }
+   bool has_temme_order(T order)const { return valid && (order == u); }
+
+   bool valid;
+   T v, u;
+   T gp, gm, spu, spu2;
+   T gamma_v1;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_BESSEL_ORDER_TERMS_HPP
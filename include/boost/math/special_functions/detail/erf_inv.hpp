@@ -16,6 +16,101 @@
 namespace boost{ namespace math{ 
 
 namespace detail{
+//
+// The two rational approximations that cover most of the domain of
+// erf_inv_imp below, these are also used directly by the batched
+// evaluation which applies each of them to a group of arguments at once:
+//
+template <class T>
+inline T erf_inv_rational_imp(const T& p, const boost::integral_constant<int, 0>&)
+{
+   //
+   // Evaluate inverse erf using the rational approximation:
+   //
+   // x = p(p+10)(Y+R(p))
+   //
+   // Where Y is a constant, and R(p) is optimised for a low
+   // absolute error compared to |Y|.
+   //
+   // double: Max error found: 2.001849e-18
+   // long double: Max error found: 1.017064e-20
+   // Maximum Deviation Found (actual error term at infinite precision) 8.030e-21
+   //
+   static const float Y = 0.0891314744949340820313f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.000508781949658280665617),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.00836874819741736770379),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0334806625409744615033),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.0126926147662974029034),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.0365637971411762664006),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0219878681111168899165),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00822687874676915743155),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.00538772965071242932965)
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.970005043303290640362),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -1.56574558234175846809),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.56221558398423026363),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.662328840472002992063),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.71228902341542847553),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.0527396382340099713954),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0795283687341571680018),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.00233393759374190016776),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.000886216390456424707504)
+   };
+   T g = p * (p + 10);
+   T r = tools::evaluate_polynomial(P, p) / tools::evaluate_polynomial(Q, p);
+   return g * Y + g * r;
+}
+
+template <class T>
+inline T erf_inv_rational_imp(const T& q, const boost::integral_constant<int, 1>&)
+{
+   //
+   // Rational approximation for 0.5 > q >= 0.25
+   //
+   // x = sqrt(-2*log(q)) / (Y + R(q))
+   //
+   // Where Y is a constant, and R(q) is optimised for a low
+   // absolute error compared to Y.
+   //
+   // double : Max error found: 7.403372e-17
+   // long double : Max error found: 6.084616e-20
+   // Maximum Deviation Found (error term) 4.811e-20
+   //
+   static const float Y = 2.249481201171875f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.202433508355938759655),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.105264680699391713268),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 8.37050328343119927838),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 17.6447298408374015486),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -18.8510648058714251895),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -44.6382324441786960818),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 17.445385985570866523),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 21.1294655448340526258),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -3.67192254707729348546)
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 6.24264124854247537712),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 3.9713437953343869095),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -28.6608180499800029974),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -20.1432634680485188801),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 48.5609213108739935468),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 10.8268667355460159008),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -22.6436933413139721736),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.72114765761200282724)
+   };
+   //
+   // Returns the denominator Y + R(q) only, the caller divides
+   // sqrt(-2*log(q)) by it:
+   //
+   T xs = q - 0.25f;
+   T r = tools::evaluate_polynomial(P, xs) / tools::evaluate_polynomial(Q, xs);
+   return Y + r;
+}
+
 //
 // The inverse erf and erfc functions share a common implementation,
 // this version is for 80-bit long double's and smaller:
@@ -29,86 +124,12 @@ T erf_inv_imp(const T& p, const T& q, const Policy&, const boost::integral_const
    
    if(p <= 0.5)
    {
-      //
-      // Evaluate inverse erf using the rational approximation:
-      //
-      // x = p(p+10)(Y+R(p))
-      //
-      // Where Y is a constant, and R(p) is optimised for a low
-      // absolute error compared to |Y|.
-      //
-      // double: Max error found: 2.001849e-18
-      // long double: Max error found: 1.017064e-20
-      // Maximum Deviation Found (actual error term at infinite precision) 8.030e-21
-      //
-      static const float Y = 0.0891314744949340820313f;
-      static const T P[] = {    
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.000508781949658280665617),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.00836874819741736770379),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.0334806625409744615033),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.0126926147662974029034),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.0365637971411762664006),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.0219878681111168899165),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.00822687874676915743155),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.00538772965071242932965)
-      };
-      static const T Q[] = {    
-         BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.970005043303290640362),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -1.56574558234175846809),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 1.56221558398423026363),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.662328840472002992063),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.71228902341542847553),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.0527396382340099713954),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.0795283687341571680018),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.00233393759374190016776),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.000886216390456424707504)
-      };
-      T g = p * (p + 10);
-      T r = tools::evaluate_polynomial(P, p) / tools::evaluate_polynomial(Q, p);
-      result = g * Y + g * r;
+      result = erf_inv_rational_imp(p, boost::integral_constant<int, 0>());
    }
    else if(q >= 0.25)
    {
-      //
-      // Rational approximation for 0.5 > q >= 0.25
-      //
-      // x = sqrt(-2*log(q)) / (Y + R(q))
-      //
-      // Where Y is a constant, and R(q) is optimised for a low
-      // absolute error compared to Y.
-      //
-      // double : Max error found: 7.403372e-17
-      // long double : Max error found: 6.084616e-20
-      // Maximum Deviation Found (error term) 4.811e-20
-      //
-      static const float Y = 2.249481201171875f;
-      static const T P[] = {    
-         BOOST_MATH_BIG_CONSTANT(T, 64, -0.202433508355938759655),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 0.105264680699391713268),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 8.37050328343119927838),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 17.6447298408374015486),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -18.8510648058714251895),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -44.6382324441786960818),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 17.445385985570866523),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 21.1294655448340526258),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -3.67192254707729348546)
-      };
-      static const T Q[] = {    
-         BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 6.24264124854247537712),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 3.9713437953343869095),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -28.6608180499800029974),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -20.1432634680485188801),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 48.5609213108739935468),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 10.8268667355460159008),
-         BOOST_MATH_BIG_CONSTANT(T, 64, -22.6436933413139721736),
-         BOOST_MATH_BIG_CONSTANT(T, 64, 1.72114765761200282724)
-      };
       T g = sqrt(-2 * log(q));
-      T xs = q - 0.25f;
-      T r = tools::evaluate_polynomial(P, xs) / tools::evaluate_polynomial(Q, xs);
-      result = g / (Y + r);
+      result = g / erf_inv_rational_imp(q, boost::integral_constant<int, 1>());
    }
    else
    {
@@ -390,6 +411,138 @@ bool erf_inv_initializer<T, Policy>::init::is_value_non_zero(T v)
    return v != 0;
 }
 
+//
+// Batched evaluation.  Group 0 and 1 are the two rational approximations
+// in erf_inv_rational_imp, group 2 are the tails which go through
+// erf_inv_imp, and group 3 are the special cases and domain errors which
+// are left to the scalar functions:
+//
+template <class T>
+struct erf_inv_batch_classifier
+{
+   erf_inv_batch_classifier(bool c) : complement(c) {}
+   unsigned operator()(const T& z)const
+   {
+      BOOST_MATH_STD_USING
+      bool valid;
+      T q;
+      if(complement)
+      {
+         valid = (z > 0) && (z < 2) && (z != 1);
+         q = z > 1 ? T(2 - z) : z;
+      }
+      else
+      {
+         valid = (z > -1) && (z < 1) && (z != 0);
+         q = 1 - fabs(z);
+      }
+      T p = complement ? T(1 - q) : T(fabs(z));
+      unsigned g = (p <= 0.5) ? 0 : (q >= 0.25) ? 1 : 2;
+      return valid ? g : 3;
+   }
+private:
+   bool complement;
+};
+
+template <class T, class V, class Policy, class ForwardingPolicy>
+void erf_inv_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool complement, const Policy& pol, const ForwardingPolicy& fpol, const boost::integral_constant<int, 64>* t, const char* function, const boost::true_type&)
+{
+   BOOST_MATH_STD_USING
+   typedef typename tools::promote_args<T>::type result_type;
+   batch_partition<4> part;
+   erf_inv_batch_classifier<result_type> classify(complement);
+   result_type values[batch_block_size];
+   result_type z[batch_block_size];
+   result_type s[batch_block_size];
+   result_type results[batch_block_size];
+   V p[batch_block_size];
+   V q[batch_block_size];
+   V r[batch_block_size];
+   while(first != last)
+   {
+      unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+      for(unsigned i = 0; i < n; ++i)
+         values[i] = static_cast<result_type>(first[i]);
+      part.assign(values, n, classify);
+      for(unsigned g = 0; g < 3; ++g)
+      {
+         const unsigned m = part.size(g);
+         if(m == 0)
+            continue;
+         part.gather(g, values, z);
+         //
+         // Reduce to p, q and sign exactly as erf_inv/erfc_inv do:
+         //
+         if(complement)
+         {
+            for(unsigned i = 0; i < m; ++i)
+            {
+               result_type qq = z[i] > 1 ? result_type(2 - z[i]) : z[i];
+               q[i] = static_cast<V>(qq);
+               p[i] = static_cast<V>(result_type(1 - qq));
+               s[i] = z[i] > 1 ? result_type(-1) : result_type(1);
+            }
+         }
+         else
+         {
+            for(unsigned i = 0; i < m; ++i)
+            {
+               result_type pp = fabs(z[i]);
+               p[i] = static_cast<V>(pp);
+               q[i] = static_cast<V>(result_type(1 - pp));
+               s[i] = z[i] < 0 ? result_type(-1) : result_type(1);
+            }
+         }
+         if(g == 0)
+         {
+            for(unsigned i = 0; i < m; ++i)
+               r[i] = erf_inv_rational_imp(p[i], boost::integral_constant<int, 0>());
+         }
+         else if(g == 1)
+         {
+            for(unsigned i = 0; i < m; ++i)
+               r[i] = erf_inv_rational_imp(q[i], boost::integral_constant<int, 1>());
+            for(unsigned i = 0; i < m; ++i)
+               r[i] = sqrt(-2 * log(q[i])) / r[i];
+         }
+         else
+         {
+            for(unsigned i = 0; i < m; ++i)
+               r[i] = erf_inv_imp(p[i], q[i], fpol, t);
+         }
+         for(unsigned i = 0; i < m; ++i)
+            results[i] = s[i] * policies::checked_narrowing_cast<result_type, ForwardingPolicy>(r[i], function);
+         part.scatter(g, results, out);
+      }
+      for(unsigned i = 0; i < part.size(3); ++i)
+      {
+         unsigned j = part.index(3, i);
+         out[j] = complement ? boost::math::erfc_inv(first[j], pol) : boost::math::erf_inv(first[j], pol);
+      }
+      first += n;
+      out += n;
+   }
+}
+//
+// Grouping only pays off when the rational approximations can be vectorized,
+// for other types we just call the scalar functions.  That includes
+// multiprecision types, which iterate from the 64-bit result anyway:
+//
+template <class T, class V, class Policy, class ForwardingPolicy, class Tag>
+void erf_inv_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool complement, const Policy& pol, const ForwardingPolicy&, const Tag*, const char*, const boost::false_type&)
+{
+   for(; first != last; ++first, ++out)
+      *out = complement ? boost::math::erfc_inv(*first, pol) : boost::math::erf_inv(*first, pol);
+}
+
+template <class T, class V, class Policy, class ForwardingPolicy, class Tag>
+inline void erf_inv_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool complement, const Policy& pol, const ForwardingPolicy& fpol, const Tag* t, const char* function)
+{
+   typedef boost::integral_constant<bool, 
+      (Tag::value == 64) && (boost::is_same<V, float>::value || boost::is_same<V, double>::value)> use_groups;
+   erf_inv_batch_imp<T, V>(first, last, out, complement, pol, fpol, t, function, use_groups());
+}
+
 } // namespace detail
 
 template <class T, class Policy>
@@ -536,6 +689,66 @@ inline typename tools::promote_args<T>::type erf_inv(T z)
    return erf_inv(z, policies::policy<>());
 }
 
+//
+// Array versions, these evaluate the inverse for each value in [first, last)
+// and store the results at out, which must have room for last - first values:
+//
+template <class T, class Policy>
+void erfc_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 64 ? 64 : 0
+   > tag_type;
+   typedef typename policies::evaluation<result_type, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::erf_inv_initializer<eval_type, forwarding_policy>::force_instantiate();
+
+   detail::erf_inv_batch_imp<T, eval_type>(first, last, out, true, pol, forwarding_policy(), static_cast<tag_type const*>(0), "boost::math::erfc_inv<%1%>(%1%, %1%)");
+}
+
+template <class T, class Policy>
+void erf_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 64 ? 64 : 0
+   > tag_type;
+   typedef typename policies::evaluation<result_type, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::erf_inv_initializer<eval_type, forwarding_policy>::force_instantiate();
+
+   detail::erf_inv_batch_imp<T, eval_type>(first, last, out, false, pol, forwarding_policy(), static_cast<tag_type const*>(0), "boost::math::erf_inv<%1%>(%1%, %1%)");
+}
+
+template <class T>
+inline void erfc_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   erfc_inv(first, last, out, policies::policy<>());
+}
+
+template <class T>
+inline void erf_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   erf_inv(first, last, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
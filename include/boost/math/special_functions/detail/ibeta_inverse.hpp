@@ -413,8 +413,8 @@ T temme_method_3_ibeta_inverse(T a, T b, T p, T q, const Policy& pol)
 template <class T, class Policy>
 struct ibeta_roots
 {
-   ibeta_roots(T _a, T _b, T t, bool inv = false)
-      : a(_a), b(_b), target(t), invert(inv) {}
+   ibeta_roots(T _a, T _b, T t, bool inv = false, const ibeta_parameter_terms<T>* c = 0)
+      : a(_a), b(_b), target(t), invert(inv), cache(c) {}
 
    boost::math::tuple<T, T, T> operator()(T x)
    {
@@ -424,7 +424,7 @@ struct ibeta_roots
       
       T f1;
       T y = 1 - x;
-      T f = ibeta_imp(a, b, x, Policy(), invert, true, &f1) - target;
+      T f = ibeta_imp(a, b, x, Policy(), invert, true, &f1, cache) - target;
       if(invert)
          f1 = -f1;
       if(y == 0)
@@ -447,10 +447,11 @@ struct ibeta_roots
 private:
    T a, b, target;
    bool invert;
+   const ibeta_parameter_terms<T>* cache;
 };
 
 template <class T, class Policy>
-T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py)
+T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py, const ibeta_parameter_terms<T>* cache = 0)
 {
    BOOST_MATH_STD_USING  // For ADL of math functions.
 
@@ -874,7 +875,7 @@ T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py)
    //
    boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
    x = boost::math::tools::halley_iterate(
-      boost::math::detail::ibeta_roots<T, Policy>(a, b, (p < q ? p : q), (p < q ? false : true)), x, lower, upper, digits, max_iter);
+      boost::math::detail::ibeta_roots<T, Policy>(a, b, (p < q ? p : q), (p < q ? false : true), cache), x, lower, upper, digits, max_iter);
    policies::check_root_iterations<T>("boost::math::ibeta<%1%>(%1%, %1%, %1%)", max_iter, pol);
    //
    // We don't really want these asserts here, but they are useful for sanity
@@ -1010,6 +1011,101 @@ inline typename tools::promote_args<RT1, RT2, RT3>::type
    return ibetac_inv(a, b, q, static_cast<result_type*>(0), pol);
 }
 
+//
+// Evaluates the incomplete beta function and its inverse repeatedly for fixed a and b:
+// everything which depends only on the parameters is computed once, in the constructor.
+// The results are identical to those of ibeta, ibetac, ibeta_inv and ibetac_inv.
+//
+template <class RealType = double, class Policy = policies::policy<> >
+class ibeta_evaluator
+{
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+public:
+   typedef RealType value_type;
+   typedef Policy policy_type;
+
+   ibeta_evaluator(RealType a, RealType b)
+      : m_a(a), m_b(b), m_terms(static_cast<eval_type>(a), static_cast<eval_type>(b), forwarding_policy()) {}
+
+   RealType a() const { return m_a; }
+   RealType b() const { return m_b; }
+
+   RealType p(RealType x) const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(detail::ibeta_imp(static_cast<eval_type>(m_a), static_cast<eval_type>(m_b), static_cast<eval_type>(x), forwarding_policy(), false, true, static_cast<eval_type*>(0), &m_terms), "boost::math::ibeta<%1%>(%1%,%1%,%1%)");
+   }
+   RealType q(RealType x) const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(detail::ibeta_imp(static_cast<eval_type>(m_a), static_cast<eval_type>(m_b), static_cast<eval_type>(x), forwarding_policy(), true, true, static_cast<eval_type*>(0), &m_terms), "boost::math::ibetac<%1%>(%1%,%1%,%1%)");
+   }
+   RealType inv(RealType p) const
+   {
+      return inv_imp(p, false);
+   }
+   RealType invc(RealType q) const
+   {
+      return inv_imp(q, true);
+   }
+
+   //
+   // Array forms, set out[i] to the function of first[i] for each i in [0, last - first):
+   //
+   void p(const RealType* first, const RealType* last, RealType* out) const
+   {
+      for(; first != last; ++first, ++out)
+         *out = p(*first);
+   }
+   void q(const RealType* first, const RealType* last, RealType* out) const
+   {
+      for(; first != last; ++first, ++out)
+         *out = q(*first);
+   }
+   void inv(const RealType* first, const RealType* last, RealType* out) const
+   {
+      for(; first != last; ++first, ++out)
+         *out = inv(*first);
+   }
+   void invc(const RealType* first, const RealType* last, RealType* out) const
+   {
+      for(; first != last; ++first, ++out)
+         *out = invc(*first);
+   }
+
+private:
+   RealType inv_imp(RealType z, bool complement) const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      const char* function = complement ? "boost::math::ibetac_inv<%1%>(%1%,%1%,%1%)" : "boost::math::ibeta_inv<%1%>(%1%,%1%,%1%)";
+      if(m_a <= 0)
+         return policies::raise_domain_error<RealType>(function, "The argument a to the incomplete beta function inverse must be greater than zero (got a=%1%).", m_a, Policy());
+      if(m_b <= 0)
+         return policies::raise_domain_error<RealType>(function, "The argument b to the incomplete beta function inverse must be greater than zero (got b=%1%).", m_b, Policy());
+      if((z < 0) || (z > 1))
+         return policies::raise_domain_error<RealType>(function, complement ? "Argument q outside the range [0,1] in the incomplete beta function inverse (got q=%1%)." : "Argument p outside the range [0,1] in the incomplete beta function inverse (got p=%1%).", z, Policy());
+      // z is p, or q for the complement:
+      RealType zc = 1 - z;
+      eval_type ry;
+      eval_type rx = detail::ibeta_inv_imp(
+            static_cast<eval_type>(m_a),
+            static_cast<eval_type>(m_b),
+            static_cast<eval_type>(complement ? zc : z),
+            static_cast<eval_type>(complement ? z : zc),
+            forwarding_policy(), &ry, &m_terms);
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(rx, function);
+   }
+
+   RealType m_a, m_b;
+   detail::ibeta_parameter_terms<eval_type> m_terms;
+};
+
 } // namespace math
 } // namespace boost
 
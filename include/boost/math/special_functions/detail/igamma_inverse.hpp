@@ -92,8 +92,51 @@ inline T didonato_FN(T p, T a, T x, unsigned N, T tolerance, const Policy& pol)
    return exp((u + x - log(didonato_SN(a, x, N, tolerance))) / a);
 }
 
+//
+// The functions of a alone which the initial guess may need, evaluated
+// on first use so that inverses sharing the same a compute each only once:
+//
 template <class T, class Policy>
-T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
+class igamma_inverse_a_terms
+{
+public:
+   igamma_inverse_a_terms(T a_, const Policy& pol_) : a(a_), pol(pol_), tgamma_a(0), lgamma_a(0), lgamma_ap1(0), have_tgamma_a(false), have_lgamma_a(false), have_lgamma_ap1(false) {}
+   T tgamma()
+   {
+      if(!have_tgamma_a)
+      {
+         tgamma_a = boost::math::tgamma(a, pol);
+         have_tgamma_a = true;
+      }
+      return tgamma_a;
+   }
+   T lgamma()
+   {
+      if(!have_lgamma_a)
+      {
+         lgamma_a = boost::math::lgamma(a, pol);
+         have_lgamma_a = true;
+      }
+      return lgamma_a;
+   }
+   T lgamma_1p()
+   {
+      if(!have_lgamma_ap1)
+      {
+         lgamma_ap1 = boost::math::lgamma(T(a + 1), pol);
+         have_lgamma_ap1 = true;
+      }
+      return lgamma_ap1;
+   }
+private:
+   T a;
+   Policy pol;
+   T tgamma_a, lgamma_a, lgamma_ap1;
+   bool have_tgamma_a, have_lgamma_a, have_lgamma_ap1;
+};
+
+template <class T, class Policy>
+T find_inverse_gamma(T a, T p, T q, igamma_inverse_a_terms<T, Policy>& terms, const Policy& pol, bool* p_has_10_digits)
 {
    //
    // In order to understand what's going on here, you will
@@ -116,7 +159,7 @@ T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
    }
    else if(a < 1)
    {
-      T g = boost::math::tgamma(a, pol);
+      T g = terms.tgamma();
       T b = q * g;
       BOOST_MATH_INSTRUMENT_VARIABLE(g);
       BOOST_MATH_INSTRUMENT_VARIABLE(b);
@@ -234,7 +277,7 @@ T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
          else
          {
             T D = (std::max)(T(2), T(a * (a - 1)));
-            T lg = boost::math::lgamma(a, pol);
+            T lg = terms.lgamma();
             T lb = log(q) + lg;
             if(lb < -D * 2.3)
             {
@@ -279,7 +322,7 @@ T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
          if(w < 0.15f * ap1)
          {
             // DiDonato and Morris Eq 35:
-            T v = log(p) + boost::math::lgamma(ap1, pol);
+            T v = log(p) + terms.lgamma_1p();
             z = exp((v + w) / a);
             s = boost::math::log1p(z / ap1 * (1 + z / ap2), pol);
             z = exp((v + z - s) / a);
@@ -301,7 +344,7 @@ T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
          {
             // DiDonato and Morris Eq 36:
             T ls = log(didonato_SN(a, z, 100, T(1e-4)));
-            T v = log(p) + boost::math::lgamma(ap1, pol);
+            T v = log(p) + terms.lgamma_1p();
             z = exp((v + z - ls) / a);
             result = z * (1 - (a * log(z) - z - v + ls) / (a - z));
 
@@ -386,7 +429,7 @@ private:
 };
 
 template <class T, class Policy>
-T gamma_p_inv_imp(T a, T p, const Policy& pol)
+T gamma_p_inv_imp(T a, T p, igamma_inverse_a_terms<T, Policy>& terms, const Policy& pol)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
 
@@ -404,7 +447,7 @@ T gamma_p_inv_imp(T a, T p, const Policy& pol)
    if(p == 0)
       return 0;
    bool has_10_digits;
-   T guess = detail::find_inverse_gamma<T>(a, p, 1 - p, pol, &has_10_digits);
+   T guess = detail::find_inverse_gamma<T>(a, p, 1 - p, terms, pol, &has_10_digits);
    if((policies::digits<T, Policy>() <= 36) && has_10_digits)
       return guess;
    T lower = tools::min_value<T>();
@@ -449,7 +492,7 @@ T gamma_p_inv_imp(T a, T p, const Policy& pol)
 }
 
 template <class T, class Policy>
-T gamma_q_inv_imp(T a, T q, const Policy& pol)
+T gamma_q_inv_imp(T a, T q, igamma_inverse_a_terms<T, Policy>& terms, const Policy& pol)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
 
@@ -464,7 +507,7 @@ T gamma_q_inv_imp(T a, T q, const Policy& pol)
    if(q == 1)
       return 0;
    bool has_10_digits;
-   T guess = detail::find_inverse_gamma<T>(a, 1 - q, q, pol, &has_10_digits);
+   T guess = detail::find_inverse_gamma<T>(a, 1 - q, q, terms, pol, &has_10_digits);
    if((policies::digits<T, Policy>() <= 36) && has_10_digits)
       return guess;
    T lower = tools::min_value<T>();
@@ -506,6 +549,35 @@ T gamma_q_inv_imp(T a, T q, const Policy& pol)
    return guess;
 }
 
+template <class T, class Policy>
+inline T gamma_p_inv_imp(T a, T p, const Policy& pol)
+{
+   igamma_inverse_a_terms<T, Policy> terms(a, pol);
+   return gamma_p_inv_imp(a, p, terms, pol);
+}
+
+template <class T, class Policy>
+inline T gamma_q_inv_imp(T a, T q, const Policy& pol)
+{
+   igamma_inverse_a_terms<T, Policy> terms(a, pol);
+   return gamma_q_inv_imp(a, q, terms, pol);
+}
+//
+// Batched inverses for a fixed a: the tgamma(a), lgamma(a) and lgamma(a+1)
+// terms of the initial guesses are shared by the whole batch, the Halley
+// refinement (when the precision requires it) is per value:
+//
+template <class T, class U, class Policy>
+void gamma_inv_batch_imp(T a, const U* first, const U* last, T* out, bool complement, const Policy& pol)
+{
+   igamma_inverse_a_terms<T, Policy> terms(a, pol);
+   for(; first != last; ++first, ++out)
+   {
+      T p = static_cast<T>(*first);
+      *out = complement ? gamma_q_inv_imp(a, p, terms, pol) : gamma_p_inv_imp(a, p, terms, pol);
+   }
+}
+
 } // namespace detail
 
 template <class T1, class T2, class Policy>
@@ -542,6 +614,32 @@ inline typename tools::promote_args<T1, T2>::type
    return gamma_q_inv(a, p, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline void gamma_p_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   detail::gamma_inv_batch_imp(static_cast<result_type>(a), first, last, out, false, pol);
+}
+
+template <class T1, class T2, class Policy>
+inline void gamma_q_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   detail::gamma_inv_batch_imp(static_cast<result_type>(a), first, last, out, true, pol);
+}
+
+template <class T1, class T2>
+inline void gamma_p_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out)
+{
+   gamma_p_inv(a, first, last, out, policies::policy<>());
+}
+
+template <class T1, class T2>
+inline void gamma_q_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out)
+{
+   gamma_q_inv(a, first, last, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
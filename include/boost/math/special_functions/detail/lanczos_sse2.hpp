@@ -20,8 +20,11 @@
 
 namespace boost{ namespace math{ namespace lanczos{
 
-template <>
-inline double lanczos13m53::lanczos_sum<double>(const double& x)
+//
+// Coefficients for lanczos13m53 with the numerator and denominator terms
+// interleaved, so that each pair can be loaded into a single register:
+//
+inline const double* lanczos13m53_sum_coefficients()
 {
    static const ALIGN16 double coeff[26] = {
       static_cast<double>(2.506628274631000270164908177133837338626L),
@@ -51,6 +54,46 @@ inline double lanczos13m53::lanczos_sum<double>(const double& x)
       static_cast<double>(23531376880.41075968857200767445163675473L),
       static_cast<double>(0u)
    };
+   return coeff;
+}
+
+inline const double* lanczos13m53_sum_expG_scaled_coefficients()
+{
+   static const ALIGN16 double coeff[26] = {
+      static_cast<double>(0.006061842346248906525783753964555936883222L),
+      static_cast<double>(1u),
+      static_cast<double>(0.5098416655656676188125178644804694509993L),
+      static_cast<double>(66u),
+      static_cast<double>(19.51992788247617482847860966235652136208L),
+      static_cast<double>(1925u),
+      static_cast<double>(449.9445569063168119446858607650988409623L),
+      static_cast<double>(32670u),
+      static_cast<double>(6955.999602515376140356310115515198987526L),
+      static_cast<double>(357423u),
+      static_cast<double>(75999.29304014542649875303443598909137092L),
+      static_cast<double>(2637558u),
+      static_cast<double>(601859.6171681098786670226533699352302507L),
+      static_cast<double>(13339535u),
+      static_cast<double>(3481712.15498064590882071018964774556468L),
+      static_cast<double>(45995730u),
+      static_cast<double>(14605578.08768506808414169982791359218571L),
+      static_cast<double>(105258076u),
+      static_cast<double>(43338889.32467613834773723740590533316085L),
+      static_cast<double>(150917976u),
+      static_cast<double>(86363131.28813859145546927288977868422342L),
+      static_cast<double>(120543840u),
+      static_cast<double>(103794043.1163445451906271053616070238554L),
+      static_cast<double>(39916800u),
+      static_cast<double>(56906521.91347156388090791033559122686859L),
+      static_cast<double>(0u)
+   };
+   return coeff;
+}
+
+template <>
+inline double lanczos13m53::lanczos_sum<double>(const double& x)
+{
+   const double* coeff = lanczos13m53_sum_coefficients();
 
    static const double lim = 4.31965e+25; // By experiment, the largest x for which the SSE2 code does not go bad.
 
@@ -117,34 +160,7 @@ inline double lanczos13m53::lanczos_sum<double>(const double& x)
 template <>
 inline double lanczos13m53::lanczos_sum_expG_scaled<double>(const double& x)
 {
-   static const ALIGN16 double coeff[26] = {
-         static_cast<double>(0.006061842346248906525783753964555936883222L),
-         static_cast<double>(1u),
-         static_cast<double>(0.5098416655656676188125178644804694509993L),
-         static_cast<double>(66u),
-         static_cast<double>(19.51992788247617482847860966235652136208L),
-         static_cast<double>(1925u),
-         static_cast<double>(449.9445569063168119446858607650988409623L),
-         static_cast<double>(32670u),
-         static_cast<double>(6955.999602515376140356310115515198987526L),
-         static_cast<double>(357423u),
-         static_cast<double>(75999.29304014542649875303443598909137092L),
-         static_cast<double>(2637558u),
-         static_cast<double>(601859.6171681098786670226533699352302507L),
-         static_cast<double>(13339535u),
-         static_cast<double>(3481712.15498064590882071018964774556468L),
-         static_cast<double>(45995730u),
-         static_cast<double>(14605578.08768506808414169982791359218571L),
-         static_cast<double>(105258076u),
-         static_cast<double>(43338889.32467613834773723740590533316085L),
-         static_cast<double>(150917976u),
-         static_cast<double>(86363131.28813859145546927288977868422342L),
-         static_cast<double>(120543840u),
-         static_cast<double>(103794043.1163445451906271053616070238554L),
-         static_cast<double>(39916800u),
-         static_cast<double>(56906521.91347156388090791033559122686859L),
-         static_cast<double>(0u)
-   };
+   const double* coeff = lanczos13m53_sum_expG_scaled_coefficients();
 
    static const double lim = 4.76886e+25; // By experiment, the largest x for which the SSE2 code does not go bad.
 
@@ -208,6 +224,61 @@ inline double lanczos13m53::lanczos_sum_expG_scaled<double>(const double& x)
    return t[0] / t[1];
 }
 
+//
+// Array versions of the above.  These perform exactly the same sequence of
+// operations for each value as the SSE2 code, but work across the values
+// rather than across the numerator and denominator, so that the compiler
+// is free to vectorize using the widest instruction set available:
+//
+inline void lanczos13m53_sum_n(const double* coeff, const double* x, double* result, unsigned n)
+{
+   for(unsigned i = 0; i < n; ++i)
+   {
+      double x2 = x[i] * x[i];
+      double num_even = coeff[0];
+      double denom_even = coeff[1];
+      double num_odd = coeff[2];
+      double denom_odd = coeff[3];
+      for(unsigned k = 4; k < 24; k += 4)
+      {
+         num_even = num_even * x2 + coeff[k];
+         denom_even = denom_even * x2 + coeff[k + 1];
+         num_odd = num_odd * x2 + coeff[k + 2];
+         denom_odd = denom_odd * x2 + coeff[k + 3];
+      }
+      num_even = num_even * x2 + coeff[24];
+      denom_even = denom_even * x2 + coeff[25];
+      num_odd = num_odd * x[i];
+      denom_odd = denom_odd * x[i];
+      result[i] = (num_even + num_odd) / (denom_even + denom_odd);
+   }
+}
+//
+// Large values take a different path in the scalar code, this threshold
+// is below the limits used there so we can just defer to it:
+//
+static const double lanczos13m53_sum_n_limit = 1e25;
+
+inline void lanczos_sum_n(const lanczos13m53&, const double* x, double* result, unsigned n)
+{
+   lanczos13m53_sum_n(lanczos13m53_sum_coefficients(), x, result, n);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      if(!(x[i] <= lanczos13m53_sum_n_limit))
+         result[i] = lanczos13m53::lanczos_sum(x[i]);
+   }
+}
+
+inline void lanczos_sum_expG_scaled_n(const lanczos13m53&, const double* x, double* result, unsigned n)
+{
+   lanczos13m53_sum_n(lanczos13m53_sum_expG_scaled_coefficients(), x, result, n);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      if(!(x[i] <= lanczos13m53_sum_n_limit))
+         result[i] = lanczos13m53::lanczos_sum_expG_scaled(x[i]);
+   }
+}
+
 #ifdef _MSC_VER
 
 BOOST_STATIC_ASSERT(sizeof(double) == sizeof(long double));
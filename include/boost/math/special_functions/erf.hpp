@@ -16,6 +16,9 @@
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/tools/big_constant.hpp>
+#include <boost/math/special_functions/detail/batch_partition.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -190,6 +193,169 @@ T erf_imp(T z, bool invert, const Policy& pol, const Tag& t)
    return result;
 }
 
+//
+// Computes exp(-z*z) / z, splitting z into high and low parts so that
+// the rounding error in z*z does not get magnified by the exponential:
+//
+template <class T>
+inline T erfc_exp_scale_imp(T z, int split_bits)
+{
+   BOOST_MATH_STD_USING
+   T hi, lo;
+   int expon;
+   hi = floor(ldexp(frexp(z, &expon), split_bits));
+   hi = ldexp(hi, expon - split_bits);
+   lo = z - hi;
+   T sq = z * z;
+   T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
+   return exp(-sq) * exp(-err_sqr) / z;
+}
+
+//
+// The rational approximations used by the 53 and 64-bit erf_imp, one per
+// interval: region 0 is erf over [1e-10, 0.5), regions 1 to 4 are the
+// rational parts of erfc over [0.5, 1.5), [1.5, 2.5), [2.5, 4.5) and
+// [4.5, limit).  They are kept separate from erf_imp so that the batched
+// evaluation can apply each one to a whole group of arguments at once.
+//
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 0>&, const boost::integral_constant<int, 53>&)
+{
+   // Maximum Deviation Found:                     1.561e-17
+   // Expected Error Term:                         1.561e-17
+   // Maximum Relative Change in Control Points:   1.155e-04
+   // Max Error found at double precision =        2.961182e-17
+
+   static const T Y = 1.044948577880859375f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0834305892146531832907),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.338165134459360935041),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.0509990735146777432841),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.00772758345802133288487),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.000322780120964605683831),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.455004033050794024546),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0875222600142252549554),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00858571925074406212772),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000370900071787748000569),
+   };
+   T zz = z * z;
+   return z * (Y + tools::evaluate_polynomial(P, zz) / tools::evaluate_polynomial(Q, zz));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 1>&, const boost::integral_constant<int, 53>&)
+{
+   // Maximum Deviation Found:                     3.702e-17
+   // Expected Error Term:                         3.702e-17
+   // Maximum Relative Change in Control Points:   2.845e-04
+   // Max Error found at double precision =        4.841816e-17
+   static const T Y = 0.405935764312744140625f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.098090592216281240205),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.178114665841120341155),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.191003695796775433986),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0888900368967884466578),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0195049001251218801359),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00180424538297014223957),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.84759070983002217845),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.42628004845511324508),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.578052804889902404909),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.12385097467900864233),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0113385233577001411017),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.337511472483094676155e-5),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 0.5)) / tools::evaluate_polynomial(Q, T(z - 0.5));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 2>&, const boost::integral_constant<int, 53>&)
+{
+   // Max Error found at double precision =        6.599585e-18
+   // Maximum Deviation Found:                     3.909e-18
+   // Expected Error Term:                         3.909e-18
+   // Maximum Relative Change in Control Points:   9.886e-05
+   static const T Y = 0.50672817230224609375f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.0243500476207698441272),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0386540375035707201728),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.04394818964209516296),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175679436311802092299),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00323962406290842133584),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000235839115596880717416),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.53991494948552447182),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.982403709157920235114),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.325732924782444448493),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0563921837420478160373),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00410369723978904575884),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 1.5)) / tools::evaluate_polynomial(Q, T(z - 1.5));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 3>&, const boost::integral_constant<int, 53>&)
+{
+   // Maximum Deviation Found:                     1.512e-17
+   // Expected Error Term:                         1.512e-17
+   // Maximum Relative Change in Control Points:   2.222e-04
+   // Max Error found at double precision =        2.062515e-17
+   static const T Y = 0.5405750274658203125f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00295276716530971662634),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0137384425896355332126),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00840807615555585383007),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00212825620914618649141),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000250269961544794627958),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.113212406648847561139e-4),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.04217814166938418171),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.442597659481563127003),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0958492726301061423444),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0105982906484876531489),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000479411269521714493907),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 3.5)) / tools::evaluate_polynomial(Q, T(z - 3.5));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 4>&, const boost::integral_constant<int, 53>&)
+{
+   // Max Error found at double precision =        2.997958e-17
+   // Maximum Deviation Found:                     2.860e-17
+   // Expected Error Term:                         2.859e-17
+   // Maximum Relative Change in Control Points:   1.357e-05
+   static const T Y = 0.5579090118408203125f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00628057170626964891937),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175389834052493308818),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.212652252872804219852),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.687717681153649930619),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -2.5518551727311523996),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -3.22729451764143718517),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -2.8175401114513378771),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 2.79257750980575282228),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 11.0567237927800161565),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 15.930646027911794143),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 22.9367376522880577224),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 13.5064170191802889145),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 5.48409182238641741584),
+   };
+   return Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
+}
+
 template <class T, class Policy>
 T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<int, 53>& t)
 {
@@ -236,28 +402,7 @@ T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<in
       }
       else
       {
-         // Maximum Deviation Found:                     1.561e-17
-         // Expected Error Term:                         1.561e-17
-         // Maximum Relative Change in Control Points:   1.155e-04
-         // Max Error found at double precision =        2.961182e-17
-
-         static const T Y = 1.044948577880859375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0834305892146531832907),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.338165134459360935041),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.0509990735146777432841),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.00772758345802133288487),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.000322780120964605683831),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.455004033050794024546),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0875222600142252549554),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00858571925074406212772),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000370900071787748000569),
-         };
-         T zz = z * z;
-         result = z * (Y + tools::evaluate_polynomial(P, zz) / tools::evaluate_polynomial(Q, zz));
+         result = erf_rational_imp(z, boost::integral_constant<int, 0>(), t);
       }
    }
    else if(invert ? (z < 28) : (z < 5.8f))
@@ -268,137 +413,26 @@ T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<in
       invert = !invert;
       if(z < 1.5f)
       {
-         // Maximum Deviation Found:                     3.702e-17
-         // Expected Error Term:                         3.702e-17
-         // Maximum Relative Change in Control Points:   2.845e-04
-         // Max Error found at double precision =        4.841816e-17
-         static const T Y = 0.405935764312744140625f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.098090592216281240205),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.178114665841120341155),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.191003695796775433986),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0888900368967884466578),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0195049001251218801359),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00180424538297014223957),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.84759070983002217845),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.42628004845511324508),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.578052804889902404909),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.12385097467900864233),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0113385233577001411017),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.337511472483094676155e-5),
-         };
-         BOOST_MATH_INSTRUMENT_VARIABLE(Y);
-         BOOST_MATH_INSTRUMENT_VARIABLE(P[0]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(Q[0]);
          BOOST_MATH_INSTRUMENT_VARIABLE(z);
-         result = Y + tools::evaluate_polynomial(P, T(z - 0.5)) / tools::evaluate_polynomial(Q, T(z - 0.5));
+         result = erf_rational_imp(z, boost::integral_constant<int, 1>(), t);
          BOOST_MATH_INSTRUMENT_VARIABLE(result);
          result *= exp(-z * z) / z;
          BOOST_MATH_INSTRUMENT_VARIABLE(result);
       }
       else if(z < 2.5f)
       {
-         // Max Error found at double precision =        6.599585e-18
-         // Maximum Deviation Found:                     3.909e-18
-         // Expected Error Term:                         3.909e-18
-         // Maximum Relative Change in Control Points:   9.886e-05
-         static const T Y = 0.50672817230224609375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.0243500476207698441272),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0386540375035707201728),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.04394818964209516296),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175679436311802092299),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00323962406290842133584),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000235839115596880717416),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.53991494948552447182),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.982403709157920235114),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.325732924782444448493),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0563921837420478160373),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00410369723978904575884),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 1.5)) / tools::evaluate_polynomial(Q, T(z - 1.5));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 2>(), t);
+         result *= erfc_exp_scale_imp(z, 26);
       }
       else if(z < 4.5f)
       {
-         // Maximum Deviation Found:                     1.512e-17
-         // Expected Error Term:                         1.512e-17
-         // Maximum Relative Change in Control Points:   2.222e-04
-         // Max Error found at double precision =        2.062515e-17
-         static const T Y = 0.5405750274658203125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00295276716530971662634),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0137384425896355332126),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00840807615555585383007),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00212825620914618649141),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000250269961544794627958),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.113212406648847561139e-4),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.04217814166938418171),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.442597659481563127003),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0958492726301061423444),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0105982906484876531489),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000479411269521714493907),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 3.5)) / tools::evaluate_polynomial(Q, T(z - 3.5));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 3>(), t);
+         result *= erfc_exp_scale_imp(z, 26);
       }
       else
       {
-         // Max Error found at double precision =        2.997958e-17
-         // Maximum Deviation Found:                     2.860e-17
-         // Expected Error Term:                         2.859e-17
-         // Maximum Relative Change in Control Points:   1.357e-05
-         static const T Y = 0.5579090118408203125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00628057170626964891937),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175389834052493308818),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.212652252872804219852),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.687717681153649930619),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -2.5518551727311523996),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -3.22729451764143718517),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -2.8175401114513378771),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 2.79257750980575282228),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 11.0567237927800161565),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 15.930646027911794143),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 22.9367376522880577224),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 13.5064170191802889145),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 5.48409182238641741584),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 4>(), t);
+         result *= erfc_exp_scale_imp(z, 26);
       }
    }
    else
@@ -419,6 +453,154 @@ T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<in
 } // template <class T, class Lanczos>T erf_imp(T z, bool invert, const Lanczos& l, const boost::integral_constant<int, 53>& t)
 
 
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 0>&, const boost::integral_constant<int, 64>&)
+{
+   // Max Error found at long double precision =   1.623299e-20
+   // Maximum Deviation Found:                     4.326e-22
+   // Expected Error Term:                         -4.326e-22
+   // Maximum Relative Change in Control Points:   1.474e-04
+   static const T Y = 1.044948577880859375f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0834305892146531988966),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.338097283075565413695),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.0509602734406067204596),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.00904906346158537794396),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.000489468651464798669181),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.200305626366151877759e-4),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.455817300515875172439),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0916537354356241792007),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0102722652675910031202),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.000650511752687851548735),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.189532519105655496778e-4),
+   };
+   return z * (Y + tools::evaluate_polynomial(P, T(z * z)) / tools::evaluate_polynomial(Q, T(z * z)));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 1>&, const boost::integral_constant<int, 64>&)
+{
+   // Max Error found at long double precision =   3.239590e-20
+   // Maximum Deviation Found:                     2.241e-20
+   // Expected Error Term:                         -2.241e-20
+   // Maximum Relative Change in Control Points:   5.110e-03
+   static const T Y = 0.405935764312744140625f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.0980905922162812031672),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.159989089922969141329),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.222359821619935712378),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.127303921703577362312),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0384057530342762400273),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00628431160851156719325),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.000441266654514391746428),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.266689068336295642561e-7),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 2.03237474985469469291),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.78355454954969405222),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.867940326293760578231),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.248025606990021698392),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0396649631833002269861),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00279220237309449026796),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 0.5f)) / tools::evaluate_polynomial(Q, T(z - 0.5f));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 2>&, const boost::integral_constant<int, 64>&)
+{
+   // Max Error found at long double precision =   3.686211e-21
+   // Maximum Deviation Found:                     1.495e-21
+   // Expected Error Term:                         -1.494e-21
+   // Maximum Relative Change in Control Points:   1.793e-04
+   static const T Y = 0.50672817230224609375f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.024350047620769840217),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0343522687935671451309),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0505420824305544949541),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0257479325917757388209),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00669349844190354356118),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00090807914416099524444),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.515917266698050027934e-4),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.71657861671930336344),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.26409634824280366218),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.512371437838969015941),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.120902623051120950935),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0158027197831887485261),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.000897871370778031611439),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 1.5f)) / tools::evaluate_polynomial(Q, T(z - 1.5f));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 3>&, const boost::integral_constant<int, 64>&)
+{
+   // Maximum Deviation Found:                     1.107e-20
+   // Expected Error Term:                         -1.106e-20
+   // Maximum Relative Change in Control Points:   1.709e-04
+   // Max Error found at long double precision =   1.446908e-20
+   static const T Y  = 0.5405750274658203125f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0029527671653097284033),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0141853245895495604051),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0104959584626432293901),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00343963795976100077626),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00059065441194877637899),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.523435380636174008685e-4),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.189896043050331257262e-5),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.19352160185285642574),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.603256964363454392857),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.165411142458540585835),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0259729870946203166468),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00221657568292893699158),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.804149464190309799804e-4),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 3.5f)) / tools::evaluate_polynomial(Q, T(z - 3.5f));
+}
+
+template <class T>
+inline T erf_rational_imp(T z, const boost::integral_constant<int, 4>&, const boost::integral_constant<int, 64>&)
+{
+   // Max Error found at long double precision =   7.961166e-21
+   // Maximum Deviation Found:                     6.677e-21
+   // Expected Error Term:                         6.676e-21
+   // Maximum Relative Change in Control Points:   2.319e-05
+   static const T Y = 0.55825519561767578125f;
+   static const T P[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.00593438793008050214106),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 0.0280666231009089713937),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.141597835204583050043),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -0.978088201154300548842),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -5.47351527796012049443),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -13.8677304660245326627),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -27.1274948720539821722),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -29.2545152747009461519),
+      BOOST_MATH_BIG_CONSTANT(T, 64, -16.8865774499799676937),
+   };
+   static const T Q[] = {    
+      BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 4.72948911186645394541),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 23.6750543147695749212),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 60.0021517335693186785),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 131.766251645149522868),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 178.167924971283482513),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 182.499390505915222699),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 104.365251479578577989),
+      BOOST_MATH_BIG_CONSTANT(T, 64, 30.8365511891224291717),
+   };
+   return Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
+}
+
 template <class T, class Policy>
 T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<int, 64>& t)
 {
@@ -459,28 +641,7 @@ T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<in
       }
       else
       {
-         // Max Error found at long double precision =   1.623299e-20
-         // Maximum Deviation Found:                     4.326e-22
-         // Expected Error Term:                         -4.326e-22
-         // Maximum Relative Change in Control Points:   1.474e-04
-         static const T Y = 1.044948577880859375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0834305892146531988966),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.338097283075565413695),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.0509602734406067204596),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.00904906346158537794396),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.000489468651464798669181),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.200305626366151877759e-4),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.455817300515875172439),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0916537354356241792007),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0102722652675910031202),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.000650511752687851548735),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.189532519105655496778e-4),
-         };
-         result = z * (Y + tools::evaluate_polynomial(P, T(z * z)) / tools::evaluate_polynomial(Q, T(z * z)));
+         result = erf_rational_imp(z, boost::integral_constant<int, 0>(), t);
       }
    }
    else if(invert ? (z < 110) : (z < 6.4f))
@@ -491,148 +652,23 @@ T erf_imp(T z, bool invert, const Policy& pol, const boost::integral_constant<in
       invert = !invert;
       if(z < 1.5)
       {
-         // Max Error found at long double precision =   3.239590e-20
-         // Maximum Deviation Found:                     2.241e-20
-         // Expected Error Term:                         -2.241e-20
-         // Maximum Relative Change in Control Points:   5.110e-03
-         static const T Y = 0.405935764312744140625f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.0980905922162812031672),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.159989089922969141329),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.222359821619935712378),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.127303921703577362312),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0384057530342762400273),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00628431160851156719325),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.000441266654514391746428),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.266689068336295642561e-7),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 2.03237474985469469291),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.78355454954969405222),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.867940326293760578231),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.248025606990021698392),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0396649631833002269861),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00279220237309449026796),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 0.5f)) / tools::evaluate_polynomial(Q, T(z - 0.5f));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 32));
-         hi = ldexp(hi, expon - 32);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 1>(), t);
+         result *= erfc_exp_scale_imp(z, 32);
       }
       else if(z < 2.5)
       {
-         // Max Error found at long double precision =   3.686211e-21
-         // Maximum Deviation Found:                     1.495e-21
-         // Expected Error Term:                         -1.494e-21
-         // Maximum Relative Change in Control Points:   1.793e-04
-         static const T Y = 0.50672817230224609375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.024350047620769840217),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0343522687935671451309),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0505420824305544949541),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0257479325917757388209),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00669349844190354356118),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00090807914416099524444),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.515917266698050027934e-4),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.71657861671930336344),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.26409634824280366218),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.512371437838969015941),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.120902623051120950935),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0158027197831887485261),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.000897871370778031611439),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 1.5f)) / tools::evaluate_polynomial(Q, T(z - 1.5f));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 32));
-         hi = ldexp(hi, expon - 32);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 2>(), t);
+         result *= erfc_exp_scale_imp(z, 32);
       }
       else if(z < 4.5)
       {
-         // Maximum Deviation Found:                     1.107e-20
-         // Expected Error Term:                         -1.106e-20
-         // Maximum Relative Change in Control Points:   1.709e-04
-         // Max Error found at long double precision =   1.446908e-20
-         static const T Y  = 0.5405750274658203125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0029527671653097284033),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0141853245895495604051),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0104959584626432293901),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00343963795976100077626),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00059065441194877637899),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.523435380636174008685e-4),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.189896043050331257262e-5),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.19352160185285642574),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.603256964363454392857),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.165411142458540585835),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0259729870946203166468),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00221657568292893699158),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.804149464190309799804e-4),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 3.5f)) / tools::evaluate_polynomial(Q, T(z - 3.5f));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 32));
-         hi = ldexp(hi, expon - 32);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 3>(), t);
+         result *= erfc_exp_scale_imp(z, 32);
       }
       else
       {
-         // Max Error found at long double precision =   7.961166e-21
-         // Maximum Deviation Found:                     6.677e-21
-         // Expected Error Term:                         6.676e-21
-         // Maximum Relative Change in Control Points:   2.319e-05
-         static const T Y = 0.55825519561767578125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.00593438793008050214106),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 0.0280666231009089713937),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.141597835204583050043),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -0.978088201154300548842),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -5.47351527796012049443),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -13.8677304660245326627),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -27.1274948720539821722),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -29.2545152747009461519),
-            BOOST_MATH_BIG_CONSTANT(T, 64, -16.8865774499799676937),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 64, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 4.72948911186645394541),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 23.6750543147695749212),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 60.0021517335693186785),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 131.766251645149522868),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 178.167924971283482513),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 182.499390505915222699),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 104.365251479578577989),
-            BOOST_MATH_BIG_CONSTANT(T, 64, 30.8365511891224291717),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 32));
-         hi = ldexp(hi, expon - 32);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erf_rational_imp(z, boost::integral_constant<int, 4>(), t);
+         result *= erfc_exp_scale_imp(z, 32);
       }
    }
    else
@@ -1173,6 +1209,178 @@ struct erf_initializer
 template <class T, class Policy, class tag>
 const typename erf_initializer<T, Policy, tag>::init erf_initializer<T, Policy, tag>::initializer;
 
+//
+// Batched evaluation.  The generic version simply hoists the policy
+// handling out of the loop and calls erf_imp for each value:
+//
+template <class T, class V, class Policy, class Tag>
+void erf_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool invert, const Policy& pol, const Tag& t, const char* function)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<result_type, Policy>(erf_imp(static_cast<V>(*first), invert, pol, t), function);
+}
+//
+// Largest argument handled by the rational approximations, beyond this
+// the result is 0 or 1 and is left to erf_imp:
+//
+inline float erf_batch_limit(bool invert, const boost::integral_constant<int, 53>&)
+{
+   return invert ? 28.0f : 5.8f;
+}
+//
+// The exp(-z*z)/z scaling applied to each erfc approximation, exactly
+// as erf_imp applies it:
+//
+template <class T, int N>
+inline T erfc_batch_scale(T z, const boost::integral_constant<int, N>&, const boost::integral_constant<int, 53>&)
+{
+   BOOST_MATH_STD_USING
+   if(N == 1)
+      return exp(-z * z) / z;
+   return erfc_exp_scale_imp(z, 26);
+}
+template <int N>
+inline double erfc_batch_scale(double z, const boost::integral_constant<int, N>&, const boost::integral_constant<int, 53>& t)
+{
+   BOOST_MATH_STD_USING
+   if((N == 1) || !std::numeric_limits<double>::is_iec559)
+      return erfc_batch_scale<double>(z, boost::integral_constant<int, N>(), t);
+   //
+   // Same as erfc_exp_scale_imp(z, 26), except that the high part of z
+   // is obtained by masking off the low 27 bits of the significand, which
+   // gives exactly the same value as the frexp/ldexp/floor sequence for
+   // positive normalised z, but does not stop the loop from being vectorized:
+   //
+   boost::uint64_t bits;
+   std::memcpy(&bits, &z, sizeof(bits));
+   bits &= ~((static_cast<boost::uint64_t>(1u) << 27) - 1);
+   double hi;
+   std::memcpy(&hi, &bits, sizeof(hi));
+   double lo = z - hi;
+   double sq = z * z;
+   double err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
+   return exp(-sq) * exp(-err_sqr) / z;
+}
+//
+// Groups 0 to 4 correspond to the regions of erf_rational_imp, group 5
+// holds everything which is left to erf_imp: zero, tiny and very large
+// arguments, NaN's, and erfc(-0.5) which erf_imp evaluates via erf(0.5).
+//
+template <class V>
+struct erf_batch_classifier
+{
+   erf_batch_classifier(bool inv) : invert(inv), limit(erf_batch_limit(inv, boost::integral_constant<int, 53>())) {}
+
+   template <class T>
+   unsigned operator()(const T& x)const
+   {
+      BOOST_MATH_STD_USING
+      V z = static_cast<V>(x);
+      V a = fabs(z);
+      unsigned g = (a >= 0.5) + (a >= 1.5) + (a >= 2.5) + (a >= 4.5);
+      // NaN's fail the first comparison:
+      bool fallback = !(a >= 1e-10) || !(a < limit) || (invert && (g != 0) && (z < 0) && !(z < -0.5));
+      return fallback ? 5 : g;
+   }
+private:
+   bool invert;
+   float limit;
+};
+
+template <class T, class V, class Policy, int R, class Tag>
+void erf_batch_group(const batch_partition<6>& part, const T* x, typename tools::promote_args<T>::type* out, bool invert, const Policy&, const boost::integral_constant<int, R>& region, const Tag& t, const char* function)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   const unsigned n = part.size(R);
+   if(n == 0)
+      return;
+   V z[batch_block_size];
+   V s[batch_block_size];
+   V r[batch_block_size];
+   result_type results[batch_block_size];
+   part.gather(R, x, z);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      s[i] = z[i] < 0 ? V(-1) : V(1);
+      z[i] *= s[i];
+   }
+   for(unsigned i = 0; i < n; ++i)
+      r[i] = erf_rational_imp(z[i], region, t);
+   if(R != 0)
+   {
+      for(unsigned i = 0; i < n; ++i)
+         r[i] *= erfc_batch_scale(z[i], region, t);
+   }
+   //
+   // Apply the same reflections as erf_imp, the arithmetic here
+   // is exact, so these agree with erf_imp to the last bit:
+   //
+   if(R == 0)
+   {
+      if(invert)
+         for(unsigned i = 0; i < n; ++i)
+            r[i] = 1 - s[i] * r[i];
+      else
+         for(unsigned i = 0; i < n; ++i)
+            r[i] = s[i] * r[i];
+   }
+   else
+   {
+      if(invert)
+         for(unsigned i = 0; i < n; ++i)
+            r[i] = (1 - s[i]) + s[i] * r[i];
+      else
+         for(unsigned i = 0; i < n; ++i)
+            r[i] = s[i] * (1 - r[i]);
+   }
+   for(unsigned i = 0; i < n; ++i)
+      results[i] = policies::checked_narrowing_cast<result_type, Policy>(r[i], function);
+   part.scatter(R, results, out);
+}
+
+template <class T, class V, class Policy, class Tag>
+void erf_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool invert, const Policy& pol, const Tag& t, const char* function, const boost::true_type&)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   batch_partition<6> part;
+   erf_batch_classifier<V> classify(invert);
+   while(first != last)
+   {
+      unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+      part.assign(first, n, classify);
+      erf_batch_group<T, V>(part, first, out, invert, pol, boost::integral_constant<int, 0>(), t, function);
+      erf_batch_group<T, V>(part, first, out, invert, pol, boost::integral_constant<int, 1>(), t, function);
+      erf_batch_group<T, V>(part, first, out, invert, pol, boost::integral_constant<int, 2>(), t, function);
+      erf_batch_group<T, V>(part, first, out, invert, pol, boost::integral_constant<int, 3>(), t, function);
+      erf_batch_group<T, V>(part, first, out, invert, pol, boost::integral_constant<int, 4>(), t, function);
+      for(unsigned i = 0; i < part.size(5); ++i)
+      {
+         unsigned j = part.index(5, i);
+         out[j] = policies::checked_narrowing_cast<result_type, Policy>(erf_imp(static_cast<V>(first[j]), invert, pol, t), function);
+      }
+      first += n;
+      out += n;
+   }
+}
+
+template <class T, class V, class Policy, class Tag>
+inline void erf_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool invert, const Policy& pol, const Tag& t, const char* function, const boost::false_type&)
+{
+   erf_batch_imp<T, V>(first, last, out, invert, pol, t, function);
+}
+//
+// Grouping the arguments only pays off when the approximations can then be
+// vectorized, which in practice means float and double.  For other types
+// (including the 80-bit long double) it's quicker to call erf_imp in a loop:
+//
+template <class T, class V, class Policy>
+inline void erf_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool invert, const Policy& pol, const boost::integral_constant<int, 53>& t, const char* function)
+{
+   typedef boost::integral_constant<bool, boost::is_same<V, float>::value || boost::is_same<V, double>::value> tag_type;
+   erf_batch_imp<T, V>(first, last, out, invert, pol, t, function, tag_type());
+}
+
 } // namespace detail
 
 template <class T, class Policy>
@@ -1257,6 +1465,72 @@ inline typename tools::promote_args<T>::type erfc(T z)
    return boost::math::erfc(z, policies::policy<>());
 }
 
+//
+// Array versions, these evaluate erf/erfc for each value in [first, last)
+// and store the results at out, which must have room for last - first values:
+//
+template <class T, class Policy>
+void erf(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& /* pol */)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   detail::erf_initializer<value_type, forwarding_policy, tag_type>::force_instantiate(); // Force constants to be initialized before main
+
+   detail::erf_batch_imp<T, value_type>(first, last, out, false, forwarding_policy(), tag_type(), "boost::math::erf<%1%>(%1%, %1%)");
+}
+
+template <class T, class Policy>
+void erfc(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& /* pol */)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   detail::erf_initializer<value_type, forwarding_policy, tag_type>::force_instantiate(); // Force constants to be initialized before main
+
+   detail::erf_batch_imp<T, value_type>(first, last, out, true, forwarding_policy(), tag_type(), "boost::math::erfc<%1%>(%1%, %1%)");
+}
+
+template <class T>
+inline void erf(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   boost::math::erf(first, last, out, policies::policy<>());
+}
+
+template <class T>
+inline void erfc(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   boost::math::erfc(first, last, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
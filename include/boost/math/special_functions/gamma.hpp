@@ -31,6 +31,7 @@
 #include <boost/math/special_functions/detail/igamma_large.hpp>
 #include <boost/math/special_functions/detail/unchecked_factorial.hpp>
 #include <boost/math/special_functions/detail/lgamma_small.hpp>
+#include <boost/math/special_functions/detail/batch_partition.hpp>
 #include <boost/math/special_functions/bernoulli.hpp>
 #include <boost/math/special_functions/polygamma.hpp>
 #include <boost/type_traits/is_convertible.hpp>
@@ -1017,14 +1018,15 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined
 // Upper gamma fraction for very small a:
 //
 template <class T, class Policy>
-inline T tgamma_small_upper_part(T a, T x, const Policy& pol, T* pgam = 0, bool invert = false, T* pderivative = 0)
+inline T tgamma_small_upper_part_imp(T a, T x, T tgamma1pm1_a, const Policy& pol, T* pgam, bool invert, T* pderivative)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
    //
-   // Compute the full upper fraction (Q) when a is very small:
+   // Compute the full upper fraction (Q) when a is very small,
+   // given tgamma1pm1(a):
    //
    T result;
-   result = boost::math::tgamma1pm1(a, pol);
+   result = tgamma1pm1_a;
    if(pgam)
       *pgam = (result + 1) / a;
    T p = boost::math::powm1(x, a, pol);
@@ -1042,6 +1044,12 @@ inline T tgamma_small_upper_part(T a, T x, const Policy& pol, T* pgam = 0, bool
       result = -result;
    return result;
 }
+
+template <class T, class Policy>
+inline T tgamma_small_upper_part(T a, T x, const Policy& pol, T* pgam = 0, bool invert = false, T* pderivative = 0)
+{
+   return tgamma_small_upper_part_imp(a, x, T(boost::math::tgamma1pm1(a, pol)), pol, pgam, invert, pderivative);
+}
 //
 // Upper gamma fraction for integer a:
 //
@@ -1940,6 +1948,677 @@ inline typename tools::promote_args<T1, T2>::type
    return tgamma(a, z, policies::policy<>(), tag);
 }
 
+//
+// Batched evaluation of tgamma and lgamma.  The generic versions just call
+// the scalar implementations for each value in the block:
+//
+template <class V, class Policy, class Lanczos>
+void gamma_batch_block(const V* z, V* result, unsigned n, const Policy& pol, const Lanczos& l, const boost::false_type&)
+{
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = gamma_imp(z[i], pol, l);
+}
+
+template <class V, class Policy, class Lanczos>
+void lgamma_batch_block(const V* z, V* result, unsigned n, const Policy& pol, const Lanczos& l, const boost::false_type&)
+{
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = lgamma_imp(z[i], pol, l);
+}
+//
+// When evaluating at float or double precision the arguments are grouped
+// into those which go through the Lanczos approximation, those which are
+// factorials and the rest, which are left to the scalar code.  The Lanczos
+// sums for each group are then evaluated together, and the results are
+// identical to those from gamma_imp and lgamma_imp.
+//
+template <class V>
+struct gamma_batch_classifier
+{
+   gamma_batch_classifier(V lim) : limit(lim) {}
+   unsigned operator()(const V& z)const
+   {
+      BOOST_MATH_STD_USING
+      bool integer = floor(z) == z;
+      // Group 1 are the factorials, 0 use the Lanczos approximation
+      // without risk of overflow, 2 are everything else:
+      if(integer && (z >= 1) && (z < max_factorial<V>::value))
+         return 1;
+      return (!integer && (z >= tools::root_epsilon<V>()) && (z < limit)) ? 0 : 2;
+   }
+private:
+   V limit;
+};
+//
+// A bound on z below which z * log(z + g - 0.5) can not overflow, given
+// that g - 0.5 < 10 for all the approximations used at these precisions:
+//
+template <class V>
+inline V gamma_batch_limit()
+{
+   BOOST_MATH_STD_USING
+   return tools::log_max_value<V>() / log(tools::log_max_value<V>() + 10);
+}
+
+template <class V, class Lanczos>
+void gamma_batch_lanczos(const V* z, V* result, unsigned n, const Lanczos& l)
+{
+   BOOST_MATH_STD_USING
+   lanczos::lanczos_sum_n(l, z, result, n);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      V zgh = (z[i] + static_cast<V>(Lanczos::g()) - boost::math::constants::half<V>());
+      result[i] *= pow(zgh, z[i] - boost::math::constants::half<V>()) / exp(zgh);
+   }
+}
+
+template <class V>
+void gamma_batch_factorial(const V* z, V* result, unsigned n)
+{
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = unchecked_factorial<V>(static_cast<unsigned>(z[i]) - 1);
+}
+
+template <class V, class Policy, class Lanczos>
+void gamma_batch_block(const V* z, V* result, unsigned n, const Policy& pol, const Lanczos& l, const boost::true_type&)
+{
+   batch_partition<3> part;
+   part.assign(z, n, gamma_batch_classifier<V>(gamma_batch_limit<V>()));
+   V x[batch_block_size];
+   V r[batch_block_size];
+   if(unsigned m = part.size(0))
+   {
+      part.gather(0, z, x);
+      gamma_batch_lanczos(x, r, m, l);
+      part.scatter(0, r, result);
+   }
+   if(unsigned m = part.size(1))
+   {
+      part.gather(1, z, x);
+      gamma_batch_factorial(x, r, m);
+      part.scatter(1, r, result);
+   }
+   for(unsigned i = 0; i < part.size(2); ++i)
+   {
+      unsigned j = part.index(2, i);
+      result[j] = gamma_imp(z[j], pol, l);
+   }
+}
+
+template <class V>
+struct lgamma_batch_classifier
+{
+   unsigned operator()(const V& z)const
+   {
+      BOOST_MATH_STD_USING
+      //
+      // lgamma_imp takes the log of tgamma for z in [15, 100) when the type
+      // has enough exponent range, group 0 and 1 are the non-integer and
+      // integer values in that range, group 2 is the asymptotic expansion,
+      // and group 3 is everything else:
+      //
+      bool medium = (std::numeric_limits<V>::max_exponent >= 1024) && (z >= 15) && (z < 100);
+      V lim = (std::numeric_limits<V>::max_exponent >= 1024) ? 100 : 15;
+      if(medium)
+         return floor(z) == z ? 1 : 0;
+      return ((z >= lim) && (z <= tools::max_value<V>())) ? 2 : 3;
+   }
+};
+
+template <class V, class Policy, class Lanczos>
+void lgamma_batch_block(const V* z, V* result, unsigned n, const Policy& pol, const Lanczos& l, const boost::true_type&)
+{
+   BOOST_MATH_STD_USING
+   batch_partition<4> part;
+   part.assign(z, n, lgamma_batch_classifier<V>());
+   V x[batch_block_size];
+   V r[batch_block_size];
+   if(unsigned m = part.size(0))
+   {
+      part.gather(0, z, x);
+      gamma_batch_lanczos(x, r, m, l);
+      for(unsigned i = 0; i < m; ++i)
+         r[i] = log(r[i]);
+      part.scatter(0, r, result);
+   }
+   if(unsigned m = part.size(1))
+   {
+      part.gather(1, z, x);
+      gamma_batch_factorial(x, r, m);
+      for(unsigned i = 0; i < m; ++i)
+         r[i] = log(r[i]);
+      part.scatter(1, r, result);
+   }
+   if(unsigned m = part.size(2))
+   {
+      part.gather(2, z, x);
+      V s[batch_block_size];
+      lanczos::lanczos_sum_expG_scaled_n(l, x, s, m);
+      for(unsigned i = 0; i < m; ++i)
+      {
+         V zgh = static_cast<V>(x[i] + Lanczos::g() - boost::math::constants::half<V>());
+         V t = log(zgh) - 1;
+         t *= x[i] - 0.5f;
+         //
+         // Only add on the lanczos sum part if we're going to need it:
+         //
+         if(t * tools::epsilon<V>() < 20)
+            t += log(s[i]);
+         r[i] = t;
+      }
+      part.scatter(2, r, result);
+   }
+   for(unsigned i = 0; i < part.size(3); ++i)
+   {
+      unsigned j = part.index(3, i);
+      result[j] = lgamma_imp(z[j], pol, l);
+   }
+}
+
+template <class T, class V, class Policy, class Lanczos>
+void gamma_batch_imp(const T* first, const T* last, typename tools::promote_args<T>::type* out, bool log_gamma, const Policy& pol, const Lanczos& l)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef boost::integral_constant<bool, 
+      (boost::is_same<V, float>::value || boost::is_same<V, double>::value) && !boost::is_same<Lanczos, lanczos::undefined_lanczos>::value> use_groups;
+   const char* function = log_gamma ? "boost::math::lgamma<%1%>(%1%)" : "boost::math::tgamma<%1%>(%1%)";
+   V z[batch_block_size];
+   V r[batch_block_size];
+   while(first != last)
+   {
+      unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+      for(unsigned i = 0; i < n; ++i)
+         z[i] = static_cast<V>(first[i]);
+      if(log_gamma)
+         lgamma_batch_block(z, r, n, pol, l, use_groups());
+      else
+         gamma_batch_block(z, r, n, pol, l, use_groups());
+      for(unsigned i = 0; i < n; ++i)
+         out[i] = policies::checked_narrowing_cast<result_type, Policy>(r[i], function);
+      first += n;
+      out += n;
+   }
+}
+//
+// tgamma_ratio: pairs for which tgamma_ratio_imp calls tgamma(x) / tgamma(y)
+// directly are batched via gamma_batch_block, the rest use the scalar code:
+//
+template <class T, class V, class Policy>
+void tgamma_ratio_batch_imp(const T* a_first, const T* a_last, const T* b_first, typename tools::promote_args<T>::type* out, const Policy& pol)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename lanczos::lanczos<V, Policy>::type lanczos_type;
+   typedef boost::integral_constant<bool, 
+      (boost::is_same<V, float>::value || boost::is_same<V, double>::value) && !boost::is_same<lanczos_type, lanczos::undefined_lanczos>::value> use_groups;
+   batch_partition<2> part;
+   unsigned char group[batch_block_size];
+   V x[batch_block_size];
+   V y[batch_block_size];
+   V gx[batch_block_size];
+   V gy[batch_block_size];
+   V r[batch_block_size];
+   while(a_first != a_last)
+   {
+      unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), a_last - a_first));
+      for(unsigned i = 0; i < n; ++i)
+      {
+         x[i] = static_cast<V>(a_first[i]);
+         y[i] = static_cast<V>(b_first[i]);
+         group[i] = (x[i] > tools::min_value<V>()) && (x[i] < max_factorial<V>::value) && (y[i] > 0) && (y[i] < max_factorial<V>::value) ? 0 : 1;
+      }
+      part.assign(group, n, batch_identity());
+      if(unsigned m = part.size(0))
+      {
+         part.gather(0, x, gx);
+         gamma_batch_block(gx, r, m, pol, lanczos_type(), use_groups());
+         for(unsigned i = 0; i < m; ++i)
+            gx[i] = policies::checked_narrowing_cast<V, Policy>(r[i], "boost::math::tgamma<%1%>(%1%)");
+         part.gather(0, y, gy);
+         gamma_batch_block(gy, r, m, pol, lanczos_type(), use_groups());
+         for(unsigned i = 0; i < m; ++i)
+            gy[i] = policies::checked_narrowing_cast<V, Policy>(r[i], "boost::math::tgamma<%1%>(%1%)");
+         for(unsigned i = 0; i < m; ++i)
+            r[i] = gx[i] / gy[i];
+         part.scatter(0, r, x);
+      }
+      for(unsigned i = 0; i < part.size(1); ++i)
+      {
+         unsigned j = part.index(1, i);
+         x[j] = tgamma_ratio_imp(x[j], y[j], pol);
+      }
+      for(unsigned i = 0; i < n; ++i)
+         out[i] = policies::checked_narrowing_cast<result_type, Policy>(x[i], "boost::math::tgamma_delta_ratio<%1%>(%1%, %1%)");
+      a_first += n;
+      b_first += n;
+      out += n;
+   }
+}
+
+//
+// Batched regularised incomplete gamma functions for a fixed a.  Everything
+// that depends only on a - the Lanczos normalisation of the prefix, tgamma(a)
+// and tgamma1pm1(a) when a < 1, tgamma(a+1), and whether a is an integer or
+// half integer - is computed once for the whole batch.  Each block of x values
+// is then split by the method gamma_incomplete_imp would select: the finite
+// sums, series and continued fractions are evaluated in lock step across
+// their group, each lane stopping where the scalar code would, so that the
+// results are identical to gamma_p and gamma_q.
+//
+template <class V, class Policy, class Lanczos>
+class igamma_batch_context
+{
+public:
+   igamma_batch_context(V a_, const Policy& pol) : a(a_), gam(1), tgamma1pm1_a(0), scale(1), tgamma_ap1(1), have_tgamma_ap1(false), tgamma_ap1_overflow(false)
+   {
+      BOOST_MATH_STD_USING
+      V fa = floor(a);
+      is_int = (fa == a);
+      is_half_int = is_int ? false : (fabs(fa - a) == 0.5f);
+      agh = a + static_cast<V>(Lanczos::g()) - V(0.5);
+      if(a < 1)
+      {
+         gam = gamma_imp(a, pol, Lanczos());
+         tgamma1pm1_a = boost::math::tgamma1pm1(a, pol);
+      }
+      else
+         scale = sqrt(agh / boost::math::constants::e<V>()) / Lanczos::lanczos_sum_expG_scaled(a);
+   }
+   //
+   // Whether the context can be used for a, otherwise the batch goes
+   // through the scalar code which raises any errors:
+   //
+   static bool valid(V a)
+   {
+      return (a >= tools::min_value<V>()) && (a <= tools::max_value<V>());
+   }
+   //
+   // The method gamma_incomplete_imp uses for normalised x >= 0,
+   // see the comments there:
+   //
+   int method(V x)const
+   {
+      BOOST_MATH_STD_USING
+      bool is_small_a = (a < 30) && (a <= x + 1) && (x < tools::log_max_value<V>());
+      if(is_small_a && is_int && (x > 0.6))
+         return 0;
+      if(is_small_a && is_half_int && (x > 0.2))
+         return 1;
+      if((x < tools::root_epsilon<V>()) && (a > 1))
+         return 6;
+      if((x > 1000) && ((a < x) || (fabs(a - 50) / x < 1)))
+         return 7;
+      if(x < 0.5)
+         return (-0.4 / log(x) < a) ? 2 : 3;
+      if(x < 1.1)
+         return (x * 0.75f < a) ? 2 : 3;
+      bool use_temme = false;
+      if(a > 20)
+      {
+         V sigma = fabs((x-a)/a);
+         if((a > 200) && (policies::digits<V, Policy>() <= 113))
+            use_temme = 20 / a > sigma * sigma;
+         else if(policies::digits<V, Policy>() <= 64)
+            use_temme = sigma < 0.4;
+      }
+      if(use_temme)
+         return 5;
+      return (x - (1 / (3 * x)) < a) ? 2 : 4;
+   }
+   //
+   // Whether the method computes the complement of the function it returns:
+   //
+   static bool inverts(int method)
+   {
+      return (method == 0) || (method == 1) || (method == 4) || (method == 7);
+   }
+   //
+   // regularised_gamma_prefix with the terms which depend only on a hoisted
+   // out, z is never negative here:
+   //
+   V prefix(V z, const Policy& pol)const
+   {
+      BOOST_MATH_STD_USING
+      if (z >= tools::max_value<V>())
+         return 0;
+      if(a < 1)
+         return pow(z, a) * exp(-z) / gam;
+      V result;
+      V d = ((z - a) - static_cast<V>(Lanczos::g()) + V(0.5)) / agh;
+      if((fabs(d*d*a) <= 100) && (a > 150))
+      {
+         result = a * boost::math::log1pmx(d, pol) + z * static_cast<V>(0.5 - Lanczos::g()) / agh;
+         result = exp(result);
+      }
+      else
+      {
+         V alz = a * log(z / agh);
+         V amz = a - z;
+         if(((std::min)(alz, amz) <= tools::log_min_value<V>()) || ((std::max)(alz, amz) >= tools::log_max_value<V>()))
+            return regularised_gamma_prefix(a, z, pol, Lanczos());
+         result = pow(z / agh, a) * exp(amz);
+      }
+      result *= scale;
+      return result;
+   }
+   //
+   // Methods 0, 2 and 4, each over a whole group of x:
+   //
+   void finite_sum(const V* x, V* result, unsigned n)const
+   {
+      BOOST_MATH_STD_USING
+      V term[batch_block_size];
+      for(unsigned i = 0; i < n; ++i)
+         result[i] = term[i] = exp(-x[i]);
+      // Once a term is zero, so are all the rest, just as in finite_gamma_q:
+      for(unsigned k = 1; k < a; ++k)
+      {
+         for(unsigned i = 0; i < n; ++i)
+         {
+            term[i] /= k;
+            term[i] *= x[i];
+            result[i] += term[i];
+         }
+      }
+   }
+   //
+   // The series and continued fractions are evaluated together for all the
+   // lanes which have yet to converge: converged lanes are dropped from the
+   // arrays as they go, so the work is the same as for the scalar code, but
+   // the lanes' independent dependency chains are interleaved.
+   //
+   // Lanes for which the series fails to converge are flagged in failed:
+   //
+   void series(const V* x, V* result, bool* failed, unsigned n, bool invert, const Policy& pol)const
+   {
+      BOOST_MATH_STD_USING
+      V z[batch_block_size];
+      V sum[batch_block_size];
+      V term[batch_block_size];
+      V total[batch_block_size];
+      unsigned lane[batch_block_size];
+      unsigned m = 0;
+      for(unsigned i = 0; i < n; ++i)
+      {
+         result[i] = prefix(x[i], pol);
+         failed[i] = false;
+         V init_value = 0;
+         if(invert && (result[i] != 0))
+         {
+            init_value = 1;
+            init_value /= result[i];
+            init_value *= -a;
+         }
+         z[m] = x[i];
+         sum[m] = init_value;
+         term[m] = 1;
+         lane[m] = i;
+         m += result[i] != 0;
+      }
+      V factor = policies::get_epsilon<V, Policy>();
+      boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      V ak = a;
+      for(boost::uintmax_t k = 0; m && (k < max_iter); ++k)
+      {
+         ak += 1;
+         unsigned kept = 0;
+         for(unsigned i = 0; i < m; ++i)
+         {
+            V next_term = term[i];
+            V s = sum[i] + next_term;
+            total[lane[i]] = s;
+            z[kept] = z[i];
+            term[kept] = next_term * (z[i] / ak);
+            sum[kept] = s;
+            lane[kept] = lane[i];
+            kept += abs(factor * s) < abs(next_term);
+         }
+         m = kept;
+      }
+      for(unsigned i = 0; i < m; ++i)
+         failed[lane[i]] = true;
+      for(unsigned i = 0; i < n; ++i)
+      {
+         if(result[i] != 0)
+         {
+            result[i] *= total[i] / a;
+            if(invert)
+               result[i] = -result[i];
+         }
+      }
+   }
+   void fraction(const V* x, V* result, unsigned n, const Policy& pol)const
+   {
+      BOOST_MATH_STD_USING
+      V z[batch_block_size];
+      V f[batch_block_size];
+      V C[batch_block_size];
+      V D[batch_block_size];
+      V total[batch_block_size];
+      unsigned lane[batch_block_size];
+      V tiny = tools::detail::tiny_value<V>::get();
+      V terminator = abs(policies::get_epsilon<V, Policy>());
+      V a0 = 1 * (a - 1);
+      unsigned m = 0;
+      for(unsigned i = 0; i < n; ++i)
+      {
+         result[i] = prefix(x[i], pol);
+         z[m] = x[i] - a + 1 + 2;
+         f[m] = z[m] == 0 ? tiny : z[m];
+         C[m] = f[m];
+         D[m] = 0;
+         lane[m] = i;
+         m += result[i] != 0;
+      }
+      for(int k = 2; m; ++k)
+      {
+         V ak = k * (a - k);
+         unsigned kept = 0;
+         for(unsigned i = 0; i < m; ++i)
+         {
+            V b = z[i] + 2;
+            V d = b + ak * D[i];
+            d = d == 0 ? tiny : d;
+            V c = b + ak / C[i];
+            c = c == 0 ? tiny : c;
+            d = 1 / d;
+            V delta = c * d;
+            V g = f[i] * delta;
+            total[lane[i]] = g;
+            z[kept] = b;
+            f[kept] = g;
+            C[kept] = c;
+            D[kept] = d;
+            lane[kept] = lane[i];
+            kept += abs(delta - 1) > terminator;
+         }
+         m = kept;
+      }
+      for(unsigned i = 0; i < n; ++i)
+      {
+         if(result[i] != 0)
+            result[i] *= 1 / (x[i] - a + 1 + a0 / total[i]);
+      }
+   }
+   //
+   // The remaining methods, one x at a time:
+   //
+   V other(int method, V x, bool& invert, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      V result = 0;
+      switch(method)
+      {
+      case 1:
+         result = finite_half_gamma_q(a, x, static_cast<V*>(0), pol);
+         break;
+      case 3:
+         {
+            V g;
+            result = tgamma_small_upper_part_imp(a, x, tgamma1pm1_a, pol, &g, !invert, static_cast<V*>(0));
+            invert = false;
+            result /= g;
+            break;
+         }
+      case 5:
+         {
+            typedef typename policies::precision<V, Policy>::type precision_type;
+
+            typedef boost::integral_constant<int,
+               precision_type::value <= 0 ? 0 :
+               precision_type::value <= 53 ? 53 :
+               precision_type::value <= 64 ? 64 :
+               precision_type::value <= 113 ? 113 : 0
+            > tag_type;
+
+            result = igamma_temme_large(a, x, pol, static_cast<tag_type const*>(0));
+            if(x >= a)
+               invert = !invert;
+            break;
+         }
+      case 6:
+         {
+            if(!have_tgamma_ap1)
+            {
+               // Evaluated on first use so that errors are only raised
+               // when the scalar code would have raised them:
+#ifndef BOOST_NO_EXCEPTIONS
+               try
+               {
+                  tgamma_ap1 = boost::math::tgamma(a + 1, pol);
+               }
+               catch (const std::overflow_error&)
+               {
+                  tgamma_ap1_overflow = true;
+               }
+#else
+               tgamma_ap1 = boost::math::tgamma(a + 1, pol);
+#endif
+               have_tgamma_ap1 = true;
+            }
+            result = tgamma_ap1_overflow ? 0 : V(pow(x, a) / tgamma_ap1);
+            result *= 1 - a * x / (a + 1);
+            break;
+         }
+      case 7:
+         {
+            result = prefix(x, pol);
+            result /= x;
+            if (result != 0)
+               result *= incomplete_tgamma_large_x(a, x, pol);
+            break;
+         }
+      }
+      return result;
+   }
+private:
+   V a, agh, gam, tgamma1pm1_a, scale, tgamma_ap1;
+   bool is_int, is_half_int, have_tgamma_ap1, tgamma_ap1_overflow;
+};
+
+template <class T, class V, class R, class Policy>
+void gamma_incomplete_batch_imp(V a, const T* first, const T* last, R* out, bool invert, const Policy& pol, const boost::false_type&)
+{
+   const char* function = invert ? "gamma_q<%1%>(%1%, %1%)" : "gamma_p<%1%>(%1%, %1%)";
+   for(; first != last; ++first, ++out)
+      *out = policies::checked_narrowing_cast<R, Policy>(gamma_incomplete_imp(a, static_cast<V>(*first), true, invert, pol, static_cast<V*>(0)), function);
+}
+
+template <class T, class V, class R, class Policy>
+void gamma_incomplete_batch_imp(V a, const T* first, const T* last, R* out, bool invert, const Policy& pol, const boost::true_type&)
+{
+   BOOST_MATH_STD_USING
+   typedef typename lanczos::lanczos<V, Policy>::type lanczos_type;
+   if(!igamma_batch_context<V, Policy, lanczos_type>::valid(a))
+      return gamma_incomplete_batch_imp(a, first, last, out, invert, pol, boost::false_type());
+   const char* function = invert ? "gamma_q<%1%>(%1%, %1%)" : "gamma_p<%1%>(%1%, %1%)";
+   igamma_batch_context<V, Policy, lanczos_type> context(a, pol);
+   //
+   // Groups 0, 1 and 2 are the finite sums, series and continued fractions,
+   // group 3 the remaining methods, and group 4 the x values the scalar code
+   // has to handle:
+   //
+   batch_partition<5> part;
+   unsigned char method[batch_block_size];
+   unsigned char group[batch_block_size];
+   bool inv[batch_block_size];
+   bool failed[batch_block_size];
+   V x[batch_block_size];
+   V gx[batch_block_size];
+   V r[batch_block_size];
+   V gr[batch_block_size];
+   while(first != last)
+   {
+      unsigned n = static_cast<unsigned>((std::min)(static_cast<std::ptrdiff_t>(batch_block_size), last - first));
+      for(unsigned i = 0; i < n; ++i)
+      {
+         x[i] = static_cast<V>(first[i]);
+         if((x[i] >= 0) && (x[i] <= tools::max_value<V>()))
+         {
+            int m = context.method(x[i]);
+            method[i] = static_cast<unsigned char>(m);
+            inv[i] = context.inverts(m) ? !invert : invert;
+            group[i] = m == 0 ? 0 : m == 2 ? 1 : m == 4 ? 2 : 3;
+         }
+         else
+            group[i] = 4;
+      }
+      part.assign(group, n, batch_identity());
+      if(unsigned m = part.size(0))
+      {
+         part.gather(0, x, gx);
+         context.finite_sum(gx, gr, m);
+         part.scatter(0, gr, r);
+      }
+      if(unsigned m = part.size(1))
+      {
+         part.gather(1, x, gx);
+         context.series(gx, gr, failed, m, invert, pol);
+         for(unsigned i = 0; i < m; ++i)
+         {
+            unsigned j = part.index(1, i);
+            // The optimised inversion is only possible when the prefix is non-zero:
+            inv[j] = invert && (gr[i] == 0);
+            // Leave the scalar code to raise the error when the series doesn't converge:
+            if(failed[i])
+            {
+               group[j] = 4;
+               gr[i] = gamma_incomplete_imp(a, gx[i], true, invert, pol, static_cast<V*>(0));
+            }
+         }
+         part.scatter(1, gr, r);
+      }
+      if(unsigned m = part.size(2))
+      {
+         part.gather(2, x, gx);
+         context.fraction(gx, gr, m, pol);
+         part.scatter(2, gr, r);
+      }
+      for(unsigned i = 0; i < part.size(3); ++i)
+      {
+         unsigned j = part.index(3, i);
+         r[j] = context.other(method[j], x[j], inv[j], pol);
+      }
+      for(unsigned i = 0; i < n; ++i)
+      {
+         if(group[i] != 4)
+         {
+            if(r[i] > 1)
+               r[i] = 1;
+            if(inv[i])
+               r[i] = 1 - r[i];
+         }
+      }
+      for(unsigned i = 0; i < part.size(4); ++i)
+      {
+         unsigned j = part.index(4, i);
+         r[j] = gamma_incomplete_imp(a, x[j], true, invert, pol, static_cast<V*>(0));
+      }
+      for(unsigned i = 0; i < n; ++i)
+         out[i] = policies::checked_narrowing_cast<R, Policy>(r[i], function);
+      first += n;
+      out += n;
+   }
+}
 
 } // namespace detail
 
@@ -1991,6 +2670,54 @@ inline typename tools::promote_args<T>::type
    return ::boost::math::lgamma(x, 0, policies::policy<>());
 }
 
+template <class T, class Policy>
+inline void tgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::gamma_batch_imp<T, value_type>(first, last, out, false, forwarding_policy(), evaluation_type());
+}
+
+template <class T>
+inline void tgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   tgamma(first, last, out, policies::policy<>());
+}
+
+template <class T, class Policy>
+inline void lgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::lgamma_initializer<value_type, forwarding_policy>::force_instantiate();
+
+   detail::gamma_batch_imp<T, value_type>(first, last, out, true, forwarding_policy(), evaluation_type());
+}
+
+template <class T>
+inline void lgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out)
+{
+   lgamma(first, last, out, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename tools::promote_args<T>::type 
    tgamma1pm1(T z, const Policy& /* pol */)
@@ -2031,7 +2758,7 @@ inline typename tools::promote_args<T1, T2>::type
    return detail::tgamma(a, z, maybe_policy());
 }
 template <class T1, class T2, class Policy>
-inline typename tools::promote_args<T1, T2>::type
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, typename tools::promote_args<T1, T2>::type>::type
    tgamma(T1 a, T2 z, const Policy& pol)
 {
    return detail::tgamma(a, z, pol, boost::false_type());
@@ -2098,6 +2825,30 @@ inline typename tools::promote_args<T1, T2>::type
 {
    return gamma_q(a, z, policies::policy<>());
 }
+template <class T1, class T2, class Policy>
+inline void gamma_q(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef boost::integral_constant<bool, !boost::is_same<evaluation_type, lanczos::undefined_lanczos>::value> use_groups;
+
+   detail::igamma_initializer<value_type, forwarding_policy>::force_instantiate();
+
+   detail::gamma_incomplete_batch_imp(static_cast<value_type>(a), first, last, out, true, forwarding_policy(), use_groups());
+}
+template <class T1, class T2>
+inline void gamma_q(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out)
+{
+   gamma_q(a, first, last, out, policies::policy<>());
+}
 //
 // Regularised lower incomplete gamma:
 //
@@ -2129,6 +2880,30 @@ inline typename tools::promote_args<T1, T2>::type
 {
    return gamma_p(a, z, policies::policy<>());
 }
+template <class T1, class T2, class Policy>
+inline void gamma_p(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef boost::integral_constant<bool, !boost::is_same<evaluation_type, lanczos::undefined_lanczos>::value> use_groups;
+
+   detail::igamma_initializer<value_type, forwarding_policy>::force_instantiate();
+
+   detail::gamma_incomplete_batch_imp(static_cast<value_type>(a), first, last, out, false, forwarding_policy(), use_groups());
+}
+template <class T1, class T2>
+inline void gamma_p(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out)
+{
+   gamma_p(a, first, last, out, policies::policy<>());
+}
 
 // ratios of gamma functions:
 template <class T1, class T2, class Policy>
@@ -2175,6 +2950,26 @@ inline typename tools::promote_args<T1, T2>::type
    return tgamma_ratio(a, b, policies::policy<>());
 }
 
+template <class T, class Policy>
+inline void tgamma_ratio(const T* a_first, const T* a_last, const T* b_first, typename tools::promote_args<T>::type* out, const Policy&)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::tgamma_ratio_batch_imp<T, value_type>(a_first, a_last, b_first, out, forwarding_policy());
+}
+template <class T>
+inline void tgamma_ratio(const T* a_first, const T* a_last, const T* b_first, typename tools::promote_args<T>::type* out)
+{
+   tgamma_ratio(a_first, a_last, b_first, out, policies::policy<>());
+}
+
 template <class T1, class T2, class Policy>
 inline typename tools::promote_args<T1, T2>::type 
    gamma_p_derivative(T1 a, T2 x, const Policy&)
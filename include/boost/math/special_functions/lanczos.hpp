@@ -3210,6 +3210,26 @@ struct lanczos58MP : public boost::integral_constant<int, 334>
 };
 
 
+//
+// Array forms of lanczos_sum and lanczos_sum_expG_scaled, these set result[i]
+// to the value of the scalar function at z[i] for i in [0, n).  Overloads for
+// specific approximations may process several values at once, but must give
+// exactly the same results as the scalar functions:
+//
+template <class Lanczos, class T>
+inline void lanczos_sum_n(const Lanczos&, const T* z, T* result, unsigned n)
+{
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = Lanczos::lanczos_sum(z[i]);
+}
+
+template <class Lanczos, class T>
+inline void lanczos_sum_expG_scaled_n(const Lanczos&, const T* z, T* result, unsigned n)
+{
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = Lanczos::lanczos_sum_expG_scaled(z[i]);
+}
+
 //
 // placeholder for no lanczos info available:
 //
@@ -24,6 +24,52 @@
 namespace boost{
 namespace math{
 
+namespace detail{
+
+// The coefficients a_1, ..., a_r of the expansion of the Legendre-Stieltjes polynomial of degree m > 0
+// in Legendre polynomials, E_m = sum_i a_i P_{2i - 1} for m odd, or sum_i a_i P_{2i - 2} for m even.
+template<class Real>
+std::vector<Real> legendre_stieltjes_coefficients(size_t m)
+{
+    std::ptrdiff_t n = m - 1;
+    std::ptrdiff_t q;
+    std::ptrdiff_t r;
+    bool odd = n & 1;
+    if (odd)
+    {
+       q = 1;
+       r = (n-1)/2 + 2;
+    }
+    else
+    {
+       q = 0;
+       r = n/2 + 1;
+    }
+    std::vector<Real> a(r + 1);
+    // We'll keep the ones-based indexing at the cost of storing a superfluous element
+    // so that we can follow Patterson's notation exactly.
+    a[r] = static_cast<Real>(1);
+    // Make sure using the zero index is a bug:
+    a[0] = std::numeric_limits<Real>::quiet_NaN();
+
+    for (std::ptrdiff_t k = 1; k < r; ++k)
+    {
+        Real ratio = 1;
+        a[r - k] = 0;
+        for (std::ptrdiff_t i = r + 1 - k; i <= r; ++i)
+        {
+            // See Patterson, equation 12
+            std::ptrdiff_t num = (n - q + 2*(i + k - 1))*(n + q + 2*(k - i + 1))*(n-1-q+2*(i-k))*(2*(k+i-1) -1 -q -n);
+            std::ptrdiff_t den = (n - q + 2*(i - k))*(2*(k + i - 1) - q - n)*(n + 1 + q + 2*(k - i))*(n - 1 - q + 2*(i + k));
+            ratio *= static_cast<Real>(num)/static_cast<Real>(den);
+            a[r - k] -= ratio*a[i];
+        }
+    }
+    return a;
+}
+
+}
+
 template<class Real>
 class legendre_stieltjes
 {
@@ -35,40 +81,7 @@ public:
            throw std::domain_error("The Legendre-Stieltjes polynomial is defined for order m > 0.\n");
         }
         m_m = static_cast<int>(m);
-        std::ptrdiff_t n = m - 1;
-        std::ptrdiff_t q;
-        std::ptrdiff_t r;
-        bool odd = n & 1;
-        if (odd)
-        {
-           q = 1;
-           r = (n-1)/2 + 2;
-        }
-        else
-        {
-           q = 0;
-           r = n/2 + 1;
-        }
-        m_a.resize(r + 1);
-        // We'll keep the ones-based indexing at the cost of storing a superfluous element
-        // so that we can follow Patterson's notation exactly.
-        m_a[r] = static_cast<Real>(1);
-        // Make sure using the zero index is a bug:
-        m_a[0] = std::numeric_limits<Real>::quiet_NaN();
-
-        for (std::ptrdiff_t k = 1; k < r; ++k)
-        {
-            Real ratio = 1;
-            m_a[r - k] = 0;
-            for (std::ptrdiff_t i = r + 1 - k; i <= r; ++i)
-            {
-                // See Patterson, equation 12
-                std::ptrdiff_t num = (n - q + 2*(i + k - 1))*(n + q + 2*(k - i + 1))*(n-1-q+2*(i-k))*(2*(k+i-1) -1 -q -n);
-                std::ptrdiff_t den = (n - q + 2*(i - k))*(2*(k + i - 1) - q - n)*(n + 1 + q + 2*(k - i))*(n - 1 - q + 2*(i + k));
-                ratio *= static_cast<Real>(num)/static_cast<Real>(den);
-                m_a[r - k] -= ratio*m_a[i];
-            }
-        }
+        m_a = detail::legendre_stieltjes_coefficients<Real>(m);
     }
 
 
@@ -135,17 +148,41 @@ public:
 
     Real prime(Real x) const
     {
-        Real Em_prime = 0;
+        // As operator(), with the derivatives from P'_{n+1}(x) = P'_{n-1}(x) + (2n+1)P_n(x),
+        // rather than each one from scratch:
+        size_t r = m_a.size() - 1;
+        Real p0 = 1;
+        Real p1 = x;
+        Real d0 = 0;
+        Real d1 = 1;
 
-        for (size_t i = 1; i < m_a.size(); ++i)
+        Real Em_prime;
+        bool odd = m_m & 1;
+        if (odd)
         {
-            if(m_m & 1)
-            {
-                Em_prime += m_a[i]*detail::legendre_p_prime_imp(static_cast<unsigned>(2*i - 1), x, policies::policy<>());
-            }
-            else
+            Em_prime = m_a[1]*d1;
+        }
+        else
+        {
+            Em_prime = m_a[1]*d0;
+        }
+
+        unsigned n = 1;
+        for (size_t i = 2; i <= r; ++i)
+        {
+            for (unsigned j = 0; j < 2; ++j)
             {
-                Em_prime += m_a[i]*detail::legendre_p_prime_imp(static_cast<unsigned>(2*i - 2), x, policies::policy<>());
+                Real p2 = boost::math::legendre_next(n, x, p1, p0);
+                Real d2 = d0 + static_cast<Real>(2*n + 1)*p1;
+                p0 = p1;
+                p1 = p2;
+                d0 = d1;
+                d1 = d2;
+                ++n;
+                if (odd == (j == 1))
+                {
+                    Em_prime += m_a[i]*d1;
+                }
             }
         }
         return Em_prime;
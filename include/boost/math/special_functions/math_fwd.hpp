@@ -174,6 +174,24 @@ namespace boost
    template <class RT, class Policy>// Error function complement inverse.
    typename tools::promote_args<RT>::type erfc_inv(RT z, const Policy& pol);
 
+   // Array versions of the above, [first, last) -> out:
+   template <class T>
+   void erf(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void erf(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&);
+   template <class T>
+   void erfc(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void erfc(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&);
+   template <class T>
+   void erf_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void erf_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& pol);
+   template <class T>
+   void erfc_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void erfc_inv(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy& pol);
+
    // Polynomials:
    template <class T1, class T2, class T3>
    typename tools::promote_args<T1, T2, T3>::type
@@ -456,7 +474,7 @@ namespace boost
    typename tools::promote_args<RT1, RT2>::type tgamma(RT1 a, RT2 z);
 
    template <class RT1, class RT2, class Policy>
-   typename tools::promote_args<RT1, RT2>::type tgamma(RT1 a, RT2 z, const Policy& pol);
+   typename boost::enable_if_c<policies::is_policy<Policy>::value, typename tools::promote_args<RT1, RT2>::type>::type tgamma(RT1 a, RT2 z, const Policy& pol);
 
    template <class RT>
    typename tools::promote_args<RT>::type lgamma(RT z, int* sign);
@@ -500,6 +518,30 @@ namespace boost
    template <class T1, class T2, class Policy>
    typename tools::promote_args<T1, T2>::type tgamma_ratio(T1 a, T2 b, const Policy&);
 
+   // Array versions of tgamma, lgamma and tgamma_ratio:
+   template <class T>
+   void tgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void tgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&);
+   template <class T>
+   void lgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void lgamma(const T* first, const T* last, typename tools::promote_args<T>::type* out, const Policy&);
+   template <class T>
+   void tgamma_ratio(const T* a_first, const T* a_last, const T* b_first, typename tools::promote_args<T>::type* out);
+   template <class T, class Policy>
+   void tgamma_ratio(const T* a_first, const T* a_last, const T* b_first, typename tools::promote_args<T>::type* out, const Policy&);
+
+   // Array versions of gamma_p and gamma_q for a fixed a:
+   template <class T1, class T2>
+   void gamma_q(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out);
+   template <class T1, class T2, class Policy>
+   void gamma_q(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&);
+   template <class T1, class T2>
+   void gamma_p(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out);
+   template <class T1, class T2, class Policy>
+   void gamma_p(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&);
+
    template <class T1, class T2>
    typename tools::promote_args<T1, T2>::type gamma_p_derivative(T1 a, T2 x);
 
@@ -531,6 +573,16 @@ namespace boost
    template <class T1, class T2, class Policy>
    typename tools::promote_args<T1, T2>::type gamma_q_inva(T1 a, T2 q, const Policy&);
 
+   // Array versions of gamma_p_inv and gamma_q_inv for a fixed a:
+   template <class T1, class T2>
+   void gamma_p_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out);
+   template <class T1, class T2, class Policy>
+   void gamma_p_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&);
+   template <class T1, class T2>
+   void gamma_q_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out);
+   template <class T1, class T2, class Policy>
+   void gamma_q_inv(T1 a, const T2* first, const T2* last, typename tools::promote_args<T1, T2>::type* out, const Policy&);
+
    // digamma:
    template <class T>
    typename tools::promote_args<T>::type digamma(T x);
@@ -730,6 +782,58 @@ namespace boost
    template <class T1, class T2>
    typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type cyl_neumann_prime(T1 v, T2 x);
 
+   // Array versions of the above for a fixed order, [first, last) -> out:
+   template <class T1, class T2>
+   void cyl_bessel_j(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out);
+   template <class T1, class T2, class Policy>
+   void cyl_bessel_j(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy&);
+   template <class T1, class T2>
+   void cyl_bessel_i(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out);
+   template <class T1, class T2, class Policy>
+   void cyl_bessel_i(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy&);
+   template <class T1, class T2>
+   void cyl_bessel_k(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out);
+   template <class T1, class T2, class Policy>
+   void cyl_bessel_k(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy&);
+   template <class T1, class T2>
+   void cyl_neumann(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, policies::policy<> >::result_type* out);
+   template <class T1, class T2, class Policy>
+   void cyl_neumann(T1 v, const T2* first, const T2* last, typename detail::bessel_traits<T1, T2, Policy>::result_type* out, const Policy&);
+
+   // Orders v0, v0 + 1, ... v0 + number_of_orders - 1 at fixed x:
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_j_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_j_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_j_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_j_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_i_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_i_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_i_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_i_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_k_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_k_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_bessel_k_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_bessel_k_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_neumann_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_neumann_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+   template <class T1, class T2, class OutputIterator>
+   OutputIterator cyl_neumann_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it);
+   template <class T1, class T2, class OutputIterator, class Policy>
+   OutputIterator cyl_neumann_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it, const Policy&);
+
    template <class T, class Policy>
    typename detail::bessel_traits<T, T, Policy>::result_type sph_neumann(unsigned v, T x, const Policy& pol);
    template <class T, class Policy>
@@ -1293,6 +1397,18 @@ namespace boost
 \
    template <class RT>\
    inline typename boost::math::tools::promote_args<RT>::type erfc_inv(RT z){ return ::boost::math::erfc_inv(z, Policy()); }\
+\
+   template <class T>\
+   inline void erf(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::erf(first, last, out, Policy()); }\
+\
+   template <class T>\
+   inline void erfc(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::erfc(first, last, out, Policy()); }\
+\
+   template <class T>\
+   inline void erf_inv(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::erf_inv(first, last, out, Policy()); }\
+\
+   template <class T>\
+   inline void erfc_inv(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::erfc_inv(first, last, out, Policy()); }\
 \
    using boost::math::legendre_next;\
 \
@@ -1443,12 +1559,27 @@ namespace boost
 \
    template <class RT1, class RT2>\
    inline typename boost::math::tools::promote_args<RT1, RT2>::type gamma_p(RT1 a, RT2 z){ return boost::math::gamma_p(a, z, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void gamma_q(T1 a, const T2* first, const T2* last, typename boost::math::tools::promote_args<T1, T2>::type* out) { ::boost::math::gamma_q(a, first, last, out, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void gamma_p(T1 a, const T2* first, const T2* last, typename boost::math::tools::promote_args<T1, T2>::type* out) { ::boost::math::gamma_p(a, first, last, out, Policy()); }\
 \
    template <class T1, class T2>\
    inline typename boost::math::tools::promote_args<T1, T2>::type tgamma_delta_ratio(T1 z, T2 delta){ return boost::math::tgamma_delta_ratio(z, delta, Policy()); }\
 \
    template <class T1, class T2>\
    inline typename boost::math::tools::promote_args<T1, T2>::type tgamma_ratio(T1 a, T2 b) { return boost::math::tgamma_ratio(a, b, Policy()); }\
+\
+   template <class T>\
+   inline void tgamma(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::tgamma(first, last, out, Policy()); }\
+\
+   template <class T>\
+   inline void lgamma(const T* first, const T* last, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::lgamma(first, last, out, Policy()); }\
+\
+   template <class T>\
+   inline void tgamma_ratio(const T* a_first, const T* a_last, const T* b_first, typename boost::math::tools::promote_args<T>::type* out) { ::boost::math::tgamma_ratio(a_first, a_last, b_first, out, Policy()); }\
 \
    template <class T1, class T2>\
    inline typename boost::math::tools::promote_args<T1, T2>::type gamma_p_derivative(T1 a, T2 x){ return boost::math::gamma_p_derivative(a, x, Policy()); }\
@@ -1464,6 +1595,12 @@ namespace boost
 \
    template <class T1, class T2>\
    inline typename boost::math::tools::promote_args<T1, T2>::type gamma_q_inva(T1 a, T2 q){ return boost::math::gamma_q_inva(a, q, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void gamma_p_inv(T1 a, const T2* first, const T2* last, typename boost::math::tools::promote_args<T1, T2>::type* out) { ::boost::math::gamma_p_inv(a, first, last, out, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void gamma_q_inv(T1 a, const T2* first, const T2* last, typename boost::math::tools::promote_args<T1, T2>::type* out) { ::boost::math::gamma_q_inv(a, first, last, out, Policy()); }\
 \
    template <class T>\
    inline typename boost::math::tools::promote_args<T>::type digamma(T x){ return boost::math::digamma(x, Policy()); }\
@@ -1551,6 +1688,54 @@ namespace boost
    template <class T1, class T2>\
    inline typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type \
    cyl_neumann_prime(T1 v, T2 x){ return boost::math::cyl_neumann_prime(v, x, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void cyl_bessel_j(T1 v, const T2* first, const T2* last, typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type* out)\
+   { boost::math::cyl_bessel_j(v, first, last, out, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void cyl_bessel_i(T1 v, const T2* first, const T2* last, typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type* out)\
+   { boost::math::cyl_bessel_i(v, first, last, out, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void cyl_bessel_k(T1 v, const T2* first, const T2* last, typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type* out)\
+   { boost::math::cyl_bessel_k(v, first, last, out, Policy()); }\
+\
+   template <class T1, class T2>\
+   inline void cyl_neumann(T1 v, const T2* first, const T2* last, typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type* out)\
+   { boost::math::cyl_neumann(v, first, last, out, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_j_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_j_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_j_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_j_prime_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_i_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_i_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_i_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_i_prime_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_k_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_k_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_bessel_k_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_bessel_k_prime_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_neumann_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_neumann_sequence(v0, x, number_of_orders, out_it, Policy()); }\
+\
+   template <class T1, class T2, class OutputIterator>\
+   inline OutputIterator cyl_neumann_prime_sequence(T1 v0, T2 x, unsigned number_of_orders, OutputIterator out_it)\
+   { return boost::math::cyl_neumann_prime_sequence(v0, x, number_of_orders, out_it, Policy()); }\
 \
    template <class T>\
    inline typename boost::math::detail::bessel_traits<T, T, Policy >::result_type \
@@ -0,0 +1,155 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_SINGLE_PASS_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_SINGLE_PASS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<execution>)
+#include <execution>
+#if defined(__cpp_lib_execution) && !defined(BOOST_MATH_NO_EXECUTION_POLICIES)
+#define BOOST_MATH_EXEC_COMPATIBLE
+#endif
+#endif
+
+namespace boost::math::statistics::detail {
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy>
+struct is_parallel_execution_policy
+{
+    using policy_type = std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>;
+    // std::execution::unseq forbids the use of threads, so only these two qualify:
+    static constexpr bool value = std::is_same_v<policy_type, std::execution::parallel_policy>
+                               || std::is_same_v<policy_type, std::execution::parallel_unsequenced_policy>;
+};
+
+template<class ExecutionPolicy, class T = void>
+using enable_if_execution_policy_t = std::enable_if_t<std::is_execution_policy_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>>, T>;
+#endif
+
+// Each thread of a parallel reduction gets at least this many elements,
+// below that the cost of launching the thread isn't recovered:
+static const constexpr std::size_t min_elements_per_thread = 16384;
+
+// Splits [first, last) into one chunk per thread, applies f to each chunk and combines
+// the partial results with merge.  The chunks are merged in order, so the result
+// depends only on the number of threads, which defaults to the hardware concurrency.
+template<class ForwardIterator, class ChunkFunction, class MergeFunction>
+auto chunked_reduce(ForwardIterator first, ForwardIterator last, ChunkFunction f, MergeFunction merge,
+                    std::size_t threads = std::thread::hardware_concurrency())
+{
+    using result_type = decltype(f(first, last));
+    std::size_t elements = std::distance(first, last);
+    threads = std::min(threads, std::max(elements/min_elements_per_thread, std::size_t(1)));
+    if (threads <= 1)
+    {
+        return f(first, last);
+    }
+
+    std::size_t chunk_size = elements/threads;
+    std::vector<std::future<result_type>> futures;
+    futures.reserve(threads - 1);
+    auto it = first;
+    for (std::size_t i = 0; i < threads - 1; ++i)
+    {
+        auto next = std::next(it, chunk_size);
+        futures.emplace_back(std::async(std::launch::async, f, it, next));
+        it = next;
+    }
+    // The calling thread takes the last chunk, which also gets the remainder:
+    result_type tail = f(it, last);
+
+    result_type result = futures[0].get();
+    for (std::size_t i = 1; i < futures.size(); ++i)
+    {
+        result = merge(result, futures[i].get());
+    }
+    return merge(result, tail);
+}
+
+// Adds x to the central sums of n - 1 values, so that n counts x.
+// Follows equation 1.5/1.6 of:
+// https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
+template<std::size_t Order, class Real, class T>
+inline void update_central_sums(T const & x, Real & M1, Real & M2, Real & M3, Real & M4, Real const & n)
+{
+    static_assert(Order >= 1 && Order <= 4, "Only the first four moments are supported.");
+    Real delta21 = x - M1;
+    Real tmp = delta21/n;
+    if constexpr (Order >= 4)
+    {
+        M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
+    }
+    if constexpr (Order >= 3)
+    {
+        M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
+    }
+    if constexpr (Order >= 2)
+    {
+        M2 = M2 + tmp*(n-1)*delta21;
+    }
+    M1 = M1 + tmp;
+}
+
+// Returns (M1, M2, M3, M4, n), where M1 is the mean of [first, last) and Mk is the sum of (x - M1)^k.
+// Only the central sums up to Order are computed, the others are zero.
+template<class Real, std::size_t Order, class ForwardIterator>
+std::tuple<Real, Real, Real, Real, Real> central_sums(ForwardIterator first, ForwardIterator last)
+{
+    Real M1 = *first;
+    Real M2 = 0;
+    Real M3 = 0;
+    Real M4 = 0;
+    Real n = 2;
+    for (auto it = std::next(first); it != last; ++it)
+    {
+        update_central_sums<Order>(*it, M1, M2, M3, M4, n);
+        n += 1;
+    }
+    return std::make_tuple(M1, M2, M3, M4, n - 1);
+}
+
+// Combines the central sums of two disjoint sets, equations 2.1 and 3.1 of:
+// https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
+template<class Real>
+std::tuple<Real, Real, Real, Real, Real> merge_central_sums(std::tuple<Real, Real, Real, Real, Real> const & a,
+                                                            std::tuple<Real, Real, Real, Real, Real> const & b)
+{
+    auto const & [M1_a, M2_a, M3_a, M4_a, n_a] = a;
+    auto const & [M1_b, M2_b, M3_b, M4_b, n_b] = b;
+    Real n = n_a + n_b;
+    Real delta = M1_b - M1_a;
+    Real delta_n = delta/n;
+    Real delta_n2 = delta_n*delta_n;
+    Real term = delta*delta_n*n_a*n_b;
+
+    Real M1 = M1_a + delta_n*n_b;
+    Real M2 = M2_a + M2_b + term;
+    Real M3 = M3_a + M3_b + term*delta_n*(n_a - n_b) + 3*delta_n*(n_a*M2_b - n_b*M2_a);
+    Real M4 = M4_a + M4_b + term*delta_n2*(n_a*n_a - n_a*n_b + n_b*n_b)
+            + 6*delta_n2*(n_a*n_a*M2_b + n_b*n_b*M2_a) + 4*delta_n*(n_a*M3_b - n_b*M3_a);
+    return std::make_tuple(M1, M2, M3, M4, n);
+}
+
+template<class Real, std::size_t Order, class ForwardIterator>
+std::tuple<Real, Real, Real, Real, Real> parallel_central_sums(ForwardIterator first, ForwardIterator last,
+                                                               std::size_t threads = std::thread::hardware_concurrency())
+{
+    return chunked_reduce(first, last,
+                          [](ForwardIterator a, ForwardIterator b) { return central_sums<Real, Order>(a, b); },
+                          merge_central_sums<Real>, threads);
+}
+
+}
+#endif
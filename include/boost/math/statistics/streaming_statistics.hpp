@@ -0,0 +1,388 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_STREAMING_STATISTICS_HPP
+#define BOOST_MATH_STATISTICS_STREAMING_STATISTICS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/math/statistics/detail/single_pass.hpp>
+
+namespace boost::math::statistics {
+
+// Accumulates the first four moments of a stream of values, without storing them.
+// Values may be pushed one at a time, or a block at a time, and two accumulators
+// may be merged, so that a stream can be sharded between threads.
+template<class Real>
+class streaming_moments
+{
+public:
+    streaming_moments() : m_M1{0}, m_M2{0}, m_M3{0}, m_M4{0}, m_count{0} {}
+
+    void push(Real const & x)
+    {
+        if (m_count++ == 0)
+        {
+            m_M1 = x;
+            return;
+        }
+        detail::update_central_sums<4>(x, m_M1, m_M2, m_M3, m_M4, Real(m_count));
+    }
+
+    template<class ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+        // The block is summarized on its own and then merged, the same as a parallel reduction:
+        auto sums = detail::central_sums<Real, 4>(first, last);
+        if (m_count == 0)
+        {
+            Real n;
+            std::tie(m_M1, m_M2, m_M3, m_M4, n) = sums;
+            m_count = std::distance(first, last);
+        }
+        else
+        {
+            merge(sums, std::distance(first, last));
+        }
+    }
+
+    void merge(streaming_moments const & other)
+    {
+        if (other.m_count == 0)
+        {
+            return;
+        }
+        if (m_count == 0)
+        {
+            *this = other;
+            return;
+        }
+        merge(std::make_tuple(other.m_M1, other.m_M2, other.m_M3, other.m_M4, Real(other.m_count)), other.m_count);
+    }
+
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+    Real mean() const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "At least one sample is required to compute the mean.");
+        return m_M1;
+    }
+
+    Real variance() const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "At least one sample is required to compute mean and variance.");
+        return m_M2/Real(m_count);
+    }
+
+    Real sample_variance() const
+    {
+        BOOST_ASSERT_MSG(m_count > 1, "At least two samples are required to compute the sample variance.");
+        return m_M2/Real(m_count - 1);
+    }
+
+    Real skewness() const
+    {
+        using std::sqrt;
+        BOOST_ASSERT_MSG(m_count > 0, "At least one sample is required to compute skewness.");
+        Real var = m_M2/Real(m_count);
+        if (var == 0)
+        {
+            // A constant dataset has no skewness, as in univariate_statistics.hpp.
+            return Real(0);
+        }
+        return m_M3/(m_M2*sqrt(var));
+    }
+
+    Real kurtosis() const
+    {
+        auto [M1, M2, M3, M4] = first_four_moments();
+        if (M2 == 0)
+        {
+            return M2;
+        }
+        return M4/(M2*M2);
+    }
+
+    Real excess_kurtosis() const
+    {
+        return kurtosis() - 3;
+    }
+
+    // Same as first_four_moments in univariate_statistics.hpp: the mean and the second, third and fourth central moments.
+    std::tuple<Real, Real, Real, Real> first_four_moments() const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "At least one sample is required to compute the first four moments.");
+        Real n = Real(m_count);
+        return std::make_tuple(m_M1, m_M2/n, m_M3/n, m_M4/n);
+    }
+
+private:
+    void merge(std::tuple<Real, Real, Real, Real, Real> const & sums, std::size_t count)
+    {
+        Real n;
+        std::tie(m_M1, m_M2, m_M3, m_M4, n) = detail::merge_central_sums<Real>(std::make_tuple(m_M1, m_M2, m_M3, m_M4, Real(m_count)), sums);
+        m_count += count;
+    }
+
+    Real m_M1;
+    Real m_M2;
+    Real m_M3;
+    Real m_M4;
+    std::size_t m_count;
+};
+
+// An approximation to the distribution of a stream of values in bounded memory, from which quantiles
+// (and the median) can be estimated.  This is the KLL sketch of:
+// Karnin, Lang and Liberty, "Optimal Quantile Approximation in Streams", FOCS 2016, https://arxiv.org/abs/1603.05346
+// The values are held in a hierarchy of buffers, level h holding values which each stand in for 2^h of the
+// original values.  When a buffer is full it is sorted and every other value, starting at random from the
+// first or second, is promoted to the next level.  The buffer sizes decrease geometrically by a factor 2/3
+// going down the hierarchy from a maximum of k, so that about 3k values are stored however long the stream,
+// and the error in the rank of a quantile is a small multiple of n/k.
+// Sketches built with the same k can be merged.  NaNs must not be pushed.
+template<class Real>
+class quantile_sketch
+{
+public:
+    explicit quantile_sketch(std::size_t k = 200, std::uint64_t seed = 0)
+        : m_k{k}, m_count{0}, m_retained{0}, m_levels(1), m_capacity{0}, m_min{0}, m_max{0}, m_gen(seed)
+    {
+        BOOST_ASSERT_MSG(k >= 8, "The sketch size k must be at least 8.");
+        m_capacity = total_capacity();
+    }
+
+    void push(Real const & x)
+    {
+        if (m_count++ == 0)
+        {
+            m_min = x;
+            m_max = x;
+        }
+        else
+        {
+            m_min = (std::min)(m_min, x);
+            m_max = (std::max)(m_max, x);
+        }
+        m_levels[0].push_back(x);
+        if (++m_retained >= m_capacity)
+        {
+            compress();
+        }
+    }
+
+    template<class ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last)
+    {
+        for (auto it = first; it != last; ++it)
+        {
+            push(*it);
+        }
+    }
+
+    void merge(quantile_sketch const & other)
+    {
+        BOOST_ASSERT_MSG(other.m_k == m_k, "Only sketches with the same value of k can be merged.");
+        if (other.m_count == 0)
+        {
+            return;
+        }
+        if (&other == this)
+        {
+            quantile_sketch copy(other);
+            merge(copy);
+            return;
+        }
+        if (m_count == 0)
+        {
+            m_min = other.m_min;
+            m_max = other.m_max;
+        }
+        else
+        {
+            m_min = (std::min)(m_min, other.m_min);
+            m_max = (std::max)(m_max, other.m_max);
+        }
+        if (m_levels.size() < other.m_levels.size())
+        {
+            m_levels.resize(other.m_levels.size());
+            m_capacity = total_capacity();
+        }
+        for (std::size_t h = 0; h < other.m_levels.size(); ++h)
+        {
+            m_levels[h].insert(m_levels[h].end(), other.m_levels[h].begin(), other.m_levels[h].end());
+        }
+        m_count += other.m_count;
+        m_retained += other.m_retained;
+        compress();
+    }
+
+    // The number of values pushed so far:
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+    // The number of values held by the sketch:
+    std::size_t retained() const
+    {
+        return m_retained;
+    }
+
+    Real min() const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "The minimum of an empty stream is undefined.");
+        return m_min;
+    }
+
+    Real max() const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "The maximum of an empty stream is undefined.");
+        return m_max;
+    }
+
+    // Returns a value whose rank in the stream is approximately p*count():
+    Real quantile(Real p) const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "The quantile of an empty stream is undefined.");
+        BOOST_ASSERT_MSG(p >= 0 && p <= 1, "The probability must be in [0, 1].");
+        if (p == 0)
+        {
+            return m_min;
+        }
+        if (p == 1)
+        {
+            return m_max;
+        }
+        auto items = weighted_values();
+        Real target = p*Real(m_count);
+        std::uint64_t rank = 0;
+        for (auto const & [value, weight] : items)
+        {
+            rank += weight;
+            if (Real(rank) >= target)
+            {
+                return value;
+            }
+        }
+        return m_max;
+    }
+
+    Real median() const
+    {
+        return quantile(Real(1)/2);
+    }
+
+    // The approximate fraction of the stream which is <= x:
+    Real cdf(Real const & x) const
+    {
+        BOOST_ASSERT_MSG(m_count > 0, "The distribution of an empty stream is undefined.");
+        std::uint64_t rank = 0;
+        for (std::size_t h = 0; h < m_levels.size(); ++h)
+        {
+            for (auto const & y : m_levels[h])
+            {
+                if (y <= x)
+                {
+                    rank += std::uint64_t(1) << h;
+                }
+            }
+        }
+        return Real(rank)/Real(m_count);
+    }
+
+private:
+    std::size_t capacity(std::size_t level) const
+    {
+        using std::ceil;
+        using std::pow;
+        double depth = static_cast<double>(m_levels.size() - level - 1);
+        return (std::max)(std::size_t(2), static_cast<std::size_t>(ceil(m_k*pow(2.0/3, depth))));
+    }
+
+    std::size_t total_capacity() const
+    {
+        std::size_t total = 0;
+        for (std::size_t h = 0; h < m_levels.size(); ++h)
+        {
+            total += capacity(h);
+        }
+        return total;
+    }
+
+    void compress()
+    {
+        while (m_retained >= m_capacity)
+        {
+            std::size_t h = 0;
+            while (m_levels[h].size() < capacity(h))
+            {
+                ++h;
+            }
+            if (h + 1 == m_levels.size())
+            {
+                m_levels.emplace_back();
+                m_capacity = total_capacity();
+            }
+            auto & level = m_levels[h];
+            std::sort(level.begin(), level.end());
+            // An odd value out stays where it is:
+            std::size_t pairs = level.size()/2;
+            std::size_t offset = m_gen() > m_gen.max()/2 ? 1 : 0;
+            auto & next = m_levels[h + 1];
+            for (std::size_t i = 0; i < pairs; ++i)
+            {
+                next.push_back(level[2*i + offset]);
+            }
+            if (level.size() & 1)
+            {
+                level[0] = level.back();
+            }
+            level.resize(level.size() & 1);
+            m_retained -= pairs;
+        }
+    }
+
+    std::vector<std::pair<Real, std::uint64_t>> weighted_values() const
+    {
+        std::vector<std::pair<Real, std::uint64_t>> items;
+        items.reserve(m_retained);
+        for (std::size_t h = 0; h < m_levels.size(); ++h)
+        {
+            for (auto const & y : m_levels[h])
+            {
+                items.emplace_back(y, std::uint64_t(1) << h);
+            }
+        }
+        std::sort(items.begin(), items.end(), [](auto const & a, auto const & b) { return a.first < b.first; });
+        return items;
+    }
+
+    std::size_t m_k;
+    std::size_t m_count;
+    std::size_t m_retained;
+    std::vector<std::vector<Real>> m_levels;
+    // The sum of the capacities of the levels:
+    std::size_t m_capacity;
+    Real m_min;
+    Real m_max;
+    std::minstd_rand m_gen;
+};
+
+}
+#endif
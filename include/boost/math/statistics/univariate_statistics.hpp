@@ -10,8 +10,10 @@
 #include <iterator>
 #include <tuple>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 #include <boost/assert.hpp>
+#include <boost/math/statistics/detail/single_pass.hpp>
 
 namespace boost::math::statistics {
 
@@ -83,39 +85,53 @@ inline auto mean(Container const & v)
     return mean(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+// The overloads taking a std::execution policy split the data into one chunk per hardware thread when
+// the policy is par or par_unseq, and merge the partial results; any other policy gives the sequential algorithm.
+template<class ExecutionPolicy, class ForwardIterator>
+auto mean(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(mean(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        using Result = decltype(mean(first, last));
+        using Partial = std::pair<Result, Result>;
+        BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute the mean.");
+        auto chunk_mean = [](ForwardIterator a, ForwardIterator b) { return Partial(mean(a, b), Result(std::distance(a, b))); };
+        auto merge = [](Partial const & a, Partial const & b)
+        {
+            Result n = a.second + b.second;
+            return Partial(a.first + (b.first - a.first)*(b.second/n), n);
+        };
+        return detail::chunked_reduce(first, last, chunk_mean, merge).first;
+    }
+    else
+    {
+        return mean(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto mean(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(mean(v.cbegin(), v.cend()))>
+{
+    return mean(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 template<class ForwardIterator>
 auto variance(ForwardIterator first, ForwardIterator last)
 {
     using Real = typename std::iterator_traits<ForwardIterator>::value_type;
     BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute mean and variance.");
-    // Higham, Accuracy and Stability, equation 1.6a and 1.6b:
+    // Welford's recurrence, as in Higham, Accuracy and Stability, equation 1.6a and 1.6b:
     if constexpr (std::is_integral<Real>::value)
     {
-        double M = *first;
-        double Q = 0;
-        double k = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            double tmp = *it - M;
-            Q = Q + ((k-1)*tmp*tmp)/k;
-            M = M + tmp/k;
-            k += 1;
-        }
-        return Q/(k-1);
+        auto [M1, M2, M3, M4, n] = detail::central_sums<double, 2>(first, last);
+        return M2/n;
     }
     else
     {
-        Real M = *first;
-        Real Q = 0;
-        Real k = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            Real tmp = (*it - M)/k;
-            Q += k*(k-1)*tmp*tmp;
-            M += tmp;
-            k += 1;
-        }
-        return Q/(k-1);
+        auto [M1, M2, M3, M4, n] = detail::central_sums<Real, 2>(first, last);
+        return M2/n;
     }
 }
 
@@ -125,6 +141,30 @@ inline auto variance(Container const & v)
     return variance(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto variance(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(variance(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        using Real = decltype(variance(first, last));
+        BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute mean and variance.");
+        auto [M1, M2, M3, M4, n] = detail::parallel_central_sums<Real, 2>(first, last);
+        return M2/n;
+    }
+    else
+    {
+        return variance(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto variance(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(variance(v.cbegin(), v.cend()))>
+{
+    return variance(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 template<class ForwardIterator>
 auto sample_variance(ForwardIterator first, ForwardIterator last)
 {
@@ -139,39 +179,37 @@ inline auto sample_variance(Container const & v)
     return sample_variance(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto sample_variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(sample_variance(first, last))>
+{
+    std::size_t n = std::distance(first, last);
+    BOOST_ASSERT_MSG(n > 1, "At least two samples are required to compute the sample variance.");
+    return n*variance(std::forward<ExecutionPolicy>(exec), first, last)/(n-1);
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto sample_variance(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(sample_variance(v.cbegin(), v.cend()))>
+{
+    return sample_variance(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 template<class ForwardIterator>
 auto mean_and_sample_variance(ForwardIterator first, ForwardIterator last)
 {
     using Real = typename std::iterator_traits<ForwardIterator>::value_type;
     BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute mean and variance.");
-    // Higham, Accuracy and Stability, equation 1.6a and 1.6b:
+    // Welford's recurrence, as in Higham, Accuracy and Stability, equation 1.6a and 1.6b:
     if constexpr (std::is_integral<Real>::value)
     {
-        double M = *first;
-        double Q = 0;
-        double k = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            double tmp = *it - M;
-            Q = Q + ((k-1)*tmp*tmp)/k;
-            M = M + tmp/k;
-            k += 1;
-        }
-        return std::pair<double, double>{M, Q/(k-2)};
+        auto [M1, M2, M3, M4, n] = detail::central_sums<double, 2>(first, last);
+        return std::pair<double, double>{M1, M2/(n-1)};
     }
     else
     {
-        Real M = *first;
-        Real Q = 0;
-        Real k = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            Real tmp = (*it - M)/k;
-            Q += k*(k-1)*tmp*tmp;
-            M += tmp;
-            k += 1;
-        }
-        return std::pair<Real, Real>{M, Q/(k-2)};
+        auto [M1, M2, M3, M4, n] = detail::central_sums<Real, 2>(first, last);
+        return std::pair<Real, Real>{M1, M2/(n-1)};
     }
 }
 
@@ -191,21 +229,8 @@ auto skewness(ForwardIterator first, ForwardIterator last)
     BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute skewness.");
     if constexpr (std::is_integral<Real>::value)
     {
-        double M1 = *first;
-        double M2 = 0;
-        double M3 = 0;
-        double n = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            double delta21 = *it - M1;
-            double tmp = delta21/n;
-            M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
-            M2 = M2 + tmp*(n-1)*delta21;
-            M1 = M1 + tmp;
-            n += 1;
-        }
-
-        double var = M2/(n-1);
+        auto [M1, M2, M3, M4, n] = detail::central_sums<double, 3>(first, last);
+        double var = M2/n;
         if (var == 0)
         {
             // The limit is technically undefined, but the interpretation here is clear:
@@ -217,21 +242,8 @@ auto skewness(ForwardIterator first, ForwardIterator last)
     }
     else
     {
-        Real M1 = *first;
-        Real M2 = 0;
-        Real M3 = 0;
-        Real n = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            Real delta21 = *it - M1;
-            Real tmp = delta21/n;
-            M3 += tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
-            M2 += tmp*(n-1)*delta21;
-            M1 += tmp;
-            n += 1;
-        }
-
-        Real var = M2/(n-1);
+        auto [M1, M2, M3, M4, n] = detail::central_sums<Real, 3>(first, last);
+        Real var = M2/n;
         if (var == 0)
         {
             // The limit is technically undefined, but the interpretation here is clear:
@@ -249,6 +261,37 @@ inline auto skewness(Container const & v)
     return skewness(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto skewness(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(skewness(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        using Real = decltype(skewness(first, last));
+        using std::sqrt;
+        BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute skewness.");
+        auto [M1, M2, M3, M4, n] = detail::parallel_central_sums<Real, 3>(first, last);
+        Real var = M2/n;
+        if (var == 0)
+        {
+            // A constant dataset has no skewness, as in the sequential case.
+            return Real(0);
+        }
+        return M3/(M2*sqrt(var));
+    }
+    else
+    {
+        return skewness(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto skewness(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(skewness(v.cbegin(), v.cend()))>
+{
+    return skewness(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 // Follows equation 1.5/1.6 of:
 // https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
 template<class ForwardIterator>
@@ -258,43 +301,13 @@ auto first_four_moments(ForwardIterator first, ForwardIterator last)
     BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute the first four moments.");
     if constexpr (std::is_integral<Real>::value)
     {
-        double M1 = *first;
-        double M2 = 0;
-        double M3 = 0;
-        double M4 = 0;
-        double n = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            double delta21 = *it - M1;
-            double tmp = delta21/n;
-            M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
-            M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
-            M2 = M2 + tmp*(n-1)*delta21;
-            M1 = M1 + tmp;
-            n += 1;
-        }
-
-        return std::make_tuple(M1, M2/(n-1), M3/(n-1), M4/(n-1));
+        auto [M1, M2, M3, M4, n] = detail::central_sums<double, 4>(first, last);
+        return std::make_tuple(M1, M2/n, M3/n, M4/n);
     }
     else
     {
-        Real M1 = *first;
-        Real M2 = 0;
-        Real M3 = 0;
-        Real M4 = 0;
-        Real n = 2;
-        for (auto it = std::next(first); it != last; ++it)
-        {
-            Real delta21 = *it - M1;
-            Real tmp = delta21/n;
-            M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
-            M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
-            M2 = M2 + tmp*(n-1)*delta21;
-            M1 = M1 + tmp;
-            n += 1;
-        }
-
-        return std::make_tuple(M1, M2/(n-1), M3/(n-1), M4/(n-1));
+        auto [M1, M2, M3, M4, n] = detail::central_sums<Real, 4>(first, last);
+        return std::make_tuple(M1, M2/n, M3/n, M4/n);
     }
 }
 
@@ -304,6 +317,30 @@ inline auto first_four_moments(Container const & v)
     return first_four_moments(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto first_four_moments(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(first_four_moments(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        using Real = std::tuple_element_t<0, decltype(first_four_moments(first, last))>;
+        BOOST_ASSERT_MSG(first != last, "At least one sample is required to compute the first four moments.");
+        auto [M1, M2, M3, M4, n] = detail::parallel_central_sums<Real, 4>(first, last);
+        return std::make_tuple(M1, M2/n, M3/n, M4/n);
+    }
+    else
+    {
+        return first_four_moments(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto first_four_moments(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(first_four_moments(v.cbegin(), v.cend()))>
+{
+    return first_four_moments(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 
 // Follows equation 1.6 of:
 // https://prod.sandia.gov/techlib-noauth/access-control.cgi/2008/086212.pdf
@@ -324,6 +361,25 @@ inline auto kurtosis(Container const & v)
     return kurtosis(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto kurtosis(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(kurtosis(first, last))>
+{
+    auto [M1, M2, M3, M4] = first_four_moments(std::forward<ExecutionPolicy>(exec), first, last);
+    if (M2 == 0)
+    {
+        return M2;
+    }
+    return M4/(M2*M2);
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto kurtosis(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(kurtosis(v.cbegin(), v.cend()))>
+{
+    return kurtosis(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 template<class ForwardIterator>
 auto excess_kurtosis(ForwardIterator first, ForwardIterator last)
 {
@@ -336,6 +392,20 @@ inline auto excess_kurtosis(Container const & v)
     return excess_kurtosis(v.cbegin(), v.cend());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class ForwardIterator>
+auto excess_kurtosis(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(excess_kurtosis(first, last))>
+{
+    return kurtosis(std::forward<ExecutionPolicy>(exec), first, last) - 3;
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto excess_kurtosis(ExecutionPolicy&& exec, Container const & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(excess_kurtosis(v.cbegin(), v.cend()))>
+{
+    return excess_kurtosis(std::forward<ExecutionPolicy>(exec), v.cbegin(), v.cend());
+}
+#endif
+
 
 template<class RandomAccessIterator>
 auto median(RandomAccessIterator first, RandomAccessIterator last)
@@ -364,6 +434,46 @@ inline auto median(RandomAccessContainer & v)
     return median(v.begin(), v.end());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class RandomAccessIterator>
+auto median(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(median(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        std::size_t num_elems = std::distance(first, last);
+        BOOST_ASSERT_MSG(num_elems > 0, "The median of a zero length vector is undefined.");
+        if (num_elems < detail::min_elements_per_thread)
+        {
+            return median(first, last);
+        }
+        if (num_elems & 1)
+        {
+            auto middle = first + (num_elems - 1)/2;
+            std::nth_element(exec, first, middle, last);
+            return *middle;
+        }
+        else
+        {
+            auto middle = first + num_elems/2 - 1;
+            std::nth_element(exec, first, middle, last);
+            // The upper half is now >= *middle, so its least element is the other half of the median:
+            auto next = std::min_element(exec, middle + 1, last);
+            return (*middle + *next)/2;
+        }
+    }
+    else
+    {
+        return median(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer>
+inline auto median(ExecutionPolicy&& exec, RandomAccessContainer & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(median(v.begin(), v.end()))>
+{
+    return median(std::forward<ExecutionPolicy>(exec), v.begin(), v.end());
+}
+#endif
+
 template<class RandomAccessIterator>
 auto gini_coefficient(RandomAccessIterator first, RandomAccessIterator last)
 {
@@ -419,6 +529,59 @@ inline auto gini_coefficient(RandomAccessContainer & v)
     return gini_coefficient(v.begin(), v.end());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class RandomAccessIterator>
+auto gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(gini_coefficient(first, last))>
+{
+    if constexpr (detail::is_parallel_execution_policy<ExecutionPolicy>::value)
+    {
+        using Real = decltype(gini_coefficient(first, last));
+        using Partial = std::pair<Real, Real>;
+        BOOST_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+        if (static_cast<std::size_t>(std::distance(first, last)) < detail::min_elements_per_thread)
+        {
+            return gini_coefficient(first, last);
+        }
+
+        std::sort(exec, first, last);
+        // Each chunk computes its share of sum(i*x_i) and sum(x_i), with i counted from the start of the whole range:
+        auto chunk_sums = [first](RandomAccessIterator a, RandomAccessIterator b)
+        {
+            Real i = Real(std::distance(first, a) + 1);
+            Real num = 0;
+            Real denom = 0;
+            for (auto it = a; it != b; ++it)
+            {
+                num += *it*i;
+                denom += *it;
+                ++i;
+            }
+            return Partial(num, denom);
+        };
+        auto merge = [](Partial const & a, Partial const & b) { return Partial(a.first + b.first, a.second + b.second); };
+        auto [num, denom] = detail::chunked_reduce(first, last, chunk_sums, merge);
+
+        // If the l1 norm is zero, all elements are zero, so every element is the same.
+        if (denom == 0)
+        {
+            return Real(0);
+        }
+        Real i = Real(std::distance(first, last) + 1);
+        return ((2*num)/denom - i)/(i-1);
+    }
+    else
+    {
+        return gini_coefficient(first, last);
+    }
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer>
+inline auto gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(gini_coefficient(v.begin(), v.end()))>
+{
+    return gini_coefficient(std::forward<ExecutionPolicy>(exec), v.begin(), v.end());
+}
+#endif
+
 template<class RandomAccessIterator>
 inline auto sample_gini_coefficient(RandomAccessIterator first, RandomAccessIterator last)
 {
@@ -432,6 +595,21 @@ inline auto sample_gini_coefficient(RandomAccessContainer & v)
     return sample_gini_coefficient(v.begin(), v.end());
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class ExecutionPolicy, class RandomAccessIterator>
+inline auto sample_gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(sample_gini_coefficient(first, last))>
+{
+    std::size_t n = std::distance(first, last);
+    return n*gini_coefficient(std::forward<ExecutionPolicy>(exec), first, last)/(n-1);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer>
+inline auto sample_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer & v) -> detail::enable_if_execution_policy_t<ExecutionPolicy, decltype(sample_gini_coefficient(v.begin(), v.end()))>
+{
+    return sample_gini_coefficient(std::forward<ExecutionPolicy>(exec), v.begin(), v.end());
+}
+#endif
+
 template<class RandomAccessIterator>
 auto median_absolute_deviation(RandomAccessIterator first, RandomAccessIterator last, typename std::iterator_traits<RandomAccessIterator>::value_type center=std::numeric_limits<typename std::iterator_traits<RandomAccessIterator>::value_type>::quiet_NaN())
 {
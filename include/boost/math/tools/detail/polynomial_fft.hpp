@@ -0,0 +1,530 @@
+//  Copyright the Boost.Math authors, 2020
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_FFT_HPP
+#define BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_FFT_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+//
+// Polynomials with floating point coefficients whose factors both have at least
+// BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD coefficients are multiplied via a fast
+// Fourier transform, and divided by Newton iteration when both the divisor and
+// quotient have at least BOOST_MATH_POLYNOMIAL_DIVISION_THRESHOLD coefficients.
+// Integer coefficients are multiplied via a number theoretic transform when both
+// factors have at least BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD coefficients.
+// Smaller polynomials use the classical algorithms:
+//
+#ifndef BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD
+#  define BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD 200
+#endif
+#ifndef BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD
+#  define BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD 600
+#endif
+#ifndef BOOST_MATH_POLYNOMIAL_DIVISION_THRESHOLD
+#  define BOOST_MATH_POLYNOMIAL_DIVISION_THRESHOLD 1000
+#endif
+
+namespace boost{ namespace math{ namespace tools{ namespace detail{
+
+//
+// Type of transform used for multiplication of polynomials with coefficient type T:
+// 0: none, 1: complex FFT, 2: NTT.
+//
+template <class T>
+struct polynomial_transform_type
+{
+   BOOST_STATIC_CONSTANT(int, value = boost::is_floating_point<T>::value ? 1 :
+      (boost::is_integral<T>::value && !boost::is_same<T, bool>::value && (sizeof(T) <= sizeof(boost::uint64_t))) ? 2 : 0);
+};
+
+//
+// Floats are transformed in double precision, which costs little and
+// considerably improves the accuracy of the result:
+//
+template <class T>
+struct polynomial_fft_working_type { typedef T type; };
+template <>
+struct polynomial_fft_working_type<float> { typedef double type; };
+
+inline std::size_t polynomial_transform_size(std::size_t n)
+{
+   std::size_t result = 1;
+   while(result < n)
+      result <<= 1;
+   return result;
+}
+
+template <class T>
+void bit_reverse_permute(std::vector<T>& a)
+{
+   std::size_t n = a.size();
+   for(std::size_t i = 1, j = 0; i < n; ++i)
+   {
+      std::size_t bit = n >> 1;
+      for(; j & bit; bit >>= 1)
+         j ^= bit;
+      j ^= bit;
+      if(i < j)
+         std::swap(a[i], a[j]);
+   }
+}
+
+//
+// In place radix 2 FFT of a, where roots[k] = exp(-2 pi i k / a.size()) for k < a.size() / 2.
+// The inverse transform is not scaled.  Complex multiplication is written out by hand
+// as std::complex may check for infinities and NaN's on every multiplication.
+//
+template <class W>
+void fft_transform(std::vector<std::complex<W> >& a, const std::vector<std::complex<W> >& roots, bool inverse)
+{
+   std::size_t n = a.size();
+   bit_reverse_permute(a);
+   for(std::size_t len = 2; len <= n; len <<= 1)
+   {
+      std::size_t half = len / 2;
+      std::size_t step = n / len;
+      for(std::size_t i = 0; i < n; i += len)
+      {
+         for(std::size_t k = 0; k < half; ++k)
+         {
+            const std::complex<W>& w = roots[k * step];
+            W wr = w.real();
+            W wi = inverse ? -w.imag() : w.imag();
+            std::complex<W>& x = a[i + k];
+            std::complex<W>& y = a[i + k + half];
+            W vr = y.real() * wr - y.imag() * wi;
+            W vi = y.real() * wi + y.imag() * wr;
+            W ur = x.real();
+            W ui = x.imag();
+            x = std::complex<W>(ur + vr, ui + vi);
+            y = std::complex<W>(ur - vr, ui - vi);
+         }
+      }
+   }
+}
+
+template <class W>
+void fft_roots(std::vector<std::complex<W> >& roots, std::size_t n)
+{
+   roots.resize(n / 2);
+   if(n < 4)
+   {
+      if(n == 2)
+         roots[0] = std::complex<W>(1, 0);
+      return;
+   }
+   BOOST_MATH_STD_USING
+   //
+   // Only the first octant requires trigonometric functions, the rest follow from
+   // exp(-i (pi/2 - t)) = -i exp(i t) and exp(-2 pi i (k + n/4) / n) = -i exp(-2 pi i k / n):
+   //
+   std::size_t quarter = n / 4;
+   for(std::size_t k = 0; k <= n / 8; ++k)
+   {
+      W t = boost::math::constants::two_pi<W>() * static_cast<W>(k) / static_cast<W>(n);
+      W c = cos(t);
+      W s = sin(t);
+      roots[k] = std::complex<W>(c, -s);
+      roots[quarter - k] = std::complex<W>(s, -c);
+   }
+   for(std::size_t k = 0; k < quarter; ++k)
+      roots[k + quarter] = std::complex<W>(roots[k].imag(), -roots[k].real());
+}
+
+//
+// Returns the largest absolute value in a, or a negative value if any element is not finite:
+//
+template <class T>
+T polynomial_max_abs(const std::vector<T>& a)
+{
+   BOOST_MATH_STD_USING
+   T result = 0;
+   for(std::size_t i = 0; i < a.size(); ++i)
+   {
+      if(!(boost::math::isfinite)(a[i]))
+         return -1;
+      result = (std::max)(result, static_cast<T>(fabs(a[i])));
+   }
+   return result;
+}
+
+//
+// Sets max_abs and min_abs to the largest and smallest nonzero absolute values in a, and
+// returns true, or returns false if any element is not finite or all of them are zero:
+//
+template <class T>
+bool polynomial_magnitudes(const std::vector<T>& a, T& max_abs, T& min_abs)
+{
+   BOOST_MATH_STD_USING
+   max_abs = 0;
+   min_abs = 0;
+   for(std::size_t i = 0; i < a.size(); ++i)
+   {
+      if(!(boost::math::isfinite)(a[i]))
+         return false;
+      T x = fabs(a[i]);
+      if(x == 0)
+         continue;
+      max_abs = (std::max)(max_abs, x);
+      min_abs = (min_abs == 0) ? x : (std::min)(min_abs, x);
+   }
+   return max_abs > 0;
+}
+
+//
+// Multiplication with floating point coefficients: both factors are scaled to
+// have unit magnitude and packed into the real and imaginary parts of a single
+// complex sequence, so that one forward and one inverse transform suffice.
+// The error in each coefficient of the result is then of the order of
+// epsilon * log(n) * max|a| * max|b|, whatever the size of that coefficient,
+// whereas the classical algorithm's error is relative to the terms which make it up.
+// So a coefficient of the product formed from terms much smaller than max|a| * max|b|
+// loses relative accuracy: we return false, and the classical algorithm is used, when
+// the ratios of the largest to the smallest nonzero coefficients of the two factors
+// multiply to more than 2^(digits(W) - digits(T)/2), so that at least half the digits
+// of every coefficient are correct relative to its terms.
+//
+template <class T>
+bool fft_multiply_imp(std::vector<T>& result, const std::vector<T>& a, const std::vector<T>& b, const boost::integral_constant<int, 1>&)
+{
+   BOOST_MATH_STD_USING
+   typedef typename polynomial_fft_working_type<T>::type W;
+   T max_a, min_a, max_b, min_b;
+   if(!polynomial_magnitudes(a, max_a, min_a) || !polynomial_magnitudes(b, max_b, min_b))
+      return false;
+   int ea, eb, fa, fb;
+   frexp(max_a, &ea);
+   frexp(max_b, &eb);
+   frexp(min_a, &fa);
+   frexp(min_b, &fb);
+   if((ea - fa) + (eb - fb) > std::numeric_limits<W>::digits - std::numeric_limits<T>::digits / 2)
+      return false;
+
+   std::size_t result_size = a.size() + b.size() - 1;
+   std::size_t n = polynomial_transform_size(result_size);
+   std::vector<std::complex<W> > roots;
+   fft_roots(roots, n);
+
+   std::vector<std::complex<W> > z(n);
+   for(std::size_t i = 0; i < a.size(); ++i)
+      z[i] = std::complex<W>(ldexp(static_cast<W>(a[i]), -ea), 0);
+   for(std::size_t i = 0; i < b.size(); ++i)
+      z[i] = std::complex<W>(z[i].real(), ldexp(static_cast<W>(b[i]), -eb));
+   fft_transform(z, roots, false);
+
+   // Separate the transforms of a and b and multiply them:
+   std::vector<std::complex<W> > c(n);
+   for(std::size_t k = 0; k < n; ++k)
+   {
+      std::size_t nk = (n - k) & (n - 1);
+      W zr = z[k].real(), zi = z[k].imag();
+      W nr = z[nk].real(), ni = -z[nk].imag();
+      W ar = (zr + nr) / 2, ai = (zi + ni) / 2;
+      W br = (zi - ni) / 2, bi = (nr - zr) / 2;
+      c[k] = std::complex<W>(ar * br - ai * bi, ar * bi + ai * br);
+   }
+   fft_transform(c, roots, true);
+
+   result.resize(result_size);
+   for(std::size_t i = 0; i < result_size; ++i)
+      result[i] = static_cast<T>(ldexp(c[i].real() / static_cast<W>(n), ea + eb));
+   return true;
+}
+
+//
+// Number theoretic transforms modulo three primes of the form k * 2^m + 1,
+// each of which has 3 as a primitive root.  The modulus is a template
+// argument so that reductions compile to multiplications rather than divisions:
+//
+static const boost::uint32_t ntt_p0 = 998244353u;
+static const boost::uint32_t ntt_p1 = 167772161u;
+static const boost::uint32_t ntt_p2 = 469762049u;
+
+template <boost::uint32_t P>
+inline boost::uint32_t ntt_mul(boost::uint32_t a, boost::uint32_t b)
+{
+   return static_cast<boost::uint32_t>((static_cast<boost::uint64_t>(a) * b) % P);
+}
+
+template <boost::uint32_t P>
+inline boost::uint32_t ntt_pow(boost::uint32_t a, boost::uint64_t e)
+{
+   boost::uint32_t result = 1;
+   while(e)
+   {
+      if(e & 1)
+         result = ntt_mul<P>(result, a);
+      a = ntt_mul<P>(a, a);
+      e >>= 1;
+   }
+   return result;
+}
+
+template <boost::uint32_t P>
+void ntt_transform(std::vector<boost::uint32_t>& a, const std::vector<boost::uint32_t>& roots)
+{
+   std::size_t n = a.size();
+   bit_reverse_permute(a);
+   for(std::size_t len = 2; len <= n; len <<= 1)
+   {
+      std::size_t half = len / 2;
+      std::size_t step = n / len;
+      for(std::size_t i = 0; i < n; i += len)
+      {
+         for(std::size_t k = 0; k < half; ++k)
+         {
+            boost::uint32_t u = a[i + k];
+            boost::uint32_t v = ntt_mul<P>(a[i + k + half], roots[k * step]);
+            a[i + k] = u + v >= P ? u + v - P : u + v;
+            a[i + k + half] = u >= v ? u - v : u + P - v;
+         }
+      }
+   }
+}
+
+template <boost::uint32_t P, class T>
+inline boost::uint32_t ntt_residue(T x, const boost::true_type&)
+{
+   boost::int64_t r = static_cast<boost::int64_t>(x) % static_cast<boost::int64_t>(P);
+   return static_cast<boost::uint32_t>(r < 0 ? r + P : r);
+}
+template <boost::uint32_t P, class T>
+inline boost::uint32_t ntt_residue(T x, const boost::false_type&)
+{
+   return static_cast<boost::uint32_t>(static_cast<boost::uint64_t>(x) % P);
+}
+
+//
+// Computes the product of a and b modulo P, with transforms of length n:
+//
+template <boost::uint32_t P, class T>
+void ntt_multiply_mod(std::vector<boost::uint32_t>& result, const std::vector<T>& a, const std::vector<T>& b, std::size_t n)
+{
+   std::vector<boost::uint32_t> roots(n / 2);
+   boost::uint32_t w = ntt_pow<P>(3, (P - 1) / n);
+   if(!roots.empty())
+      roots[0] = 1;
+   for(std::size_t k = 1; k < roots.size(); ++k)
+      roots[k] = ntt_mul<P>(roots[k - 1], w);
+
+   std::vector<boost::uint32_t> fb(n);
+   result.assign(n, 0);
+   for(std::size_t k = 0; k < a.size(); ++k)
+      result[k] = ntt_residue<P>(a[k], boost::is_signed<T>());
+   for(std::size_t k = 0; k < b.size(); ++k)
+      fb[k] = ntt_residue<P>(b[k], boost::is_signed<T>());
+   ntt_transform<P>(result, roots);
+   ntt_transform<P>(fb, roots);
+   for(std::size_t k = 0; k < n; ++k)
+      result[k] = ntt_mul<P>(result[k], fb[k]);
+   // The inverse transform is the forward transform with the outputs reversed:
+   ntt_transform<P>(result, roots);
+   std::reverse(result.begin() + 1, result.end());
+   boost::uint32_t n_inverse = ntt_pow<P>(static_cast<boost::uint32_t>(n % P), P - 2);
+   for(std::size_t k = 0; k < n; ++k)
+      result[k] = ntt_mul<P>(result[k], n_inverse);
+}
+
+//
+// Multiplication with integer coefficients: the product is computed modulo three
+// primes and reconstructed by the Chinese remainder theorem.  This is exact provided
+// the magnitude of every coefficient of the product is less than half the product of
+// the primes (about 2^85), otherwise we return false and the classical algorithm is used.
+//
+template <class T>
+bool fft_multiply_imp(std::vector<T>& result, const std::vector<T>& a, const std::vector<T>& b, const boost::integral_constant<int, 2>&)
+{
+   BOOST_MATH_STD_USING
+   double max_a = 0;
+   double max_b = 0;
+   for(std::size_t i = 0; i < a.size(); ++i)
+      max_a = (std::max)(max_a, fabs(static_cast<double>(a[i])));
+   for(std::size_t i = 0; i < b.size(); ++i)
+      max_b = (std::max)(max_b, fabs(static_cast<double>(b[i])));
+   if(max_a * max_b * static_cast<double>((std::min)(a.size(), b.size())) >= ldexp(1.0, 84))
+      return false;
+
+   std::size_t result_size = a.size() + b.size() - 1;
+   std::size_t n = polynomial_transform_size(result_size);
+   // All three primes support transforms of up to 2^23 elements:
+   if(n > (static_cast<std::size_t>(1u) << 23))
+      return false;
+
+   std::vector<boost::uint32_t> r0, r1, r2;
+   ntt_multiply_mod<ntt_p0>(r0, a, b, n);
+   ntt_multiply_mod<ntt_p1>(r1, a, b, n);
+   ntt_multiply_mod<ntt_p2>(r2, a, b, n);
+   //
+   // Garner's algorithm gives the mixed radix digits of each coefficient,
+   // c = v0 + v1 * p0 + v2 * p0 * p1 with 0 <= v[i] < p[i], which we then
+   // evaluate modulo 2^64:
+   //
+   const boost::uint32_t p0_inverse = ntt_pow<ntt_p1>(ntt_p0 % ntt_p1, ntt_p1 - 2);
+   const boost::uint32_t p0p1_inverse = ntt_pow<ntt_p2>(ntt_mul<ntt_p2>(ntt_p0 % ntt_p2, ntt_p1), ntt_p2 - 2);
+   const boost::uint64_t p0p1 = static_cast<boost::uint64_t>(ntt_p0) * ntt_p1;
+   const boost::uint64_t modulus = p0p1 * ntt_p2; // modulo 2^64
+   result.resize(result_size);
+   for(std::size_t k = 0; k < result_size; ++k)
+   {
+      boost::uint32_t v0 = r0[k];
+      boost::uint32_t v1 = ntt_mul<ntt_p1>((r1[k] + ntt_p1 - v0 % ntt_p1) % ntt_p1, p0_inverse);
+      boost::uint32_t partial = static_cast<boost::uint32_t>((v0 + static_cast<boost::uint64_t>(v1) * ntt_p0) % ntt_p2);
+      boost::uint32_t v2 = ntt_mul<ntt_p2>((r2[k] + ntt_p2 - partial) % ntt_p2, p0p1_inverse);
+      boost::uint64_t c = v0 + static_cast<boost::uint64_t>(v1) * ntt_p0 + static_cast<boost::uint64_t>(v2) * p0p1;
+      // Values above half the modulus represent negative numbers, compare digit by digit:
+      bool negative = (v2 != ntt_p2 / 2) ? v2 > ntt_p2 / 2 : (v1 != ntt_p1 / 2) ? v1 > ntt_p1 / 2 : v0 > ntt_p0 / 2;
+      if(negative)
+         c -= modulus;
+      result[k] = static_cast<T>(c);
+   }
+   return true;
+}
+
+template <class T>
+inline bool fft_multiply_imp(std::vector<T>&, const std::vector<T>&, const std::vector<T>&, const boost::integral_constant<int, 0>&)
+{
+   return false;
+}
+
+//
+// Sets result to the product of the polynomials with coefficients a and b, and returns true,
+// if the coefficient type supports a fast transform and both are large enough to benefit
+// from it, otherwise returns false:
+//
+template <class T, class U, class V>
+inline bool fft_multiply(std::vector<T>&, const std::vector<U>&, const std::vector<V>&)
+{
+   return false;
+}
+
+template <class T>
+inline bool fft_multiply(std::vector<T>& result, const std::vector<T>& a, const std::vector<T>& b)
+{
+   static const int transform = polynomial_transform_type<T>::value;
+   std::size_t threshold = transform == 1 ? BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD : BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD;
+   if((std::min)(a.size(), b.size()) < threshold)
+      return false;
+   return fft_multiply_imp(result, a, b, boost::integral_constant<int, transform>());
+}
+
+template <class T>
+void multiply_coefficients(std::vector<T>& result, const std::vector<T>& a, const std::vector<T>& b)
+{
+   if(a.empty() || b.empty())
+   {
+      result.clear();
+      return;
+   }
+   if(fft_multiply(result, a, b))
+      return;
+   result.assign(a.size() + b.size() - 1, T(0));
+   for(std::size_t i = 0; i < a.size(); ++i)
+      for(std::size_t j = 0; j < b.size(); ++j)
+         result[i + j] += a[i] * b[j];
+}
+
+//
+// Computes the first k coefficients of the power series g = 1 / f, by Newton iteration:
+// given g = 1 / f mod x^m, then g - g * (f * g - 1) = 1 / f mod x^2m.
+// The coefficients of g grow geometrically when f has roots inside the unit circle,
+// in which case the quotient computed from g would be inaccurate: returns false
+// if |f[0] * g[i]| exceeds the square root of the largest integer representable in T.
+//
+template <class T>
+bool power_series_inverse(std::vector<T>& g, const std::vector<T>& f, std::size_t k)
+{
+   BOOST_MATH_STD_USING
+   T limit = ldexp(T(1), std::numeric_limits<T>::digits / 2) / fabs(f[0]);
+   g.assign(1, 1 / f[0]);
+   std::vector<T> f_low, e, t;
+   std::size_t m = 1;
+   while(m < k)
+   {
+      m = (std::min)(2 * m, k);
+      f_low.assign(f.begin(), f.begin() + (std::min)(m, f.size()));
+      multiply_coefficients(e, f_low, g);
+      e.resize(m, T(0));
+      e[0] -= 1;
+      multiply_coefficients(t, g, e);
+      g.resize(m, T(0));
+      for(std::size_t i = 0; i < m; ++i)
+         g[i] -= t[i];
+      T max_g = polynomial_max_abs(g);
+      if((max_g < 0) || (max_g > limit))
+         return false;
+   }
+   return true;
+}
+
+//
+// Division of u by v with floating point coefficients, via the reversed polynomials:
+// rev(q) = rev(u) / rev(v) mod x^(deg(u) - deg(v) + 1).  Returns false if the
+// classical algorithm should be used instead, either because the polynomials are
+// small, or because v has roots outside the unit circle which would make the
+// Newton iteration inaccurate.
+//
+template <class T>
+bool newton_division_imp(std::vector<T>& q, std::vector<T>& r, const std::vector<T>& u, const std::vector<T>& v, const boost::true_type&)
+{
+   std::size_t m = u.size() - 1;
+   std::size_t n = v.size() - 1;
+   std::size_t k = m - n + 1;
+   if((n < BOOST_MATH_POLYNOMIAL_DIVISION_THRESHOLD) || (k < BOOST_MATH_POLYNOMIAL_DIVISION_THRESHOLD))
+      return false;
+
+   std::vector<T> reversed_u(k), reversed_v((std::min)(k, n + 1));
+   for(std::size_t i = 0; i < k; ++i)
+      reversed_u[i] = u[m - i];
+   for(std::size_t i = 0; i < reversed_v.size(); ++i)
+      reversed_v[i] = v[n - i];
+   std::vector<T> inverse, reversed_q;
+   if(!power_series_inverse(inverse, reversed_v, k))
+      return false;
+   multiply_coefficients(reversed_q, reversed_u, inverse);
+   q.resize(k);
+   for(std::size_t i = 0; i < k; ++i)
+      q[i] = reversed_q[k - 1 - i];
+
+   std::vector<T> qv;
+   multiply_coefficients(qv, q, v);
+   r.resize(n);
+   for(std::size_t i = 0; i < n; ++i)
+      r[i] = u[i] - qv[i];
+   return true;
+}
+
+template <class T>
+inline bool newton_division_imp(std::vector<T>&, std::vector<T>&, const std::vector<T>&, const std::vector<T>&, const boost::false_type&)
+{
+   return false;
+}
+
+template <class T>
+inline bool newton_division(std::vector<T>& q, std::vector<T>& r, const std::vector<T>& u, const std::vector<T>& v)
+{
+   return newton_division_imp(q, r, u, v, boost::integral_constant<bool, polynomial_transform_type<T>::value == 1>());
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_FFT_HPP
@@ -0,0 +1,192 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_DETAIL_THREAD_POOL_HPP
+#define BOOST_MATH_TOOLS_DETAIL_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost { namespace math { namespace tools { namespace detail {
+
+//
+// A fixed set of worker threads which repeatedly share out the indices [0, n) of a job.
+// The thread which submits a job works on it too, so a pool of size 1 has no workers
+// and simply runs the job in a loop.  Workers sleep between jobs, so that an adaptive
+// routine can keep one pool for all of its refinement steps rather than paying for
+// thread creation on every step.
+//
+class thread_pool
+{
+public:
+   explicit thread_pool(std::size_t threads)
+      : m_job(nullptr), m_size(0), m_next(0), m_active(0), m_generation(0), m_stop(false)
+   {
+      for (std::size_t i = 1; i < threads; ++i)
+      {
+         m_workers.emplace_back(&thread_pool::work, this);
+      }
+   }
+
+   thread_pool(const thread_pool&) = delete;
+   thread_pool& operator=(const thread_pool&) = delete;
+
+   ~thread_pool()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_stop = true;
+      }
+      m_wake.notify_all();
+      for (auto& t : m_workers)
+      {
+         t.join();
+      }
+   }
+
+   std::size_t size() const
+   {
+      return m_workers.size() + 1;
+   }
+
+   //
+   // Calls f(i) for each i in [0, n) and returns when all the calls have completed.
+   // If any call throws, the remaining indices are abandoned and the first exception
+   // is rethrown here.
+   //
+   void parallel_for(std::size_t n, const std::function<void(std::size_t)>& f)
+   {
+      if (m_workers.empty() || n < 2)
+      {
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            f(i);
+         }
+         return;
+      }
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_job = &f;
+         m_size = n;
+         m_next = 0;
+         m_active = m_workers.size();
+         m_error = nullptr;
+         ++m_generation;
+      }
+      m_wake.notify_all();
+      run_job();
+      std::exception_ptr error;
+      {
+         std::unique_lock<std::mutex> lock(m_mutex);
+         m_done.wait(lock, [this] { return m_active == 0; });
+         m_job = nullptr;
+         error = m_error;
+      }
+      if (error)
+      {
+         std::rethrow_exception(error);
+      }
+   }
+
+private:
+   void work()
+   {
+      std::size_t seen = 0;
+      for (;;)
+      {
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop)
+            {
+               return;
+            }
+            seen = m_generation;
+         }
+         run_job();
+         {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_active == 0)
+            {
+               m_done.notify_one();
+            }
+         }
+      }
+   }
+
+   void run_job()
+   {
+      for (;;)
+      {
+         std::size_t i = m_next.fetch_add(1);
+         if (i >= m_size)
+         {
+            return;
+         }
+         try
+         {
+            (*m_job)(i);
+         }
+         catch (...)
+         {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error)
+            {
+               m_error = std::current_exception();
+            }
+            m_next = m_size;
+         }
+      }
+   }
+
+   std::vector<std::thread> m_workers;
+   std::mutex m_mutex;
+   std::condition_variable m_wake;
+   std::condition_variable m_done;
+   const std::function<void(std::size_t)>* m_job;
+   std::size_t m_size;
+   std::atomic<std::size_t> m_next;
+   std::size_t m_active;
+   std::size_t m_generation;
+   std::exception_ptr m_error;
+   bool m_stop;
+};
+
+//
+// Calls f(begin, end) on consecutive pieces [begin, end) of [0, n), of at least min_chunk
+// indices each (except perhaps the last), on up to threads threads of a pool made for the
+// purpose.  There are a few pieces per thread, so that a thread which is held up does not
+// hold up the rest, and if only one thread would be used, f(0, n) is simply called here.
+//
+template <class F>
+void parallel_for_range(std::size_t n, std::size_t threads, std::size_t min_chunk, const F& f)
+{
+   std::size_t chunks = (n + min_chunk - 1) / min_chunk;
+   threads = (std::min)(threads, chunks);
+   if (threads < 2)
+   {
+      f(std::size_t(0), n);
+      return;
+   }
+   chunks = (std::min)(chunks, 8 * threads);
+   std::size_t chunk = (n + chunks - 1) / chunks;
+   thread_pool pool(threads);
+   pool.parallel_for(chunks, [&](std::size_t c)
+   {
+      std::size_t begin = (std::min)(c * chunk, n);
+      f(begin, (std::min)(begin + chunk, n));
+   });
+}
+
+}}}} // namespaces
+
+#endif
@@ -15,6 +15,7 @@
 
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/math/tools/cxx03_warn.hpp>
 #ifdef BOOST_NO_CXX11_LAMBDAS
 #include <boost/lambda/lambda.hpp>
@@ -26,10 +27,12 @@
 #include <boost/core/enable_if.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/math/tools/detail/is_const_iterable.hpp>
+#include <boost/math/tools/detail/polynomial_fft.hpp>
 
 #include <vector>
 #include <ostream>
 #include <algorithm>
+#include <limits>
 #ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
 #include <initializer_list>
 #endif
@@ -201,9 +204,15 @@ division(polynomial<T> u, const polynomial<T>& v)
 
     typedef typename polynomial<T>::size_type N;
 
+    polynomial<T> q, r;
+    if (newton_division(q.data(), r.data(), u.data(), v.data()))
+    {
+        r.normalize();
+        return std::make_pair(q, r);
+    }
+
     N const m = u.size() - 1, n = v.size() - 1;
     N k = m - n;
-    polynomial<T> q;
     q.data().resize(m - n + 1);
 
     do
@@ -385,6 +394,15 @@ public:
    {
       return m_data.size() > 0 ? boost::math::tools::evaluate_polynomial(&m_data[0], z, m_data.size()) : T(0);
    }
+
+   // Evaluates the polynomial at each point in [first, last), writing the results to out:
+   void evaluate(const T* first, const T* last, T* out) const
+   {
+      if (m_data.size() == 0)
+         std::fill(out, out + (last - first), T(0));
+      else
+         boost::math::tools::evaluate_polynomial(&m_data[0], m_data.size(), first, out, static_cast<std::size_t>(last - first));
+   }
    std::vector<T> chebyshev() const
    {
       return polynomial_to_chebyshev(m_data);
@@ -511,7 +529,13 @@ public:
            this->set_zero();
            return;
        }
-       std::vector<T> prod(a.size() + b.size() - 1, T(0));
+       std::vector<T> prod;
+       if (detail::fft_multiply(prod, a.data(), b.data()))
+       {
+           m_data.swap(prod);
+           return;
+       }
+       prod.assign(a.size() + b.size() - 1, T(0));
        for (unsigned i = 0; i < a.size(); ++i)
            for (unsigned j = 0; j < b.size(); ++j)
                prod[i+j] += a.m_data[i] * b.m_data[j];
@@ -844,6 +868,53 @@ bool even(polynomial<T> const &a)
     return !odd(a);
 }
 
+/**
+ * Returns the polynomial of least degree passing through the points (x[i], y[i]),
+ * where x = [x_first, x_last): the Newton divided differences of the data are
+ * computed, and the Newton form then expanded into the monomial basis.
+ * Requires O(N^2) operations, and the abscissas must be distinct.
+ * There is deliberately no O(N log^2 N) subproduct tree path, here or in evaluate:
+ * in floating point it is unstable beyond a few dozen points, and with integer
+ * coefficients the subproduct polynomials overflow long before they are large
+ * enough for the number theoretic transform to be used (see the docs).
+ */
+template <class T>
+polynomial<T> interpolating_polynomial(const T* x_first, const T* x_last, const T* y_first)
+{
+    BOOST_STATIC_ASSERT_MSG(!std::numeric_limits<T>::is_integer, "Interpolation requires coefficients from a field, not an integer type.");
+    std::size_t n = static_cast<std::size_t>(x_last - x_first);
+    if (n == 0)
+        return polynomial<T>();
+    std::vector<T> c(y_first, y_first + n);
+    for (std::size_t k = 1; k < n; ++k)
+    {
+        for (std::size_t i = n - 1; i >= k; --i)
+        {
+            T dx = x_first[i] - x_first[i - k];
+            if (dx == 0)
+            {
+                policies::raise_domain_error(
+                    "boost::math::tools::interpolating_polynomial<%1%>",
+                    "The abscissas must be distinct, but %1% is repeated.",
+                    x_first[i], policies::policy<>());
+                return polynomial<T>();
+            }
+            c[i] = (c[i] - c[i - 1]) / dx;
+        }
+    }
+    // Expand c[0] + (x - x[0]) (c[1] + (x - x[1]) (c[2] + ...)) from the inside out:
+    std::vector<T> p(n, T(0));
+    p[0] = c[n - 1];
+    for (std::size_t k = n - 1; k-- != 0;)
+    {
+        // p = p * (x - x[k]) + c[k], where p currently has degree n - 2 - k:
+        for (std::size_t i = n - 1 - k; i > 0; --i)
+            p[i] = p[i - 1] - x_first[k] * p[i];
+        p[0] = c[k] - x_first[k] * p[0];
+    }
+    return polynomial<T>(p.begin(), p.end());
+}
+
 template <class T>
 polynomial<T> pow(polynomial<T> base, int exp)
 {
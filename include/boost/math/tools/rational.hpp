@@ -322,6 +322,265 @@ inline V evaluate_rational(const boost::array<T,N>& a, const boost::array<U,N>&
    return detail::evaluate_rational_c_imp(a.data(), b.data(), z, static_cast<boost::integral_constant<int, N>*>(0));
 }
 
+//
+// Batch evaluation of one set of coefficients at many arguments.
+// The arguments are taken in blocks, and the innermost loops run across the
+// block so that the compiler can keep one argument in each lane of a SIMD register.
+// The results are exactly those of the runtime sized functions above, for example
+// result[i] == evaluate_polynomial(poly, z[i], count), which may differ in the last
+// bit from the compile time sized forms as these may use second or third order Horner
+// schemes.  The exception is when the compiler is allowed to contract a multiply and an
+// add into a fused multiply-add, as it may not do so the same way in both loops.
+// In all cases result may be the same array as z.
+//
+namespace detail{
+
+//
+// 64 bytes of arguments per block: 16 floats, 8 doubles, or 4 long doubles:
+//
+template <class U>
+struct batch_lanes
+{
+   static const std::size_t bytes = 64 / sizeof(U);
+   static const std::size_t value = bytes < 4 ? 4 : (bytes > 16 ? 16 : bytes);
+};
+
+template <std::size_t W, class T, class U>
+inline void evaluate_polynomial_lanes(const T* poly, std::size_t count, const U* z, U* result) BOOST_MATH_NOEXCEPT(U)
+{
+   U sum[W];
+   for(std::size_t l = 0; l < W; ++l)
+      sum[l] = static_cast<U>(poly[count - 1]);
+   for(int i = static_cast<int>(count) - 2; i >= 0; --i)
+   {
+      for(std::size_t l = 0; l < W; ++l)
+      {
+         sum[l] *= z[l];
+         sum[l] += static_cast<U>(poly[i]);
+      }
+   }
+   for(std::size_t l = 0; l < W; ++l)
+      result[l] = sum[l];
+}
+
+//
+// Estrin's scheme: the coefficients are taken eight at a time, and each group is
+// evaluated as a tree, ((c0 + c1 z) + (c2 + c3 z) z^2) + ((c4 + c5 z) + (c6 + c7 z) z^2) z^4,
+// so that its critical path is three multiply-adds rather than seven.  The groups
+// are then combined by Horner's rule in z^8.  The group of the leading coefficients
+// may be short, and its missing terms are left out rather than multiplied by zero,
+// which would give 0 * inf = NaN where a power of z overflows and Horner's rule gives
+// an infinity:
+//
+template <std::size_t W, class T, class U>
+inline void evaluate_estrin_group(const T* poly, std::size_t count, std::size_t first, const U* z, const U* z2, const U* z4, U* result) BOOST_MATH_NOEXCEPT(U)
+{
+   const std::size_t k = (std::min)(count - first, std::size_t(8));
+   U c[8];
+   for(std::size_t j = 0; j < k; ++j)
+      c[j] = static_cast<U>(poly[first + j]);
+   if(k == 8)
+   {
+      for(std::size_t l = 0; l < W; ++l)
+      {
+         U e0 = c[0] + c[1] * z[l];
+         U e1 = c[2] + c[3] * z[l];
+         U e2 = c[4] + c[5] * z[l];
+         U e3 = c[6] + c[7] * z[l];
+         result[l] = (e0 + e1 * z2[l]) + (e2 + e3 * z2[l]) * z4[l];
+      }
+      return;
+   }
+   for(std::size_t l = 0; l < W; ++l)
+   {
+      U e0 = k > 1 ? U(c[0] + c[1] * z[l]) : c[0];
+      if(k <= 2)
+      {
+         result[l] = e0;
+         continue;
+      }
+      U e1 = k > 3 ? U(c[2] + c[3] * z[l]) : c[2];
+      U lower = e0 + e1 * z2[l];
+      if(k <= 4)
+      {
+         result[l] = lower;
+         continue;
+      }
+      U e2 = k > 5 ? U(c[4] + c[5] * z[l]) : c[4];
+      U upper = k > 6 ? U(e2 + c[6] * z2[l]) : e2;
+      result[l] = lower + upper * z4[l];
+   }
+}
+
+template <std::size_t W, class T, class U>
+inline void evaluate_polynomial_estrin_lanes(const T* poly, std::size_t count, const U* z, U* result) BOOST_MATH_NOEXCEPT(U)
+{
+   U x[W], z2[W], z4[W], z8[W], sum[W], group[W];
+   for(std::size_t l = 0; l < W; ++l)
+   {
+      x[l] = z[l];
+      z2[l] = x[l] * x[l];
+      z4[l] = z2[l] * z2[l];
+      z8[l] = z4[l] * z4[l];
+   }
+   std::size_t first = ((count - 1) / 8) * 8;
+   evaluate_estrin_group<W>(poly, count, first, x, z2, z4, sum);
+   while(first != 0)
+   {
+      first -= 8;
+      evaluate_estrin_group<W>(poly, count, first, x, z2, z4, group);
+      for(std::size_t l = 0; l < W; ++l)
+         sum[l] = sum[l] * z8[l] + group[l];
+   }
+   for(std::size_t l = 0; l < W; ++l)
+      result[l] = sum[l];
+}
+
+template <std::size_t W, class T, class U, class V>
+inline void evaluate_rational_lanes(const T* num, const U* denom, std::size_t count, const V* z, V* result) BOOST_MATH_NOEXCEPT(V)
+{
+   //
+   // Lanes on opposite sides of 1 take the coefficients in opposite orders,
+   // so a mixed block falls back to evaluating one lane at a time:
+   //
+   std::size_t small = 0;
+   for(std::size_t l = 0; l < W; ++l)
+      small += z[l] <= 1 ? 1 : 0;
+   V s1[W], s2[W], x[W];
+   if(small == W)
+   {
+      for(std::size_t l = 0; l < W; ++l)
+      {
+         x[l] = z[l];
+         s1[l] = static_cast<V>(num[count-1]);
+         s2[l] = static_cast<V>(denom[count-1]);
+      }
+      for(int i = (int)count - 2; i >= 0; --i)
+      {
+         for(std::size_t l = 0; l < W; ++l)
+         {
+            s1[l] *= x[l];
+            s2[l] *= x[l];
+            s1[l] += num[i];
+            s2[l] += denom[i];
+         }
+      }
+   }
+   else if(small == 0)
+   {
+      for(std::size_t l = 0; l < W; ++l)
+      {
+         x[l] = 1 / z[l];
+         s1[l] = static_cast<V>(num[0]);
+         s2[l] = static_cast<V>(denom[0]);
+      }
+      for(unsigned i = 1; i < count; ++i)
+      {
+         for(std::size_t l = 0; l < W; ++l)
+         {
+            s1[l] *= x[l];
+            s2[l] *= x[l];
+            s1[l] += num[i];
+            s2[l] += denom[i];
+         }
+      }
+   }
+   else
+   {
+      for(std::size_t l = 0; l < W; ++l)
+         result[l] = boost::math::tools::evaluate_rational(num, denom, z[l], count);
+      return;
+   }
+   for(std::size_t l = 0; l < W; ++l)
+      result[l] = s1[l] / s2[l];
+}
+
+} // namespace detail
+
+template <class T, class U>
+inline void evaluate_polynomial(const T* poly, std::size_t count, const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   BOOST_ASSERT(count > 0);
+   const std::size_t W = detail::batch_lanes<U>::value;
+   const std::size_t blocked = n - n % W;
+   for(std::size_t i = 0; i < blocked; i += W)
+      detail::evaluate_polynomial_lanes<W>(poly, count, z + i, result + i);
+   for(std::size_t i = blocked; i < n; ++i)
+      result[i] = evaluate_polynomial(poly, z[i], count);
+}
+
+template <std::size_t N, class T, class U>
+inline void evaluate_polynomial(const T(&a)[N], const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   evaluate_polynomial(static_cast<const T*>(a), N, z, result, n);
+}
+
+template <std::size_t N, class T, class U>
+inline void evaluate_polynomial(const boost::array<T,N>& a, const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   evaluate_polynomial(static_cast<const T*>(a.data()), N, z, result, n);
+}
+//
+// Estrin's scheme has a shorter dependency chain than Horner's rule, which pays
+// when the compiler can't vectorise the lanes and has to hide the latency of each
+// multiply-add instead, at the cost of a few more multiplications and a different rounding:
+//
+template <class T, class U>
+inline void evaluate_polynomial_estrin(const T* poly, std::size_t count, const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   BOOST_ASSERT(count > 0);
+   const std::size_t W = detail::batch_lanes<U>::value;
+   const std::size_t blocked = n - n % W;
+   for(std::size_t i = 0; i < blocked; i += W)
+      detail::evaluate_polynomial_estrin_lanes<W>(poly, count, z + i, result + i);
+   if(blocked < n)
+   {
+      // The remainder is padded out to a full block:
+      U x[W];
+      U r[W];
+      for(std::size_t l = 0; l < W; ++l)
+         x[l] = blocked + l < n ? z[blocked + l] : U(0);
+      detail::evaluate_polynomial_estrin_lanes<W>(poly, count, static_cast<const U*>(x), r);
+      for(std::size_t l = 0; blocked + l < n; ++l)
+         result[blocked + l] = r[l];
+   }
+}
+
+template <std::size_t N, class T, class U>
+inline void evaluate_polynomial_estrin(const T(&a)[N], const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   evaluate_polynomial_estrin(static_cast<const T*>(a), N, z, result, n);
+}
+
+template <std::size_t N, class T, class U>
+inline void evaluate_polynomial_estrin(const boost::array<T,N>& a, const U* z, U* result, std::size_t n) BOOST_MATH_NOEXCEPT(U)
+{
+   evaluate_polynomial_estrin(static_cast<const T*>(a.data()), N, z, result, n);
+}
+
+template <class T, class U, class V>
+inline void evaluate_rational(const T* num, const U* denom, std::size_t count, const V* z, V* result, std::size_t n) BOOST_MATH_NOEXCEPT(V)
+{
+   const std::size_t W = detail::batch_lanes<V>::value;
+   const std::size_t blocked = n - n % W;
+   for(std::size_t i = 0; i < blocked; i += W)
+      detail::evaluate_rational_lanes<W>(num, denom, count, z + i, result + i);
+   for(std::size_t i = blocked; i < n; ++i)
+      result[i] = evaluate_rational(num, denom, z[i], count);
+}
+
+template <std::size_t N, class T, class U, class V>
+inline void evaluate_rational(const T(&a)[N], const U(&b)[N], const V* z, V* result, std::size_t n) BOOST_MATH_NOEXCEPT(V)
+{
+   evaluate_rational(static_cast<const T*>(a), static_cast<const U*>(b), N, z, result, n);
+}
+
+template <std::size_t N, class T, class U, class V>
+inline void evaluate_rational(const boost::array<T,N>& a, const boost::array<U,N>& b, const V* z, V* result, std::size_t n) BOOST_MATH_NOEXCEPT(V)
+{
+   evaluate_rational(static_cast<const T*>(a.data()), static_cast<const U*>(b.data()), N, z, result, n);
+}
+
 } // namespace tools
 } // namespace math
 } // namespace boost
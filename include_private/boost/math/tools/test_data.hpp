@@ -35,7 +35,13 @@ namespace random_ns = boost::random;
 #include <boost/math/tools/tuple.hpp>
 #include <boost/math/tools/real_cast.hpp>
 
+#include <boost/math/tools/detail/thread_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 #include <iostream>
 
@@ -178,6 +184,39 @@ inline void unpack_and_append(Seq& s, const Item& data)
    unpack_and_append(s, data, ::boost::is_convertible<Item, value_type>());
 }
 
+//
+// Calls func with the N arguments in x and appends the result to row:
+//
+template <class Seq, class F, class T>
+inline void invoke_and_append(Seq& row, F& func, const T* x, const boost::integral_constant<int, 1>&)
+{
+   unpack_and_append(row, func(x[0]));
+}
+
+template <class Seq, class F, class T>
+inline void invoke_and_append(Seq& row, F& func, const T* x, const boost::integral_constant<int, 2>&)
+{
+   unpack_and_append(row, func(x[0], x[1]));
+}
+
+template <class Seq, class F, class T>
+inline void invoke_and_append(Seq& row, F& func, const T* x, const boost::integral_constant<int, 3>&)
+{
+   unpack_and_append(row, func(x[0], x[1], x[2]));
+}
+
+template <class Seq, class F, class T>
+inline void invoke_and_append(Seq& row, F& func, const T* x, const boost::integral_constant<int, 4>&)
+{
+   unpack_and_append(row, func(x[0], x[1], x[2], x[3]));
+}
+
+template <class Seq, class F, class T>
+inline void invoke_and_append(Seq& row, F& func, const T* x, const boost::integral_constant<int, 5>&)
+{
+   unpack_and_append(row, func(x[0], x[1], x[2], x[3], x[4]));
+}
+
 } // detail
 
 template <class T>
@@ -197,9 +236,9 @@ public:
    typedef typename container_type::size_type size_type;
 
    // creation:
-   test_data(){}
+   test_data() : m_threads(1), m_progress(0) {}
    template <class F>
-   test_data(F func, const parameter_info<T>& arg1)
+   test_data(F func, const parameter_info<T>& arg1) : m_threads(1), m_progress(0)
    {
       insert(func, arg1);
    }
@@ -209,32 +248,8 @@ public:
    test_data& insert(F func, const parameter_info<T>& arg1)
    {
       // generate data for single argument functor F
-
-      typedef typename std::set<T>::const_iterator it_type;
-
-      std::set<T> points;
-      create_test_points(points, arg1);
-      it_type a = points.begin();
-      it_type b = points.end();
-      row_type row;
-      while(a != b)
-      {
-         if((arg1.type & dummy_param) == 0)
-            row.push_back(*a);
-#ifndef BOOST_NO_EXCEPTIONS
-         try{
-#endif
-            // domain_error exceptions from func are swallowed
-            // and this data point is ignored:
-            boost::math::tools::detail::unpack_and_append(row, func(*a));
-            m_data.insert(row);
-#ifndef BOOST_NO_EXCEPTIONS
-         }
-         catch(const std::domain_error&){}
-#endif
-         row.clear();
-         ++a;
-      }
+      const parameter_info<T>* args[] = { &arg1 };
+      insert_grid(func, args);
       return *this;
    }
 
@@ -242,41 +257,8 @@ public:
    test_data& insert(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2)
    {
       // generate data for 2-argument functor F
-
-      typedef typename std::set<T>::const_iterator it_type;
-
-      std::set<T> points1, points2;
-      create_test_points(points1, arg1);
-      create_test_points(points2, arg2);
-      it_type a = points1.begin();
-      it_type b = points1.end();
-      row_type row;
-      while(a != b)
-      {
-         it_type c = points2.begin();
-         it_type d = points2.end();
-         while(c != d)
-         {
-            if((arg1.type & dummy_param) == 0)
-               row.push_back(*a);
-            if((arg2.type & dummy_param) == 0)
-               row.push_back(*c);
-#ifndef BOOST_NO_EXCEPTIONS
-            try{
-#endif
-               // domain_error exceptions from func are swallowed
-               // and this data point is ignored:
-               detail::unpack_and_append(row, func(*a, *c));
-               m_data.insert(row);
-#ifndef BOOST_NO_EXCEPTIONS
-            }
-            catch(const std::domain_error&){}
-#endif
-            row.clear();
-            ++c;
-         }
-         ++a;
-      }
+      const parameter_info<T>* args[] = { &arg1, &arg2 };
+      insert_grid(func, args);
       return *this;
    }
 
@@ -284,50 +266,8 @@ public:
    test_data& insert(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3)
    {
       // generate data for 3-argument functor F
-
-      typedef typename std::set<T>::const_iterator it_type;
-
-      std::set<T> points1, points2, points3;
-      create_test_points(points1, arg1);
-      create_test_points(points2, arg2);
-      create_test_points(points3, arg3);
-      it_type a = points1.begin();
-      it_type b = points1.end();
-      row_type row;
-      while(a != b)
-      {
-         it_type c = points2.begin();
-         it_type d = points2.end();
-         while(c != d)
-         {
-            it_type e = points3.begin();
-            it_type f = points3.end();
-            while(e != f)
-            {
-               if((arg1.type & dummy_param) == 0)
-                  row.push_back(*a);
-               if((arg2.type & dummy_param) == 0)
-                  row.push_back(*c);
-               if((arg3.type & dummy_param) == 0)
-                  row.push_back(*e);
-#ifndef BOOST_NO_EXCEPTIONS
-               try{
-#endif
-                  // domain_error exceptions from func are swallowed
-                  // and this data point is ignored:
-                  detail::unpack_and_append(row, func(*a, *c, *e));
-                  m_data.insert(row);
-#ifndef BOOST_NO_EXCEPTIONS
-               }
-               catch(const std::domain_error&){}
-#endif
-               row.clear();
-               ++e;
-            }
-            ++c;
-         }
-         ++a;
-      }
+      const parameter_info<T>* args[] = { &arg1, &arg2, &arg3 };
+      insert_grid(func, args);
       return *this;
    }
 
@@ -335,59 +275,8 @@ public:
    test_data& insert(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3, const parameter_info<T>& arg4)
    {
       // generate data for 4-argument functor F
-
-      typedef typename std::set<T>::const_iterator it_type;
-
-      std::set<T> points1, points2, points3, points4;
-      create_test_points(points1, arg1);
-      create_test_points(points2, arg2);
-      create_test_points(points3, arg3);
-      create_test_points(points4, arg4);
-      it_type a = points1.begin();
-      it_type b = points1.end();
-      row_type row;
-      while(a != b)
-      {
-         it_type c = points2.begin();
-         it_type d = points2.end();
-         while(c != d)
-         {
-            it_type e = points3.begin();
-            it_type f = points3.end();
-            while(e != f)
-            {
-               it_type g = points4.begin();
-               it_type h = points4.end();
-               while (g != h)
-               {
-                  if ((arg1.type & dummy_param) == 0)
-                     row.push_back(*a);
-                  if ((arg2.type & dummy_param) == 0)
-                     row.push_back(*c);
-                  if ((arg3.type & dummy_param) == 0)
-                     row.push_back(*e);
-                  if ((arg4.type & dummy_param) == 0)
-                     row.push_back(*g);
-#ifndef BOOST_NO_EXCEPTIONS
-                  try {
-#endif
-                     // domain_error exceptions from func are swallowed
-                     // and this data point is ignored:
-                     detail::unpack_and_append(row, func(*a, *c, *e, *g));
-                     m_data.insert(row);
-#ifndef BOOST_NO_EXCEPTIONS
-                  }
-                  catch (const std::domain_error&) {}
-#endif
-                  row.clear();
-                  ++g;
-               }
-               ++e;
-            }
-            ++c;
-         }
-         ++a;
-      }
+      const parameter_info<T>* args[] = { &arg1, &arg2, &arg3, &arg4 };
+      insert_grid(func, args);
       return *this;
    }
 
@@ -395,71 +284,25 @@ public:
    test_data& insert(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3, const parameter_info<T>& arg4, const parameter_info<T>& arg5)
    {
       // generate data for 5-argument functor F
-
-      typedef typename std::set<T>::const_iterator it_type;
-
-      std::set<T> points1, points2, points3, points4, points5;
-      create_test_points(points1, arg1);
-      create_test_points(points2, arg2);
-      create_test_points(points3, arg3);
-      create_test_points(points4, arg4);
-      create_test_points(points5, arg5);
-      it_type a = points1.begin();
-      it_type b = points1.end();
-      row_type row;
-      while(a != b)
-      {
-         it_type c = points2.begin();
-         it_type d = points2.end();
-         while(c != d)
-         {
-            it_type e = points3.begin();
-            it_type f = points3.end();
-            while(e != f)
-            {
-               it_type g = points4.begin();
-               it_type h = points4.end();
-               while (g != h)
-               {
-                  it_type i = points5.begin();
-                  it_type j = points5.end();
-                  while (i != j)
-                  {
-                     if ((arg1.type & dummy_param) == 0)
-                        row.push_back(*a);
-                     if ((arg2.type & dummy_param) == 0)
-                        row.push_back(*c);
-                     if ((arg3.type & dummy_param) == 0)
-                        row.push_back(*e);
-                     if ((arg4.type & dummy_param) == 0)
-                        row.push_back(*g);
-                     if ((arg5.type & dummy_param) == 0)
-                        row.push_back(*i);
-#ifndef BOOST_NO_EXCEPTIONS
-                     try {
-#endif
-                        // domain_error exceptions from func are swallowed
-                        // and this data point is ignored:
-                        detail::unpack_and_append(row, func(*a, *c, *e, *g, *i));
-                        m_data.insert(row);
-#ifndef BOOST_NO_EXCEPTIONS
-                     }
-                     catch (const std::domain_error&) {}
-#endif
-                     row.clear();
-                     ++i;
-                  }
-                  ++g;
-               }
-               ++e;
-            }
-            ++c;
-         }
-         ++a;
-      }
+      const parameter_info<T>* args[] = { &arg1, &arg2, &arg3, &arg4, &arg5 };
+      insert_grid(func, args);
       return *this;
    }
 
+   //
+   // Parallel mode: the points of each call to insert are shared out between
+   // this many threads, or one per hardware thread when threads == 0.  Since
+   // the rows are kept sorted the data is identical to that of a sequential
+   // run, but the functor must be safe to call concurrently.
+   //
+   test_data& set_threads(unsigned threads){ m_threads = threads; return *this; }
+   unsigned threads()const{ return m_threads; }
+   //
+   // Reports the number of points evaluated by each call to insert to *os,
+   // at every whole percent, or nothing if os is null:
+   //
+   test_data& set_progress(std::ostream* os){ m_progress = os; return *this; }
+
    void clear(){ m_data.clear(); }
 
    // access:
@@ -481,7 +324,11 @@ public:
 
 private:
    void create_test_points(std::set<T>& points, const parameter_info<T>& arg1);
+   template <class F, int N>
+   void insert_grid(F& func, const parameter_info<T>* const (&info)[N]);
    std::set<row_type> m_data;
+   unsigned m_threads;
+   std::ostream* m_progress;
 
    static float extern_val;
    static float truncate_to_float(float const * pf);
@@ -508,6 +355,116 @@ inline float test_data<T>::truncate_to_float(float const * pf)
 template <class T>
 float test_data<T>::extern_val = 0;
 
+//
+// Evaluates func at every point of the grid formed from the parameters,
+// the last parameter varying fastest, and stores the rows:
+//
+template <class T>
+template <class F, int N>
+void test_data<T>::insert_grid(F& func, const parameter_info<T>* const (&info)[N])
+{
+   std::vector<T> points[N];
+   std::size_t total = 1;
+   for(int i = 0; i < N; ++i)
+   {
+      std::set<T> p;
+      create_test_points(p, *info[i]);
+      points[i].assign(p.begin(), p.end());
+      total *= points[i].size();
+   }
+
+   std::atomic<std::size_t> done(0);
+   std::size_t reported = 0;
+   std::mutex progress_mutex;
+   std::ostream* progress = m_progress;
+   // Computes the row for grid point n, returns false if it is to be ignored:
+   auto evaluate = [&](std::size_t n, row_type& row)
+   {
+      T x[N];
+      for(int i = N - 1; i >= 0; --i)
+      {
+         x[i] = points[i][n % points[i].size()];
+         n /= points[i].size();
+      }
+      for(int i = 0; i < N; ++i)
+      {
+         if((info[i]->type & dummy_param) == 0)
+            row.push_back(x[i]);
+      }
+      bool result = false;
+#ifndef BOOST_NO_EXCEPTIONS
+      try{
+#endif
+         // domain_error exceptions from func are swallowed
+         // and this data point is ignored:
+         detail::invoke_and_append(row, func, x, boost::integral_constant<int, N>());
+         result = true;
+#ifndef BOOST_NO_EXCEPTIONS
+      }
+      catch(const std::domain_error&){}
+#endif
+      if(progress)
+      {
+         std::size_t count = ++done;
+         std::size_t percent = count * 100 / total;
+         std::lock_guard<std::mutex> lock(progress_mutex);
+         if(percent > reported)
+         {
+            reported = percent;
+            *progress << count << " of " << total << " points (" << percent << "%)" << std::endl;
+         }
+      }
+      return result;
+   };
+
+   std::size_t threads = m_threads ? m_threads : std::thread::hardware_concurrency();
+   if((threads <= 1) || (total < 2))
+   {
+      row_type row;
+      for(std::size_t n = 0; n < total; ++n)
+      {
+         if(evaluate(n, row))
+            m_data.insert(row);
+         row.clear();
+      }
+      return;
+   }
+   //
+   // Each thread writes only its own rows, and they are inserted in grid order
+   // once all are done:
+   //
+   std::vector<row_type> rows(total);
+   std::vector<char> keep(total, 0);
+#ifndef BOOST_NO_EXCEPTIONS
+   try{
+#endif
+      boost::math::tools::detail::thread_pool pool(threads);
+      pool.parallel_for(total, [&](std::size_t n)
+      {
+         keep[n] = evaluate(n, rows[n]);
+         if(!keep[n])
+            row_type().swap(rows[n]);
+      });
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch(...)
+   {
+      // Keep the points which completed, as a sequential run would:
+      for(std::size_t n = 0; n < total; ++n)
+      {
+         if(keep[n])
+            m_data.insert(rows[n]);
+      }
+      throw;
+   }
+#endif
+   for(std::size_t n = 0; n < total; ++n)
+   {
+      if(keep[n])
+         m_data.insert(rows[n]);
+   }
+}
+
 template <class T>
 void test_data<T>::create_test_points(std::set<T>& points, const parameter_info<T>& arg1)
 {
@@ -0,0 +1,171 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares evaluation of barycentric rational interpolants one point at a time with evaluation of a whole array of points,
+// exactly and with the sums over distant nodes approximated, as the number of nodes grows.
+// g++ -std=c++17 -O3 -march=native -I../../include barycentric_rational_performance.cpp -lbenchmark -pthread
+
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/barycentric_rational.hpp>
+
+using boost::math::barycentric_rational;
+
+constexpr std::size_t points = 1024;
+
+template<class Real>
+barycentric_rational<Real> interpolant(std::size_t n)
+{
+    std::mt19937_64 gen(1234);
+    std::uniform_real_distribution<Real> dis(Real(0.5), Real(1.5));
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    x[0] = 0;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        x[i] = x[i - 1] + dis(gen)/n;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = std::sin(10*x[i]) + x[i]*x[i];
+    }
+    return barycentric_rational<Real>(std::move(x), std::move(y));
+}
+
+template<class Real>
+std::vector<Real> abscissas()
+{
+    std::mt19937_64 gen(4321);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<Real> t(points);
+    for (auto& x : t)
+    {
+        x = dis(gen);
+    }
+    return t;
+}
+
+template<class Real>
+void Scalar(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void Batch(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void BatchThreaded(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin(), Real(0), std::thread::hardware_concurrency());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+// Includes the cost of setting up the approximation, which is made afresh for each batch:
+template<class Real>
+void Approximate(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin(), Real(1e-10));
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void PrimeScalar(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s.prime(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void PrimeBatch(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s.prime(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void PrimeApproximate(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto t = abscissas<Real>();
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s.prime(t.begin(), t.end(), y.begin(), Real(1e-10));
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_TEMPLATE(Scalar, float)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(Batch, float)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(Scalar, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(Batch, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(BatchThreaded, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity()->UseRealTime();
+BENCHMARK_TEMPLATE(Approximate, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(PrimeScalar, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(PrimeBatch, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+BENCHMARK_TEMPLATE(PrimeApproximate, double)->RangeMultiplier(4)->Range(256, 65536)->Complexity();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,219 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares evaluation of the cardinal B-spline interpolators one point at a time with evaluation of a whole array of points.
+// g++ -std=c++17 -O3 -march=native -I../../include cardinal_b_spline_performance.cpp -lbenchmark -pthread
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/cardinal_quadratic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_quintic_b_spline.hpp>
+
+using boost::math::interpolators::cardinal_quadratic_b_spline;
+using boost::math::interpolators::cardinal_cubic_b_spline;
+using boost::math::interpolators::cardinal_quintic_b_spline;
+
+constexpr std::size_t points = 4096;
+
+template<class Real>
+std::vector<Real> samples()
+{
+    std::vector<Real> v(1000);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = std::sin(Real(i)/64);
+    }
+    return v;
+}
+
+template<class Real>
+std::vector<Real> abscissas(Real t_max)
+{
+    std::mt19937_64 gen(1234);
+    std::uniform_real_distribution<Real> dis(0, t_max);
+    std::vector<Real> t(points);
+    for (auto& x : t)
+    {
+        x = dis(gen);
+    }
+    return t;
+}
+
+template<class Real>
+void QuadraticScalar(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quadratic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void QuadraticBatch(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quadratic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void CubicScalar(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_cubic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(Real(v.size() - 1));
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void CubicBatch(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_cubic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(Real(v.size() - 1));
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s.evaluate(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void CubicPrimeScalar(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_cubic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(Real(v.size() - 1));
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s.prime(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void CubicPrimeBatch(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_cubic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(Real(v.size() - 1));
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s.prime(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void QuinticScalar(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quintic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void QuinticBatch(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quintic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void QuinticDoublePrimeScalar(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quintic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    for (auto _ : state)
+    {
+        for (auto x : t)
+        {
+            benchmark::DoNotOptimize(s.double_prime(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void QuinticDoublePrimeBatch(benchmark::State& state)
+{
+    auto v = samples<Real>();
+    cardinal_quintic_b_spline<Real> s(v.data(), v.size(), Real(0), Real(1));
+    auto t = abscissas<Real>(s.t_max());
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s.double_prime(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+BENCHMARK_TEMPLATE(QuadraticScalar, float);
+BENCHMARK_TEMPLATE(QuadraticBatch, float);
+BENCHMARK_TEMPLATE(QuadraticScalar, double);
+BENCHMARK_TEMPLATE(QuadraticBatch, double);
+BENCHMARK_TEMPLATE(CubicScalar, float);
+BENCHMARK_TEMPLATE(CubicBatch, float);
+BENCHMARK_TEMPLATE(CubicScalar, double);
+BENCHMARK_TEMPLATE(CubicBatch, double);
+BENCHMARK_TEMPLATE(CubicPrimeScalar, double);
+BENCHMARK_TEMPLATE(CubicPrimeBatch, double);
+BENCHMARK_TEMPLATE(QuinticScalar, float);
+BENCHMARK_TEMPLATE(QuinticBatch, float);
+BENCHMARK_TEMPLATE(QuinticScalar, double);
+BENCHMARK_TEMPLATE(QuinticBatch, double);
+BENCHMARK_TEMPLATE(QuinticDoublePrimeScalar, double);
+BENCHMARK_TEMPLATE(QuinticDoublePrimeBatch, double);
+
+BENCHMARK_MAIN();
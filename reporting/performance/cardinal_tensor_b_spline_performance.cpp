@@ -0,0 +1,201 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Construction and evaluation of the bicubic and tricubic cardinal B-spline interpolators,
+// one point at a time and a whole array of points at once.
+// g++ -std=c++17 -O3 -march=native -I../../include cardinal_tensor_b_spline_performance.cpp -lbenchmark -pthread
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/cardinal_bicubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_tricubic_b_spline.hpp>
+
+using boost::math::interpolators::cardinal_bicubic_b_spline;
+using boost::math::interpolators::cardinal_tricubic_b_spline;
+
+constexpr std::size_t points = 4096;
+
+template<class Real>
+std::vector<Real> samples(std::size_t size)
+{
+    std::vector<Real> v(size);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = std::sin(Real(i)/64) + std::cos(Real(i)/1000);
+    }
+    return v;
+}
+
+template<class Real, std::size_t d>
+std::vector<std::array<Real, d>> abscissas(const std::array<Real, d>& t_max)
+{
+    std::mt19937_64 gen(1234);
+    std::vector<std::array<Real, d>> t(points);
+    for (auto& x : t)
+    {
+        for (std::size_t i = 0; i < d; ++i)
+        {
+            std::uniform_real_distribution<Real> dis(0, t_max[i]);
+            x[i] = dis(gen);
+        }
+    }
+    return t;
+}
+
+template<class Real>
+cardinal_bicubic_b_spline<Real> bicubic(std::size_t n)
+{
+    return cardinal_bicubic_b_spline<Real>(samples<Real>(n*n), n, n, Real(0), Real(0), Real(1), Real(1));
+}
+
+template<class Real>
+cardinal_tricubic_b_spline<Real> tricubic(std::size_t n)
+{
+    return cardinal_tricubic_b_spline<Real>(samples<Real>(n*n*n), n, n, n, Real(0), Real(0), Real(0), Real(1), Real(1), Real(1));
+}
+
+template<class Real>
+void BicubicConstruction(benchmark::State& state)
+{
+    std::size_t n = state.range(0);
+    auto v = samples<Real>(n*n);
+    for (auto _ : state)
+    {
+        cardinal_bicubic_b_spline<Real> s(v, n, n, Real(0), Real(0), Real(1), Real(1));
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetComplexityN(n*n);
+}
+
+template<class Real>
+void BicubicScalar(benchmark::State& state)
+{
+    auto s = bicubic<Real>(state.range(0));
+    auto t = abscissas<Real, 2>({{s.x_max(), s.y_max()}});
+    for (auto _ : state)
+    {
+        for (auto const & x : t)
+        {
+            benchmark::DoNotOptimize(s(x[0], x[1]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void BicubicBatch(benchmark::State& state)
+{
+    auto s = bicubic<Real>(state.range(0));
+    auto t = abscissas<Real, 2>({{s.x_max(), s.y_max()}});
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void BicubicGradientScalar(benchmark::State& state)
+{
+    auto s = bicubic<Real>(state.range(0));
+    auto t = abscissas<Real, 2>({{s.x_max(), s.y_max()}});
+    for (auto _ : state)
+    {
+        for (auto const & x : t)
+        {
+            benchmark::DoNotOptimize(s.gradient(x[0], x[1]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void BicubicGradientBatch(benchmark::State& state)
+{
+    auto s = bicubic<Real>(state.range(0));
+    auto t = abscissas<Real, 2>({{s.x_max(), s.y_max()}});
+    std::vector<std::array<Real, 2>> g(t.size());
+    for (auto _ : state)
+    {
+        s.gradient(t.begin(), t.end(), g.begin());
+        benchmark::DoNotOptimize(g.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void TricubicConstruction(benchmark::State& state)
+{
+    std::size_t n = state.range(0);
+    auto v = samples<Real>(n*n*n);
+    for (auto _ : state)
+    {
+        cardinal_tricubic_b_spline<Real> s(v, n, n, n, Real(0), Real(0), Real(0), Real(1), Real(1), Real(1));
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetComplexityN(n*n*n);
+}
+
+template<class Real>
+void TricubicScalar(benchmark::State& state)
+{
+    auto s = tricubic<Real>(state.range(0));
+    auto t = abscissas<Real, 3>({{s.x_max(), s.y_max(), s.z_max()}});
+    for (auto _ : state)
+    {
+        for (auto const & x : t)
+        {
+            benchmark::DoNotOptimize(s(x[0], x[1], x[2]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void TricubicBatch(benchmark::State& state)
+{
+    auto s = tricubic<Real>(state.range(0));
+    auto t = abscissas<Real, 3>({{s.x_max(), s.y_max(), s.z_max()}});
+    std::vector<Real> y(t.size());
+    for (auto _ : state)
+    {
+        s(t.begin(), t.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<class Real>
+void TricubicGradientBatch(benchmark::State& state)
+{
+    auto s = tricubic<Real>(state.range(0));
+    auto t = abscissas<Real, 3>({{s.x_max(), s.y_max(), s.z_max()}});
+    std::vector<std::array<Real, 3>> g(t.size());
+    for (auto _ : state)
+    {
+        s.gradient(t.begin(), t.end(), g.begin());
+        benchmark::DoNotOptimize(g.data());
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+BENCHMARK_TEMPLATE(BicubicConstruction, double)->RangeMultiplier(2)->Range(16, 512)->Complexity();
+BENCHMARK_TEMPLATE(BicubicScalar, float)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BicubicBatch, float)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BicubicScalar, double)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BicubicBatch, double)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BicubicGradientScalar, double)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BicubicGradientBatch, double)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(TricubicConstruction, double)->RangeMultiplier(2)->Range(8, 64)->Complexity();
+BENCHMARK_TEMPLATE(TricubicScalar, double)->Arg(16)->Arg(128);
+BENCHMARK_TEMPLATE(TricubicBatch, double)->Arg(16)->Arg(128);
+BENCHMARK_TEMPLATE(TricubicGradientBatch, double)->Arg(16)->Arg(128);
+
+BENCHMARK_MAIN();
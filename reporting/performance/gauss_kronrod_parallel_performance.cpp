@@ -0,0 +1,53 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares gauss_kronrod::integrate with gauss_kronrod::parallel_integrate as the number of threads grows,
+// for an integrand which is expensive to evaluate, as when each evaluation is itself a small simulation.
+// g++ -std=c++17 -O3 -march=native -I../../include gauss_kronrod_parallel_performance.cpp -lbenchmark -pthread
+
+#include <cmath>
+#include <thread>
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+using boost::math::quadrature::gauss_kronrod;
+
+// Roughly 10 microseconds per call, with a sharp peak at x = 1/3 to make the integrator work:
+template<class Real>
+Real expensive(Real x)
+{
+    using std::cos;
+    Real s = 0;
+    for (int k = 1; k <= 1000; ++k)
+    {
+        s += cos(k*x)/(k*k);
+    }
+    return s/(1 + 100000*(x - Real(1)/3)*(x - Real(1)/3));
+}
+
+template<class Real>
+void GaussKronrodSerial(benchmark::State& state)
+{
+    Real error;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(gauss_kronrod<Real, 15>::integrate(expensive<Real>, Real(0), Real(1), 15, Real(1e-10), &error));
+    }
+}
+
+template<class Real>
+void GaussKronrodParallel(benchmark::State& state)
+{
+    Real error;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(gauss_kronrod<Real, 15>::parallel_integrate(expensive<Real>, Real(0), Real(1), 15, Real(1e-10), &error, nullptr, state.range(0)));
+    }
+}
+
+BENCHMARK_TEMPLATE(GaussKronrodSerial, double)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GaussKronrodParallel, double)->DenseRange(1, (std::max)(1u, std::thread::hardware_concurrency()))->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
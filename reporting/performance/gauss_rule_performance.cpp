@@ -0,0 +1,106 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Computing Gauss and Gauss-Kronrod rules with many points: the O(n^2) computation that gauss and gauss_kronrod
+// make for untabulated rules, and the O(n) one of gauss_rule, on one and many threads.
+// g++ -std=c++17 -O3 -march=native -I../../include gauss_rule_performance.cpp -lbenchmark -pthread
+
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/gauss_rule.hpp>
+#include <boost/math/special_functions/legendre.hpp>
+#include <boost/math/special_functions/legendre_stieltjes.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// As gauss_detail computes the rule:
+template<class Real>
+void LegendreZeros(benchmark::State& state)
+{
+    unsigned n = static_cast<unsigned>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<Real> x = boost::math::legendre_p_zeros<Real>(n);
+        std::vector<Real> w(x.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            Real p = boost::math::legendre_p_prime(n, x[i]);
+            w[i] = 2 / ((1 - x[i] * x[i]) * p * p);
+        }
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void GaussRule(benchmark::State& state)
+{
+    unsigned n = static_cast<unsigned>(state.range(0));
+    std::size_t threads = state.range(1);
+    std::vector<Real> x;
+    std::vector<Real> w;
+    for (auto _ : state)
+    {
+        boost::math::quadrature::detail::gauss_legendre_rule(n, threads, x, w);
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// As gauss_kronrod_detail computes the rule:
+template<class Real>
+void LegendreStieltjesZeros(benchmark::State& state)
+{
+    unsigned n = static_cast<unsigned>(state.range(0));
+    for (auto _ : state)
+    {
+        boost::math::legendre_stieltjes<Real> E(n + 1);
+        std::vector<Real> x = E.zeros();
+        std::vector<Real> w(x.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            w[i] = 2 / ((n + 1) * boost::math::legendre_p(n, x[i]) * E.prime(x[i]));
+        }
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void GaussKronrodRule(benchmark::State& state)
+{
+    unsigned n = static_cast<unsigned>(state.range(0));
+    std::size_t threads = state.range(1);
+    std::vector<Real> x;
+    std::vector<Real> w;
+    std::vector<Real> g;
+    for (auto _ : state)
+    {
+        boost::math::quadrature::detail::gauss_kronrod_rule(2 * n + 1, threads, x, w, g);
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+static void Threads(benchmark::internal::Benchmark* b, long long lo, long long hi)
+{
+    long long threads = (std::max)(std::thread::hardware_concurrency(), 2u);
+    for (long long n = lo; n <= hi; n *= 4)
+    {
+        b->Args({n, 1});
+        b->Args({n, threads});
+    }
+}
+
+BENCHMARK_TEMPLATE(LegendreZeros, double)->RangeMultiplier(4)->Range(64, 4096)->Complexity();
+BENCHMARK_TEMPLATE(GaussRule, double)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 64, 65536); })->UseRealTime();
+BENCHMARK_TEMPLATE(LegendreStieltjesZeros, double)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+BENCHMARK_TEMPLATE(GaussKronrodRule, double)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 16, 4096); })->UseRealTime();
+BENCHMARK_TEMPLATE(LegendreZeros, cpp_bin_float_50)->RangeMultiplier(4)->Range(16, 256)->Complexity();
+BENCHMARK_TEMPLATE(GaussRule, cpp_bin_float_50)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 16, 1024); })->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -10,8 +10,12 @@
 #include <boost/array.hpp>
 #include <boost/chrono.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#include "table_helper.hpp"
 
 extern std::vector<std::vector<double> > data;
 
@@ -116,4 +120,58 @@ double exec_timed_test(Func f)
    return t / (repeats * data.size());
 }
 
+//
+// Returns the number of elements processed per second by f, which
+// evaluates n elements each time it is called:
+//
+template <class Func>
+double exec_timed_throughput(Func f, std::size_t n)
+{
+   double t = 0;
+   unsigned repeats = 1;
+   do{
+      stopwatch<boost::chrono::high_resolution_clock> w;
+
+      for(unsigned count = 0; count < repeats; ++count)
+         sum += f();
+
+      t = boost::chrono::duration_cast<boost::chrono::duration<double>>(w.elapsed()).count();
+      if(t < 0.5)
+         repeats *= 2;
+   } while(t < 0.5);
+   return static_cast<double>(n) * repeats / t;
+}
+
+//
+// Summarises the trials of one timing by their median and median absolute deviation:
+//
+inline timing_statistics summarise_trials(std::vector<double>& trials)
+{
+   std::sort(trials.begin(), trials.end());
+   std::size_t n = trials.size();
+   double median = n % 2 ? trials[n / 2] : (trials[n / 2 - 1] + trials[n / 2]) / 2;
+   std::vector<double> deviations;
+   for(std::size_t i = 0; i < n; ++i)
+      deviations.push_back(std::fabs(trials[i] - median));
+   std::sort(deviations.begin(), deviations.end());
+   timing_statistics stats;
+   stats.median = median;
+   stats.mad = n % 2 ? deviations[n / 2] : (deviations[n / 2 - 1] + deviations[n / 2]) / 2;
+   stats.trials = static_cast<unsigned>(n);
+   return stats;
+}
+
+//
+// As exec_timed_test, but repeated performance_trials() times, for programs which
+// record the spread of their timings with report_execution_time:
+//
+template <class Func>
+timing_statistics exec_timed_trials(Func f)
+{
+   std::vector<double> trials;
+   for(unsigned trial = 0; trial < performance_trials(); ++trial)
+      trials.push_back(exec_timed_test(f));
+   return summarise_trials(trials);
+}
+
 #endif // PERFORMANCE_HPP
@@ -13,11 +13,18 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/interprocess/sync/named_mutex.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
+#include <algorithm>
+#include <limits>
 #include <vector>
 #include <set>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <thread>
+#include <utility>
 #include "table_helper.hpp"
 
 void add_cell(boost::intmax_t val, const std::string& table_name, const std::string& row_name, const std::string& column_heading);
@@ -355,10 +362,193 @@ void add_cell(boost::intmax_t val, const std::string& table_name, const std::str
    }
 }
 
+static std::string input_domain;
+
+unsigned performance_trials()
+{
+   static const unsigned trials = []()
+   {
+      const char* p = std::getenv("BOOST_MATH_PERFORMANCE_TRIALS");
+      int n = p ? std::atoi(p) : 1;
+      return n > 1 ? static_cast<unsigned>(n) : 1u;
+   }();
+   return trials;
+}
+
+void set_input_domain(const std::string& domain)
+{
+   input_domain = domain;
+}
+
+std::string data_range(const std::string& name, unsigned column)
+{
+   double lo = std::numeric_limits<double>::infinity();
+   double hi = -lo;
+   for(std::vector<std::vector<double> >::const_iterator i = data.begin(); i != data.end(); ++i)
+   {
+      lo = (std::min)(lo, (*i)[column]);
+      hi = (std::max)(hi, (*i)[column]);
+   }
+   std::stringstream ss;
+   ss << std::setprecision(4) << name << " in [" << lo << ", " << hi << "]";
+   return ss.str();
+}
+
+//
+// Quickbook markup in the table, row and column names doesn't belong in the
+// machine readable results.  Note that the functions below don't use boost::regex:
+// they're called from main, and any regex state they construct would be destroyed
+// before the content_loader destructor which relies on it.
+//
+std::string strip_markup(std::string s)
+{
+   std::string::size_type pos;
+   while((pos = s.find("[br]")) != std::string::npos)
+      s.replace(pos, 4, " ");
+   return s;
+}
+
+std::string json_string(const std::string& s)
+{
+   std::string result = "\"";
+   for(std::string::const_iterator i = s.begin(); i != s.end(); ++i)
+   {
+      switch(*i)
+      {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if(static_cast<unsigned char>(*i) < 0x20)
+            result += " ";
+         else
+            result += *i;
+      }
+   }
+   return result + "\"";
+}
+
+std::string csv_string(const std::string& s)
+{
+   std::string result = "\"";
+   for(std::string::const_iterator i = s.begin(); i != s.end(); ++i)
+   {
+      if(*i == '"')
+         result += '"';
+      result += *i;
+   }
+   return result + "\"";
+}
+
+std::string replace_all(std::string s, const std::string& what, const std::string& with)
+{
+   std::string::size_type pos = 0;
+   while(!what.empty() && ((pos = s.find(what, pos)) != std::string::npos))
+   {
+      s.replace(pos, what.size(), with);
+      pos += with.size();
+   }
+   return s;
+}
+
+//
+// The table and column names contain the compiler and library versions, which are exactly what
+// changes between a baseline and the results checked against it.  So the records name the table
+// and implementation without them, and hold the versions in fields of their own.  The compiler
+// and platform names are replaced with placeholders, and version numbers - words made of
+// digits and dots, as in "GSL 2.6" or "boost 1.74" - are moved to the version field.
+//
+std::string version_free_table(std::string table)
+{
+   table = replace_all(table, compiler_name(), "compiler");
+   return strip_markup(replace_all(table, platform_name(), "platform"));
+}
+
+bool is_version_number(const std::string& word)
+{
+   return !word.empty() && std::isdigit(static_cast<unsigned char>(word[0])) && (word.find_first_not_of("0123456789.") == std::string::npos);
+}
+
+std::pair<std::string, std::string> version_free_implementation(std::string heading)
+{
+   heading = replace_all(heading, compiler_name() + "[br]", "");
+   std::stringstream ss(strip_markup(heading));
+   std::string word, name, version;
+   while(ss >> word)
+   {
+      std::string& s = is_version_number(word) ? version : name;
+      s += (s.empty() ? "" : " ") + word;
+   }
+   return std::make_pair(name, version);
+}
+
+void write_machine_readable_result(const timing_statistics& stats, const std::string& table, const std::string& row, const std::string& heading)
+{
+   const char* file_name = std::getenv("BOOST_MATH_PERFORMANCE_RESULTS");
+   if(!file_name || !*file_name)
+      return;
+   std::pair<std::string, std::string> implementation = version_free_implementation(heading);
+   std::string fields[][2] = {
+      { "table", version_free_table(table) },
+      { "function", strip_markup(row) },
+      { "implementation", implementation.first },
+      { "implementation_version", implementation.second },
+      { "domain", input_domain },
+      { "points", boost::lexical_cast<std::string>(data.size()) },
+      { "ns_per_call", format_precision(stats.median / 1e-9, 3) },
+      // A time below the resolution of the clock has no finite rate, and JSON has no infinity:
+      { "calls_per_second", stats.median > 0 ? format_precision(1 / stats.median, 0) : std::string("null") },
+      { "mad_ns", format_precision(stats.mad / 1e-9, 3) },
+      { "trials", boost::lexical_cast<std::string>(stats.trials) },
+      { "compiler", compiler_name() },
+      { "compiler_flags", get_compiler_flags() },
+      { "platform", platform_name() },
+      { "cpu", get_cpu_name() },
+      { "boost", boost_name() },
+   };
+   const unsigned field_count = sizeof(fields) / sizeof(fields[0]);
+   // Fields holding numbers, the rest are strings:
+   const bool numeric[field_count] = { false, false, false, false, false, true, true, true, true, true, false, false, false, false, false };
+
+   boost::interprocess::named_mutex mu(boost::interprocess::open_or_create, "handle_test_result");
+   boost::interprocess::scoped_lock<boost::interprocess::named_mutex> lock(mu);
+   boost::filesystem::path p(file_name);
+   bool csv = p.extension() == ".csv";
+   bool new_file = !boost::filesystem::exists(p) || (boost::filesystem::file_size(p) == 0);
+   boost::filesystem::ofstream os(p, std::ios_base::app);
+   if(csv)
+   {
+      if(new_file)
+      {
+         for(unsigned i = 0; i < field_count; ++i)
+            os << (i ? "," : "") << fields[i][0];
+         os << "\n";
+      }
+      for(unsigned i = 0; i < field_count; ++i)
+         os << (i ? "," : "") << (numeric[i] ? (fields[i][1] == "null" ? std::string() : fields[i][1]) : csv_string(fields[i][1]));
+      os << "\n";
+   }
+   else
+   {
+      os << "{";
+      for(unsigned i = 0; i < field_count; ++i)
+         os << (i ? ", " : "") << json_string(fields[i][0]) << ": " << (numeric[i] ? fields[i][1] : json_string(fields[i][1]));
+      os << "}\n";
+   }
+}
+
 void report_execution_time(double t, std::string table, std::string row, std::string heading)
 {
-   items_to_add.push_back(std::make_tuple(t, table, row, heading));
+   timing_statistics stats = { t, 0, 1 };
+   report_execution_time(stats, table, row, heading);
+}
+
+void report_execution_time(const timing_statistics& stats, std::string table, std::string row, std::string heading)
+{
+   items_to_add.push_back(std::make_tuple(stats.median, table, row, heading));
    //add_cell(static_cast<boost::uintmax_t>(t / 1e-9), table, row, heading);
+   write_machine_readable_result(stats, table, row, heading);
 }
 
 std::string get_compiler_options_name()
@@ -398,3 +588,70 @@ std::string get_compiler_options_name()
 #endif
 }
 
+std::string get_compiler_flags()
+{
+#ifdef BOOST_MATH_PERFORMANCE_COMPILER_FLAGS
+   return BOOST_MATH_PERFORMANCE_COMPILER_FLAGS;
+#elif defined(BOOST_MSVC) || defined(__ICL)
+   return get_compiler_options_name();
+#else
+   //
+   // The command line isn't available, so describe the options which affect
+   // code generation by the macros they define:
+   //
+   std::string result;
+#ifdef __OPTIMIZE__
+   result += " optimized";
+#else
+   result += " unoptimized";
+#endif
+#ifdef NDEBUG
+   result += " NDEBUG";
+#endif
+#ifdef __FAST_MATH__
+   result += " fast-math";
+#endif
+#if defined(__AVX512F__)
+   result += " AVX512F";
+#elif defined(__AVX2__)
+   result += " AVX2";
+#elif defined(__AVX__)
+   result += " AVX";
+#elif defined(__SSE2__)
+   result += " SSE2";
+#endif
+#ifdef __FMA__
+   result += " FMA";
+#endif
+#ifdef __ARM_NEON
+   result += " NEON";
+#endif
+   return result.substr(1);
+#endif
+}
+
+std::string get_cpu_name()
+{
+   std::string result;
+#ifdef __linux__
+   std::ifstream is("/proc/cpuinfo");
+   std::string line;
+   while(std::getline(is, line))
+   {
+      if(line.compare(0, 10, "model name") == 0)
+      {
+         std::string::size_type first = line.find(':');
+         if(first == std::string::npos)
+            continue;
+         first = line.find_first_not_of(" \t", first + 1);
+         std::string::size_type last = line.find_last_not_of(" \t\r");
+         if((first != std::string::npos) && (last >= first))
+            result = line.substr(first, last + 1 - first);
+         break;
+      }
+   }
+#endif
+   if(result.empty())
+      result = "unknown";
+   return result + " (" + boost::lexical_cast<std::string>(std::thread::hardware_concurrency()) + " threads)";
+}
@@ -298,6 +298,31 @@ extern std::vector<std::vector<double> > data;
 void report_execution_time(double t, std::string table, std::string row, std::string heading);
 std::string get_compiler_options_name();
 
+//
+// Machine readable results: when the environment variable BOOST_MATH_PERFORMANCE_RESULTS
+// names a file, each result passed to report_execution_time is also appended to that file,
+// one JSON object per line, or one CSV row per result if the name ends in ".csv".
+// A time passed as a double is recorded as a single trial.  Programs which time with
+// exec_timed_trials (see performance.hpp) pass the timing_statistics it returns instead:
+// the median and median absolute deviation of BOOST_MATH_PERFORMANCE_TRIALS trials (default 1).
+// See tools/compare_perf_results.cpp for comparing two such files.
+//
+struct timing_statistics
+{
+   double median;  // seconds per call
+   double mad;     // median absolute deviation of the trials, seconds per call
+   unsigned trials;
+};
+
+void report_execution_time(const timing_statistics& stats, std::string table, std::string row, std::string heading);
+unsigned performance_trials();
+// Tags the results which follow with a description of the input domain:
+void set_input_domain(const std::string& domain);
+// Describes the range of values in a column of the test data, for set_input_domain:
+std::string data_range(const std::string& name, unsigned column);
+std::string get_compiler_flags();
+std::string get_cpu_name();
+
 inline std::string boost_name()
 {
    return "boost " + boost::lexical_cast<std::string>(BOOST_VERSION / 100000) + "." + boost::lexical_cast<std::string>((BOOST_VERSION / 100) % 1000);
@@ -14,6 +14,8 @@
 #include "table_helper.hpp"
 #include "performance.hpp"
 #include <iostream>
+#include <algorithm>
+#include <random>
 
 int main()
 {
@@ -67,6 +69,41 @@ int main()
 #endif
 
 
+   //
+   // Throughput of the array overloads against calling the scalar version in a loop:
+   //
+   {
+      std::vector<double> x, y;
+      for(unsigned i = 0; i < 64; ++i)
+         for(std::vector<std::vector<double> >::const_iterator j = data.begin(); j != data.end(); ++j)
+            x.push_back((i & 1) ? -(*j)[0] : (*j)[0]);
+      // The test data is sorted, shuffle it so that branch prediction doesn't flatter the scalar loop:
+      std::shuffle(x.begin(), x.end(), std::mt19937(0));
+      y.resize(x.size());
+      double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::erf(x[i]); return y.back(); }, x.size());
+      double batch = exec_timed_throughput([&]() { boost::math::erf(x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+      std::cout << "erf elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+      scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::erfc(x[i]); return y.back(); }, x.size());
+      batch = exec_timed_throughput([&]() { boost::math::erfc(x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+      std::cout << "erfc elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+#if !defined(COMPILER_COMPARISON_TABLES)
+      typedef boost::math::policies::policy<boost::math::policies::promote_double<false> > no_promote_policy;
+      scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::erf(x[i], no_promote_policy()); return y.back(); }, x.size());
+      batch = exec_timed_throughput([&]() { boost::math::erf(x.data(), x.data() + x.size(), y.data(), no_promote_policy()); return y.back(); }, x.size());
+      std::cout << "erf elements/second with promote_double<false>, scalar: " << scalar << " batch: " << batch << std::endl;
+      std::vector<double> p(x.size());
+      for(std::size_t i = 0; i < x.size(); ++i)
+      {
+         // Keep clear of the poles at +-1:
+         double t = boost::math::erf(x[i] / 4);
+         p[i] = std::fabs(t) < 1 ? t : 0.5;
+      }
+      scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < p.size(); ++i) y[i] = boost::math::erf_inv(p[i]); return y.back(); }, p.size());
+      batch = exec_timed_throughput([&]() { boost::math::erf_inv(p.data(), p.data() + p.size(), y.data()); return y.back(); }, p.size());
+      std::cout << "erf_inv elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+#endif
+   }
+
 #if defined(TEST_C99) && !defined(COMPILER_COMPARISON_TABLES)
    time = exec_timed_test([](const std::vector<double>& v){  return ::erf(v[0]);  });
    std::cout << time << std::endl;
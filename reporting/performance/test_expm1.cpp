@@ -38,9 +38,10 @@ int main()
    unsigned data_used = data.size();
    std::string function = "expm1[br](" + boost::lexical_cast<std::string>(data_used) + "/" + boost::lexical_cast<std::string>(data_total) + " tests selected)";
    std::string function_short = "expm1";
+   set_input_domain(data_range("x", 0));
 
-   double time = exec_timed_test([](const std::vector<double>& v){  return boost::math::expm1(v[0]);  });
-   std::cout << time << std::endl;
+   timing_statistics time = exec_timed_trials([](const std::vector<double>& v){  return boost::math::expm1(v[0]);  });
+   std::cout << time.median << std::endl;
 #if !defined(COMPILER_COMPARISON_TABLES) && (defined(TEST_GSL) || defined(TEST_RMATH) || defined(TEST_C99) || defined(TEST_LIBSTDCXX))
    report_execution_time(time, std::string("Library Comparison with ") + std::string(compiler_name()) + std::string(" on ") + platform_name(), function, boost_name());
 #endif
@@ -51,8 +52,8 @@ int main()
 #if !defined(COMPILER_COMPARISON_TABLES)
    if(sizeof(long double) != sizeof(double))
    {
-      double time = exec_timed_test([](const std::vector<double>& v){  return boost::math::expm1(v[0], boost::math::policies::make_policy(boost::math::policies::promote_double<false>()));  });
-      std::cout << time << std::endl;
+      timing_statistics time = exec_timed_trials([](const std::vector<double>& v){  return boost::math::expm1(v[0], boost::math::policies::make_policy(boost::math::policies::promote_double<false>()));  });
+      std::cout << time.median << std::endl;
 #if !defined(COMPILER_COMPARISON_TABLES) && (defined(TEST_GSL) || defined(TEST_RMATH) || defined(TEST_C99) || defined(TEST_LIBSTDCXX))
       report_execution_time(time, std::string("Library Comparison with ") + std::string(compiler_name()) + std::string(" on ") + platform_name(), function, boost_name() + "[br]promote_double<false>");
 #endif
@@ -62,13 +63,13 @@ int main()
 
 
 #if defined(TEST_C99) && !defined(COMPILER_COMPARISON_TABLES)
-   time = exec_timed_test([](const std::vector<double>& v){  return ::expm1(v[0]);  });
-   std::cout << time << std::endl;
+   time = exec_timed_trials([](const std::vector<double>& v){  return ::expm1(v[0]);  });
+   std::cout << time.median << std::endl;
    report_execution_time(time, std::string("Library Comparison with ") + std::string(compiler_name()) + std::string(" on ") + platform_name(), function, "math.h");
 #endif
 #if defined(TEST_LIBSTDCXX) && !defined(COMPILER_COMPARISON_TABLES)
-   time = exec_timed_test([](const std::vector<double>& v){  return std::tr1::expm1(v[0]);  });
-   std::cout << time << std::endl;
+   time = exec_timed_trials([](const std::vector<double>& v){  return std::tr1::expm1(v[0]);  });
+   std::cout << time.median << std::endl;
    report_execution_time(time, std::string("Library Comparison with ") + std::string(compiler_name()) + std::string(" on ") + platform_name(), function, "tr1/cmath");
 #endif
 
@@ -14,6 +14,7 @@
 #include "table_helper.hpp"
 #include "performance.hpp"
 #include <iostream>
+#include <random>
 
 typedef double T;
 #define SC_(x) static_cast<double>(x)
@@ -69,6 +70,23 @@ int main()
    }
 #endif
 
+   //
+   // Throughput of the array overloads for a fixed a against calling the scalar version in a loop:
+   //
+   {
+      std::vector<double> x(1 << 15), y(x.size());
+      std::mt19937 gen(0);
+      for(double a : { 0.5, 2.0, 4.5, 12.25, 75.0 })
+      {
+         std::uniform_real_distribution<double> dist(0, 3 * a + 10);
+         for(std::size_t i = 0; i < x.size(); ++i)
+            x[i] = dist(gen);
+         double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::gamma_p(a, x[i]); return y.back(); }, x.size());
+         double batch = exec_timed_throughput([&]() { boost::math::gamma_p(a, x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+         std::cout << "gamma_p(" << a << ", x) elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+      }
+   }
+
 
 #if defined(TEST_GSL) && !defined(COMPILER_COMPARISON_TABLES)
    time = exec_timed_test([](const std::vector<double>& v){  return gsl_sf_gamma_inc_P(v[0], v[1]);  });
@@ -14,6 +14,7 @@
 #include "table_helper.hpp"
 #include "performance.hpp"
 #include <iostream>
+#include <random>
 
 typedef double T;
 #define SC_(x) static_cast<double>(x)
@@ -69,6 +70,26 @@ int main()
    }
 #endif
 
+   //
+   // Throughput of ibeta_evaluator for fixed a and b against calling the scalar version in a loop,
+   // the parameters are those of Student's t with 5 and 30 degrees of freedom, F(5, 12) and a general case:
+   //
+   {
+      std::vector<double> x(1 << 12), y(x.size());
+      std::mt19937 gen(0);
+      std::uniform_real_distribution<double> dist(0, 1);
+      for(std::size_t i = 0; i < x.size(); ++i)
+         x[i] = dist(gen);
+      double shapes[][2] = { { 2.5, 0.5 }, { 15, 0.5 }, { 2.5, 6 }, { 20.5, 39.5 } };
+      for(auto const& s : shapes)
+      {
+         double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::ibeta(s[0], s[1], x[i]); return y.back(); }, x.size());
+         boost::math::ibeta_evaluator<double> f(s[0], s[1]);
+         double cached = exec_timed_throughput([&]() { f.p(x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+         std::cout << "ibeta(" << s[0] << ", " << s[1] << ", x) elements/second, scalar: " << scalar << " evaluator: " << cached << std::endl;
+      }
+   }
+
 
 #if defined(TEST_RMATH) && !defined(COMPILER_COMPARISON_TABLES)
    time = exec_timed_test([](const std::vector<double>& v){  return ::pbeta(v[2], v[0], v[1], 1, 0);  });
@@ -14,6 +14,7 @@
 #include "table_helper.hpp"
 #include "performance.hpp"
 #include <iostream>
+#include <random>
 
 typedef double T;
 #define SC_(x) static_cast<double>(x)
@@ -97,6 +98,32 @@ int main()
    }
 #endif
 
+   //
+   // Throughput of the order sequences against calling the scalar version for each order,
+   // and of the array overloads for a fixed order against calling the scalar version in a loop:
+   //
+   {
+      std::vector<double> y(100);
+      for(double x : { 0.5, 5.0, 50.0 })
+      {
+         double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < y.size(); ++i) y[i] = boost::math::cyl_bessel_j(0.25 + i, x); return y.back(); }, y.size());
+         double sequence = exec_timed_throughput([&]() { boost::math::cyl_bessel_j_sequence(0.25, x, y.size(), y.begin()); return y.back(); }, y.size());
+         std::cout << "cyl_bessel_j(0.25 + n, " << x << ") elements/second, scalar: " << scalar << " sequence: " << sequence << std::endl;
+      }
+      std::vector<double> x(1 << 12);
+      y.resize(x.size());
+      std::mt19937 gen(0);
+      for(double upper : { 2.0, 50.0 })
+      {
+         std::uniform_real_distribution<double> dist(0, upper);
+         for(std::size_t i = 0; i < x.size(); ++i)
+            x[i] = dist(gen);
+         double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::cyl_bessel_j(2.25, x[i]); return y.back(); }, x.size());
+         double batch = exec_timed_throughput([&]() { boost::math::cyl_bessel_j(2.25, x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+         std::cout << "cyl_bessel_j(2.25, x < " << upper << ") elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+      }
+   }
+
 
 #if defined(TEST_LIBSTDCXX) && !defined(COMPILER_COMPARISON_TABLES)
    time = exec_timed_test([](const std::vector<double>& v){  return std::tr1::cyl_bessel_j(v[0], v[1]);  });
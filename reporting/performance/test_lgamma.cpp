@@ -14,6 +14,8 @@
 #include "table_helper.hpp"
 #include "performance.hpp"
 #include <iostream>
+#include <algorithm>
+#include <random>
 
 int main()
 {
@@ -72,6 +74,28 @@ int main()
 #endif
 
 
+   //
+   // Throughput of the array overloads against calling the scalar version in a loop:
+   //
+   {
+      std::vector<double> x, y;
+      for(unsigned i = 0; i < 64; ++i)
+         for(std::vector<std::vector<double> >::const_iterator j = data.begin(); j != data.end(); ++j)
+            x.push_back((*j)[0]);
+      // The test data is sorted, shuffle it so that branch prediction doesn't flatter the scalar loop:
+      std::shuffle(x.begin(), x.end(), std::mt19937(0));
+      y.resize(x.size());
+      double scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::lgamma(x[i]); return y.back(); }, x.size());
+      double batch = exec_timed_throughput([&]() { boost::math::lgamma(x.data(), x.data() + x.size(), y.data()); return y.back(); }, x.size());
+      std::cout << "lgamma elements/second, scalar: " << scalar << " batch: " << batch << std::endl;
+#if !defined(COMPILER_COMPARISON_TABLES)
+      typedef boost::math::policies::policy<boost::math::policies::promote_double<false> > no_promote_policy;
+      scalar = exec_timed_throughput([&]() { for(std::size_t i = 0; i < x.size(); ++i) y[i] = boost::math::lgamma(x[i], no_promote_policy()); return y.back(); }, x.size());
+      batch = exec_timed_throughput([&]() { boost::math::lgamma(x.data(), x.data() + x.size(), y.data(), no_promote_policy()); return y.back(); }, x.size());
+      std::cout << "lgamma elements/second with promote_double<false>, scalar: " << scalar << " batch: " << batch << std::endl;
+#endif
+   }
+
 #if defined(TEST_C99) && !defined(COMPILER_COMPARISON_TABLES)
    time = exec_timed_test([](const std::vector<double>& v){  return ::lgamma(v[0]);  });
    std::cout << time << std::endl;
@@ -41,6 +41,8 @@
 #undef evaluate_rational_c_imp
 #undef BOOST_MATH_TOOLS_POLY_RAT_20_HPP
 
+#include <boost/math/tools/rational.hpp>
+
 static const double num[21] = {
    static_cast<double>(56906521.91347156388090791033559122686859L),
    static_cast<double>(103794043.1163445451906271053616070238554L),
@@ -308,6 +310,77 @@ V evaluate_rational_0(const T* num, const U* denom, const V& z_, std::size_t cou
    return s1 / s2;
 }
 
+//
+// The batch interfaces evaluate one polynomial at many points, compare them
+// against a loop over the scalar runtime-order routine:
+//
+static const unsigned batch_size = 64;
+
+void make_batch(double x, double* z)
+{
+   for (unsigned j = 0; j < batch_size; ++j)
+      z[j] = x * (j + 1) / batch_size;
+}
+
+void test_batch(unsigned i)
+{
+   std::string table = std::string("Batch Polynomial Method Comparison with ") + compiler_name() + std::string(" on ") + platform_name();
+
+   double time = exec_timed_test([&](const std::vector<double>& v) {
+      double z[batch_size];
+      make_batch(v[0], z);
+      double result = 0;
+      for (unsigned j = 0; j < batch_size; ++j)
+         result += boost::math::tools::evaluate_polynomial(denom, z[j], i);
+      return result;
+   });
+   report_execution_time(time, table, "Order " + make_order_string(i), "Scalar Loop");
+
+   time = exec_timed_test([&](const std::vector<double>& v) {
+      double z[batch_size];
+      make_batch(v[0], z);
+      boost::math::tools::evaluate_polynomial(denom, i, z, z, batch_size);
+      double result = 0;
+      for (unsigned j = 0; j < batch_size; ++j)
+         result += z[j];
+      return result;
+   });
+   report_execution_time(time, table, "Order " + make_order_string(i), "Batch Horner");
+
+   time = exec_timed_test([&](const std::vector<double>& v) {
+      double z[batch_size];
+      make_batch(v[0], z);
+      boost::math::tools::evaluate_polynomial_estrin(denom, i, z, z, batch_size);
+      double result = 0;
+      for (unsigned j = 0; j < batch_size; ++j)
+         result += z[j];
+      return result;
+   });
+   report_execution_time(time, table, "Order " + make_order_string(i), "Batch Estrin");
+
+   table = std::string("Batch Rational Method Comparison with ") + compiler_name() + std::string(" on ") + platform_name();
+
+   time = exec_timed_test([&](const std::vector<double>& v) {
+      double z[batch_size];
+      make_batch(v[0], z);
+      double result = 0;
+      for (unsigned j = 0; j < batch_size; ++j)
+         result += boost::math::tools::evaluate_rational(num, denom, z[j], i);
+      return result;
+   });
+   report_execution_time(time, table, "Order " + make_order_string(i), "Scalar Loop");
+
+   time = exec_timed_test([&](const std::vector<double>& v) {
+      double z[batch_size];
+      make_batch(v[0], z);
+      boost::math::tools::evaluate_rational(num, denom, i, z, z, batch_size);
+      double result = 0;
+      for (unsigned j = 0; j < batch_size; ++j)
+         result += z[j];
+      return result;
+   });
+   report_execution_time(time, table, "Order " + make_order_string(i), "Batch");
+}
 
 int main()
 {
@@ -366,6 +439,9 @@ int main()
    test_rat_2(boost::integral_constant<int, 20>());
    test_rat_3(boost::integral_constant<int, 20>());
 
+   for (unsigned i = 3; i <= 20; ++i)
+      test_batch(i);
+
    return 0;
 }
 
@@ -15,6 +15,7 @@
 #include <boost/random.hpp>
 #include <boost/math/tools/polynomial.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <numeric>
 
 unsigned max_reps = 1000;
 
@@ -251,6 +252,100 @@ void test(const char* type)
    //report_execution_time(t.test_gcd() / count, table_name, "gcd", type);
 }
 
+//
+// Large polynomials are multiplied via FFT or NTT and divided by Newton iteration,
+// compare these with the classical algorithms:
+//
+template <class T>
+std::vector<T> classical_multiply(const std::vector<T>& a, const std::vector<T>& b)
+{
+   std::vector<T> result(a.size() + b.size() - 1, T(0));
+   for(std::size_t i = 0; i < a.size(); ++i)
+      for(std::size_t j = 0; j < b.size(); ++j)
+         result[i + j] += a[i] * b[j];
+   return result;
+}
+
+template <class T>
+std::vector<T> classical_divide(std::vector<T> u, const std::vector<T>& v)
+{
+   std::size_t n = v.size() - 1;
+   std::vector<T> q(u.size() - n);
+   for(std::size_t k = q.size(); k-- != 0;)
+   {
+      q[k] = u[n + k] / v[n];
+      for(std::size_t j = 0; j <= n; ++j)
+         u[j + k] -= q[k] * v[j];
+   }
+   return q;
+}
+
+template <class F>
+double time_large_operation(F f)
+{
+   unsigned repeats = 0;
+   double t;
+   stopwatch<boost::chrono::high_resolution_clock> w;
+   do
+   {
+      f();
+      ++repeats;
+      t = boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+   } while(t < 0.5);
+   return t / repeats;
+}
+
+template <class Number>
+void test_large(const char* type)
+{
+   std::cout << "Testing large polynomials of type: " << type << std::endl;
+   std::string table_name = "Large Polynomial Arithmetic (" + compiler_name() + ", " + platform_name() + ")";
+   boost::random::mt19937 gen;
+   boost::uniform_int<> ui(1, 10000);
+   std::size_t const degrees[] = { 100, 1000, 10000, 100000 };
+   for(unsigned d = 0; d < sizeof(degrees) / sizeof(degrees[0]); ++d)
+   {
+      std::size_t n = degrees[d];
+      std::vector<Number> a(n + 1), b(n + 1);
+      for(std::size_t i = 0; i <= n; ++i)
+      {
+         a[i] = static_cast<Number>(ui(gen));
+         b[i] = static_cast<Number>(ui(gen));
+      }
+      boost::math::tools::polynomial<Number> pa(a.begin(), a.end()), pb(b.begin(), b.end());
+      boost::math::tools::polynomial<Number> product = pa * pb;
+      std::string degree = boost::lexical_cast<std::string>(n);
+      report_execution_time(time_large_operation([&]() { product = pa * pb; }), table_name, "operator * (degree " + degree + ")", type);
+      // The classical algorithm takes too long at the largest degree:
+      if(n <= 10000)
+         report_execution_time(time_large_operation([&]() { sum += static_cast<double>(classical_multiply(a, b)[n]); }), table_name, "operator * (degree " + degree + ")", std::string(type) + " (classical)");
+      if(boost::is_floating_point<Number>::value && (n <= 1000))
+      {
+         // Evaluation at many points in [-1, 1]:
+         std::vector<Number> x(10000), y(x.size());
+         for(std::size_t i = 0; i < x.size(); ++i)
+            x[i] = static_cast<Number>(std::cos(static_cast<double>(i)));
+         report_execution_time(time_large_operation([&]() { pa.evaluate(&x[0], &x[0] + x.size(), &y[0]); sum += static_cast<double>(y[0]); }), table_name, "evaluate at 10000 points (degree " + degree + ")", type);
+         report_execution_time(time_large_operation([&]() { for(std::size_t i = 0; i < x.size(); ++i) sum += static_cast<double>(pa(x[i])); }), table_name, "evaluate at 10000 points (degree " + degree + ")", std::string(type) + " (operator())");
+      }
+      if(boost::is_floating_point<Number>::value)
+      {
+         //
+         // Divide a polynomial of degree 2n by one of degree n, Newton iteration is
+         // used only when the divisor has all its roots inside the unit circle, which
+         // is the case when the leading coefficient dominates:
+         //
+         b[n] = std::accumulate(b.begin(), b.end() - 1, Number(1));
+         pb = boost::math::tools::polynomial<Number>(b.begin(), b.end());
+         product = pa * pb;
+         boost::math::tools::polynomial<Number> quotient;
+         report_execution_time(time_large_operation([&]() { quotient = product / pb; }), table_name, "operator / (degree " + degree + ")", type);
+         if(n <= 10000)
+            report_execution_time(time_large_operation([&]() { sum += static_cast<double>(classical_divide(product.data(), b)[0]); }), table_name, "operator / (degree " + degree + ")", std::string(type) + " (classical)");
+      }
+   }
+}
+
 
 int main()
 {
@@ -258,6 +353,8 @@ int main()
    test<double>("double");
    max_reps = 100;
    test<boost::multiprecision::cpp_int>("cpp_int");
+   test_large<boost::uint64_t>("boost::uint64_t");
+   test_large<double>("double");
    return 0;
 }
 
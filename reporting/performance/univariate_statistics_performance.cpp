@@ -0,0 +1,140 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the sequential and parallel (std::execution::par) forms of the univariate statistics.
+// g++ -std=c++17 -O3 -march=native -I../../include univariate_statistics_performance.cpp -lbenchmark -ltbb -pthread
+
+#include <random>
+#include <vector>
+#include <execution>
+#include <benchmark/benchmark.h>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+template<class Real>
+std::vector<Real> random_vector(std::size_t n)
+{
+    std::mt19937_64 mt(12345);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(n);
+    for (auto & x : v)
+    {
+        x = dis(mt);
+    }
+    return v;
+}
+
+#define BOOST_MATH_STATISTICS_BENCHMARK(Name, function)                                         \
+template<class Real>                                                                            \
+void Name##Sequential(benchmark::State& state)                                                  \
+{                                                                                               \
+    std::vector<Real> v = random_vector<Real>(state.range(0));                                  \
+    for (auto _ : state)                                                                        \
+    {                                                                                           \
+        benchmark::DoNotOptimize(boost::math::statistics::function(v));                         \
+    }                                                                                           \
+    state.SetItemsProcessed(state.iterations()*state.range(0));                                 \
+    state.SetComplexityN(state.range(0));                                                       \
+}                                                                                               \
+                                                                                                \
+template<class Real>                                                                            \
+void Name##Parallel(benchmark::State& state)                                                    \
+{                                                                                               \
+    std::vector<Real> v = random_vector<Real>(state.range(0));                                  \
+    for (auto _ : state)                                                                        \
+    {                                                                                           \
+        benchmark::DoNotOptimize(boost::math::statistics::function(std::execution::par, v));    \
+    }                                                                                           \
+    state.SetItemsProcessed(state.iterations()*state.range(0));                                 \
+    state.SetComplexityN(state.range(0));                                                       \
+}                                                                                               \
+                                                                                                \
+BENCHMARK_TEMPLATE(Name##Sequential, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity(); \
+BENCHMARK_TEMPLATE(Name##Parallel, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity();
+
+BOOST_MATH_STATISTICS_BENCHMARK(Mean, mean)
+BOOST_MATH_STATISTICS_BENCHMARK(Variance, variance)
+BOOST_MATH_STATISTICS_BENCHMARK(Skewness, skewness)
+BOOST_MATH_STATISTICS_BENCHMARK(Kurtosis, kurtosis)
+BOOST_MATH_STATISTICS_BENCHMARK(FirstFourMoments, first_four_moments)
+
+// median and gini_coefficient reorder their input, so each iteration works on a fresh copy:
+template<class Real>
+void MedianSequential(benchmark::State& state)
+{
+    std::vector<Real> v = random_vector<Real>(state.range(0));
+    std::vector<Real> w(v.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        w = v;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(boost::math::statistics::median(w));
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void MedianParallel(benchmark::State& state)
+{
+    std::vector<Real> v = random_vector<Real>(state.range(0));
+    std::vector<Real> w(v.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        w = v;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(boost::math::statistics::median(std::execution::par, w));
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void GiniCoefficientSequential(benchmark::State& state)
+{
+    std::vector<Real> v = random_vector<Real>(state.range(0));
+    for (auto & x : v)
+    {
+        x = abs(x);
+    }
+    std::vector<Real> w(v.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        w = v;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(boost::math::statistics::gini_coefficient(w));
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void GiniCoefficientParallel(benchmark::State& state)
+{
+    std::vector<Real> v = random_vector<Real>(state.range(0));
+    for (auto & x : v)
+    {
+        x = abs(x);
+    }
+    std::vector<Real> w(v.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        w = v;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(boost::math::statistics::gini_coefficient(std::execution::par, w));
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_TEMPLATE(MedianSequential, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity(benchmark::oN);
+BENCHMARK_TEMPLATE(MedianParallel, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity(benchmark::oN);
+BENCHMARK_TEMPLATE(GiniCoefficientSequential, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(GiniCoefficientParallel, double)->RangeMultiplier(4)->Range(1<<10, 1<<24)->UseRealTime()->Complexity(benchmark::oNLogN);
+
+BENCHMARK_MAIN();
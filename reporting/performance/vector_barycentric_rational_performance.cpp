@@ -0,0 +1,172 @@
+//  (C) Copyright the Boost.Math authors 2020.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Construction of vector valued barycentric rational interpolants of long trajectories on one and many threads,
+// and evaluation one point at a time, or a whole array of points at once into the caller's storage.
+// g++ -std=c++17 -O3 -march=native -I../../include vector_barycentric_rational_performance.cpp -lbenchmark -pthread
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/vector_barycentric_rational.hpp>
+
+using boost::math::vector_barycentric_rational;
+
+constexpr std::size_t points = 256;
+
+template<class Real>
+using trajectory = vector_barycentric_rational<std::vector<Real>, std::vector<std::array<Real, 3>>>;
+
+// An orbit, sampled at slightly irregular times:
+template<class Real>
+void samples(std::size_t n, std::vector<Real>& t, std::vector<std::array<Real, 3>>& y)
+{
+    std::mt19937_64 gen(1234);
+    std::uniform_real_distribution<Real> dis(Real(0.5), Real(1.5));
+    t.resize(n);
+    y.resize(n);
+    t[0] = 0;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        t[i] = t[i - 1] + dis(gen)/n;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Real theta = 20*t[i];
+        y[i] = {{std::cos(theta), std::sin(theta)/2, std::sin(theta)*Real(0.8)}};
+    }
+}
+
+template<class Real>
+trajectory<Real> interpolant(std::size_t n)
+{
+    std::vector<Real> t;
+    std::vector<std::array<Real, 3>> y;
+    samples(n, t, y);
+    return trajectory<Real>(std::move(t), std::move(y));
+}
+
+template<class Real>
+std::vector<Real> abscissas()
+{
+    std::mt19937_64 gen(4321);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<Real> s(points);
+    for (auto& x : s)
+    {
+        x = dis(gen);
+    }
+    return s;
+}
+
+// The copies of the data, which the interpolant takes ownership of, are made outside of the timing:
+template<class Real>
+void Construction(benchmark::State& state)
+{
+    std::vector<Real> t;
+    std::vector<std::array<Real, 3>> y;
+    samples(state.range(0), t, y);
+    std::size_t threads = state.range(1);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Real> tc = t;
+        std::vector<std::array<Real, 3>> yc = y;
+        state.ResumeTiming();
+        trajectory<Real> s(std::move(tc), std::move(yc), 3, threads);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void Scalar(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto x = abscissas<Real>();
+    std::array<Real, 3> p;
+    for (auto _ : state)
+    {
+        for (auto xi : x)
+        {
+            s(p, xi);
+            benchmark::DoNotOptimize(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void CallerStorage(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto x = abscissas<Real>();
+    std::vector<Real> p(3*x.size());
+    std::size_t threads = state.range(1);
+    for (auto _ : state)
+    {
+        s(x.data(), x.size(), p.data(), threads);
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void PrimeScalar(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto x = abscissas<Real>();
+    std::array<Real, 3> p;
+    std::array<Real, 3> dp;
+    for (auto _ : state)
+    {
+        for (auto xi : x)
+        {
+            s.eval_with_prime(p, dp, xi);
+            benchmark::DoNotOptimize(dp);
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void PrimeCallerStorage(benchmark::State& state)
+{
+    auto s = interpolant<Real>(state.range(0));
+    auto x = abscissas<Real>();
+    std::vector<Real> dp(3*x.size());
+    std::size_t threads = state.range(1);
+    for (auto _ : state)
+    {
+        s.prime(x.data(), x.size(), dp.data(), threads);
+        benchmark::DoNotOptimize(dp.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+    state.SetComplexityN(state.range(0));
+}
+
+static void Threads(benchmark::internal::Benchmark* b, long long lo, long long hi)
+{
+    long long threads = (std::max)(std::thread::hardware_concurrency(), 2u);
+    for (long long n = lo; n <= hi; n *= 8)
+    {
+        b->Args({n, 1});
+        b->Args({n, threads});
+    }
+}
+
+BENCHMARK_TEMPLATE(Construction, double)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 1 << 14, 1 << 20); })->UseRealTime();
+BENCHMARK_TEMPLATE(Scalar, double)->Args({1 << 12, 1})->Args({1 << 15, 1})->Args({1 << 18, 1});
+BENCHMARK_TEMPLATE(CallerStorage, double)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 1 << 12, 1 << 18); })->UseRealTime();
+BENCHMARK_TEMPLATE(PrimeScalar, double)->Args({1 << 12, 1})->Args({1 << 15, 1})->Args({1 << 18, 1});
+BENCHMARK_TEMPLATE(PrimeCallerStorage, double)->Apply([](benchmark::internal::Benchmark* b) { Threads(b, 1 << 12, 1 << 18); })->UseRealTime();
+
+BENCHMARK_MAIN();
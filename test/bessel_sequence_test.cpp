@@ -0,0 +1,409 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/bessel_prime.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// The array overloads must reproduce the scalar functions exactly, unless the
+// compiler is free to fuse multiplies and adds, and does so differently in the
+// precomputed terms:
+#if defined(FP_FAST_FMA) || defined(FP_FAST_FMAF) || defined(FP_FAST_FMAL)
+const int batch_ulps = 8;
+#else
+const int batch_ulps = 0;
+#endif
+
+// J, Y, I and K and their derivatives for orders v0 ... v0 + orders - 1, and
+// one more order for the values, at 50 digits:
+struct reference
+{
+    double v0;
+    double x;
+    std::vector<cpp_bin_float_50> values[4];
+    std::vector<cpp_bin_float_50> derivatives[4];
+};
+
+const unsigned orders = 40;
+
+std::vector<reference> make_references()
+{
+    using namespace boost::math;
+    std::vector<reference> refs;
+    for (double v0 : {0.0, 0.25, 2.5, 10.0, 50.75})
+    {
+        for (double x : {1e-3, 0.5, 2.0, 5.0, 12.5, 40.0, 100.0})
+        {
+            reference r;
+            r.v0 = v0;
+            r.x = x;
+            cpp_bin_float_50 z(x);
+            for (unsigned k = 0; k <= orders; ++k)
+            {
+                cpp_bin_float_50 v = cpp_bin_float_50(v0) + k;
+                r.values[0].push_back(cyl_bessel_j(v, z));
+                r.values[1].push_back(cyl_neumann(v, z));
+                r.values[2].push_back(cyl_bessel_i(v, z));
+                r.values[3].push_back(cyl_bessel_k(v, z));
+                r.derivatives[0].push_back(cyl_bessel_j_prime(v, z));
+                r.derivatives[1].push_back(cyl_neumann_prime(v, z));
+                r.derivatives[2].push_back(cyl_bessel_i_prime(v, z));
+                r.derivatives[3].push_back(cyl_bessel_k_prime(v, z));
+            }
+            refs.push_back(r);
+        }
+    }
+    return refs;
+}
+
+// The error in units of epsilon relative to the size of the function near
+// this order: J and Y oscillate, so measure against the neighbouring orders
+// and, for the derivatives, against the terms of the recurrence relation.
+// Returns zero for values beyond the normal range of Real, which lose
+// precision or overflow, as in the scalar functions:
+template<class Real>
+cpp_bin_float_50 sequence_error(Real computed, reference const & r, int family, bool derivative, unsigned k)
+{
+    using std::abs;
+    using std::max;
+    typedef cpp_bin_float_50 mp;
+    mp eps = std::numeric_limits<Real>::epsilon();
+    mp smallest = mp((std::numeric_limits<Real>::min)()) / eps;
+    mp largest = mp((std::numeric_limits<Real>::max)()) / 16;
+    std::vector<mp> const & f = r.values[family];
+    mp expected = derivative ? r.derivatives[family][k] : f[k];
+    mp scale = abs(expected);
+    if (family < 2)
+    {
+        if (derivative)
+        {
+            scale = max(scale, mp(abs(f[k + 1]) + (r.v0 + k) / r.x * abs(f[k])));
+        }
+        else
+        {
+            scale = max(scale, mp(abs(f[k + 1])));
+            if (k > 0)
+            {
+                scale = max(scale, mp(abs(f[k - 1])));
+            }
+        }
+    }
+    if ((scale < smallest) || (scale > largest))
+    {
+        return 0;
+    }
+    return abs(mp(computed) - expected) / (eps * scale);
+}
+
+// The sequences start from, or are normalised by, the scalar functions, so
+// may be as inaccurate as the scalar values of the function at this and the
+// neighbouring orders, but no more than tolerance worse:
+template<class Real>
+void check_sequence(std::vector<Real> const & computed, std::vector<Real> const & scalar, reference const & r, int family, bool derivative, Real tolerance)
+{
+    using std::max;
+    for (unsigned k = 0; k < computed.size(); ++k)
+    {
+        cpp_bin_float_50 scalar_error = 0;
+        for (unsigned j = (k > 0 ? k - 1 : 0); (j <= k + 1) && (j < orders); ++j)
+        {
+            scalar_error = (max)(scalar_error, sequence_error(scalar[j], r, family, false, j));
+        }
+        cpp_bin_float_50 error = sequence_error(computed[k], r, family, derivative, k);
+        if (!CHECK_LE(error, tolerance + 2 * scalar_error))
+        {
+            std::cerr << "  Family " << family << (derivative ? " derivative" : "") << " at v = " << r.v0 + k << ", x = " << r.x << "\n";
+        }
+    }
+}
+
+template<class Real>
+void test_sequences(std::vector<reference> const & refs)
+{
+    using namespace boost::math;
+    using namespace boost::math::policies;
+    // No internal promotion, so that the recurrences are carried out in Real:
+    typedef policy<promote_float<false>, promote_double<false>, overflow_error<ignore_error> > test_policy;
+    test_policy pol;
+    Real value_tolerance = 50;
+    Real derivative_tolerance = 400;
+    std::vector<Real> y(orders);
+    std::vector<Real> scalar[4];
+    for (auto const & r : refs)
+    {
+        Real v0 = static_cast<Real>(r.v0);
+        Real x = static_cast<Real>(r.x);
+        for (auto & s : scalar)
+        {
+            s.clear();
+        }
+        for (unsigned k = 0; k <= orders; ++k)
+        {
+            scalar[0].push_back(cyl_bessel_j(v0 + k, x, pol));
+            scalar[1].push_back(cyl_neumann(v0 + k, x, pol));
+            scalar[2].push_back(cyl_bessel_i(v0 + k, x, pol));
+            scalar[3].push_back(cyl_bessel_k(v0 + k, x, pol));
+        }
+        cyl_bessel_j_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[0], r, 0, false, value_tolerance);
+        cyl_neumann_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[1], r, 1, false, value_tolerance);
+        cyl_bessel_i_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[2], r, 2, false, value_tolerance);
+        cyl_bessel_k_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[3], r, 3, false, value_tolerance);
+        cyl_bessel_j_prime_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[0], r, 0, true, derivative_tolerance);
+        cyl_neumann_prime_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[1], r, 1, true, derivative_tolerance);
+        cyl_bessel_i_prime_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[2], r, 2, true, derivative_tolerance);
+        cyl_bessel_k_prime_sequence(v0, x, orders, y.begin(), pol);
+        check_sequence(y, scalar[3], r, 3, true, derivative_tolerance);
+    }
+}
+
+// The scalar functions overflow to infinity under the ignore_error policy:
+template<class Real>
+void check_same(Real expected, Real computed, int ulps)
+{
+    if ((boost::math::isnan)(expected))
+    {
+        CHECK_NAN(computed);
+    }
+    else if ((boost::math::isinf)(expected))
+    {
+        CHECK_EQUAL(expected, computed);
+    }
+    else
+    {
+        CHECK_ULP_CLOSE(expected, computed, ulps);
+    }
+}
+
+// Arguments the recurrences do not handle go through the scalar functions:
+template<class Real>
+void test_scalar_fallback()
+{
+    using namespace boost::math;
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error>, overflow_error<ignore_error> > ignore_policy;
+    ignore_policy pol;
+    Real cases[][2] = {{0, 0}, {Real(2.5), 0}, {3, Real(-2.5)}, {Real(-4.5), Real(1.5)}, {Real(-7), Real(10)}};
+    for (auto const & c : cases)
+    {
+        for (unsigned n : {0u, 1u, 2u, 7u})
+        {
+            std::vector<Real> y(n + 1, Real(12345));
+            cyl_bessel_j_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_bessel_j(c[0] + k, c[1], pol), y[k], 0);
+            }
+            // Nothing beyond the requested orders is written:
+            CHECK_EQUAL(y[n], Real(12345));
+            cyl_neumann_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_neumann(c[0] + k, c[1], pol), y[k], 0);
+            }
+            cyl_bessel_i_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_bessel_i(c[0] + k, c[1], pol), y[k], 0);
+            }
+            cyl_bessel_k_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_bessel_k(c[0] + k, c[1], pol), y[k], 0);
+            }
+            cyl_bessel_j_prime_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_bessel_j_prime(c[0] + k, c[1], pol), y[k], 0);
+            }
+            cyl_bessel_k_prime_sequence(c[0], c[1], n, y.begin(), pol);
+            for (unsigned k = 0; k < n; ++k)
+            {
+                check_same(cyl_bessel_k_prime(c[0] + k, c[1], pol), y[k], 0);
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_overflow()
+{
+    using namespace boost::math;
+    using namespace boost::math::policies;
+    // Y and K overflow once the order is large enough, as the scalar functions do:
+    std::vector<Real> y(1000);
+    bool thrown = false;
+    try
+    {
+        cyl_neumann_sequence(Real(0.5), Real(1e-3), 1000, y.begin());
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        cyl_bessel_k_prime_sequence(Real(0.5), Real(1e-3), 1000, y.begin());
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    typedef policy<overflow_error<ignore_error> > ignore_policy;
+    Real inf = std::numeric_limits<Real>::infinity();
+    cyl_neumann_sequence(Real(0.5), Real(1e-3), 1000, y.begin(), ignore_policy());
+    CHECK_ULP_CLOSE(cyl_neumann(Real(0.5), Real(1e-3)), y[0], 0);
+    CHECK_EQUAL(y[999], -inf);
+    cyl_bessel_k_sequence(Real(0.5), Real(1e-3), 1000, y.begin(), ignore_policy());
+    CHECK_EQUAL(y[999], inf);
+    cyl_neumann_prime_sequence(Real(0.5), Real(1e-3), 1000, y.begin(), ignore_policy());
+    CHECK_EQUAL(y[999], inf);
+    cyl_bessel_k_prime_sequence(Real(0.5), Real(1e-3), 1000, y.begin(), ignore_policy());
+    CHECK_EQUAL(y[999], -inf);
+    // Whereas J and I underflow to zero:
+    cyl_bessel_j_sequence(Real(0.5), Real(1e-3), 1000, y.begin());
+    CHECK_EQUAL(y[999], Real(0));
+    cyl_bessel_i_prime_sequence(Real(0.5), Real(1e-3), 1000, y.begin());
+    CHECK_EQUAL(y[999], Real(0));
+}
+
+template<class Real, class Policy>
+void test_batch(Real v, const Policy& pol)
+{
+    using namespace boost::math;
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> small(0, 2);
+    std::uniform_real_distribution<long double> large(0, 60);
+    std::vector<Real> x(501);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = static_cast<Real>(i % 2 ? small(gen) : large(gen));
+    }
+    for (Real t : {Real(1e-20), Real(1e-5), Real(0.5), Real(1), Real(2), Real(5), Real(30), Real(1000)})
+    {
+        x.push_back(t);
+    }
+    std::vector<Real> y(x.size());
+    cyl_bessel_j(v, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        check_same(cyl_bessel_j(v, x[i], pol), y[i], batch_ulps);
+    }
+    cyl_neumann(v, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        check_same(cyl_neumann(v, x[i], pol), y[i], batch_ulps);
+    }
+    cyl_bessel_i(v, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        check_same(cyl_bessel_i(v, x[i], pol), y[i], batch_ulps);
+    }
+    cyl_bessel_k(v, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        check_same(cyl_bessel_k(v, x[i], pol), y[i], batch_ulps);
+    }
+}
+
+template<class Real>
+void test_batch()
+{
+    using namespace boost::math::policies;
+    typedef policy<overflow_error<ignore_error> > ignore_policy;
+    typedef policy<promote_float<false>, promote_double<false>, overflow_error<ignore_error> > no_promote_policy;
+    // Integer and non-integer orders, both signs, small enough for the series
+    // and large enough for the asymptotic expansions:
+    for (Real v : {Real(0), Real(1), Real(3), Real(0.25), Real(0.5), Real(-0.75), Real(2.5), Real(7.125), Real(-12.5), Real(40.25), Real(180.5)})
+    {
+        test_batch<Real>(v, ignore_policy());
+        test_batch<Real>(v, no_promote_policy());
+    }
+
+    // Integer orders of integer type, and the policy free overloads:
+    std::vector<Real> x{Real(0.5), Real(2.5), Real(10)};
+    std::vector<Real> y(x.size());
+    boost::math::cyl_bessel_j(4, x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cyl_bessel_j(4, x[i]), y[i], batch_ulps);
+    }
+    boost::math::cyl_bessel_k(Real(1.5), x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cyl_bessel_k(Real(1.5), x[i]), y[i], batch_ulps);
+    }
+    boost::math::cyl_neumann(Real(1.5), x.data(), x.data(), y.data());
+}
+
+void test_errors()
+{
+    std::vector<double> x{0.5, -2, 3.5};
+    std::vector<double> y(x.size());
+    bool thrown = false;
+    try
+    {
+        boost::math::cyl_neumann(2.5, x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        boost::math::cyl_bessel_j_sequence(2.5, -1.0, 10, y.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    std::vector<reference> refs = make_references();
+    test_sequences<float>(refs);
+    test_sequences<double>(refs);
+    test_sequences<long double>(refs);
+
+    test_scalar_fallback<float>();
+    test_scalar_fallback<double>();
+    test_scalar_fallback<long double>();
+
+    test_overflow<float>();
+    test_overflow<double>();
+    test_overflow<long double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/interpolators/cardinal_bicubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::interpolators::cardinal_bicubic_b_spline;
+using boost::math::interpolators::cardinal_cubic_b_spline;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Real>
+Real p(Real x)
+{
+    return 1 + x*(Real(-2) + x*(Real(3) + x/2));
+}
+
+template<class Real>
+Real dp(Real x)
+{
+    return Real(-2) + x*(Real(6) + 3*x/2);
+}
+
+template<class Real>
+Real q(Real y)
+{
+    return 2 + y*(Real(1) - y*y/3);
+}
+
+template<class Real>
+Real dq(Real y)
+{
+    return Real(1) - y*y;
+}
+
+// Products of cubics are reproduced, as the estimates of the derivatives at the edges are exact for them:
+template<class Real>
+void test_cubic()
+{
+    size_t nx = 12;
+    size_t ny = 9;
+    Real x0 = -1;
+    Real y0 = Real(1)/Real(2);
+    Real hx = Real(1)/Real(8);
+    Real hy = Real(1)/Real(4);
+    std::vector<Real> f(nx*ny);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            f[i*ny + j] = p(x0 + i*hx)*q(y0 + j*hy);
+        }
+    }
+    auto s = cardinal_bicubic_b_spline<Real>(f, nx, ny, x0, y0, hx, hy);
+    CHECK_ULP_CLOSE(x0 + (nx - 1)*hx, s.x_max(), 0);
+    CHECK_ULP_CLOSE(y0 + (ny - 1)*hy, s.y_max(), 0);
+
+    Real tol = 256*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> dis(0, 1);
+    for (size_t l = 0; l < 200; ++l) {
+        Real x = x0 + Real(dis(gen))*(s.x_max() - x0);
+        Real y = y0 + Real(dis(gen))*(s.y_max() - y0);
+        if (l == 0) {
+            x = x0;
+            y = y0;
+        }
+        if (l == 1) {
+            x = s.x_max();
+            y = s.y_max();
+        }
+        CHECK_ABSOLUTE_ERROR(p(x)*q(y), s(x, y), tol);
+        std::array<Real, 2> g = s.gradient(x, y);
+        CHECK_ABSOLUTE_ERROR(dp(x)*q(y), g[0], 8*tol);
+        CHECK_ABSOLUTE_ERROR(p(x)*dq(y), g[1], 8*tol);
+    }
+}
+
+template<class Real>
+void test_interpolation_condition()
+{
+    size_t nx = 10;
+    size_t ny = 17;
+    std::mt19937 gen(321);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<Real> f(nx*ny);
+    for (auto& fij : f) {
+        fij = Real(dis(gen));
+    }
+    Real x0 = 3;
+    Real y0 = -2;
+    Real hx = Real(1)/Real(3);
+    Real hy = 2;
+    auto s = cardinal_bicubic_b_spline<Real>(f.data(), nx, ny, x0, y0, hx, hy);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            CHECK_ABSOLUTE_ERROR(f[i*ny + j], s(x0 + i*hx, y0 + j*hy), 64*std::numeric_limits<Real>::epsilon());
+        }
+    }
+}
+
+// The same as interpolating along y with one dimensional splines, and then along x through the values found:
+template<class Real>
+void test_chained()
+{
+    using std::sin;
+    using std::cos;
+    size_t nx = 11;
+    size_t ny = 14;
+    Real x0 = 0;
+    Real y0 = 1;
+    Real hx = Real(1)/Real(10);
+    Real hy = Real(1)/Real(7);
+    std::vector<Real> f(nx*ny);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            f[i*ny + j] = sin(3*(x0 + i*hx))*cos(2*(y0 + j*hy)) + x0 + i*hx;
+        }
+    }
+    auto s = cardinal_bicubic_b_spline<Real>(f, nx, ny, x0, y0, hx, hy);
+    std::mt19937 gen(99);
+    std::uniform_real_distribution<double> dis(0, 1);
+    for (size_t l = 0; l < 50; ++l) {
+        Real x = x0 + Real(dis(gen))*(s.x_max() - x0);
+        Real y = y0 + Real(dis(gen))*(s.y_max() - y0);
+        std::vector<Real> g(nx);
+        for (size_t i = 0; i < nx; ++i) {
+            cardinal_cubic_b_spline<Real> row(f.data() + i*ny, ny, y0, hy);
+            g[i] = row(y);
+        }
+        cardinal_cubic_b_spline<Real> column(g.data(), nx, x0, hx);
+        CHECK_ABSOLUTE_ERROR(column(x), s(x, y), 64*std::numeric_limits<Real>::epsilon());
+    }
+}
+
+template<class Real>
+void test_batch()
+{
+    using std::exp;
+    size_t nx = 23;
+    size_t ny = 7;
+    Real x0 = 0;
+    Real y0 = 0;
+    Real hx = Real(1)/Real(22);
+    Real hy = Real(1)/Real(6);
+    std::vector<Real> f(nx*ny);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            f[i*ny + j] = exp(-(x0 + i*hx)*(y0 + j*hy));
+        }
+    }
+    auto s = cardinal_bicubic_b_spline<Real>(f, nx, ny, x0, y0, hx, hy);
+
+    // A count which is not a multiple of the block size, including the corners:
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dis(0, 1);
+    std::vector<std::array<Real, 2>> pts(101);
+    for (auto& pt : pts) {
+        pt = {{Real(dis(gen)), Real(dis(gen))}};
+    }
+    pts[0] = {{x0, y0}};
+    pts[50] = {{s.x_max(), s.y_max()}};
+
+    std::vector<Real> v(pts.size());
+    std::vector<std::array<Real, 2>> g(pts.size());
+    s(pts.begin(), pts.end(), v.begin());
+    s.gradient(pts.begin(), pts.end(), g.begin());
+    // The same arithmetic is done either way, but a compiler may fuse different multiply-adds in vectorized code:
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (size_t l = 0; l < pts.size(); ++l) {
+        CHECK_ABSOLUTE_ERROR(s(pts[l][0], pts[l][1]), v[l], tol);
+        std::array<Real, 2> gl = s.gradient(pts[l][0], pts[l][1]);
+        CHECK_ABSOLUTE_ERROR(gl[0], g[l][0], tol/hx);
+        CHECK_ABSOLUTE_ERROR(gl[1], g[l][1], tol/hy);
+    }
+}
+
+template<class Real>
+void test_errors()
+{
+    std::vector<Real> f(25, Real(1));
+    auto s = cardinal_bicubic_b_spline<Real>(f, 5, 5, 0, 0, 1, 1);
+    CHECK_ULP_CLOSE(Real(1), s(2, 3), 2);
+
+    bool thrown = false;
+    try {
+        s(Real(-0.25), 1);
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        s.gradient(1, std::numeric_limits<Real>::quiet_NaN());
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    std::vector<std::array<Real, 2>> pts(20, std::array<Real, 2>{{1, 1}});
+    pts[17][1] = 5;
+    pts[17][1] += Real(1)/Real(1024);
+    std::vector<Real> v(pts.size());
+    try {
+        s(pts.begin(), pts.end(), v.begin());
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        cardinal_bicubic_b_spline<Real>(f.data(), 5, 4, 0, 0, 1, 1);
+    }
+    catch (const std::logic_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        cardinal_bicubic_b_spline<Real>(f, 5, 6, 0, 0, 1, 1);
+    }
+    catch (const std::logic_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_cubic<float>();
+    test_cubic<double>();
+    test_cubic<long double>();
+    test_cubic<cpp_bin_float_50>();
+
+    test_interpolation_condition<float>();
+    test_interpolation_condition<double>();
+    test_interpolation_condition<long double>();
+
+    test_chained<double>();
+    test_chained<long double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
+    test_errors<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -227,6 +227,38 @@ void test_quadratic_function()
 }
 
 
+template<class Real>
+void test_cubic_function()
+{
+    using std::abs;
+    std::cout << "Testing that cubic functions are interpolated correctly near the ends by cubic b splines on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Cubics are in the spline space, and the default endpoint derivatives are exact for them,
+    // so the interpolant is the cubic itself, right up to both ends of the interval:
+    std::vector<Real> v(50);
+    Real step = 0.125;
+    auto f = [](Real x) { return ((Real(0.25)*x - 1)*x + Real(1.5))*x - 2; };
+    auto f_prime = [](Real x) { return (Real(0.75)*x - 2)*x + Real(1.5); };
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = f(i*step);
+    }
+
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), 0, step);
+
+    Real b = (v.size() - 1)*step;
+    Real tol = 1000*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i <= 64; ++i)
+    {
+        Real x = i*step/16;
+        BOOST_CHECK_SMALL(spline(x) - f(x), tol*abs(f(x)));
+        BOOST_CHECK_SMALL(spline.prime(x) - f_prime(x), tol*(1 + abs(f_prime(x))));
+        x = b - x;
+        BOOST_CHECK_SMALL(spline(x) - f(x), tol*abs(f(x)));
+        BOOST_CHECK_SMALL(spline.prime(x) - f_prime(x), tol*(1 + abs(f_prime(x))));
+    }
+}
+
+
 template<class Real>
 void test_trig_function()
 {
@@ -314,6 +346,46 @@ void test_outside_interval()
     cnull << spline(2000);
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing that evaluation at many points agrees with evaluation at each on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    std::vector<Real> v(100);
+    Real x0 = 1;
+    Real step = Real(1)/Real(8);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step * i);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), x0, step);
+
+    // Points inside and outside the interval, at the knots and between them, and a count which is not a multiple of the block size:
+    std::mt19937 gen(17);
+    boost::random::uniform_real_distribution<Real> dis(x0 - 2, x0 + (v.size() + 1)*step);
+    std::vector<Real> x(203);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = i % 5 == 0 ? x0 + (i/5)*step : dis(gen);
+    }
+    x.back() = x0 + (v.size() - 1)*step;
+
+    std::vector<Real> y(x.size());
+    std::vector<Real> dy(x.size());
+    std::vector<Real> d2y(x.size());
+    spline.evaluate(x.begin(), x.end(), y.begin());
+    spline.prime(x.begin(), x.end(), dy.begin());
+    spline.double_prime(x.begin(), x.end(), d2y.begin());
+    // The same arithmetic is done either way, but a compiler may fuse different multiply-adds in vectorized code:
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        BOOST_CHECK_SMALL(Real(y[i] - spline(x[i])), tol);
+        BOOST_CHECK_SMALL(Real(dy[i] - spline.prime(x[i])), tol/step);
+        BOOST_CHECK_SMALL(Real(d2y[i] - spline.double_prime(x[i])), tol/(step*step));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 {
     test_b3_spline<float>();
@@ -341,6 +413,11 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
     test_quadratic_function<long double>();
     test_affine_function<cpp_bin_float_50>();
 
+    test_cubic_function<float>();
+    test_cubic_function<double>();
+    test_cubic_function<long double>();
+    test_cubic_function<cpp_bin_float_50>();
+
     test_trig_function<float>();
     test_trig_function<double>();
     test_trig_function<long double>();
@@ -348,4 +425,9 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 
     test_copy_move<double>();
     test_outside_interval<double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+    test_batch<cpp_bin_float_50>();
 }
@@ -8,6 +8,9 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <random>
+#include <limits>
+#include <stdexcept>
 #include <boost/math/interpolators/cardinal_quadratic_b_spline.hpp>
 using boost::math::interpolators::cardinal_quadratic_b_spline;
 
@@ -113,6 +116,51 @@ void test_quadratic()
     }
 }
 
+template<class Real>
+void test_batch()
+{
+    using std::sin;
+    Real t0 = 1;
+    Real h = Real(1)/Real(8);
+    std::vector<Real> v(100);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = sin(t0 + i*h);
+    }
+    auto qbs = cardinal_quadratic_b_spline<Real>(v.data(), v.size(), t0, h);
+
+    // At the knots and between them, at both endpoints, and a count which is not a multiple of the block size:
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(t0, qbs.t_max());
+    std::vector<Real> t(203);
+    for (size_t i = 0; i < t.size(); ++i) {
+        t[i] = i % 5 == 0 ? t0 + (i/5)*h : dis(gen);
+    }
+    t.front() = t0;
+    t.back() = qbs.t_max();
+
+    std::vector<Real> y(t.size());
+    std::vector<Real> dy(t.size());
+    qbs(t.begin(), t.end(), y.begin());
+    qbs.prime(t.begin(), t.end(), dy.begin());
+    // The same arithmetic is done either way, but a compiler may fuse different multiply-adds in vectorized code:
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_ABSOLUTE_ERROR(qbs(t[i]), y[i], tol);
+        CHECK_ABSOLUTE_ERROR(qbs.prime(t[i]), dy[i], tol/h);
+    }
+
+    // Points outside the domain throw, as they do for a single point:
+    t[100] = t0 - 1;
+    bool thrown = false;
+    try {
+        qbs(t.begin(), t.end(), y.begin());
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
 int main()
 {
     test_constant<float>();
@@ -126,5 +174,9 @@ int main()
     test_quadratic<double>();
     test_quadratic<long double>();
 
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
     return boost::math::test::report_errors();
 }
@@ -8,6 +8,9 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <random>
+#include <limits>
+#include <stdexcept>
 #include <boost/math/interpolators/cardinal_quintic_b_spline.hpp>
 #ifdef BOOST_HAS_FLOAT128
 #include <boost/multiprecision/float128.hpp>
@@ -264,6 +267,54 @@ void test_quadratic_estimate_derivatives()
 }
 
 
+template<class Real>
+void test_batch()
+{
+    using std::sin;
+    Real t0 = 1;
+    Real h = Real(1)/Real(8);
+    std::vector<Real> v(100);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = sin(t0 + i*h);
+    }
+    auto qbs = cardinal_quintic_b_spline<Real>(v.data(), v.size(), t0, h);
+
+    // At the knots and between them, at both endpoints, and a count which is not a multiple of the block size:
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(t0, qbs.t_max());
+    std::vector<Real> t(203);
+    for (size_t i = 0; i < t.size(); ++i) {
+        t[i] = i % 5 == 0 ? t0 + (i/5)*h : dis(gen);
+    }
+    t.front() = t0;
+    t.back() = qbs.t_max();
+
+    std::vector<Real> y(t.size());
+    std::vector<Real> dy(t.size());
+    std::vector<Real> d2y(t.size());
+    qbs(t.begin(), t.end(), y.begin());
+    qbs.prime(t.begin(), t.end(), dy.begin());
+    qbs.double_prime(t.begin(), t.end(), d2y.begin());
+    // The same arithmetic is done either way, but a compiler may fuse different multiply-adds in vectorized code:
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_ABSOLUTE_ERROR(qbs(t[i]), y[i], tol);
+        CHECK_ABSOLUTE_ERROR(qbs.prime(t[i]), dy[i], tol/h);
+        CHECK_ABSOLUTE_ERROR(qbs.double_prime(t[i]), d2y[i], tol/(h*h));
+    }
+
+    // Points outside the domain throw, as they do for a single point:
+    t[100] = t0 - 1;
+    bool thrown = false;
+    try {
+        qbs(t.begin(), t.end(), y.begin());
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
 int main()
 {
     test_constant<double>();
@@ -285,6 +336,10 @@ int main()
     test_quadratic_estimate_derivatives<double>();
     test_quadratic_estimate_derivatives<long double>();
 
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
 
     #ifdef BOOST_HAS_FLOAT128
         test_constant<float128>();
@@ -0,0 +1,292 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/interpolators/cardinal_tricubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_bicubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+
+using boost::math::interpolators::cardinal_tricubic_b_spline;
+using boost::math::interpolators::cardinal_bicubic_b_spline;
+using boost::math::interpolators::cardinal_cubic_b_spline;
+
+template<class Real>
+Real p(Real x)
+{
+    return 1 + x*(Real(-2) + x*(Real(3) + x/2));
+}
+
+template<class Real>
+Real dp(Real x)
+{
+    return Real(-2) + x*(Real(6) + 3*x/2);
+}
+
+template<class Real>
+Real q(Real y)
+{
+    return 2 + y*(Real(1) - y*y/3);
+}
+
+template<class Real>
+Real dq(Real y)
+{
+    return Real(1) - y*y;
+}
+
+template<class Real>
+Real r(Real z)
+{
+    return z*z - 1;
+}
+
+template<class Real>
+Real dr(Real z)
+{
+    return 2*z;
+}
+
+template<class Real>
+void test_cubic()
+{
+    size_t nx = 8;
+    size_t ny = 6;
+    size_t nz = 11;
+    Real x0 = -1;
+    Real y0 = Real(1)/Real(2);
+    Real z0 = 0;
+    Real hx = Real(1)/Real(4);
+    Real hy = Real(1)/Real(4);
+    Real hz = Real(1)/Real(8);
+    std::vector<Real> f(nx*ny*nz);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            for (size_t k = 0; k < nz; ++k) {
+                f[(i*ny + j)*nz + k] = p(x0 + i*hx)*q(y0 + j*hy)*r(z0 + k*hz);
+            }
+        }
+    }
+    auto s = cardinal_tricubic_b_spline<Real>(f, nx, ny, nz, x0, y0, z0, hx, hy, hz);
+    CHECK_ULP_CLOSE(x0 + (nx - 1)*hx, s.x_max(), 0);
+    CHECK_ULP_CLOSE(y0 + (ny - 1)*hy, s.y_max(), 0);
+    CHECK_ULP_CLOSE(z0 + (nz - 1)*hz, s.z_max(), 0);
+
+    Real tol = 256*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(2468);
+    std::uniform_real_distribution<double> dis(0, 1);
+    for (size_t l = 0; l < 200; ++l) {
+        Real x = x0 + Real(dis(gen))*(s.x_max() - x0);
+        Real y = y0 + Real(dis(gen))*(s.y_max() - y0);
+        Real z = z0 + Real(dis(gen))*(s.z_max() - z0);
+        if (l == 0) {
+            x = x0;
+            y = y0;
+            z = z0;
+        }
+        if (l == 1) {
+            x = s.x_max();
+            y = s.y_max();
+            z = s.z_max();
+        }
+        CHECK_ABSOLUTE_ERROR(p(x)*q(y)*r(z), s(x, y, z), tol);
+        std::array<Real, 3> g = s.gradient(x, y, z);
+        CHECK_ABSOLUTE_ERROR(dp(x)*q(y)*r(z), g[0], 8*tol);
+        CHECK_ABSOLUTE_ERROR(p(x)*dq(y)*r(z), g[1], 8*tol);
+        CHECK_ABSOLUTE_ERROR(p(x)*q(y)*dr(z), g[2], 8*tol);
+    }
+}
+
+template<class Real>
+void test_interpolation_condition()
+{
+    size_t nx = 7;
+    size_t ny = 9;
+    size_t nz = 5;
+    std::mt19937 gen(135);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<Real> f(nx*ny*nz);
+    for (auto& fijk : f) {
+        fijk = Real(dis(gen));
+    }
+    Real x0 = 1;
+    Real y0 = -3;
+    Real z0 = 2;
+    Real hx = Real(1)/Real(3);
+    Real hy = 2;
+    Real hz = Real(1)/Real(5);
+    auto s = cardinal_tricubic_b_spline<Real>(f.data(), nx, ny, nz, x0, y0, z0, hx, hy, hz);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            for (size_t k = 0; k < nz; ++k) {
+                CHECK_ABSOLUTE_ERROR(f[(i*ny + j)*nz + k], s(x0 + i*hx, y0 + j*hy, z0 + k*hz), 128*std::numeric_limits<Real>::epsilon());
+            }
+        }
+    }
+}
+
+// On a plane z = z0 + k hz through the grid, the tricubic spline is the bicubic spline of the values on that plane:
+template<class Real>
+void test_plane()
+{
+    using std::sin;
+    using std::cos;
+    size_t nx = 9;
+    size_t ny = 6;
+    size_t nz = 7;
+    Real x0 = 0;
+    Real y0 = 1;
+    Real z0 = -1;
+    Real hx = Real(1)/Real(8);
+    Real hy = Real(1)/Real(5);
+    Real hz = Real(1)/Real(3);
+    std::vector<Real> f(nx*ny*nz);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            for (size_t k = 0; k < nz; ++k) {
+                Real x = x0 + i*hx;
+                Real y = y0 + j*hy;
+                Real z = z0 + k*hz;
+                f[(i*ny + j)*nz + k] = sin(x + 2*y)*cos(z) + x*z;
+            }
+        }
+    }
+    auto s = cardinal_tricubic_b_spline<Real>(f, nx, ny, nz, x0, y0, z0, hx, hy, hz);
+    size_t k = 4;
+    std::vector<Real> plane(nx*ny);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            plane[i*ny + j] = f[(i*ny + j)*nz + k];
+        }
+    }
+    auto b = cardinal_bicubic_b_spline<Real>(plane, nx, ny, x0, y0, hx, hy);
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dis(0, 1);
+    for (size_t l = 0; l < 50; ++l) {
+        Real x = x0 + Real(dis(gen))*(s.x_max() - x0);
+        Real y = y0 + Real(dis(gen))*(s.y_max() - y0);
+        CHECK_ABSOLUTE_ERROR(b(x, y), s(x, y, z0 + k*hz), 128*std::numeric_limits<Real>::epsilon());
+    }
+}
+
+template<class Real>
+void test_batch()
+{
+    using std::exp;
+    size_t nx = 6;
+    size_t ny = 13;
+    size_t nz = 9;
+    Real x0 = 0;
+    Real y0 = 0;
+    Real z0 = 0;
+    Real hx = Real(1)/Real(5);
+    Real hy = Real(1)/Real(12);
+    Real hz = Real(1)/Real(8);
+    std::vector<Real> f(nx*ny*nz);
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            for (size_t k = 0; k < nz; ++k) {
+                f[(i*ny + j)*nz + k] = exp(-(x0 + i*hx)*(y0 + j*hy) + z0 + k*hz);
+            }
+        }
+    }
+    auto s = cardinal_tricubic_b_spline<Real>(f, nx, ny, nz, x0, y0, z0, hx, hy, hz);
+
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<double> dis(0, 1);
+    std::vector<std::array<Real, 3>> pts(77);
+    for (auto& pt : pts) {
+        pt = {{Real(dis(gen)), Real(dis(gen)), Real(dis(gen))}};
+    }
+    pts[0] = {{x0, y0, z0}};
+    pts[40] = {{s.x_max(), s.y_max(), s.z_max()}};
+
+    std::vector<Real> v(pts.size());
+    std::vector<std::array<Real, 3>> g(pts.size());
+    s(pts.begin(), pts.end(), v.begin());
+    s.gradient(pts.begin(), pts.end(), g.begin());
+    // The same arithmetic is done either way, but a compiler may fuse different multiply-adds in vectorized code:
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (size_t l = 0; l < pts.size(); ++l) {
+        CHECK_ABSOLUTE_ERROR(s(pts[l][0], pts[l][1], pts[l][2]), v[l], 4*tol);
+        std::array<Real, 3> gl = s.gradient(pts[l][0], pts[l][1], pts[l][2]);
+        CHECK_ABSOLUTE_ERROR(gl[0], g[l][0], 4*tol/hx);
+        CHECK_ABSOLUTE_ERROR(gl[1], g[l][1], 4*tol/hy);
+        CHECK_ABSOLUTE_ERROR(gl[2], g[l][2], 4*tol/hz);
+    }
+}
+
+template<class Real>
+void test_errors()
+{
+    std::vector<Real> f(125, Real(1));
+    auto s = cardinal_tricubic_b_spline<Real>(f, 5, 5, 5, 0, 0, 0, 1, 1, 1);
+    CHECK_ULP_CLOSE(Real(1), s(2, 3, 1), 2);
+
+    bool thrown = false;
+    try {
+        s(1, 1, Real(4.25));
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        s.gradient(std::numeric_limits<Real>::quiet_NaN(), 1, 1);
+    }
+    catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        cardinal_tricubic_b_spline<Real>(f.data(), 5, 5, 5, 0, 0, 0, 1, 0, 1);
+    }
+    catch (const std::logic_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try {
+        cardinal_tricubic_b_spline<Real>(f, 5, 5, 4, 0, 0, 0, 1, 1, 1);
+    }
+    catch (const std::logic_error&) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_cubic<float>();
+    test_cubic<double>();
+    test_cubic<long double>();
+
+    test_interpolation_condition<float>();
+    test_interpolation_condition<double>();
+    test_interpolation_condition<long double>();
+
+    test_plane<double>();
+    test_plane<long double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
+    test_errors<double>();
+
+    return boost::math::test::report_errors();
+}
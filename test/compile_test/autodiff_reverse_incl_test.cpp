@@ -0,0 +1,24 @@
+//  Copyright the Boost.Math authors, 2020
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/differentiation/autodiff_reverse.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/differentiation/autodiff_reverse.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+   using namespace boost::math::differentiation::reverse_mode;
+   rvar<double> const x = make_rvar(2.0);
+   rvar<double> const y = x * x * exp(x);
+   y.backward();
+
+   check_result<double>(x.adjoint());
+}
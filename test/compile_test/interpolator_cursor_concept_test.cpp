@@ -0,0 +1,36 @@
+//  Copyright the Boost.Math authors, 2020
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Every member of interpolator_cursor must compile for each interpolator which provides one.
+#include <vector>
+#include <boost/math/interpolators/cubic_hermite.hpp>
+#include <boost/math/interpolators/pchip.hpp>
+#include <boost/math/interpolators/makima.hpp>
+#include <boost/math/interpolators/quintic_hermite.hpp>
+#include <boost/math/interpolators/septic_hermite.hpp>
+
+template<class Interpolator>
+void check_cursor(Interpolator const & interpolator)
+{
+    typename Interpolator::cursor_type c = interpolator.cursor();
+    c(0.5);
+    c.prime(0.5);
+    c.double_prime(0.5);
+}
+
+void compile_and_link_test()
+{
+    using boost::math::interpolators::cubic_hermite;
+    using boost::math::interpolators::pchip;
+    using boost::math::interpolators::makima;
+    using boost::math::interpolators::quintic_hermite;
+    using boost::math::interpolators::septic_hermite;
+    using V = std::vector<double>;
+    check_cursor(cubic_hermite<V>(V{0, 1, 2}, V{0, 1, 4}, V{0, 2, 4}));
+    check_cursor(pchip<V>(V{0, 1, 2, 3}, V{0, 1, 4, 9}));
+    check_cursor(makima<V>(V{0, 1, 2, 3}, V{0, 1, 4, 9}));
+    check_cursor(quintic_hermite<V>(V{0, 1, 2}, V{0, 1, 4}, V{0, 2, 4}, V{2, 2, 2}));
+    check_cursor(septic_hermite<V>(V{0, 1, 2}, V{0, 1, 4}, V{0, 2, 4}, V{2, 2, 2}, V{0, 0, 0}));
+}
@@ -6,6 +6,8 @@
  */
 
 #include "math_unit_test.hpp"
+#include "interpolator_batch_test.hpp"
+#include <algorithm>
 #include <numeric>
 #include <utility>
 #include <random>
@@ -172,11 +174,16 @@ void test_quadratic()
     }
 
     auto s = cubic_hermite(std::move(x), std::move(y), std::move(dydx));
+    auto c = s.cursor();
+    // The second derivative is found from differences of y of size t^2 over intervals of at least 0.1:
+    auto tol = [](Real t) { return 8*std::numeric_limits<Real>::epsilon()*(t*t + 1)/(Real(0.1)*Real(0.1)); };
     for (Real t = x0; t <= xmax; t+= 0.0125)
     {
         CHECK_ULP_CLOSE(t*t/2, s(t), 5);
         CHECK_ULP_CLOSE(t, s.prime(t), 65);
+        CHECK_ABSOLUTE_ERROR(Real(1), c.double_prime(t), tol(t));
     }
+    CHECK_ABSOLUTE_ERROR(Real(1), c.double_prime(xmax), tol(xmax));
 }
 
 template<typename Real>
@@ -420,8 +427,21 @@ void test_cardinal_interpolation_condition()
 
 
 
+template<typename Real>
+void test_batch_evaluation()
+{
+    std::mt19937 gen(327);
+    auto x = batch_test_abscissas<Real>(gen);
+    auto y = batch_test_values<Real>(gen, x.size());
+    auto dydx = batch_test_values<Real>(gen, x.size());
+    auto x_copy = x;
+    auto interpolator = cubic_hermite(std::move(x_copy), std::move(y), std::move(dydx));
+    check_batch_evaluation(interpolator, x, gen);
+}
+
 int main()
 {
+    test_batch_evaluation<float>();
     test_constant<float>();
     test_linear<float>();
     test_quadratic<float>();
@@ -431,6 +451,7 @@ int main()
     test_cardinal_quadratic<float>();
     test_cardinal_interpolation_condition<float>();
 
+    test_batch_evaluation<double>();
     test_constant<double>();
     test_linear<double>();
     test_quadratic<double>();
@@ -440,6 +461,7 @@ int main()
     test_cardinal_quadratic<double>();
     test_cardinal_interpolation_condition<double>();
 
+    test_batch_evaluation<long double>();
     test_constant<long double>();
     test_linear<long double>();
     test_quadratic<long double>();
@@ -0,0 +1,205 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <limits>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/exponential.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/students_t.hpp>
+
+// The array forms of pdf, cdf and quantile must reproduce the scalar
+// functions exactly, so everything here is checked at zero ulps.
+
+template<class Real>
+std::vector<Real> variates(Real lo, Real hi)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> dis(static_cast<long double>(lo), static_cast<long double>(hi));
+    // Not a multiple of the internal block size:
+    std::vector<Real> x(1021);
+    for (auto & t : x)
+    {
+        t = static_cast<Real>(dis(gen));
+    }
+    return x;
+}
+
+template<class Dist>
+void test_distribution(const Dist& dist, std::vector<typename Dist::value_type> x)
+{
+    typedef typename Dist::value_type Real;
+    std::vector<Real> y(x.size());
+    boost::math::pdf(dist, x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::pdf(dist, x[i]), y[i], 0);
+    }
+    boost::math::cdf(dist, x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cdf(dist, x[i]), y[i], 0);
+    }
+    std::vector<Real> p = variates<Real>(0, 1);
+    p.push_back(Real(0.5));
+    p.push_back(Real(1e-30));
+    p.push_back(1 - std::numeric_limits<Real>::epsilon());
+    y.resize(p.size());
+    boost::math::quantile(dist, p.data(), p.data() + p.size(), y.data());
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::quantile(dist, p[i]), y[i], 0);
+    }
+}
+
+template<class Real, class Policy>
+void test_distributions()
+{
+    std::vector<Real> x = variates<Real>(-10, 10);
+    x.push_back(std::numeric_limits<Real>::infinity());
+    x.push_back(-std::numeric_limits<Real>::infinity());
+    test_distribution(boost::math::normal_distribution<Real, Policy>(), x);
+    test_distribution(boost::math::normal_distribution<Real, Policy>(Real(1.5), Real(0.25)), x);
+
+    x = variates<Real>(0, 20);
+    x.push_back(0);
+    test_distribution(boost::math::lognormal_distribution<Real, Policy>(Real(0.5), 2), x);
+    test_distribution(boost::math::exponential_distribution<Real, Policy>(Real(0.75)), x);
+    test_distribution(boost::math::gamma_distribution<Real, Policy>(Real(2.5), 2), x);
+    test_distribution(boost::math::gamma_distribution<Real, Policy>(Real(0.5), Real(0.25)), x);
+    test_distribution(boost::math::gamma_distribution<Real, Policy>(1), x);
+    test_distribution(boost::math::gamma_distribution<Real, Policy>(150, Real(0.125)), x);
+
+    x = variates<Real>(-10, 10);
+    x.push_back(0);
+    x.push_back(std::numeric_limits<Real>::infinity());
+    x.push_back(-std::numeric_limits<Real>::infinity());
+    x.push_back(Real(1e-20));
+    x.push_back(Real(-1e-20));
+    test_distribution(boost::math::students_t_distribution<Real, Policy>(5), x);
+    if (std::numeric_limits<Real>::digits > std::numeric_limits<float>::digits)
+    {
+        // In float these overflow finding the quantile of 1e-30 unless promoted to double:
+        test_distribution(boost::math::students_t_distribution<Real, Policy>(Real(0.75)), x);
+        test_distribution(boost::math::students_t_distribution<Real, Policy>(Real(2.5)), x);
+    }
+    test_distribution(boost::math::students_t_distribution<Real, Policy>(2), x);
+    test_distribution(boost::math::students_t_distribution<Real, Policy>(Real(1e10)), x);
+    // Treated as normal:
+    test_distribution(boost::math::students_t_distribution<Real, Policy>(1 / std::numeric_limits<Real>::epsilon() * 4), x);
+}
+
+template<class Real>
+void test_distributions()
+{
+    using namespace boost::math::policies;
+    test_distributions<Real, policy<> >();
+    test_distributions<Real, policy<promote_float<false>, promote_double<false> > >();
+}
+
+void test_errors()
+{
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error>, overflow_error<ignore_error> > ignore_policy;
+    std::vector<double> x{0.5, std::numeric_limits<double>::quiet_NaN(), -1, 2, std::numeric_limits<double>::infinity()};
+    std::vector<double> y(x.size());
+
+    boost::math::normal_distribution<double, ignore_policy> norm;
+    boost::math::cdf(norm, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[1]);
+    CHECK_ULP_CLOSE(boost::math::cdf(norm, x[0]), y[0], 0);
+    boost::math::quantile(norm, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[1]);
+    CHECK_NAN(y[2]);
+    CHECK_NAN(y[3]);
+    CHECK_ULP_CLOSE(boost::math::quantile(norm, x[0]), y[0], 0);
+
+    boost::math::lognormal_distribution<double, ignore_policy> lognorm;
+    boost::math::pdf(lognorm, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[2]);
+    CHECK_ULP_CLOSE(boost::math::pdf(lognorm, x[3]), y[3], 0);
+
+    // The edges of the support, and points outside it:
+    std::vector<double> p{0, 1, 0.25, -0.5, 1.5, std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> q(p.size());
+    boost::math::gamma_distribution<double, ignore_policy> gamma(2);
+    boost::math::pdf(gamma, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[1]);
+    CHECK_NAN(y[2]);
+    CHECK_ULP_CLOSE(boost::math::pdf(gamma, x[3]), y[3], 0);
+    boost::math::cdf(gamma, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[1]);
+    CHECK_NAN(y[2]);
+    CHECK_ULP_CLOSE(boost::math::cdf(gamma, x[0]), y[0], 0);
+    CHECK_NAN(y[4]);
+    boost::math::quantile(gamma, p.data(), p.data() + p.size(), q.data());
+    CHECK_EQUAL(q[0], 0.0);
+    CHECK_EQUAL(q[1], boost::math::quantile(gamma, 1.0));
+    CHECK_ULP_CLOSE(boost::math::quantile(gamma, p[2]), q[2], 0);
+    CHECK_NAN(q[3]);
+    CHECK_NAN(q[4]);
+    CHECK_NAN(q[5]);
+    boost::math::cdf(boost::math::gamma_distribution<double, ignore_policy>(-1), x.data(), x.data() + x.size(), y.data());
+    for (auto t : y)
+    {
+        CHECK_NAN(t);
+    }
+
+    boost::math::students_t_distribution<double, ignore_policy> t(3);
+    boost::math::quantile(t, p.data(), p.data() + p.size(), q.data());
+    CHECK_EQUAL(q[0], boost::math::quantile(t, 0.0));
+    CHECK_EQUAL(q[1], boost::math::quantile(t, 1.0));
+    CHECK_ULP_CLOSE(boost::math::quantile(t, p[2]), q[2], 0);
+    CHECK_NAN(q[3]);
+    CHECK_NAN(q[4]);
+    CHECK_NAN(q[5]);
+    boost::math::pdf(t, x.data(), x.data() + x.size(), y.data());
+    CHECK_NAN(y[1]);
+    CHECK_ULP_CLOSE(boost::math::pdf(t, x[2]), y[2], 0);
+    CHECK_EQUAL(y[4], 0.0);
+    boost::math::pdf(boost::math::students_t_distribution<double, ignore_policy>(0), x.data(), x.data() + x.size(), y.data());
+    for (auto v : y)
+    {
+        CHECK_NAN(v);
+    }
+
+    bool thrown = false;
+    try
+    {
+        boost::math::cdf(boost::math::normal_distribution<double>(), x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    thrown = false;
+    try
+    {
+        boost::math::pdf(boost::math::students_t_distribution<double>(3), x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_distributions<float>();
+    test_distributions<double>();
+    test_distributions<long double>();
+
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <limits>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// The array overloads must reproduce the scalar functions exactly,
+// so everything here is checked at zero ulps.
+
+template<class Real>
+std::vector<Real> erf_arguments(Real lo, Real hi)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> dis(static_cast<long double>(lo), static_cast<long double>(hi));
+    // Not a multiple of the internal block size:
+    std::vector<Real> x(1377);
+    for (auto & t : x)
+    {
+        t = static_cast<Real>(dis(gen));
+    }
+    // Region boundaries and special values:
+    Real special[] = {0, Real(-0.0), Real(1e-11), Real(-1e-11), Real(0.5), Real(-0.5), Real(1.5), Real(-1.5), Real(2.5), Real(-2.5),
+                      Real(4.5), Real(-4.5), Real(5.8), Real(-5.8), Real(6.4), Real(-6.4), 27, 28, 29, -28, 109, 111, -200, 200};
+    for (auto t : special)
+    {
+        x.push_back(t);
+    }
+    return x;
+}
+
+template<class Real, class Policy>
+void test_erf(const Policy& pol)
+{
+    for (Real scale : {Real(1), Real(0.01), Real(10)})
+    {
+        std::vector<Real> x = erf_arguments<Real>(-4*scale, 4*scale);
+        std::vector<Real> y(x.size());
+        boost::math::erf(x.data(), x.data() + x.size(), y.data(), pol);
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            CHECK_ULP_CLOSE(boost::math::erf(x[i], pol), y[i], 0);
+        }
+        boost::math::erfc(x.data(), x.data() + x.size(), y.data(), pol);
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            CHECK_ULP_CLOSE(boost::math::erfc(x[i], pol), y[i], 0);
+        }
+    }
+}
+
+template<class Real>
+void test_erf()
+{
+    test_erf<Real>(boost::math::policies::policy<>());
+    test_erf<Real>(boost::math::policies::make_policy(boost::math::policies::promote_float<false>(), boost::math::policies::promote_double<false>()));
+
+    std::vector<Real> x = erf_arguments<Real>(-3, 3);
+    std::vector<Real> y(x.size());
+    boost::math::erf(x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::erf(x[i]), y[i], 0);
+    }
+    // Empty range is a no-op:
+    boost::math::erfc(x.data(), x.data(), y.data());
+}
+
+template<class Real, class Policy>
+void test_erf_inv(const Policy& pol)
+{
+    std::mt19937_64 gen(4321);
+    std::uniform_real_distribution<long double> dis(-1, 1);
+    std::vector<Real> x(2049);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        Real t = static_cast<Real>(dis(gen));
+        // Push some values into the tails:
+        if (i % 5 == 0)
+        {
+            t = t < 0 ? -1 - Real(1e-3)*t : 1 - Real(1e-3)*t;
+        }
+        if (i % 11 == 0)
+        {
+            t = t < 0 ? -1 - Real(1e-7)*t : 1 - Real(1e-7)*t;
+        }
+        // Rounding can take us to the poles at +-1:
+        x[i] = (t > -1 && t < 1) ? t : Real(0.5);
+    }
+    x.push_back(0);
+    x.push_back(Real(0.5));
+    x.push_back(Real(-0.5));
+    x.push_back(Real(0.75));
+
+    std::vector<Real> y(x.size());
+    boost::math::erf_inv(x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::erf_inv(x[i], pol), y[i], 0);
+    }
+
+    for (auto & t : x)
+    {
+        t += 1;
+        if (!(t > 0 && t < 2))
+        {
+            t = 1;
+        }
+    }
+    boost::math::erfc_inv(x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::erfc_inv(x[i], pol), y[i], 0);
+    }
+}
+
+template<class Real>
+void test_erf_inv()
+{
+    test_erf_inv<Real>(boost::math::policies::policy<>());
+    test_erf_inv<Real>(boost::math::policies::make_policy(boost::math::policies::promote_float<false>(), boost::math::policies::promote_double<false>()));
+}
+
+void test_domain_errors()
+{
+    std::vector<double> x{0.5, 1.5, -0.25};
+    std::vector<double> y(x.size());
+    bool thrown = false;
+    try
+    {
+        boost::math::erf_inv(x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error> > ignore_policy;
+    boost::math::erf_inv(x.data(), x.data() + x.size(), y.data(), ignore_policy());
+    CHECK_NAN(y[1]);
+    CHECK_ULP_CLOSE(boost::math::erf_inv(-0.25), y[2], 0);
+
+    std::vector<double> z{std::numeric_limits<double>::quiet_NaN(), 0.5};
+    boost::math::erf(z.data(), z.data() + z.size(), y.data());
+    CHECK_NAN(y[0]);
+    CHECK_ULP_CLOSE(boost::math::erf(0.5), y[1], 0);
+}
+
+int main()
+{
+    test_erf<float>();
+    test_erf<double>();
+    test_erf<long double>();
+    test_erf<cpp_bin_float_50>();
+
+    test_erf_inv<float>();
+    test_erf_inv<double>();
+    test_erf_inv<long double>();
+    test_erf_inv<cpp_bin_float_50>();
+
+    test_domain_errors();
+
+    return boost::math::test::report_errors();
+}
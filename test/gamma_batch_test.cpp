@@ -0,0 +1,171 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <limits>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// The array overloads must reproduce the scalar functions exactly,
+// so everything here is checked at zero ulps.
+
+template<class Real>
+std::vector<Real> gamma_arguments(Real hi)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> dis(0, static_cast<long double>(hi));
+    // Not a multiple of the internal block size:
+    std::vector<Real> x(1377);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        Real t = static_cast<Real>(dis(gen));
+        // Plenty of integers, these are the factorials:
+        if (i % 3 == 0)
+        {
+            t = static_cast<Real>(static_cast<int>(t) + 1);
+        }
+        // Some negative values which use the reflection formula:
+        if (i % 7 == 0)
+        {
+            t = -t / 8 - Real(0.3);
+        }
+        x[i] = t;
+    }
+    // Region boundaries and special values:
+    Real special[] = {Real(1e-12), Real(-1e-12), 1, 2, 3, Real(14.5), 15, Real(15.5), Real(99.5), 100, Real(100.5), 170, Real(170.5),
+                      Real(1e10), Real(1e20), Real(1e30), Real(0.5)};
+    for (auto t : special)
+    {
+        if (t < hi)
+        {
+            x.push_back(t);
+        }
+    }
+    return x;
+}
+
+template<class Real, class Policy>
+void test_gamma(const Policy& pol)
+{
+    std::vector<Real> x = gamma_arguments<Real>(Real(std::numeric_limits<Real>::max_exponent > 128 ? 160 : 30));
+    std::vector<Real> y(x.size());
+    boost::math::tgamma(x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::tgamma(x[i], pol), y[i], 0);
+    }
+
+    for (Real hi : {Real(30), Real(300), Real(1e6)})
+    {
+        x = gamma_arguments<Real>(hi);
+        y.resize(x.size());
+        boost::math::lgamma(x.data(), x.data() + x.size(), y.data(), pol);
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            CHECK_ULP_CLOSE(boost::math::lgamma(x[i], pol), y[i], 0);
+        }
+    }
+    // Ratios which stay in range, including some large values which
+    // are close together:
+    Real hi = std::numeric_limits<Real>::max_exponent > 128 ? 160 : 30;
+    x = gamma_arguments<Real>(hi);
+    std::vector<Real> b(x.rbegin(), x.rend());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = x[i] > 0 ? x[i] : -x[i];
+        b[i] = b[i] > 0 ? b[i] : Real(1.25);
+        if (i % 4 == 0)
+        {
+            x[i] += 3 * hi;
+            b[i] = x[i] - b[i] / 16;
+        }
+    }
+    y.resize(x.size());
+    boost::math::tgamma_ratio(x.data(), x.data() + x.size(), b.data(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::tgamma_ratio(x[i], b[i], pol), y[i], 0);
+    }
+}
+
+template<class Real>
+void test_gamma()
+{
+    test_gamma<Real>(boost::math::policies::policy<>());
+    test_gamma<Real>(boost::math::policies::make_policy(boost::math::policies::promote_float<false>(), boost::math::policies::promote_double<false>()));
+
+    std::vector<Real> x = gamma_arguments<Real>(25);
+    std::vector<Real> y(x.size());
+    boost::math::lgamma(x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::lgamma(x[i]), y[i], 0);
+    }
+    boost::math::tgamma(x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::tgamma(x[i]), y[i], 0);
+    }
+    // Empty range is a no-op:
+    boost::math::tgamma(x.data(), x.data(), y.data());
+}
+
+void test_errors()
+{
+    std::vector<double> x{0.5, -2, 3.5};
+    std::vector<double> y(x.size());
+    bool thrown = false;
+    try
+    {
+        boost::math::tgamma(x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    using namespace boost::math::policies;
+    typedef policy<pole_error<ignore_error>, promote_double<false> > ignore_policy;
+    boost::math::tgamma(x.data(), x.data() + x.size(), y.data(), ignore_policy());
+    CHECK_NAN(y[1]);
+    CHECK_ULP_CLOSE(boost::math::tgamma(x[2], ignore_policy()), y[2], 0);
+
+    std::vector<double> z{std::numeric_limits<double>::quiet_NaN(), 20.5};
+    boost::math::lgamma(z.data(), z.data() + z.size(), y.data(), ignore_policy());
+    CHECK_NAN(y[0]);
+    CHECK_ULP_CLOSE(boost::math::lgamma(z[1], ignore_policy()), y[1], 0);
+
+    std::vector<double> a{1.5, -1.5};
+    std::vector<double> b{2.5, 2.5};
+    thrown = false;
+    try
+    {
+        boost::math::tgamma_ratio(a.data(), a.data() + a.size(), b.data(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_gamma<float>();
+    test_gamma<double>();
+    test_gamma<long double>();
+    test_gamma<cpp_bin_float_50>();
+
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
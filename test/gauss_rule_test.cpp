@@ -0,0 +1,290 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/gauss_rule.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss_rule;
+using boost::math::quadrature::gauss_kronrod_rule;
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The tabulated rules are correctly rounded.  The abscissas are found as cos(theta), which is accurate to about epsilon
+// absolutely rather than relatively, as theta is; that matters for the small ones:
+template<class Real, unsigned N>
+void test_gauss_table()
+{
+    typedef gauss<Real, N> table;
+    gauss_rule<Real> rule(N);
+    CHECK_EQUAL(rule.points(), N);
+    CHECK_EQUAL(rule.abscissa().size(), table::abscissa().size());
+    CHECK_EQUAL(rule.weights().size(), table::weights().size());
+    for (std::size_t i = 0; i < rule.abscissa().size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(table::abscissa()[i], rule.abscissa()[i], 2*std::numeric_limits<Real>::epsilon());
+        CHECK_ULP_CLOSE(table::weights()[i], rule.weights()[i], 16);
+    }
+}
+
+template<class Real, unsigned N>
+void test_gauss_kronrod_table()
+{
+    typedef gauss_kronrod<Real, N> table;
+    typedef gauss<Real, (N - 1) / 2> gauss_table;
+    gauss_kronrod_rule<Real> rule(N);
+    CHECK_EQUAL(rule.points(), N);
+    CHECK_EQUAL(rule.abscissa().size(), table::abscissa().size());
+    CHECK_EQUAL(rule.gauss_weights().size(), gauss_table::weights().size());
+    for (std::size_t i = 0; i < rule.abscissa().size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(table::abscissa()[i], rule.abscissa()[i], 2*std::numeric_limits<Real>::epsilon());
+        CHECK_ULP_CLOSE(table::weights()[i], rule.weights()[i], 32);
+    }
+    for (std::size_t i = 0; i < rule.gauss_weights().size(); ++i)
+    {
+        CHECK_ULP_CLOSE(gauss_table::weights()[i], rule.gauss_weights()[i], 16);
+    }
+}
+
+template<class Real>
+void test_tables()
+{
+    test_gauss_table<Real, 7>();
+    test_gauss_table<Real, 10>();
+    test_gauss_table<Real, 15>();
+    test_gauss_table<Real, 20>();
+    test_gauss_table<Real, 25>();
+    test_gauss_table<Real, 30>();
+    test_gauss_kronrod_table<Real, 15>();
+    test_gauss_kronrod_table<Real, 21>();
+    test_gauss_kronrod_table<Real, 31>();
+    test_gauss_kronrod_table<Real, 41>();
+    test_gauss_kronrod_table<Real, 51>();
+    test_gauss_kronrod_table<Real, 61>();
+}
+
+// Beyond the tables, against the same rules found in higher precision:
+template<class Real, class Reference>
+void test_reference(unsigned n)
+{
+    gauss_rule<Real> rule(n);
+    gauss_rule<Reference> reference(n);
+    CHECK_EQUAL(rule.abscissa().size(), reference.abscissa().size());
+    for (std::size_t i = 0; i < rule.abscissa().size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(static_cast<Real>(reference.abscissa()[i]), rule.abscissa()[i], 2*std::numeric_limits<Real>::epsilon());
+        CHECK_ULP_CLOSE(static_cast<Real>(reference.weights()[i]), rule.weights()[i], 16);
+    }
+    gauss_kronrod_rule<Real> kronrod(2*n + 1);
+    gauss_kronrod_rule<Reference> kronrod_reference(2*n + 1);
+    for (std::size_t i = 0; i < kronrod.abscissa().size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(static_cast<Real>(kronrod_reference.abscissa()[i]), kronrod.abscissa()[i], 2*std::numeric_limits<Real>::epsilon());
+        CHECK_ULP_CLOSE(static_cast<Real>(kronrod_reference.weights()[i]), kronrod.weights()[i], 64);
+    }
+}
+
+// And the reference against legendre_p_zeros:
+void test_legendre_p_zeros()
+{
+    for (unsigned n : {21u, 64u})
+    {
+        gauss_rule<cpp_bin_float_50> rule(n);
+        std::vector<cpp_bin_float_50> zeros = boost::math::legendre_p_zeros<cpp_bin_float_50>(n);
+        CHECK_EQUAL(rule.abscissa().size(), zeros.size());
+        for (std::size_t i = 0; i < zeros.size(); ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(zeros[i], rule.abscissa()[i], 4*std::numeric_limits<cpp_bin_float_50>::epsilon());
+        }
+    }
+}
+
+// The n + 1 point Gauss-Kronrod extension of the one point rule is the three point Gauss rule:
+void test_three_points()
+{
+    gauss_kronrod_rule<double> rule(3);
+    CHECK_EQUAL(rule.abscissa().size(), std::size_t(2));
+    CHECK_EQUAL(rule.abscissa()[0], 0.0);
+    CHECK_ULP_CLOSE(std::sqrt(0.6), rule.abscissa()[1], 1);
+    CHECK_ULP_CLOSE(8.0/9, rule.weights()[0], 2);
+    CHECK_ULP_CLOSE(5.0/9, rule.weights()[1], 2);
+    CHECK_EQUAL(rule.gauss_weights().size(), std::size_t(1));
+    CHECK_ULP_CLOSE(2.0, rule.gauss_weights()[0], 1);
+}
+
+template<class Real>
+void test_many_points()
+{
+    using std::sin;
+    using std::cos;
+    using std::exp;
+    using std::abs;
+    Real eps = std::numeric_limits<Real>::epsilon();
+    for (unsigned n : {1000u, 1001u, 4000u})
+    {
+        gauss_rule<Real> rule(n);
+        Real sum = (n & 1) ? rule.weights()[0] : Real(0);
+        for (std::size_t i = (n & 1); i < rule.weights().size(); ++i)
+        {
+            sum += 2*rule.weights()[i];
+        }
+        CHECK_ABSOLUTE_ERROR(Real(2), sum, 16*eps);
+        // Oscillatory, with a few hundred periods in the range:
+        Real L1;
+        Real Q = rule.integrate([](Real x) { return cos(1000*x); }, &L1);
+        CHECK_LE(abs(Q - 2*sin(Real(1000))/1000), 64*eps*L1);
+        Q = rule.integrate([](Real x) { return cos(200*x)*exp(x); }, Real(0), 2*pi<Real>(), &L1);
+        Real expected = (exp(2*pi<Real>()) - 1)/(1 + 200*200);
+        CHECK_LE(abs(Q - expected), 64*eps*L1);
+    }
+
+    gauss_kronrod_rule<Real> rule(2001);
+    Real error = 0;
+    Real L1 = 0;
+    Real Q = rule.integrate([](Real x) { return cos(1000*x); }, Real(-1), Real(1), 0, std::sqrt(eps), &error, &L1);
+    CHECK_LE(abs(Q - 2*sin(Real(1000))/1000), 64*eps*L1);
+    CHECK_LE(error, 64*eps*L1);
+    // Exact for polynomials of degree 3n + 1:
+    Q = rule.integrate([](Real x) { return boost::math::legendre_p(3001, x) + boost::math::legendre_p(3000, x); }, Real(-1), Real(1), 0, std::sqrt(eps), &error, &L1);
+    CHECK_LE(abs(Q), 64*eps*L1);
+}
+
+template<class Real>
+void test_integrals()
+{
+    using std::exp;
+    using std::sqrt;
+    using std::atan;
+    Real tol = sqrt(std::numeric_limits<Real>::epsilon());
+    Real inf = std::numeric_limits<Real>::infinity();
+
+    gauss_rule<Real> g(40);
+    CHECK_ULP_CLOSE(exp(Real(1)) - 1, g.integrate([](Real x) { return exp(x); }, Real(0), Real(1)), 4);
+    CHECK_ULP_CLOSE(-Real(1)/3, g.integrate([](Real x) { return x*x; }, Real(1), Real(0)), 8);
+    CHECK_EQUAL(g.integrate([](Real x) { return x; }, Real(1), Real(1)), Real(0));
+    CHECK_ABSOLUTE_ERROR(Real(1), g.integrate([](Real x) { return exp(-x); }, Real(0), inf), 10*tol);
+
+    gauss_kronrod_rule<Real> gk(101);
+    Real error;
+    CHECK_ULP_CLOSE(atan(Real(100))/50, gk.integrate([](Real x) { return 1/(1 + 10000*x*x); }, Real(-1), Real(1), 15, tol, &error), 16);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), gk.integrate([](Real x) { return exp(-x*x); }, -inf, inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(Real(1), gk.integrate([](Real x) { return exp(x); }, -inf, Real(0)), 10*tol);
+    CHECK_ULP_CLOSE(-Real(1)/3, gk.integrate([](Real x) { return x*x; }, Real(1), Real(0)), 8);
+
+    // The globally adaptive integration of gauss_kronrod, whose result doesn't depend on the number of threads:
+    auto runge = [](Real x) { return 1/(1 + 10000*x*x); };
+    Real parallel_error;
+    Real Q = gk.parallel_integrate(runge, Real(-1), Real(1), 15, tol, &parallel_error, nullptr, 1);
+    CHECK_ULP_CLOSE(atan(Real(100))/50, Q, 16);
+    CHECK_LE(parallel_error, tol*Q);
+    CHECK_EQUAL(Q, gk.parallel_integrate(runge, Real(-1), Real(1), 15, tol, nullptr, nullptr, 4));
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), gk.parallel_integrate([](Real x) { return exp(-x*x); }, -inf, inf), 10*tol);
+    CHECK_ULP_CLOSE(-Real(1)/3, gk.parallel_integrate([](Real x) { return x*x; }, Real(1), Real(0)), 8);
+}
+
+// The rule doesn't depend on the number of threads, and each is computed once and shared:
+void test_threads()
+{
+    namespace detail = boost::math::quadrature::detail;
+    for (unsigned n : {17u, 500u, 1999u})
+    {
+        std::vector<double> x1, w1, x3, w3, g1, g3;
+        detail::gauss_legendre_rule<double>(n, 1, x1, w1);
+        detail::gauss_legendre_rule<double>(n, 3, x3, w3);
+        CHECK_EQUAL(x1 == x3, true);
+        CHECK_EQUAL(w1 == w3, true);
+        detail::gauss_kronrod_rule<double>(2*n + 1, 1, x1, w1, g1);
+        detail::gauss_kronrod_rule<double>(2*n + 1, 3, x3, w3, g3);
+        CHECK_EQUAL(x1 == x3, true);
+        CHECK_EQUAL(w1 == w3, true);
+        CHECK_EQUAL(g1 == g3, true);
+    }
+
+    gauss_rule<double> a(777, 2);
+    gauss_rule<double> b(777, 1);
+    CHECK_EQUAL(&a.abscissa() == &b.abscissa(), true);
+    gauss_kronrod_rule<double> c(777, 2);
+    CHECK_EQUAL(&a.abscissa() == &c.abscissa(), false);
+
+    std::vector<const double*> data(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        threads.emplace_back([&data, i]() { data[i] = gauss_kronrod_rule<double>(1235, 2).weights().data(); });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (std::size_t i = 1; i < data.size(); ++i)
+    {
+        CHECK_EQUAL(data[i] == data[0], true);
+    }
+}
+
+void test_domain_errors()
+{
+    for (unsigned points : {0u, 1u, 4u})
+    {
+        bool caught = false;
+        try
+        {
+            if (points == 0)
+            {
+                gauss_rule<double> rule(points);
+            }
+            else
+            {
+                gauss_kronrod_rule<double> rule(points);
+            }
+        }
+        catch (const std::domain_error&)
+        {
+            caught = true;
+        }
+        CHECK_EQUAL(caught, true);
+    }
+    bool caught = false;
+    try
+    {
+        gauss_rule<double>(5).integrate([](double x) { return x; }, std::numeric_limits<double>::quiet_NaN(), 1.0);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+int main()
+{
+    test_tables<float>();
+    test_tables<double>();
+    test_tables<long double>();
+    test_reference<double, cpp_bin_float_50>(150);
+    test_reference<long double, cpp_bin_float_50>(70);
+    test_legendre_p_zeros();
+    test_three_points();
+    test_many_points<double>();
+    test_integrals<float>();
+    test_integrals<double>();
+    test_integrals<long double>();
+    test_threads();
+    test_domain_errors();
+    return boost::math::test::report_errors();
+}
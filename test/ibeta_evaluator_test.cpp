@@ -0,0 +1,211 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::ibeta_evaluator;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The evaluator must reproduce the scalar functions exactly, unless the
+// compiler is free to fuse multiplies and adds, and does so differently
+// in the precomputed terms:
+#if defined(FP_FAST_FMA) || defined(FP_FAST_FMAF) || defined(FP_FAST_FMAL)
+const int evaluator_ulps = 8;
+#else
+const int evaluator_ulps = 0;
+#endif
+
+template<class Real, class Policy>
+void test_shape(Real a, Real b, const Policy& pol)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> linear(0, 1);
+    std::uniform_real_distribution<long double> logarithmic(-20, 0);
+    std::vector<Real> x(301);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        switch (i % 3)
+        {
+        case 0:
+            x[i] = static_cast<Real>(linear(gen));
+            break;
+        case 1:
+            x[i] = static_cast<Real>(std::pow(10.0L, logarithmic(gen)));
+            break;
+        default:
+            x[i] = static_cast<Real>(1 - std::pow(10.0L, logarithmic(gen)));
+        }
+    }
+    for (Real t : {Real(0), Real(1), Real(0.5), Real(0.1), Real(0.3), Real(0.7), Real(0.9)})
+    {
+        x.push_back(t);
+    }
+
+    ibeta_evaluator<Real, Policy> f(a, b);
+    CHECK_EQUAL(f.a(), a);
+    CHECK_EQUAL(f.b(), b);
+    std::vector<Real> y(x.size());
+    f.p(x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        Real expected = boost::math::ibeta(a, b, x[i], pol);
+        CHECK_ULP_CLOSE(expected, f.p(x[i]), evaluator_ulps);
+        CHECK_ULP_CLOSE(expected, y[i], evaluator_ulps);
+    }
+    f.q(x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        Real expected = boost::math::ibetac(a, b, x[i], pol);
+        CHECK_ULP_CLOSE(expected, f.q(x[i]), evaluator_ulps);
+        CHECK_ULP_CLOSE(expected, y[i], evaluator_ulps);
+    }
+
+    // The inverses, from p and q in [0, 1].  The root finder gives up for some
+    // extreme arguments, and then the evaluator must do the same:
+    for (size_t i = 0; i < x.size(); i += 5)
+    {
+        for (bool complement : {false, true})
+        {
+            Real expected = 0;
+            bool expected_thrown = false;
+            try
+            {
+                expected = complement ? boost::math::ibetac_inv(a, b, x[i], pol) : boost::math::ibeta_inv(a, b, x[i], pol);
+            }
+            catch (const boost::math::evaluation_error&)
+            {
+                expected_thrown = true;
+            }
+            Real computed = 0;
+            bool thrown = false;
+            try
+            {
+                if (complement)
+                {
+                    f.invc(&x[i], &x[i] + 1, &computed);
+                }
+                else
+                {
+                    computed = f.inv(x[i]);
+                }
+            }
+            catch (const boost::math::evaluation_error&)
+            {
+                thrown = true;
+            }
+            CHECK_EQUAL(expected_thrown, thrown);
+            CHECK_ULP_CLOSE(expected, computed, evaluator_ulps);
+        }
+    }
+}
+
+template<class Real>
+void test_shapes()
+{
+    using namespace boost::math::policies;
+    // Every region of ibeta_imp: both a and b below 1, one of them below 1
+    // with the other small or large, integers (the binomial sum), small
+    // non-integers (the sidesteps onto the asymptotic expansion), large
+    // values (the continued fraction), and the Student's t and F cases:
+    Real shapes[][2] = {
+        {Real(0.5), Real(0.5)}, {Real(0.1), Real(0.7)}, {Real(0.001), Real(0.9)}, {Real(0.9), Real(0.05)},
+        {Real(0.25), 3}, {Real(0.75), Real(12.5)}, {Real(0.5), 20}, {30, Real(0.5)}, {Real(0.2), 200},
+        {1, 1}, {1, Real(4.5)}, {Real(2.5), 1},
+        {2, 3}, {7, 7}, {12, 30},
+        {Real(1.5), Real(2.25)}, {Real(4.5), Real(9.75)}, {Real(17.5), Real(3.25)}, {Real(20.5), Real(39.5)}, {Real(3.5), Real(35.5)},
+        {Real(50.5), Real(60.25)}, {Real(400.5), Real(20.75)}, {Real(1000), Real(1000)}, {Real(2.5), Real(1e4)},
+        // Student's t with 1, 5, and 30 degrees of freedom, and F(5, 12):
+        {Real(0.5), Real(0.5)}, {Real(2.5), Real(0.5)}, {15, Real(0.5)}, {Real(2.5), 6}};
+    for (auto const & s : shapes)
+    {
+        test_shape<Real>(s[0], s[1], policy<>());
+        test_shape<Real>(s[0], s[1], make_policy(promote_float<false>(), promote_double<false>()));
+    }
+}
+
+void test_errors()
+{
+    using namespace boost::math::policies;
+    ibeta_evaluator<double> f(2.5, 3.5);
+    bool thrown = false;
+    try
+    {
+        f.p(1.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        f.invc(-0.25);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // Invalid parameters are reported when the functions are called:
+    ibeta_evaluator<double> g(-1, 2);
+    thrown = false;
+    try
+    {
+        g.q(0.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        g.inv(0.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // a = 0 is valid for the forward functions only:
+    ibeta_evaluator<double> h(0, 2);
+    CHECK_EQUAL(h.p(0.5), 1.0);
+    CHECK_EQUAL(h.q(0.5), 0.0);
+
+    typedef policy<domain_error<ignore_error> > ignore_policy;
+    ibeta_evaluator<double, ignore_policy> k(2, -3);
+    CHECK_NAN(k.inv(0.5));
+    ibeta_evaluator<double, ignore_policy> m(2, 3);
+    CHECK_NAN(m.p(-1.0));
+    CHECK_NAN(m.inv(2.0));
+}
+
+int main()
+{
+    test_shapes<float>();
+    test_shapes<double>();
+    test_shapes<long double>();
+
+    // Multiprecision types have no Lanczos approximation, but still cache the
+    // terms of the asymptotic expansion:
+    test_shape<cpp_bin_float_50>(cpp_bin_float_50(20.5), cpp_bin_float_50(0.75), boost::math::policies::policy<>());
+    test_shape<cpp_bin_float_50>(cpp_bin_float_50(4.5), cpp_bin_float_50(9.75), boost::math::policies::policy<>());
+
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
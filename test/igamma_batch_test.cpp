@@ -0,0 +1,211 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// The array overloads must reproduce the scalar functions exactly, unless the
+// compiler is free to fuse multiplies and adds, and does so differently in the
+// batched loops:
+#if defined(FP_FAST_FMA) || defined(FP_FAST_FMAF) || defined(FP_FAST_FMAL)
+const int batch_ulps = 8;
+#else
+const int batch_ulps = 0;
+#endif
+
+// Values of x in every region of gamma_incomplete_imp for shape a:
+template<class Real>
+std::vector<Real> igamma_arguments(Real a)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<long double> linear(0, 3 * static_cast<long double>(a) + 10);
+    std::uniform_real_distribution<long double> logarithmic(-25, 7);
+    // Not a multiple of the internal block size:
+    std::vector<Real> x(1377);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = static_cast<Real>(i % 2 ? linear(gen) : std::pow(10.0L, logarithmic(gen)));
+    }
+    // Region boundaries and special values:
+    Real special[] = {0, std::numeric_limits<Real>::min(), Real(1e-10), Real(0.2), Real(0.5), Real(0.6), Real(1.1), Real(2),
+                      a, a + 1, a / 2, Real(999), Real(1000), Real(1001), Real(5000), Real(1e10)};
+    for (auto t : special)
+    {
+        x.push_back(t);
+    }
+    return x;
+}
+
+template<class Real, class Policy>
+void test_igamma(Real a, const Policy& pol)
+{
+    std::vector<Real> x = igamma_arguments<Real>(a);
+    std::vector<Real> y(x.size());
+    boost::math::gamma_p(a, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_p(a, x[i], pol), y[i], batch_ulps);
+    }
+    boost::math::gamma_q(a, x.data(), x.data() + x.size(), y.data(), pol);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_q(a, x[i], pol), y[i], batch_ulps);
+    }
+}
+
+template<class Real, class Policy>
+void test_igamma_inv(Real a, const Policy& pol)
+{
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<long double> logarithmic(-30, 0);
+    std::vector<Real> p(301);
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        p[i] = static_cast<Real>(i % 2 ? std::pow(10.0L, logarithmic(gen)) : 1 - std::pow(10.0L, logarithmic(gen)));
+        // p = 1 is an overflow:
+        p[i] = (std::min)(p[i], 1 - std::numeric_limits<Real>::epsilon());
+    }
+    p.push_back(0);
+    p.push_back(Real(0.5));
+    std::vector<Real> y(p.size());
+    boost::math::gamma_p_inv(a, p.data(), p.data() + p.size(), y.data(), pol);
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_p_inv(a, p[i], pol), y[i], 0);
+    }
+    // q = 0 is an overflow, use q = 1 instead:
+    p[p.size() - 2] = 1;
+    boost::math::gamma_q_inv(a, p.data(), p.data() + p.size(), y.data(), pol);
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_q_inv(a, p[i], pol), y[i], 0);
+    }
+}
+
+template<class Real>
+void test_igamma()
+{
+    using namespace boost::math::policies;
+    // Small a, integers and half integers in and out of the finite sum
+    // range, and large a where the Temme expansion is used:
+    Real shapes[] = {Real(1e-30), Real(1e-5), Real(0.1), Real(0.5), Real(0.8), 1, Real(1.5), 2, 5, Real(7.3), Real(12.5), 17, Real(25.2),
+                     29, Real(29.5), 30, Real(50.5), 150, Real(151.5), 250, 1000, Real(1e5)};
+    for (Real a : shapes)
+    {
+        test_igamma<Real>(a, policy<>());
+        test_igamma<Real>(a, make_policy(promote_float<false>(), promote_double<false>()));
+    }
+    for (Real a : {Real(0.01), Real(0.5), Real(1), Real(4.5), Real(10), Real(300)})
+    {
+        test_igamma_inv<Real>(a, policy<>());
+    }
+
+    // The policy free overloads, and an empty range:
+    std::vector<Real> x = igamma_arguments<Real>(3);
+    std::vector<Real> y(x.size());
+    boost::math::gamma_p(Real(3), x.data(), x.data() + x.size(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_p(Real(3), x[i]), y[i], batch_ulps);
+    }
+    boost::math::gamma_q(Real(3), x.data(), x.data(), y.data());
+    std::vector<Real> p{Real(0.125), Real(0.5), Real(0.875)};
+    boost::math::gamma_q_inv(Real(3), p.data(), p.data() + p.size(), y.data());
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_q_inv(Real(3), p[i]), y[i], 0);
+    }
+}
+
+void test_errors()
+{
+    std::vector<double> x{0.5, -2, 3.5};
+    std::vector<double> y(x.size());
+    bool thrown = false;
+    try
+    {
+        boost::math::gamma_p(2.5, x.data(), x.data() + x.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        boost::math::gamma_q(-2.5, x.data(), x.data() + 1, y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error>, overflow_error<ignore_error>, promote_double<false> > ignore_policy;
+    x.push_back(std::numeric_limits<double>::quiet_NaN());
+    x.push_back(std::numeric_limits<double>::infinity());
+    y.resize(x.size());
+    boost::math::gamma_q(2.5, x.data(), x.data() + x.size(), y.data(), ignore_policy());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        double expected = boost::math::gamma_q(2.5, x[i], ignore_policy());
+        if (std::isnan(expected))
+        {
+            CHECK_NAN(y[i]);
+        }
+        else
+        {
+            CHECK_ULP_CLOSE(expected, y[i], 0);
+        }
+    }
+
+    std::vector<double> p{0.25, 1.5, 1};
+    thrown = false;
+    try
+    {
+        boost::math::gamma_p_inv(2.5, p.data(), p.data() + p.size(), y.data());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        boost::math::gamma_p_inv(2.5, p.data() + 2, p.data() + 3, y.data());
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_igamma<float>();
+    test_igamma<double>();
+    test_igamma<long double>();
+
+    // Multiprecision types take the scalar path:
+    test_igamma<cpp_bin_float_50>(cpp_bin_float_50(7.5), boost::math::policies::policy<>());
+
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
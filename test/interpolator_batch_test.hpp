@@ -0,0 +1,101 @@
+// Copyright the Boost.Math authors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TEST_INTERPOLATOR_BATCH_TEST_HPP
+#define BOOST_MATH_TEST_INTERPOLATOR_BATCH_TEST_HPP
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "math_unit_test.hpp"
+
+// Shared by the tests of the batch evaluation and cursors of the piecewise interpolators.
+
+// n increasing abscissas with random spacing:
+template<class Real>
+std::vector<Real> batch_test_abscissas(std::mt19937& gen, std::size_t n = 100)
+{
+    std::uniform_real_distribution<Real> dis(Real(0.1), Real(1));
+    std::vector<Real> x(n);
+    x[0] = dis(gen);
+    for (std::size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+    }
+    return x;
+}
+
+// n random ordinates or derivatives:
+template<class Real>
+std::vector<Real> batch_test_values(std::mt19937& gen, std::size_t n)
+{
+    std::uniform_real_distribution<Real> dis(Real(-1), Real(1));
+    std::vector<Real> y(n);
+    for (auto & t : y)
+    {
+        t = dis(gen);
+    }
+    return y;
+}
+
+// Checks that the batch overload and a cursor agree exactly with the scalar functions at the
+// knots x and between them, both endpoints included, for increasing, decreasing and random
+// queries, and that the cursor rejects a point past the end:
+template<bool CheckDoublePrime = false, class Interpolator, class Real>
+void check_batch_evaluation(Interpolator const & interpolator, std::vector<Real> const & x, std::mt19937& gen)
+{
+    std::vector<Real> z;
+    Real a = x.front();
+    Real b = x.back();
+    for (std::size_t i = 0; i <= 1000; ++i)
+    {
+        z.push_back(a + (b-a)*i/1000);
+    }
+    z.insert(z.end(), x.begin(), x.end());
+    std::sort(z.begin(), z.end());
+    z.back() = b;
+    std::vector<Real> w(z.size());
+
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        if (pass == 1)
+        {
+            std::reverse(z.begin(), z.end());
+        }
+        if (pass == 2)
+        {
+            std::shuffle(z.begin(), z.end(), gen);
+        }
+        interpolator(z.begin(), z.end(), w.begin());
+        auto c = interpolator.cursor();
+        for (std::size_t i = 0; i < z.size(); ++i)
+        {
+            Real t = z[i];
+            CHECK_ULP_CLOSE(interpolator(t), w[i], 0);
+            CHECK_ULP_CLOSE(interpolator(t), c(t), 0);
+            CHECK_ULP_CLOSE(interpolator.prime(t), c.prime(t), 0);
+            if constexpr (CheckDoublePrime)
+            {
+                CHECK_ULP_CLOSE(interpolator.double_prime(t), c.double_prime(t), 0);
+            }
+        }
+    }
+
+    auto c = interpolator.cursor();
+    bool caught = false;
+    try
+    {
+        c(b + 1);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+#endif
@@ -6,6 +6,9 @@
  */
 
 #include "math_unit_test.hpp"
+#include "interpolator_batch_test.hpp"
+#include <vector>
+#include <algorithm>
 #include <numeric>
 #include <utility>
 #include <random>
@@ -163,16 +166,30 @@ void test_interpolation_condition()
     }
 }
 
+template<typename Real>
+void test_batch_evaluation()
+{
+    std::mt19937 gen(327);
+    auto x = batch_test_abscissas<Real>(gen);
+    auto y = batch_test_values<Real>(gen, x.size());
+    auto x_copy = x;
+    auto interpolator = makima(std::move(x_copy), std::move(y));
+    check_batch_evaluation(interpolator, x, gen);
+}
+
 int main()
 {
+    test_batch_evaluation<float>();
     test_constant<float>();
     test_linear<float>();
     test_interpolation_condition<float>();
 
+    test_batch_evaluation<double>();
     test_constant<double>();
     test_linear<double>();
     test_interpolation_condition<double>();
 
+    test_batch_evaluation<long double>();
     test_constant<long double>();
     test_linear<long double>();
     test_interpolation_condition<long double>();
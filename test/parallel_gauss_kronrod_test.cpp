@@ -0,0 +1,133 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/constants/constants.hpp>
+
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::constants::pi;
+
+template<class Real, unsigned N, class F>
+void check_integral(F f, Real a, Real b, Real expected, Real tol)
+{
+    using std::abs;
+    Real error;
+    Real L1;
+    Real Q = gauss_kronrod<Real, N>::parallel_integrate(f, a, b, 15, tol, &error, &L1, 4);
+    CHECK_LE(abs(Q - expected), (std::max)(10*tol*abs(expected), 10*std::numeric_limits<Real>::epsilon()));
+    CHECK_LE(Real(0), error);
+    CHECK_LE(abs(Q), L1*(1 + std::numeric_limits<Real>::epsilon()));
+
+    // Agrees with the depth first algorithm to within the requested tolerance:
+    Real Q_serial = gauss_kronrod<Real, N>::integrate(f, a, b, 15, tol);
+    CHECK_LE(abs(Q - Q_serial), (std::max)(20*tol*abs(expected), 20*std::numeric_limits<Real>::epsilon()));
+
+    // The result doesn't depend on the number of threads:
+    for (std::size_t threads : {1, 2, 3, 8})
+    {
+        Real e;
+        Real l;
+        Real R = gauss_kronrod<Real, N>::parallel_integrate(f, a, b, 15, tol, &e, &l, threads);
+        CHECK_ULP_CLOSE(Q, R, 0);
+        CHECK_ULP_CLOSE(error, e, 0);
+        CHECK_ULP_CLOSE(L1, l, 0);
+    }
+}
+
+template<class Real>
+void test_integrals()
+{
+    using std::exp;
+    using std::sin;
+    using std::cos;
+    using std::sqrt;
+    using std::abs;
+    using std::atan;
+    Real tol = sqrt(std::numeric_limits<Real>::epsilon());
+    Real inf = std::numeric_limits<Real>::infinity();
+
+    check_integral<Real, 15>([](Real x) { return exp(x); }, Real(0), Real(1), exp(Real(1)) - 1, tol);
+    check_integral<Real, 31>([](Real x) { return cos(x); }, Real(0), pi<Real>()/2, Real(1), tol);
+    // Sharply peaked, so that most of the work is in a small part of the range:
+    check_integral<Real, 15>([](Real x) { return 1/(1 + 10000*x*x); }, Real(-1), Real(1), atan(Real(100))/50, tol);
+    check_integral<Real, 31>([](Real x) { return sin(50*x)*sin(50*x); }, Real(0), pi<Real>(), pi<Real>()/2, tol);
+    // A kink, which only bisection down to it resolves:
+    check_integral<Real, 15>([](Real x) { return abs(x - Real(1)/3); }, Real(0), Real(1), Real(5)/18, tol);
+    // Reversed limits:
+    check_integral<Real, 15>([](Real x) { return x*x; }, Real(1), Real(0), -Real(1)/3, tol);
+    // Infinite ranges:
+    check_integral<Real, 15>([](Real x) { return exp(-x*x); }, -inf, inf, sqrt(pi<Real>()), tol);
+    check_integral<Real, 15>([](Real x) { return exp(-x); }, Real(0), inf, Real(1), tol);
+    check_integral<Real, 15>([](Real x) { return exp(x); }, -inf, Real(0), Real(1), tol);
+}
+
+void test_complex()
+{
+    using std::exp;
+    typedef std::complex<double> K;
+    auto f = [](double x) { return exp(K(0, 3*x)); };
+    double error;
+    K Q = gauss_kronrod<double, 15>::parallel_integrate(f, 0.0, 1.0, 15, 1e-10, &error, nullptr, 2);
+    K expected = (exp(K(0, 3)) - 1.0)/K(0, 3);
+    CHECK_ABSOLUTE_ERROR(expected.real(), Q.real(), 1e-12);
+    CHECK_ABSOLUTE_ERROR(expected.imag(), Q.imag(), 1e-12);
+}
+
+void test_edge_cases()
+{
+    typedef gauss_kronrod<double, 15> integrator;
+    double error = -1;
+    double L1 = -1;
+    // Non adaptive:
+    std::atomic<int> calls(0);
+    auto f = [&](double x) { ++calls; return x*x*x; };
+    double Q = integrator::parallel_integrate(f, 0.0, 2.0, 0, 1e-10, &error, &L1, 4);
+    CHECK_ULP_CLOSE(4.0, Q, 2);
+    CHECK_EQUAL(calls.load(), 15);
+    CHECK_ULP_CLOSE(integrator::integrate(f, 0.0, 2.0, 0), Q, 0);
+
+    CHECK_EQUAL(integrator::parallel_integrate(f, 1.0, 1.0), 0.0);
+
+    // Exceptions thrown by the integrand reach the caller:
+    bool caught = false;
+    try
+    {
+        integrator::parallel_integrate([](double x) -> double { if (x > 0.9) { throw std::runtime_error("boom"); } return 1/(x - 0.5); }, 0.0, 1.0, 15, 1e-10, nullptr, nullptr, 4);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+
+    caught = false;
+    try
+    {
+        integrator::parallel_integrate([](double x) { return x; }, std::numeric_limits<double>::quiet_NaN(), 1.0);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+int main()
+{
+    test_integrals<float>();
+    test_integrals<double>();
+    test_integrals<long double>();
+    test_complex();
+    test_edge_cases();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::sinh_sinh;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Quadrature>
+bool throws_runtime_error(std::string const & file)
+{
+    try
+    {
+        Quadrature q(file);
+    }
+    catch (std::runtime_error const &)
+    {
+        return true;
+    }
+    return false;
+}
+
+// A quadrature loaded from a table must reproduce the one which saved it exactly,
+// both for the rows which were saved, and for those computed afterwards:
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::sqrt;
+    using std::log;
+    std::string file = "tanh_sinh_nodes.bin";
+    auto f = [](Real x) { return sqrt(1 - x*x); };
+    auto g = [](Real x) { return log(x)*log(1 - x); };
+    tanh_sinh<Real> original;
+    Real error;
+    std::size_t levels;
+    Real Q = original.integrate(f, Real(-1), Real(1), boost::math::tools::root_epsilon<Real>(), &error, nullptr, &levels);
+    original.save_tables(file);
+
+    tanh_sinh<Real> loaded(file);
+    Real error2;
+    std::size_t levels2;
+    Real Q2 = loaded.integrate(f, Real(-1), Real(1), boost::math::tools::root_epsilon<Real>(), &error2, nullptr, &levels2);
+    CHECK_ULP_CLOSE(Q, Q2, 0);
+    CHECK_ULP_CLOSE(error, error2, 0);
+    CHECK_EQUAL(levels, levels2);
+    CHECK_ULP_CLOSE(pi<Real>()/2, Q2, 10);
+
+    // Beyond the saved rows, with a tighter tolerance:
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    Q = original.integrate(g, Real(0), Real(1), tol, &error, nullptr, &levels);
+    Q2 = loaded.integrate(g, Real(0), Real(1), tol, &error2, nullptr, &levels2);
+    CHECK_ULP_CLOSE(Q, Q2, 0);
+    CHECK_EQUAL(levels, levels2);
+
+    // Saving more levels than have been used computes them first:
+    tanh_sinh<Real> fresh(10);
+    fresh.save_tables(file, 7);
+    tanh_sinh<Real> deep(file);
+    Q = fresh.integrate(g, Real(0), Real(1), tol, &error, nullptr, &levels);
+    Q2 = deep.integrate(g, Real(0), Real(1), tol, &error2, nullptr, &levels2);
+    CHECK_ULP_CLOSE(Q, Q2, 0);
+    CHECK_EQUAL(levels, levels2);
+
+    // Tables are specific to the quadrature and the type:
+    CHECK_EQUAL(throws_runtime_error<exp_sinh<Real>>(file), true);
+    typedef typename std::conditional<std::is_same<Real, float>::value, double, float>::type other_type;
+    CHECK_EQUAL(throws_runtime_error<tanh_sinh<other_type>>(file), true);
+    CHECK_EQUAL(throws_runtime_error<tanh_sinh<Real>>("no_such_file.bin"), true);
+    std::remove(file.c_str());
+}
+
+template<class Real>
+void test_exp_sinh()
+{
+    using std::exp;
+    std::string file = "exp_sinh_nodes.bin";
+    auto f = [](Real x) { return exp(-x)*x*x; };
+    exp_sinh<Real> original;
+    Real error, error2;
+    std::size_t levels, levels2;
+    Real Q = original.integrate(f, boost::math::tools::root_epsilon<Real>(), &error, nullptr, &levels);
+    original.save_tables(file);
+    exp_sinh<Real> loaded(file);
+    Real Q2 = loaded.integrate(f, boost::math::tools::root_epsilon<Real>(), &error2, nullptr, &levels2);
+    CHECK_ULP_CLOSE(Q, Q2, 0);
+    CHECK_ULP_CLOSE(error, error2, 0);
+    CHECK_EQUAL(levels, levels2);
+    CHECK_ULP_CLOSE(Real(2), Q2, 10);
+    CHECK_EQUAL(throws_runtime_error<sinh_sinh<Real>>(file), true);
+    std::remove(file.c_str());
+}
+
+template<class Real>
+void test_sinh_sinh()
+{
+    using std::exp;
+    std::string file = "sinh_sinh_nodes.bin";
+    auto f = [](Real x) { return 1/(1 + x*x); };
+    sinh_sinh<Real> original;
+    Real error, error2;
+    std::size_t levels, levels2;
+    Real Q = original.integrate(f, boost::math::tools::root_epsilon<Real>(), &error, nullptr, &levels);
+    original.save_tables(file);
+    sinh_sinh<Real> loaded(file);
+    Real Q2 = loaded.integrate(f, boost::math::tools::root_epsilon<Real>(), &error2, nullptr, &levels2);
+    CHECK_ULP_CLOSE(Q, Q2, 0);
+    CHECK_ULP_CLOSE(error, error2, 0);
+    CHECK_EQUAL(levels, levels2);
+    CHECK_ULP_CLOSE(pi<Real>(), Q2, 10);
+    CHECK_EQUAL(throws_runtime_error<tanh_sinh<Real>>(file), true);
+    std::remove(file.c_str());
+}
+
+void test_corrupt_file()
+{
+    std::string file = "corrupt_nodes.bin";
+    tanh_sinh<double> original;
+    original.save_tables(file);
+    std::ifstream is(file.c_str(), std::ios_base::binary);
+    std::string contents((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    is.close();
+    {
+        std::ofstream os(file.c_str(), std::ios_base::binary | std::ios_base::trunc);
+        os.write(contents.data(), contents.size()/2);
+    }
+    CHECK_EQUAL(throws_runtime_error<tanh_sinh<double>>(file), true);
+    {
+        std::ofstream os(file.c_str(), std::ios_base::binary | std::ios_base::trunc);
+        os << "Not a table at all";
+    }
+    CHECK_EQUAL(throws_runtime_error<tanh_sinh<double>>(file), true);
+    std::remove(file.c_str());
+}
+
+int main()
+{
+    test_tanh_sinh<float>();
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+    test_tanh_sinh<cpp_bin_float_50>();
+    test_exp_sinh<double>();
+    test_exp_sinh<cpp_bin_float_50>();
+    test_sinh_sinh<double>();
+    test_sinh_sinh<cpp_bin_float_50>();
+    test_corrupt_file();
+    return boost::math::test::report_errors();
+}
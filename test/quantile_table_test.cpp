@@ -0,0 +1,169 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <vector>
+#include <random>
+#include <limits>
+#include <boost/math/distributions/quantile_table.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/skew_normal.hpp>
+#include <boost/math/distributions/kolmogorov_smirnov.hpp>
+
+using boost::math::quantile_table;
+
+template<class Dist>
+void test_table(const Dist& dist)
+{
+    typedef typename Dist::value_type Real;
+    using std::abs;
+    quantile_table<Dist> table(dist, quantile_table<Dist>::default_tolerance(), quantile_table<Dist>::default_tail_probability(), 1);
+    Real error = table.estimated_probability_error();
+    // The cdf of the skew normal is only accurate to about 1e-7 relative to p in the far lower tail,
+    // which the reported error reflects; elsewhere the tolerance is met.
+    CHECK_LE(error, (std::max)(Real(1e-6), quantile_table<Dist>::default_tolerance()));
+
+    std::mt19937_64 gen(87654321);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    for (int i = 0; i < 2000; ++i)
+    {
+        Real p = dis(gen);
+        if (p == 0 || p == 1)
+        {
+            continue;
+        }
+        Real x = table(p);
+        Real e = p <= Real(0.5) ? abs(cdf(dist, x) - p) / p : abs(cdf(complement(dist, x)) - (1 - p)) / (1 - p);
+        // Away from the tails the tolerance is met, not just the reported error:
+        CHECK_LE(e, 2 * quantile_table<Dist>::default_tolerance());
+        CHECK_LE(e, 2 * error);
+    }
+
+    // Monotone, including where it joins the fallback at the tails:
+    Real tail = table.tail_probability();
+    std::vector<Real> p{tail / 2, tail};
+    for (int i = 1; i < 20000; ++i)
+    {
+        p.push_back(Real(i) / 20000);
+    }
+    if (1 - tail / 2 < 1)
+    {
+        p.push_back(1 - tail);
+        p.push_back(1 - tail / 2);
+        CHECK_ULP_CLOSE(quantile(dist, 1 - tail / 2), table(1 - tail / 2), 0);
+    }
+    for (size_t i = 1; i < p.size(); ++i)
+    {
+        CHECK_LE(table(p[i - 1]), table(p[i]));
+    }
+
+    // The table starts from the exact quantile, and beyond it the distribution's own quantile is used:
+    CHECK_ULP_CLOSE(quantile(dist, tail), table(tail), 0);
+    CHECK_ULP_CLOSE(quantile(dist, tail / 2), table(tail / 2), 0);
+    CHECK_MOLLIFIED_CLOSE(quantile(dist, Real(0.5)), table(Real(0.5)), 16 * std::numeric_limits<Real>::epsilon());
+
+    // The table does not depend on the number of threads used to build it:
+    quantile_table<Dist> parallel_table(dist, quantile_table<Dist>::default_tolerance(), quantile_table<Dist>::default_tail_probability(), 3);
+    CHECK_EQUAL(table.size(), parallel_table.size());
+    CHECK_ULP_CLOSE(table.estimated_probability_error(), parallel_table.estimated_probability_error(), 0);
+    for (size_t i = 0; i < p.size(); i += 7)
+    {
+        CHECK_ULP_CLOSE(table(p[i]), parallel_table(p[i]), 0);
+    }
+}
+
+void test_tolerance()
+{
+    boost::math::non_central_chi_squared dist(4, 3);
+    quantile_table<boost::math::non_central_chi_squared> coarse(dist, 1e-6, 1e-6, 2);
+    quantile_table<boost::math::non_central_chi_squared> fine(dist);
+    CHECK_LE(coarse.estimated_probability_error(), 1e-6);
+    CHECK_LE(coarse.size(), fine.size() / 4);
+    CHECK_ULP_CLOSE(quantile(dist, 1e-7), coarse(1e-7), 0);
+}
+
+void test_errors()
+{
+    typedef boost::math::normal_distribution<double> dist_type;
+    quantile_table<dist_type> table(dist_type(), 1e-10, 1e-8);
+    bool thrown = false;
+    try
+    {
+        table(-0.25);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        table(std::numeric_limits<double>::quiet_NaN());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        quantile_table<dist_type> bad(dist_type(), 0);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        quantile_table<dist_type> bad(dist_type(), 1e-10, 0.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // If the errors return, the table is empty and the distribution's own quantile is used throughout:
+    typedef boost::math::policies::policy<boost::math::policies::domain_error<boost::math::policies::ignore_error> > ignore_policy;
+    typedef boost::math::normal_distribution<double, ignore_policy> ignore_dist_type;
+    for (double tail : {0.0, -1.0, 0.5, std::numeric_limits<double>::quiet_NaN()})
+    {
+        quantile_table<ignore_dist_type> empty(ignore_dist_type(), 1e-10, tail);
+        CHECK_EQUAL(empty.size(), std::size_t(0));
+        for (double p : {1e-20, 1e-5, 0.25, 0.5, 0.75, 1 - 1e-5})
+        {
+            CHECK_ULP_CLOSE(quantile(ignore_dist_type(), p), empty(p), 0);
+        }
+    }
+    quantile_table<ignore_dist_type> empty(ignore_dist_type(), -1);
+    CHECK_EQUAL(empty.size(), std::size_t(0));
+    CHECK_ULP_CLOSE(quantile(ignore_dist_type(), 0.25), empty(0.25), 0);
+}
+
+int main()
+{
+    test_table(boost::math::normal_distribution<double>(1, 3));
+    test_table(boost::math::normal_distribution<float>());
+    test_table(boost::math::non_central_t(5, 2));
+    test_table(boost::math::non_central_chi_squared(4, 3));
+    test_table(boost::math::non_central_beta(2, 3, 1.5));
+    test_table(boost::math::skew_normal(0, 1, 4));
+    test_table(boost::math::kolmogorov_smirnov_distribution<double>(20));
+
+    test_tolerance();
+    test_errors();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/quasi_monte_carlo.hpp>
+
+using boost::math::quadrature::quasi_monte_carlo;
+using boost::math::constants::pi;
+
+// The first 2^m points of each pair of dimensions of the Sobol' sequence form a (t, m, 2)-net:
+// every box [i/2^a, (i+1)/2^a) x [j/2^b, (j+1)/2^b) with a + b = m - t holds exactly 2^t points.
+// For the first two dimensions t = 0.  Scrambling must preserve this.
+void test_net_property()
+{
+    using namespace boost::math::quadrature::detail;
+    std::size_t dimension = 40;
+    auto v = sobol_direction_numbers(dimension);
+    std::mt19937_64 gen(5);
+    auto w = v;
+    scramble_direction_numbers(w, gen);
+    for (auto const & directions : {v, w})
+    {
+        unsigned m = 10;
+        std::vector<std::vector<uint64_t>> points(dimension, std::vector<uint64_t>(uint64_t(1) << m));
+        for (std::size_t j = 0; j < dimension; ++j)
+        {
+            for (uint64_t i = 0; i < points[j].size(); ++i)
+            {
+                uint64_t gray = i ^ (i >> 1);
+                uint64_t x = 0;
+                for (unsigned k = 0; k < 32; ++k)
+                {
+                    if ((gray >> k) & 1)
+                    {
+                        x ^= directions[j][k];
+                    }
+                }
+                points[j][i] = x;
+            }
+        }
+        // Each dimension is stratified:
+        for (std::size_t j = 0; j < dimension; ++j)
+        {
+            std::vector<int> counts(uint64_t(1) << m, 0);
+            for (auto x : points[j])
+            {
+                ++counts[x >> (64 - m)];
+            }
+            for (auto c : counts)
+            {
+                CHECK_EQUAL(c, 1);
+            }
+        }
+        // The first two dimensions form a (0, m, 2)-net:
+        for (unsigned a = 0; a <= m; ++a)
+        {
+            unsigned b = m - a;
+            std::vector<int> counts(uint64_t(1) << m, 0);
+            for (uint64_t i = 0; i < points[0].size(); ++i)
+            {
+                uint64_t row = (a == 0) ? 0 : points[0][i] >> (64 - a);
+                uint64_t column = (b == 0) ? 0 : points[1][i] >> (64 - b);
+                ++counts[(row << b) | column];
+            }
+            for (auto c : counts)
+            {
+                CHECK_EQUAL(c, 1);
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_smooth_product()
+{
+    using std::abs;
+    // A smooth 8 dimensional integrand with integral 1:
+    auto f = [](std::vector<Real> const & x)->Real
+    {
+        Real y = 1;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            y *= 1 + (x[i] - Real(0.5))/(i + 1);
+        }
+        return y;
+    };
+    std::vector<std::pair<Real, Real>> bounds(8, std::make_pair(Real(0), Real(1)));
+    Real error_goal = Real(1e-5);
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, /* singular = */ false, /* threads = */ 2, /* seed = */ 1234);
+    Real Q = qmc.integrate().get();
+    CHECK_LE(qmc.current_error_estimate(), error_goal);
+    CHECK_LE(abs(Q - 1), 10*error_goal);
+    // Naive Monte Carlo needs about variance/error_goal^2 ~ 10^9 calls for this:
+    CHECK_LE(qmc.calls(), uint64_t(2000000));
+    CHECK_EQUAL(qmc.progress(), Real(1));
+
+    // The result depends on the seed but not on the number of threads:
+    for (uint64_t threads : {1, 3, 5})
+    {
+        quasi_monte_carlo<Real, decltype(f)> other(f, bounds, error_goal, false, threads, 1234);
+        Real R = other.integrate().get();
+        CHECK_ULP_CLOSE(Q, R, 0);
+        CHECK_EQUAL(qmc.calls(), other.calls());
+    }
+}
+
+template<class Real>
+void test_unbounded()
+{
+    using std::exp;
+    using std::sqrt;
+    using std::abs;
+    auto f = [](std::vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]);
+    };
+    Real inf = std::numeric_limits<Real>::infinity();
+    std::vector<std::pair<Real, Real>> bounds{{-inf, inf}, {Real(0), inf}};
+    Real error_goal = Real(1e-4);
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, true, 2, 77);
+    Real Q = qmc.integrate().get();
+    CHECK_LE(abs(Q - sqrt(pi<Real>())), 10*error_goal);
+
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        return exp(x[0]);
+    };
+    std::vector<std::pair<Real, Real>> lower{{-inf, Real(0)}};
+    quasi_monte_carlo<Real, decltype(g)> qmc2(g, lower, error_goal, true, 2, 78);
+    Q = qmc2.integrate().get();
+    CHECK_LE(abs(Q - 1), 10*error_goal);
+}
+
+void test_cancel_and_restart()
+{
+    using std::abs;
+    using std::exp;
+    auto f = [](std::vector<double> const & x)
+    {
+        return exp(x[0] + x[1] + x[2]);
+    };
+    double exact = (exp(1.0) - 1)*(exp(1.0) - 1)*(exp(1.0) - 1);
+    std::vector<std::pair<double, double>> bounds(3, std::make_pair(0.0, 1.0));
+    // An unreachable goal, so that the integration has to be cancelled:
+    quasi_monte_carlo<double, decltype(f)> qmc(f, bounds, 0.0, false, 2, 99);
+    auto task = qmc.integrate();
+    while (qmc.calls() < 100000)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    qmc.cancel();
+    double Q = task.get();
+    uint64_t calls = qmc.calls();
+    CHECK_LE(abs(Q - exact), 1e-4);
+    CHECK_EQUAL(Q, qmc.current_estimate());
+
+    // Restarting carries on from where the cancelled run stopped:
+    qmc.update_target_error(1e-7);
+    Q = qmc.integrate().get();
+    CHECK_LE(calls, qmc.calls());
+    CHECK_LE(qmc.current_error_estimate(), 1e-7);
+    CHECK_LE(abs(Q - exact), 1e-6);
+}
+
+void test_exception_from_integrand()
+{
+    auto f = [](std::vector<double> const & x)
+    {
+        if (x[0] > 0.99)
+        {
+            throw std::logic_error("Raising test exception");
+        }
+        return x[0];
+    };
+    std::vector<std::pair<double, double>> bounds{{0.0, 1.0}};
+    quasi_monte_carlo<double, decltype(f)> qmc(f, bounds, 1e-9, false, 2, 5);
+    bool caught = false;
+    try
+    {
+        qmc.integrate().get();
+    }
+    catch (std::logic_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+
+    // Non-finite values are reported as domain errors:
+    auto g = [](std::vector<double> const & x)
+    {
+        return 1/(x[0] - x[0]);
+    };
+    quasi_monte_carlo<double, decltype(g)> qmc2(g, bounds, 1e-3, false, 2, 5);
+    caught = false;
+    try
+    {
+        qmc2.integrate().get();
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+// The extreme words map strictly inside (0, 1), so that unbounded transforms of the points stay finite:
+template<class Real>
+void test_coordinate_bounds()
+{
+    using boost::math::quadrature::detail::sobol_coordinate;
+    Real x = sobol_coordinate<Real>(~uint64_t(0));
+    CHECK_LE(x, Real(1) - std::numeric_limits<Real>::epsilon()/2);
+    CHECK_EQUAL(x < 1, true);
+    CHECK_EQUAL(std::isfinite(std::log(1 - x)), true);
+    x = sobol_coordinate<Real>(0);
+    CHECK_EQUAL(x > 0, true);
+    CHECK_EQUAL(std::isfinite(std::log(x)), true);
+}
+
+int main()
+{
+    test_net_property();
+    test_coordinate_bounds<float>();
+    test_coordinate_bounds<double>();
+    test_coordinate_bounds<long double>();
+    test_smooth_product<float>();
+    test_smooth_product<double>();
+    test_unbounded<double>();
+    test_unbounded<long double>();
+    test_cancel_and_restart();
+    test_exception_from_integrand();
+    return boost::math::test::report_errors();
+}
@@ -6,6 +6,9 @@
  */
 
 #include "math_unit_test.hpp"
+#include "interpolator_batch_test.hpp"
+#include <algorithm>
+#include <random>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -521,8 +524,22 @@ void test_cardinal_quartic()
 }
 
 
+template<typename Real>
+void test_batch_evaluation()
+{
+    std::mt19937 gen(327);
+    auto x = batch_test_abscissas<Real>(gen);
+    auto y = batch_test_values<Real>(gen, x.size());
+    auto dydx = batch_test_values<Real>(gen, x.size());
+    auto d2ydx2 = batch_test_values<Real>(gen, x.size());
+    auto x_copy = x;
+    auto interpolator = quintic_hermite(std::move(x_copy), std::move(y), std::move(dydx), std::move(d2ydx2));
+    check_batch_evaluation<true>(interpolator, x, gen);
+}
+
 int main()
 {
+    test_batch_evaluation<float>();
     test_constant<float>();
     test_linear<float>();
     test_quadratic<float>();
@@ -536,6 +553,7 @@ int main()
     test_cardinal_cubic<float>();
     test_cardinal_quartic<float>();
 
+    test_batch_evaluation<double>();
     test_constant<double>();
     test_linear<double>();
     test_quadratic<double>();
@@ -549,6 +567,7 @@ int main()
     test_cardinal_cubic<double>();
     test_cardinal_quartic<double>();
 
+    test_batch_evaluation<long double>();
     test_constant<long double>();
     test_linear<long double>();
     test_quadratic<long double>();
@@ -0,0 +1,216 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/math/tools/rational.hpp>
+
+using boost::math::tools::evaluate_polynomial;
+using boost::math::tools::evaluate_polynomial_estrin;
+using boost::math::tools::evaluate_rational;
+
+// Estrin's scheme rounds differently from Horner's rule, so its error is bounded by
+// the sum of the magnitudes of the terms rather than by the value:
+template<class T, class Real>
+Real estrin_tolerance(const T* poly, std::size_t count, Real z)
+{
+    using std::abs;
+    Real scale = 0;
+    Real power = 1;
+    for (std::size_t j = 0; j < count; ++j)
+    {
+        scale += abs(Real(poly[j]))*power;
+        power *= abs(z);
+    }
+    return 4*count*std::numeric_limits<Real>::epsilon()*scale;
+}
+
+// The batch results are identical to the scalar ones, unless the compiler is free
+// to fuse multiplies and adds, and does so differently in the two loops:
+template<class Real>
+Real horner_tolerance(Real estrin)
+{
+#if defined(FP_FAST_FMA) || defined(FP_FAST_FMAF) || defined(FP_FAST_FMAL)
+    return estrin;
+#else
+    return 0*estrin;
+#endif
+}
+
+#define CHECK_BATCH_CLOSE(expected, computed, tol) \
+    do { if ((tol) == 0) { CHECK_ULP_CLOSE(expected, computed, 0); } else { CHECK_ABSOLUTE_ERROR(expected, computed, tol); } } while (0)
+
+template<class Real>
+void test_polynomial()
+{
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(-2, 2);
+    // Sizes which are not a multiple of the block size, and orders either side of a power of two:
+    for (std::size_t n : {0, 1, 3, 7, 16, 33, 100})
+    {
+        std::vector<Real> z(n);
+        for (auto & x : z)
+        {
+            x = dis(gen);
+        }
+        for (std::size_t count : {1, 2, 3, 4, 5, 8, 9, 17, 20})
+        {
+            std::vector<Real> poly(count);
+            for (auto & c : poly)
+            {
+                c = dis(gen);
+            }
+            std::vector<Real> result(n);
+            evaluate_polynomial(poly.data(), count, z.data(), result.data(), n);
+            std::vector<Real> estrin(n);
+            evaluate_polynomial_estrin(poly.data(), count, z.data(), estrin.data(), n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                Real expected = evaluate_polynomial(poly.data(), z[i], count);
+                Real tol = estrin_tolerance(poly.data(), count, z[i]);
+                CHECK_BATCH_CLOSE(expected, result[i], horner_tolerance(tol));
+                CHECK_ABSOLUTE_ERROR(expected, estrin[i], tol);
+            }
+            // In place:
+            std::vector<Real> w = z;
+            evaluate_polynomial(poly.data(), count, w.data(), w.data(), n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CHECK_BATCH_CLOSE(result[i], w[i], horner_tolerance(estrin_tolerance(poly.data(), count, z[i])));
+            }
+            w = z;
+            evaluate_polynomial_estrin(poly.data(), count, w.data(), w.data(), n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CHECK_BATCH_CLOSE(estrin[i], w[i], horner_tolerance(estrin_tolerance(poly.data(), count, z[i])));
+            }
+        }
+    }
+
+    // Fixed size and integer coefficients:
+    static const int a[] = {3, -1, 4, 1, -5, 9, 2};
+    boost::array<int, 7> b = {{3, -1, 4, 1, -5, 9, 2}};
+    std::vector<Real> z(37);
+    for (auto & x : z)
+    {
+        x = dis(gen);
+    }
+    std::vector<Real> r1(z.size()), r2(z.size()), r3(z.size());
+    evaluate_polynomial(a, z.data(), r1.data(), z.size());
+    evaluate_polynomial(b, z.data(), r2.data(), z.size());
+    evaluate_polynomial_estrin(a, z.data(), r3.data(), z.size());
+    for (std::size_t i = 0; i < z.size(); ++i)
+    {
+        Real expected = evaluate_polynomial(a, z[i], 7);
+        Real tol = estrin_tolerance(a, 7, z[i]);
+        CHECK_BATCH_CLOSE(expected, r1[i], horner_tolerance(tol));
+        CHECK_BATCH_CLOSE(expected, r2[i], horner_tolerance(tol));
+        CHECK_ABSOLUTE_ERROR(expected, r3[i], tol);
+    }
+
+    // Where the powers of z overflow, a group shorter than 8 must not multiply its missing
+    // coefficients by them, or it gives 0 * inf = NaN where Horner's rule gives inf:
+    Real big = std::sqrt(std::sqrt((std::numeric_limits<Real>::max)()));
+    std::vector<Real> w{2 * big, 16 * big, big * big, std::numeric_limits<Real>::infinity()};
+    std::vector<Real> r(w.size());
+    for (std::size_t count = 1; count <= 17; ++count)
+    {
+        std::vector<Real> poly(count, Real(1));
+        evaluate_polynomial_estrin(poly.data(), count, w.data(), r.data(), w.size());
+        for (std::size_t i = 0; i < w.size(); ++i)
+        {
+            CHECK_EQUAL(r[i], evaluate_polynomial(poly.data(), w[i], count));
+        }
+    }
+}
+
+template<class Real>
+void test_rational()
+{
+    std::mt19937 gen(29);
+    std::uniform_real_distribution<Real> coefficient(-1, 1);
+    std::uniform_real_distribution<Real> small(0, 1);
+    std::uniform_real_distribution<Real> large(1, 10);
+    using std::abs;
+    for (std::size_t count : {1, 2, 5, 11})
+    {
+        std::vector<Real> num(count), denom(count);
+        Real scale = 0;
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            num[j] = coefficient(gen);
+            scale += abs(num[j]);
+            // Keep the denominator above one on both sides of 1:
+            denom[j] = 1 + small(gen);
+        }
+        Real tol = horner_tolerance(8*count*std::numeric_limits<Real>::epsilon()*scale);
+        // Blocks with every argument below 1, every argument above 1, and both:
+        for (int kind = 0; kind < 3; ++kind)
+        {
+            std::size_t n = 53;
+            std::vector<Real> z(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (kind == 0 || (kind == 2 && i % 3 == 0))
+                {
+                    z[i] = small(gen);
+                }
+                else
+                {
+                    z[i] = large(gen);
+                }
+            }
+            z[0] = 1;
+            std::vector<Real> result(n);
+            evaluate_rational(num.data(), denom.data(), count, z.data(), result.data(), n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CHECK_BATCH_CLOSE(evaluate_rational(num.data(), denom.data(), z[i], count), result[i], tol);
+            }
+            evaluate_rational(num.data(), denom.data(), count, z.data(), z.data(), n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CHECK_BATCH_CLOSE(result[i], z[i], tol);
+            }
+        }
+    }
+
+    static const int a[] = {1, 2, 3, 4};
+    static const unsigned b[] = {4, 3, 2, 1};
+    boost::array<int, 4> c = {{1, 2, 3, 4}};
+    boost::array<unsigned, 4> d = {{4, 3, 2, 1}};
+    std::vector<Real> z(21);
+    for (std::size_t i = 0; i < z.size(); ++i)
+    {
+        z[i] = i % 2 ? small(gen) : large(gen);
+    }
+    std::vector<Real> r1(z.size()), r2(z.size());
+    evaluate_rational(a, b, z.data(), r1.data(), z.size());
+    evaluate_rational(c, d, z.data(), r2.data(), z.size());
+    for (std::size_t i = 0; i < z.size(); ++i)
+    {
+        Real expected = evaluate_rational(a, b, z[i], 4);
+        Real tol = horner_tolerance(40*std::numeric_limits<Real>::epsilon());
+        CHECK_BATCH_CLOSE(expected, r1[i], tol);
+        CHECK_BATCH_CLOSE(expected, r2[i], tol);
+    }
+}
+
+int main()
+{
+    test_polynomial<float>();
+    test_polynomial<double>();
+    test_polynomial<long double>();
+    test_rational<float>();
+    test_rational<double>();
+    test_rational<long double>();
+    return boost::math::test::report_errors();
+}
@@ -6,6 +6,10 @@
  */
 
 #include "math_unit_test.hpp"
+#include "interpolator_batch_test.hpp"
+#include <vector>
+#include <algorithm>
+#include <random>
 #include <numeric>
 #include <utility>
 #include <array>
@@ -494,8 +498,23 @@ void test_interpolation_condition()
 }
 
 
+template<typename Real>
+void test_batch_evaluation()
+{
+    std::mt19937 gen(327);
+    auto x = batch_test_abscissas<Real>(gen);
+    auto y = batch_test_values<Real>(gen, x.size());
+    auto dydx = batch_test_values<Real>(gen, x.size());
+    auto d2ydx2 = batch_test_values<Real>(gen, x.size());
+    auto d3ydx3 = batch_test_values<Real>(gen, x.size());
+    auto x_copy = x;
+    auto interpolator = septic_hermite(std::move(x_copy), std::move(y), std::move(dydx), std::move(d2ydx2), std::move(d3ydx3));
+    check_batch_evaluation(interpolator, x, gen);
+}
+
 int main()
 {
+    test_batch_evaluation<float>();
     test_constant<float>();
     test_linear<float>();
     test_quadratic<float>();
@@ -503,6 +522,7 @@ int main()
     test_quartic<float>();
     test_interpolation_condition<float>();
 
+    test_batch_evaluation<double>();
     test_constant<double>();
     test_linear<double>();
     test_quadratic<double>();
@@ -510,6 +530,7 @@ int main()
     test_quartic<double>();
     test_interpolation_condition<double>();
 
+    test_batch_evaluation<long double>();
     test_constant<long double>();
     test_linear<long double>();
     test_quadratic<long double>();
@@ -0,0 +1,202 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include <boost/math/statistics/streaming_statistics.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+using boost::math::statistics::streaming_moments;
+using boost::math::statistics::quantile_sketch;
+
+template<class Real>
+std::vector<Real> random_vector(size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dis(-1, 3);
+    std::vector<Real> v(n);
+    for (auto & x : v)
+    {
+        // Skewed, so that every moment is nonzero:
+        double t = dis(gen);
+        x = Real(t*t*t);
+    }
+    return v;
+}
+
+template<class Real>
+void test_streaming_moments()
+{
+    std::vector<Real> v = random_vector<Real>(1000, 1);
+    streaming_moments<Real> acc;
+    for (auto const & x : v)
+    {
+        acc.push(x);
+    }
+    CHECK_EQUAL(acc.count(), v.size());
+    // Pushing one value at a time is the sequential algorithm:
+    auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(v);
+    CHECK_ULP_CLOSE(M1, acc.mean(), 0);
+    CHECK_ULP_CLOSE(M2, acc.variance(), 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::variance(v), acc.variance(), 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::mean_and_sample_variance(v).second, acc.sample_variance(), 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::sample_variance(v), acc.sample_variance(), 4);
+    auto [N1, N2, N3, N4] = acc.first_four_moments();
+    CHECK_ULP_CLOSE(M3, N3, 0);
+    CHECK_ULP_CLOSE(M4, N4, 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::kurtosis(v), acc.kurtosis(), 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::excess_kurtosis(v), acc.excess_kurtosis(), 0);
+    CHECK_ULP_CLOSE(boost::math::statistics::skewness(v), acc.skewness(), 0);
+
+    // Blocks, and merged accumulators, agree to within rounding error:
+    streaming_moments<Real> blocks;
+    blocks.push(v.begin(), v.begin() + 1);
+    blocks.push(v.begin() + 1, v.begin() + 300);
+    blocks.push(v.begin() + 300, v.begin() + 300);
+    streaming_moments<Real> other;
+    other.push(v.begin() + 300, v.begin() + 700);
+    for (size_t i = 700; i < v.size(); ++i)
+    {
+        other.push(v[i]);
+    }
+    blocks.merge(other);
+    blocks.merge(streaming_moments<Real>());
+    CHECK_EQUAL(blocks.count(), v.size());
+    CHECK_ULP_CLOSE(acc.mean(), blocks.mean(), 30);
+    CHECK_ULP_CLOSE(acc.variance(), blocks.variance(), 30);
+    CHECK_ULP_CLOSE(acc.skewness(), blocks.skewness(), 100);
+    CHECK_ULP_CLOSE(acc.kurtosis(), blocks.kurtosis(), 100);
+
+    streaming_moments<Real> empty;
+    empty.merge(acc);
+    CHECK_ULP_CLOSE(acc.kurtosis(), empty.kurtosis(), 0);
+
+    // A constant stream:
+    streaming_moments<Real> c;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        c.push(Real(2));
+    }
+    CHECK_EQUAL(c.mean(), Real(2));
+    CHECK_EQUAL(c.variance(), Real(0));
+    CHECK_EQUAL(c.skewness(), Real(0));
+    CHECK_EQUAL(c.kurtosis(), Real(0));
+}
+
+void test_sharded_moments()
+{
+    // Each thread accumulates its own shard, and the results are merged:
+    std::vector<double> v = random_vector<double>(100000, 2);
+    std::vector<streaming_moments<double>> shards(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (size_t j = i; j < v.size(); j += shards.size())
+            {
+                shards[i].push(v[j]);
+            }
+        });
+    }
+    for (auto & t : threads)
+    {
+        t.join();
+    }
+    for (size_t i = 1; i < shards.size(); ++i)
+    {
+        shards[0].merge(shards[i]);
+    }
+    auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(v);
+    CHECK_ULP_CLOSE(M1, shards[0].mean(), 1000);
+    CHECK_ULP_CLOSE(M2, shards[0].variance(), 1000);
+    CHECK_ULP_CLOSE(boost::math::statistics::skewness(v), shards[0].skewness(), 1000);
+    CHECK_ULP_CLOSE(boost::math::statistics::kurtosis(v), shards[0].kurtosis(), 1000);
+}
+
+// The exact fraction of the values in the sorted vector v which are <= x:
+template<class Real>
+double rank(std::vector<Real> const & v, Real x)
+{
+    return double(std::upper_bound(v.begin(), v.end(), x) - v.begin())/v.size();
+}
+
+template<class Real>
+void test_quantile_sketch()
+{
+    const size_t k = 200;
+    std::vector<Real> v = random_vector<Real>(200000, 3);
+    quantile_sketch<Real> sketch(k);
+    sketch.push(v.begin(), v.end());
+    CHECK_EQUAL(sketch.count(), v.size());
+    // Bounded memory:
+    CHECK_LE(sketch.retained(), 4*k);
+
+    std::vector<Real> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    CHECK_EQUAL(sketch.quantile(0), sorted.front());
+    CHECK_EQUAL(sketch.quantile(1), sorted.back());
+    CHECK_EQUAL(sketch.min(), sorted.front());
+    CHECK_EQUAL(sketch.max(), sorted.back());
+    // The rank error is O(1/k):
+    double tol = 4.0/k;
+    for (Real p : {Real(0.01), Real(0.1), Real(0.25), Real(0.5), Real(0.75), Real(0.9), Real(0.99)})
+    {
+        Real q = sketch.quantile(p);
+        CHECK_ABSOLUTE_ERROR(double(p), rank(sorted, q), tol);
+        CHECK_ABSOLUTE_ERROR(rank(sorted, q), double(sketch.cdf(q)), tol);
+    }
+    CHECK_ABSOLUTE_ERROR(0.5, rank(sorted, sketch.median()), tol);
+
+    // Merging shards gives a sketch of the whole stream:
+    std::vector<quantile_sketch<Real>> shards(5, quantile_sketch<Real>(k));
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        shards[(i*7) % shards.size()].push(v[i]);
+    }
+    quantile_sketch<Real> merged(k);
+    for (auto const & s : shards)
+    {
+        merged.merge(s);
+    }
+    CHECK_EQUAL(merged.count(), v.size());
+    CHECK_LE(merged.retained(), 4*k);
+    CHECK_EQUAL(merged.quantile(0), sorted.front());
+    for (Real p : {Real(0.1), Real(0.5), Real(0.9)})
+    {
+        CHECK_ABSOLUTE_ERROR(double(p), rank(sorted, merged.quantile(p)), tol);
+    }
+
+    // Short streams are exact:
+    quantile_sketch<Real> small(k);
+    for (int i = 9; i > 0; --i)
+    {
+        small.push(Real(i));
+    }
+    CHECK_EQUAL(small.median(), Real(5));
+    CHECK_EQUAL(small.cdf(Real(3)), Real(3)/9);
+}
+
+int main()
+{
+    test_streaming_moments<float>();
+    test_streaming_moments<double>();
+    test_streaming_moments<long double>();
+    test_streaming_moments<cpp_bin_float_50>();
+
+    test_sharded_moments();
+
+    test_quantile_sketch<float>();
+    test_quantile_sketch<double>();
+    test_quantile_sketch<long double>();
+
+    return boost::math::test::report_errors();
+}
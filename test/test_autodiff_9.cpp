@@ -0,0 +1,236 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_9)
+
+// The truncated Taylor series kernels, against the obvious O(N^2) loops.  Both sides of
+// each unrolling threshold are covered, as are arrays of zero and one coefficient.
+
+namespace {
+
+template <typename T, std::size_t N>
+std::array<T, N> naive_product(std::array<T, N> const& a, std::array<T, N> const& b) {
+  std::array<T, N> r;
+  for (std::size_t i = 0; i < N; ++i) {
+    r[i] = 0;
+    for (std::size_t k = 0; k <= i; ++k)
+      r[i] += a[k] * b[i - k];
+  }
+  return r;
+}
+
+template <typename T, std::size_t N>
+std::array<T, N> naive_quotient(std::array<T, N> const& a, std::array<T, N> const& b) {
+  std::array<T, N> r;
+  for (std::size_t i = 0; i < N; ++i) {
+    T sum = a[i];
+    for (std::size_t k = 1; k <= i; ++k)
+      sum -= b[k] * r[i - k];
+    r[i] = sum / b[0];
+  }
+  return r;
+}
+
+// The bound for each coefficient is relative to the sum of the magnitudes of its terms:
+template <typename T, std::size_t N>
+std::array<T, N> product_magnitude(std::array<T, N> const& a, std::array<T, N> const& b) {
+  using std::fabs;
+  std::array<T, N> r;
+  for (std::size_t i = 0; i < N; ++i) {
+    r[i] = 0;
+    for (std::size_t k = 0; k <= i; ++k)
+      r[i] += fabs(a[k] * b[i - k]);
+  }
+  return r;
+}
+
+template <typename T, std::size_t N>
+void check_close(std::array<T, N> const& r, std::array<T, N> const& expected, std::array<T, N> const& magnitude) {
+  using std::fabs;
+  for (std::size_t i = 0; i < N; ++i) {
+    T const tolerance = 4 * (i + 1) * std::numeric_limits<T>::epsilon() * magnitude[i];
+    BOOST_CHECK_LE(fabs(r[i] - expected[i]), tolerance);
+  }
+}
+
+template <typename T, std::size_t N>
+std::array<T, N> random_array(test_detail::RandomSample<T>& sampler) {
+  std::array<T, N> r;
+  for (auto& x : r)
+    x = sampler.next();
+  return r;
+}
+
+template <typename T, std::size_t N>
+void test_multiply() {
+  using detail::truncated_multiply;
+  using detail::truncated_multiply_by_epsilon;
+  test_detail::RandomSample<T> sampler{-10, 10};
+  for (int trial = 0; trial < 10; ++trial) {
+    auto a = random_array<T, N>(sampler);
+    auto b = random_array<T, N>(sampler);
+    auto const expected = naive_product(a, b);
+    auto const magnitude = product_magnitude(a, b);
+    std::array<T, N> r;
+    truncated_multiply(r, a, b);
+    check_close(r, expected, magnitude);
+
+    // Each of the aliased forms:
+    auto c = a;
+    truncated_multiply(c, c, b);
+    check_close(c, expected, magnitude);
+    c = b;
+    truncated_multiply(c, a, c);
+    check_close(c, expected, magnitude);
+    c = a;
+    truncated_multiply(c, c, c);
+    check_close(c, naive_product(a, a), product_magnitude(a, a));
+
+    // Multiplication by epsilon, whose constant term is zero:
+    if (N > 0)
+      b[0] = 0;
+    auto const expected_epsilon = naive_product(a, b);
+    auto const magnitude_epsilon = product_magnitude(a, b);
+    truncated_multiply_by_epsilon(r, a, b);
+    check_close(r, expected_epsilon, magnitude_epsilon);
+    if (N > 0)
+      BOOST_CHECK_EQUAL(r[0], T(0));
+    c = a;
+    truncated_multiply_by_epsilon(c, c, b);
+    check_close(c, expected_epsilon, magnitude_epsilon);
+    c = b;
+    truncated_multiply_by_epsilon(c, a, c);
+    check_close(c, expected_epsilon, magnitude_epsilon);
+  }
+}
+
+template <typename T, std::size_t N>
+void test_divide() {
+  using detail::truncated_divide;
+  using detail::truncated_multiply;
+  test_detail::RandomSample<T> sampler{-10, 10};
+  for (int trial = 0; trial < 10; ++trial) {
+    auto a = random_array<T, N>(sampler);
+    auto b = random_array<T, N>(sampler);
+    // Keep away from division by (nearly) zero:
+    if (N > 0)
+      b[0] = b[0] < 0 ? b[0] - 1 : b[0] + 1;
+    auto const expected = naive_quotient(a, b);
+    // The error in q[i] is bounded by the terms of q * b = a:
+    auto const magnitude = product_magnitude(expected, b);
+    std::array<T, N> r;
+    truncated_divide(r, a, b);
+    check_close(r, expected, magnitude);
+
+    // r may be the same as a:
+    auto c = a;
+    truncated_divide(c, c, b);
+    check_close(c, expected, magnitude);
+
+    // And multiplying back recovers a:
+    truncated_multiply(c, r, b);
+    check_close(c, a, magnitude);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(truncated_multiply_kernels, T, bin_float_types) {
+  static_assert(detail::max_unrolled_order == 4, "Update the orders tested below.");
+  test_multiply<T, 0>();
+  test_multiply<T, 1>();
+  test_multiply<T, 2>();
+  test_multiply<T, 4>();
+  test_multiply<T, 5>();
+  test_multiply<T, 6>();
+  test_multiply<T, 11>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(truncated_divide_kernels, T, bin_float_types) {
+  test_divide<T, 0>();
+  test_divide<T, 1>();
+  test_divide<T, 2>();
+  test_divide<T, 4>();
+  test_divide<T, 5>();
+}
+
+// An fvar with the given Taylor coefficients: apply_coefficients on a variable only shifts them, so is exact.
+template <typename T, std::size_t N>
+detail::fvar<T, N - 1> make_series(std::array<T, N> const& coefficients) {
+  return make_fvar<T, N - 1>(0).apply_coefficients(N - 1, [&](std::size_t i) { return coefficients[i]; });
+}
+
+template <typename T, std::size_t Order>
+std::array<T, Order + 1> coefficients_of(detail::fvar<T, Order> const& x) {
+  std::array<T, Order + 1> r;
+  for (std::size_t i = 0; i <= Order; ++i)
+    r[i] = x[i];
+  return r;
+}
+
+// The kernels as used through fvar, including a *= a and a /= a:
+template <typename T, std::size_t Order>
+void test_fvar_aliasing() {
+  test_detail::RandomSample<T> sampler{1, 10};
+  for (int trial = 0; trial < 10; ++trial) {
+    auto const coefficients = random_array<T, Order + 1>(sampler);
+    auto const a = make_series(coefficients);
+    BOOST_CHECK(coefficients_of(a) == coefficients);
+
+    auto b = a;
+    b *= b;
+    check_close(coefficients_of(b), naive_product(coefficients, coefficients), product_magnitude(coefficients, coefficients));
+
+    b = a;
+    b /= b;
+    BOOST_CHECK_EQUAL(b[0], T(1));
+    for (std::size_t i = 1; i <= Order; ++i)
+      BOOST_CHECK_EQUAL(b[i], T(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(fvar_aliasing, T, bin_float_types) {
+  test_fvar_aliasing<T, 0>();
+  test_fvar_aliasing<T, 1>();
+  test_fvar_aliasing<T, 4>();
+  test_fvar_aliasing<T, 5>();
+  test_fvar_aliasing<T, 8>();
+}
+
+// apply_coefficients is Horner's method in epsilon = x - x[0], by way of multiply_assign_by_epsilon:
+template <typename T, std::size_t Order>
+void test_apply_coefficients() {
+  using std::fabs;
+  test_detail::RandomSample<T> sampler{-2, 2};
+  for (int trial = 0; trial < 10; ++trial) {
+    auto const x = make_series(random_array<T, Order + 1>(sampler));
+    auto const f = random_array<T, Order + 1>(sampler);
+    auto const y = x.apply_coefficients(Order, [&](std::size_t i) { return f[i]; });
+
+    auto epsilon = coefficients_of(x);
+    epsilon[0] = 0;
+    std::array<T, Order + 1> expected{};
+    std::array<T, Order + 1> magnitude{};
+    for (std::size_t i = Order + 1; i-- != 0;) {
+      magnitude = product_magnitude(magnitude, epsilon);
+      magnitude[0] += fabs(f[i]);
+      expected = naive_product(expected, epsilon);
+      expected[0] += f[i];
+    }
+    check_close(coefficients_of(y), expected, magnitude);
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(multiply_by_epsilon, T, bin_float_types) {
+  test_apply_coefficients<T, 0>();
+  test_apply_coefficients<T, 1>();
+  test_apply_coefficients<T, 4>();
+  test_apply_coefficients<T, 5>();
+  test_apply_coefficients<T, 9>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,301 @@
+//  Copyright the Boost.Math authors, 2020
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE test_autodiff_reverse
+
+#ifndef BOOST_ALLOW_DEPRECATED_HEADERS
+#define BOOST_ALLOW_DEPRECATED_HEADERS // artifact of sp_typeinfo.hpp inclusion from unit_test.hpp
+#endif
+
+#include <boost/math/differentiation/autodiff.hpp>
+#include <boost/math/differentiation/autodiff_reverse.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/mp11/list.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace mp11 = boost::mp11;
+namespace bmp = boost::multiprecision;
+
+#if defined(BOOST_USE_VALGRIND) || defined(BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS) || defined(BOOST_NO_STRESS_TEST)
+using all_float_types = mp11::mp_list<float, double>;
+#else
+using all_float_types = mp11::mp_list<float, double, long double, bmp::cpp_bin_float_50>;
+#endif
+
+using boost::math::differentiation::make_fvar;
+using namespace boost::math::differentiation::reverse_mode;
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_reverse)
+
+template <typename T>
+T tolerance() {
+  return 200 * std::numeric_limits<T>::epsilon();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(arithmetic, T, all_float_types) {
+  gradient_tape<T>& tape = get_active_tape<T>();
+  tape.clear();
+  rvar<T> const x = make_rvar(T(3));
+  rvar<T> const y = make_rvar(T(-2));
+  rvar<T> const c = T(5);
+  BOOST_CHECK(c.is_constant());
+  BOOST_CHECK(!x.is_constant());
+
+  // f = x y + x / y - 2 y + 5 x - 1 / x + c (y - x)
+  rvar<T> f = x * y + x / y - 2 * y + x * 5 - 1 / x + c * (y - x);
+  f += 7;
+  f -= y;
+  f *= 2;
+  f /= x;
+  f = -f + x;
+  BOOST_CHECK_EQUAL(f.value(), static_cast<T>(f));
+  f.backward();
+  // Hand differentiated: g = x y + x / y - 3 y + 5 x - 1 / x + 5 (y - x) + 7, f = -2 g / x + x.
+  T const xv = 3, yv = -2;
+  T const g = xv * yv + xv / yv - 3 * yv + 5 * xv - 1 / xv + 5 * (yv - xv) + 7;
+  T const dg_dx = yv + 1 / yv + 5 + 1 / (xv * xv) - 5;
+  T const dg_dy = xv - xv / (yv * yv) - 3 + 5;
+  BOOST_CHECK_CLOSE_FRACTION(f.value(), -2 * g / xv + xv, tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), -2 * dg_dx / xv + 2 * g / (xv * xv) + 1, tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), -2 * dg_dy / xv, tolerance<T>());
+  BOOST_CHECK_EQUAL(c.adjoint(), 0);
+  BOOST_CHECK_EQUAL(f.adjoint(), 1);
+
+  // Operations on constants alone are not recorded:
+  std::size_t const size = tape.size();
+  rvar<T> const d = c * c + exp(c) - c / 2;
+  BOOST_CHECK(d.is_constant());
+  BOOST_CHECK_EQUAL(tape.size(), size);
+
+  BOOST_CHECK(x > y);
+  BOOST_CHECK(x >= 3);
+  BOOST_CHECK(2 < x);
+  BOOST_CHECK(y <= -2);
+  BOOST_CHECK(x == T(3));
+  BOOST_CHECK(x != y);
+
+  // Intermediate results have adjoints of their own, even when shifted by a constant:
+  // z = a b with b = a + 1, so dz/db = a and dz/da = 2 a + 1.
+  tape.clear();
+  rvar<T> const a = make_rvar(T(2));
+  rvar<T> const b = a + 1;
+  rvar<T> const e = 1 - (3 + b - 2);
+  rvar<T> const z = a * b + e;
+  z.backward();
+  BOOST_CHECK_EQUAL(b.adjoint(), 2 - 1);
+  BOOST_CHECK_EQUAL(e.adjoint(), 1);
+  BOOST_CHECK_EQUAL(a.adjoint(), 2 * 2 + 1 - 1);
+}
+
+// Compares the derivative found by the tape with that of the forward mode fvar:
+template <typename T>
+void check_unary(std::function<rvar<T>(rvar<T> const&)> const& f_r,
+                 std::function<boost::math::differentiation::autodiff_fvar<T, 1>(
+                     boost::math::differentiation::autodiff_fvar<T, 1> const&)> const& f_f,
+                 T x,
+                 char const* name) {
+  BOOST_TEST_CONTEXT(name << " at " << x) {
+    get_active_tape<T>().clear();
+    rvar<T> const xr = make_rvar(x);
+    rvar<T> const y = f_r(xr);
+    y.backward();
+    auto const yf = f_f(make_fvar<T, 1>(x));
+    BOOST_CHECK_CLOSE_FRACTION(y.value(), yf.derivative(0), tolerance<T>());
+    BOOST_CHECK_CLOSE_FRACTION(xr.adjoint(), yf.derivative(1), tolerance<T>());
+  }
+}
+
+#define CHECK_UNARY(function, x)                                                             \
+  check_unary<T>([](rvar<T> const& v) { return function(v); },                               \
+                 [](boost::math::differentiation::autodiff_fvar<T, 1> const& v) {            \
+                   return boost::math::differentiation::autodiff_fvar<T, 1>(function(v));    \
+                 },                                                                          \
+                 T(x),                                                                       \
+                 #function)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(standard_functions, T, all_float_types) {
+  using std::abs;
+  T const points[] = {T(0.25), T(0.75), T(1.5), T(-0.5)};
+  for (T x : points) {
+    CHECK_UNARY(fabs, x);
+    CHECK_UNARY(abs, x);
+    CHECK_UNARY(exp, x);
+    CHECK_UNARY(sin, x);
+    CHECK_UNARY(cos, x);
+    CHECK_UNARY(tan, x);
+    CHECK_UNARY(atan, x);
+    CHECK_UNARY(sinh, x);
+    CHECK_UNARY(cosh, x);
+    CHECK_UNARY(tanh, x);
+    CHECK_UNARY(asinh, x);
+    CHECK_UNARY(erf, x);
+    CHECK_UNARY(erfc, x);
+    CHECK_UNARY(sinc, x);
+    CHECK_UNARY(lambert_w0, fabs(x));
+    CHECK_UNARY(sqrt, fabs(x));
+    CHECK_UNARY(log, fabs(x));
+    CHECK_UNARY(lgamma, fabs(x));
+    CHECK_UNARY(tgamma, fabs(x));
+    CHECK_UNARY(digamma, fabs(x));
+    CHECK_UNARY(acosh, fabs(x) + 1);
+    if (fabs(x) < 1) {
+      CHECK_UNARY(asin, x);
+      CHECK_UNARY(acos, x);
+      CHECK_UNARY(atanh, x);
+    }
+  }
+  // fabs'(0) = 0, as for fvar:
+  CHECK_UNARY(fabs, 0);
+  CHECK_UNARY(abs, 0);
+  // Functions which fvar does not provide:
+  get_active_tape<T>().clear();
+  rvar<T> const x = make_rvar(T(0.5));
+  rvar<T> y = log1p(x) + expm1(x) + log10(x) + cbrt(x) + ldexp(x, 3);
+  y.backward();
+  T const expected = 1 / T(1.5) + exp(T(0.5)) + 1 / (T(0.5) * log(T(10))) +
+                     1 / (3 * boost::math::cbrt(T(0.25))) + 8;
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), expected, tolerance<T>());
+
+  // Piecewise constant functions have zero derivative:
+  y = floor(x) + ceil(x) + round(x) + trunc(x);
+  BOOST_CHECK(y.is_constant());
+  BOOST_CHECK_EQUAL(itrunc(x * 3), 1);
+  BOOST_CHECK_EQUAL(iround(x * 3), 2);
+  BOOST_CHECK_EQUAL(llround(x * 3), 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(binary_functions, T, all_float_types) {
+  using std::atan2;
+  using std::fmod;
+  using std::pow;
+  using std::log;
+  gradient_tape<T>& tape = get_active_tape<T>();
+  tape.clear();
+  T const xv = T(1.75), yv = T(0.625);
+  rvar<T> const x = make_rvar(xv), y = make_rvar(yv);
+
+  rvar<T> f = pow(x, y);
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), yv * pow(xv, yv - 1), tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), pow(xv, yv) * log(xv), tolerance<T>());
+
+  f = pow(x, T(3)) + pow(T(2), y);
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), 3 * xv * xv, tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), pow(T(2), yv) * log(T(2)), tolerance<T>());
+
+  f = atan2(y, x);
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(f.value(), atan2(yv, xv), tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), -yv / (xv * xv + yv * yv), tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), xv / (xv * xv + yv * yv), tolerance<T>());
+
+  f = atan2(y, T(2)) + atan2(T(2), x);
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), -2 / (xv * xv + 4), tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), 2 / (yv * yv + 4), tolerance<T>());
+
+  f = fmod(x, y);
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(f.value(), fmod(xv, yv), tolerance<T>());
+  BOOST_CHECK_EQUAL(x.adjoint(), 1);
+  BOOST_CHECK_EQUAL(y.adjoint(), -2);
+
+  // A user supplied derivative, here d/dx J0(x) = -J1(x):
+  f = apply_derivative(x, boost::math::cyl_bessel_j(0, xv), -boost::math::cyl_bessel_j(1, xv)) * y;
+  f.backward();
+  BOOST_CHECK_CLOSE_FRACTION(x.adjoint(), -boost::math::cyl_bessel_j(1, xv) * yv, tolerance<T>());
+  BOOST_CHECK_CLOSE_FRACTION(y.adjoint(), boost::math::cyl_bessel_j(0, xv), tolerance<T>());
+  f = apply_derivatives(x, y, xv * yv, yv, xv);
+  f.backward();
+  BOOST_CHECK_EQUAL(x.adjoint(), yv);
+  BOOST_CHECK_EQUAL(y.adjoint(), xv);
+}
+
+// An objective of many parameters, whose gradient is found with one backward sweep:
+template <typename T>
+rvar<T> objective(std::vector<rvar<T>> const& p) {
+  rvar<T> result = 0;
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    rvar<T> const r = p[i] - T(i) / p.size();
+    result += r * r * exp(-p[(i + 1) % p.size()]);
+  }
+  return log(result);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(gradient_and_checkpoints, T, all_float_types) {
+  using std::exp;
+  using std::log;
+  gradient_tape<T>& tape = get_active_tape<T>();
+  tape.clear();
+  std::size_t const n = 300;
+  std::vector<rvar<T>> p;
+  std::vector<T> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i] = T(1) / (i + 2);
+    p.push_back(make_rvar(v[i]));
+  }
+  typename gradient_tape<T>::position const start = tape.checkpoint();
+  BOOST_CHECK_EQUAL(start, n);
+
+  std::size_t recorded = 0;
+  T const rate = T(1) / 100;
+  T loss = 0;
+  for (unsigned evaluation = 0; evaluation < 4; ++evaluation) {
+    if (evaluation == 2) {
+      // Take a gradient descent step: new independent variables are needed for the
+      // new parameter values, so start the tape again.  The adjoints are read first,
+      // since clearing the tape discards them.
+      std::vector<T> step(n);
+      for (std::size_t i = 0; i < n; ++i)
+        step[i] = -rate * p[i].adjoint();
+      tape.clear();
+      for (std::size_t i = 0; i < n; ++i) {
+        p[i] = make_rvar(T(v[i] + step[i]));
+        BOOST_CHECK_NE(p[i].value(), v[i]);
+        BOOST_CHECK_CLOSE_FRACTION(p[i].value() - v[i], step[i], 1000 * tolerance<T>());
+      }
+      BOOST_CHECK_EQUAL(tape.checkpoint(), start);
+    }
+    // Evaluations after the first discard the previous evaluation and reuse its memory:
+    tape.rewind(start);
+    rvar<T> const f = objective(p);
+    if (evaluation)
+      BOOST_CHECK_EQUAL(tape.size(), recorded);
+    recorded = tape.size();
+    // The tape size is proportional to the cost of evaluating the objective:
+    BOOST_CHECK_LE(recorded - start, 7 * n);
+    f.backward();
+    if (evaluation == 2)
+      BOOST_CHECK_LT(f.value(), loss);
+    loss = f.value();
+
+    for (std::size_t i = 0; i < n; ++i)
+      v[i] = p[i].value();
+    T s = 0;
+    std::vector<T> r(n), w(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      r[i] = v[i] - T(i) / n;
+      w[i] = exp(-v[(i + 1) % n]);
+      s += r[i] * r[i] * w[i];
+    }
+    BOOST_CHECK_CLOSE_FRACTION(f.value(), log(s), tolerance<T>());
+    for (std::size_t i = 0; i < n; ++i) {
+      std::size_t const prev = (i + n - 1) % n;
+      T const expected = (2 * r[i] * w[i] - r[prev] * r[prev] * w[prev]) / s;
+      BOOST_CHECK_SMALL(static_cast<T>(p[i].adjoint() - expected), 10 * tolerance<T>());
+    }
+  }
+  tape.clear();
+  BOOST_CHECK_EQUAL(tape.size(), 0u);
+  BOOST_CHECK_EQUAL(p[0].adjoint(), 0);
+  tape.shrink_to_fit();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -252,6 +252,88 @@ void test_weights()
 
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batch evaluation of barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(10);
+    boost::random::uniform_real_distribution<Real> dis(0.5f, 1.5f);
+    std::vector<Real> x(2000);
+    std::vector<Real> y(x.size());
+    x[0] = 0;
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen)/x.size();
+    }
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        y[i] = sin(10*x[i]) + x[i]*x[i];
+    }
+    boost::math::barycentric_rational<Real> interpolator(x.data(), y.data(), y.size(), 3);
+
+    // A number of points which is not a multiple of the block size, including some nodes:
+    boost::random::uniform_real_distribution<Real> points(x.front(), x.back());
+    std::vector<Real> t(501);
+    for (auto& ti : t)
+    {
+        ti = points(gen);
+    }
+    t[0] = x[0];
+    t[17] = x[1234];
+    t[500] = x.back();
+
+    std::vector<Real> v(t.size());
+    std::vector<Real> dv(t.size());
+    interpolator(t.begin(), t.end(), v.begin());
+    interpolator.prime(t.begin(), t.end(), dv.begin());
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        // The same sums are formed in the same order, but a compiler may fuse different multiply-adds in vectorized code,
+        // and the derivative is ill-conditioned: even the exact sums only give it to about n^2 epsilon.
+        BOOST_CHECK_SMALL(v[i] - interpolator(t[i]), 64*numeric_limits<Real>::epsilon());
+        Real d = interpolator.prime(t[i]);
+        BOOST_CHECK_SMALL(dv[i] - d, x.size()*x.size()*numeric_limits<Real>::epsilon()*(1 + abs(d)));
+    }
+    BOOST_CHECK_EQUAL(v[0], y[0]);
+    BOOST_CHECK_EQUAL(v[17], y[1234]);
+
+    // Each point is evaluated in the same way whichever thread it is given to:
+    std::vector<Real> w(t.size());
+    interpolator(t.begin(), t.end(), w.begin(), 0, 3);
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(v[i], w[i]);
+    }
+    // Nor does it matter if the output is not random access:
+    w.clear();
+    interpolator(t.begin(), t.end(), std::back_inserter(w), 0, 3);
+    BOOST_CHECK_EQUAL(w.size(), t.size());
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(v[i], w[i]);
+    }
+
+    // Approximating the sums over the distant nodes:
+    for (Real tol : {Real(1e-3), Real(1e-6), Real(10)*numeric_limits<Real>::epsilon()})
+    {
+        std::vector<Real> a(t.size());
+        std::vector<Real> da(t.size());
+        interpolator(t.begin(), t.end(), a.begin(), tol, 2);
+        interpolator.prime(t.begin(), t.end(), da.begin(), tol);
+        for (size_t i = 0; i < t.size(); ++i)
+        {
+            BOOST_CHECK_SMALL(a[i] - v[i], (std::max)(tol, 64*numeric_limits<Real>::epsilon()));
+            BOOST_CHECK_SMALL(da[i] - dv[i], (tol + x.size()*x.size()*numeric_limits<Real>::epsilon())*(1 + abs(dv[i])));
+        }
+        BOOST_CHECK_EQUAL(a[17], y[1234]);
+        BOOST_CHECK_SMALL(da[17] - dv[17], 1024*numeric_limits<Real>::epsilon()*(1 + abs(dv[17])));
+    }
+
+    BOOST_CHECK_THROW(interpolator(t.begin(), t.end(), v.begin(), Real(-1)), std::domain_error);
+    BOOST_CHECK_THROW(interpolator.prime(t.begin(), t.end(), v.begin(), numeric_limits<Real>::quiet_NaN()), std::domain_error);
+}
+
 
 BOOST_AUTO_TEST_CASE(barycentric_rational)
 {
@@ -284,6 +366,10 @@ BOOST_AUTO_TEST_CASE(barycentric_rational)
     //test_runge<long double>();
     //test_runge<cpp_bin_float_50>();
 
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
+
 #ifdef BOOST_HAS_FLOAT128
     //test_interpolation_condition<boost::multiprecision::float128>();
     //test_constant<boost::multiprecision::float128>();
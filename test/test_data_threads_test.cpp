@@ -0,0 +1,57 @@
+/*
+ * Copyright the Boost.Math authors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <boost/math/tools/test_data.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/tools/tuple.hpp>
+
+using boost::math::tools::test_data;
+using boost::math::tools::make_periodic_param;
+using boost::math::tools::make_power_param;
+
+// Two results per point, with the points where x is much larger than a rejected:
+template<class Real>
+boost::math::tuple<Real, Real> incomplete_gamma(Real a, Real x)
+{
+    if (x > 20 * a)
+    {
+        throw std::domain_error("");
+    }
+    return boost::math::make_tuple(boost::math::gamma_p(a, x), boost::math::gamma_q(a, x));
+}
+
+template<class Real>
+test_data<Real> generate(unsigned threads)
+{
+    test_data<Real> data;
+    data.set_threads(threads);
+    data.insert(&incomplete_gamma<Real>, make_periodic_param(Real(0.5), Real(40), 37), make_power_param(Real(0), -10, 10));
+    data.insert([](Real x) { return boost::math::tgamma(x); }, make_periodic_param(Real(0.25), Real(30), 101));
+    return data;
+}
+
+template<class Real>
+void test_threads()
+{
+    test_data<Real> sequential = generate<Real>(1);
+    CHECK_LE(std::size_t(500), static_cast<std::size_t>(sequential.size()));
+    for (unsigned threads : {2u, 3u, 8u, 0u})
+    {
+        test_data<Real> parallel = generate<Real>(threads);
+        CHECK_EQUAL(parallel.size(), sequential.size());
+        CHECK_EQUAL(parallel == sequential, true);
+    }
+}
+
+int main()
+{
+    test_threads<float>();
+    test_threads<double>();
+    return boost::math::test::report_errors();
+}
@@ -7,6 +7,7 @@
 #define BOOST_TEST_MAIN
 #include <boost/array.hpp>
 #include <boost/math/tools/polynomial.hpp>
+#include <boost/math/constants/constants.hpp>
 #include <boost/integer/common_factor_rt.hpp>
 #include <boost/mpl/list.hpp>
 #include <boost/mpl/joint_view.hpp>
@@ -612,3 +613,210 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_prime, T, all_test_types)
 
 }
 #endif
+
+#ifdef TEST1
+//
+// Large polynomials are multiplied by FFT or NTT, and divided by Newton iteration,
+// check these against the classical algorithms:
+//
+typedef boost::mpl::list<float, double, long double> fft_test_types;
+typedef boost::mpl::list<int, long long, unsigned long long> ntt_test_types;
+
+template <typename T, typename U>
+std::vector<T> schoolbook_product(std::vector<U> const &a, std::vector<U> const &b)
+{
+    std::vector<T> result(a.size() + b.size() - 1, T(0));
+    for (std::size_t i = 0; i < a.size(); ++i)
+        for (std::size_t j = 0; j < b.size(); ++j)
+            result[i + j] += static_cast<T>(a[i]) * static_cast<T>(b[j]);
+    return result;
+}
+
+template <typename T>
+std::vector<T> pseudo_random_coefficients(std::size_t n, double seed)
+{
+    std::vector<T> result(n);
+    for (std::size_t i = 0; i < n; ++i)
+        result[i] = static_cast<T>(std::sin(seed * static_cast<double>(i + 1)));
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_fft_multiplication, T, fft_test_types)
+{
+    std::size_t const sizes[][2] = { { 200, 200 }, { 700, 3000 }, { 2049, 2048 } };
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        std::vector<T> a = pseudo_random_coefficients<T>(sizes[s][0], 0.7);
+        std::vector<T> b = pseudo_random_coefficients<T>(sizes[s][1], 1.3);
+        polynomial<T> const pa(a.begin(), a.end());
+        polynomial<T> const pb(b.begin(), b.end());
+        polynomial<T> product = pa * pb;
+        std::vector<long double> expected = schoolbook_product<long double>(a, b);
+        BOOST_REQUIRE_EQUAL(product.size(), expected.size());
+        // The error is proportional to the norms of the factors:
+        long double tolerance = 10 * std::numeric_limits<T>::epsilon() * std::log(static_cast<long double>(expected.size()))
+            * std::sqrt(static_cast<long double>(a.size()) * static_cast<long double>(b.size()));
+        long double max_error = 0;
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            max_error = (std::max)(max_error, std::fabs(product[i] - expected[i]));
+        BOOST_CHECK_LE(max_error, tolerance);
+
+        polynomial<T> c(pa);
+        c *= pb;
+        BOOST_CHECK_EQUAL(c, product);
+    }
+    // Coefficients spanning a wide range use the classical algorithm, so that
+    // the small coefficients of the product keep their relative accuracy:
+    {
+        std::vector<T> a(300), b(300);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            a[i] = b[i] = static_cast<T>(std::pow(2.0L, -static_cast<long double>(i) / 8));
+        polynomial<T> product = polynomial<T>(a.begin(), a.end()) * polynomial<T>(b.begin(), b.end());
+        std::vector<long double> expected = schoolbook_product<long double>(a, b);
+        BOOST_REQUIRE_EQUAL(product.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            BOOST_CHECK_LE(std::fabs(product[i] - expected[i]), 4 * (i + 1) * std::numeric_limits<T>::epsilon() * expected[i]);
+    }
+    // Non finite coefficients use the classical algorithm:
+    std::vector<T> a(300, T(1)), b(300, T(1));
+    a[0] = std::numeric_limits<T>::infinity();
+    polynomial<T> product = polynomial<T>(a.begin(), a.end()) * polynomial<T>(b.begin(), b.end());
+    BOOST_CHECK((boost::math::isinf)(product[0]));
+    BOOST_CHECK_EQUAL(product[product.size() - 1], T(1));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_ntt_multiplication, T, ntt_test_types)
+{
+    // Coefficient magnitudes chosen so that the product may overflow an unsigned T, the
+    // results must still agree with the classical algorithm modulo 2^64.  Signed overflow
+    // is undefined behaviour, so those cases are only tested for unsigned types:
+    long long const max_coefficients[] = { 1000, 1LL << 31, 1LL << 36, 1LL << 60 };
+    for (unsigned s = 0; s < sizeof(max_coefficients) / sizeof(max_coefficients[0]); ++s)
+    {
+        if (static_cast<double>(max_coefficients[s]) > static_cast<double>((std::numeric_limits<T>::max)()))
+            continue;
+        if (std::numeric_limits<T>::is_signed && (static_cast<double>(max_coefficients[s]) * max_coefficients[s] * 1500 > static_cast<double>((std::numeric_limits<T>::max)())))
+            continue;
+        std::vector<T> a(700), b(1500);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            a[i] = static_cast<T>(static_cast<long long>(std::sin(0.7 * (i + 1)) * max_coefficients[s]));
+        for (std::size_t i = 0; i < b.size(); ++i)
+            b[i] = static_cast<T>(static_cast<long long>(std::sin(1.3 * (i + 1)) * max_coefficients[s]));
+        a.back() = b.back() = 1;
+        polynomial<T> const pa(a.begin(), a.end());
+        polynomial<T> const pb(b.begin(), b.end());
+        polynomial<T> product = pa * pb;
+        std::vector<unsigned long long> ua(a.begin(), a.end()), ub(b.begin(), b.end());
+        std::vector<unsigned long long> expected = schoolbook_product<unsigned long long>(ua, ub);
+        BOOST_REQUIRE_EQUAL(product.size(), expected.size());
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            if (product[i] != static_cast<T>(expected[i]))
+                ++mismatches;
+        BOOST_CHECK_EQUAL(mismatches, 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_newton_division, T, non_integral_test_types)
+{
+    std::size_t const sizes[][2] = { { 1000, 1000 }, { 1500, 4000 }, { 3000, 1200 } };
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        // A well conditioned divisor: monic with small lower order coefficients.
+        std::size_t n = sizes[s][0];
+        std::vector<T> v = pseudo_random_coefficients<T>(n + 1, 0.9);
+        for (std::size_t i = 0; i < n; ++i)
+            v[i] /= 2 * n;
+        v[n] = 1;
+        std::vector<T> q = pseudo_random_coefficients<T>(sizes[s][1], 0.7);
+        std::vector<T> r = pseudo_random_coefficients<T>(n, 1.3);
+        polynomial<T> const pv(v.begin(), v.end());
+        polynomial<T> const pq(q.begin(), q.end());
+        polynomial<T> const pr(r.begin(), r.end());
+        polynomial<T> const u = pq * pv + pr;
+
+        std::pair< polynomial<T>, polynomial<T> > result = quotient_remainder(u, pv);
+        BOOST_REQUIRE_EQUAL(result.first.size(), pq.size());
+        BOOST_REQUIRE_EQUAL(result.second.size(), pr.size());
+        T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(u.size());
+        T max_error = 0;
+        for (std::size_t i = 0; i < pq.size(); ++i)
+            max_error = (std::max)(max_error, static_cast<T>(std::fabs(result.first[i] - pq[i])));
+        for (std::size_t i = 0; i < pr.size(); ++i)
+            max_error = (std::max)(max_error, static_cast<T>(std::fabs(result.second[i] - pr[i])));
+        BOOST_CHECK_LE(max_error, tolerance);
+        BOOST_CHECK_EQUAL(u / pv, result.first);
+        BOOST_CHECK_EQUAL(u % pv, result.second);
+    }
+    //
+    // A divisor with roots outside the unit circle, Newton iteration would be unstable
+    // so we should get the same result as the classical algorithm (Knuth's algorithm D):
+    //
+    std::vector<T> v = pseudo_random_coefficients<T>(1201, 0.9);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] += T(1.5);
+    std::vector<T> u = pseudo_random_coefficients<T>(2700, 0.7);
+    std::size_t const n = v.size() - 1;
+    std::vector<T> expected(u.size() - n), w(u);
+    for (std::size_t k = expected.size(); k-- != 0;)
+    {
+        expected[k] = w[n + k] / v[n];
+        for (std::size_t j = n + k; j > k;)
+        {
+            j--;
+            w[j] -= expected[k] * v[j - k];
+        }
+    }
+    polynomial<T> const pu(u.begin(), u.end());
+    polynomial<T> const pv(v.begin(), v.end());
+    BOOST_CHECK(pu / pv == polynomial<T>(expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_evaluate_at_points, T, integral_test_types)
+{
+    polynomial<T> const a = { 3, -1, 2, 0, 1 };
+    std::vector<T> x;
+    for (int i = -10; i <= 10; ++i)
+        x.push_back(static_cast<T>(i % 4));
+    std::vector<T> y(x.size());
+    a.evaluate(&x[0], &x[0] + x.size(), &y[0]);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_EQUAL(y[i], a(x[i]));
+    // Results may be written over the input:
+    a.evaluate(&x[0], &x[0] + x.size(), &x[0]);
+    BOOST_CHECK(x == y);
+    polynomial<T> const zero;
+    zero.evaluate(&y[0], &y[0] + y.size(), &y[0]);
+    BOOST_CHECK(std::count(y.begin(), y.end(), T(0)) == static_cast<std::ptrdiff_t>(y.size()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_interpolating_polynomial, T, fft_test_types)
+{
+    std::vector<T> coefficients = pseudo_random_coefficients<T>(12, 0.7);
+    polynomial<T> const a(coefficients.begin(), coefficients.end());
+    std::vector<T> x(coefficients.size()), y(x.size()), z(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = std::cos(static_cast<T>(2 * i + 1) * boost::math::constants::pi<T>() / static_cast<T>(2 * x.size()));
+    a.evaluate(&x[0], &x[0] + x.size(), &y[0]);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_CLOSE_FRACTION(y[i], a(x[i]), 4 * std::numeric_limits<T>::epsilon());
+
+    //
+    // The monomial basis is poorly conditioned even at the Chebyshev nodes: the
+    // coefficients of T_11 are of order 2^10, so we can only expect an error of
+    // roughly that many epsilon:
+    //
+    polynomial<T> const b = interpolating_polynomial(&x[0], &x[0] + x.size(), &y[0]);
+    BOOST_REQUIRE_EQUAL(b.size(), a.size());
+    T const tolerance = 2000 * std::numeric_limits<T>::epsilon();
+    for (std::size_t i = 0; i < a.size(); ++i)
+        BOOST_CHECK_SMALL(static_cast<T>(b[i] - a[i]), tolerance);
+    b.evaluate(&x[0], &x[0] + x.size(), &z[0]);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_SMALL(static_cast<T>(z[i] - y[i]), tolerance);
+
+    BOOST_CHECK_EQUAL(interpolating_polynomial(&x[0], &x[0], &y[0]).size(), 0u);
+    x[3] = x[7];
+    BOOST_CHECK_THROW(interpolating_polynomial(&x[0], &x[0] + x.size(), &y[0]), std::domain_error);
+}
+#endif
@@ -370,6 +370,180 @@ void test_weights()
     }
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batch evaluation of barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(11);
+    boost::random::uniform_real_distribution<Real> dis(0.5f, 1.5f);
+    std::vector<Real> t(1500);
+    std::vector<std::array<Real, 3>> y(t.size());
+    t[0] = 0;
+    for (size_t i = 1; i < t.size(); ++i)
+    {
+        t[i] = t[i-1] + dis(gen)/t.size();
+    }
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        y[i] = {sin(10*t[i]), t[i]*t[i], 1/(1 + t[i])};
+    }
+    std::vector<Real> t_copy = t;
+    std::vector<std::array<Real, 3>> y_copy = y;
+    boost::math::vector_barycentric_rational<decltype(t), decltype(y)> interpolator(std::move(t), std::move(y));
+
+    // A number of points which is not a multiple of the block size, including some nodes:
+    boost::random::uniform_real_distribution<Real> points(t_copy.front(), t_copy.back());
+    std::vector<Real> s(203);
+    for (auto& si : s)
+    {
+        si = points(gen);
+    }
+    s[0] = t_copy[0];
+    s[100] = t_copy[777];
+    s[202] = t_copy.back();
+
+    std::vector<std::array<Real, 3>> v(s.size());
+    std::vector<std::array<Real, 3>> dv(s.size());
+    interpolator(s.begin(), s.end(), v.begin());
+    interpolator.prime(s.begin(), s.end(), dv.begin());
+    // The values are the same sums in the same order, but a compiler may fuse different multiply-adds in vectorized code.
+    // The derivative multiplies by 1/(t - t_i) rather than dividing, and is ill-conditioned: even the exact sums only give it
+    // to about n^2 epsilon.
+    Real tol = t_copy.size()*t_copy.size()*numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        std::array<Real, 3> z = interpolator(s[i]);
+        std::array<Real, 3> dz = interpolator.prime(s[i]);
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_SMALL(v[i][j] - z[j], 64*numeric_limits<Real>::epsilon());
+            BOOST_CHECK_SMALL(dv[i][j] - dz[j], tol*(1 + abs(dz[j])));
+        }
+    }
+    for (size_t j = 0; j < 3; ++j)
+    {
+        BOOST_CHECK_EQUAL(v[100][j], y_copy[777][j]);
+    }
+
+    std::vector<std::array<Real, 3>> w(s.size());
+    interpolator(s.begin(), s.end(), w.begin(), 0, 3);
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_EQUAL(v[i][j], w[i][j]);
+        }
+    }
+
+    // Approximating the sums over the distant nodes:
+    Real approximation_tol = 1e-6;
+    interpolator(s.begin(), s.end(), w.begin(), approximation_tol, 2);
+    std::vector<std::array<Real, 3>> dw(s.size());
+    interpolator.prime(s.begin(), s.end(), dw.begin(), approximation_tol);
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_SMALL(w[i][j] - v[i][j], approximation_tol);
+            BOOST_CHECK_SMALL(dw[i][j] - dv[i][j], (approximation_tol + tol)*(1 + abs(dv[i][j])));
+        }
+    }
+
+    // Eigen vectors:
+    std::vector<Real> te = t_copy;
+    std::vector<Eigen::Vector2d> ye(te.size());
+    for (size_t i = 0; i < te.size(); ++i)
+    {
+        ye[i][0] = y_copy[i][0];
+        ye[i][1] = y_copy[i][2];
+    }
+    boost::math::vector_barycentric_rational<decltype(te), decltype(ye)> eigen_interpolator(std::move(te), std::move(ye));
+    std::vector<Eigen::Vector2d> ve(s.size());
+    eigen_interpolator(s.begin(), s.end(), ve.begin(), approximation_tol);
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        BOOST_CHECK_SMALL(ve[i][0] - v[i][0], approximation_tol);
+        BOOST_CHECK_SMALL(ve[i][1] - v[i][2], approximation_tol);
+    }
+
+    BOOST_CHECK_THROW(interpolator(s.begin(), s.end(), w.begin(), Real(-1)), std::domain_error);
+}
+
+template<class Real>
+void test_caller_storage()
+{
+    std::cout << "Testing evaluation into caller storage of barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    // More components than are done at once by the batch evaluation:
+    constexpr size_t d = 11;
+    std::mt19937 gen(23);
+    boost::random::uniform_real_distribution<Real> dis(0.5f, 1.5f);
+    std::vector<Real> t(700);
+    std::vector<std::array<Real, d>> y(t.size());
+    t[0] = -1;
+    for (size_t i = 1; i < t.size(); ++i)
+    {
+        t[i] = t[i-1] + dis(gen)/t.size();
+    }
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        for (size_t j = 0; j < d; ++j)
+        {
+            y[i][j] = cos((j + 1)*t[i]) + j;
+        }
+    }
+    std::vector<Real> t_copy = t;
+    std::vector<std::array<Real, d>> y_copy = y;
+    boost::math::vector_barycentric_rational<decltype(t), decltype(y)> interpolator(std::move(t), std::move(y), 4);
+
+    // The weights do not depend on how they are shared out between threads:
+    std::vector<Real> t_threaded = t_copy;
+    std::vector<std::array<Real, d>> y_threaded = y_copy;
+    boost::math::vector_barycentric_rational<decltype(t), decltype(y)> threaded(std::move(t_threaded), std::move(y_threaded), 4, 3);
+
+    boost::random::uniform_real_distribution<Real> points(t_copy.front(), t_copy.back());
+    std::vector<Real> s(75);
+    for (auto& si : s)
+    {
+        si = points(gen);
+    }
+    s[3] = t_copy[0];
+    s[40] = t_copy[350];
+    s[74] = t_copy.back();
+
+    std::vector<Real> v(s.size()*d);
+    std::vector<Real> dv(s.size()*d);
+    interpolator(s.data(), s.size(), v.data());
+    interpolator.prime(s.data(), s.size(), dv.data());
+    Real tol = t_copy.size()*t_copy.size()*numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        std::array<Real, d> z = interpolator(s[i]);
+        std::array<Real, d> dz = interpolator.prime(s[i]);
+        std::array<Real, d> zt = threaded(s[i]);
+        for (size_t j = 0; j < d; ++j)
+        {
+            BOOST_CHECK_EQUAL(z[j], zt[j]);
+            BOOST_CHECK_SMALL(v[i*d + j] - z[j], 64*numeric_limits<Real>::epsilon()*(1 + abs(z[j])));
+            BOOST_CHECK_SMALL(dv[i*d + j] - dz[j], tol*(1 + abs(dz[j])));
+        }
+    }
+    for (size_t j = 0; j < d; ++j)
+    {
+        BOOST_CHECK_EQUAL(v[3*d + j], y_copy[0][j]);
+        BOOST_CHECK_EQUAL(v[40*d + j], y_copy[350][j]);
+        BOOST_CHECK_EQUAL(v[74*d + j], y_copy.back()[j]);
+    }
+
+    std::vector<Real> w(s.size()*d);
+    threaded.prime(s.data(), s.size(), w.data(), 2);
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(w[i], dv[i]);
+    }
+}
+
 
 BOOST_AUTO_TEST_CASE(vector_barycentric_rational)
 {
@@ -382,4 +556,6 @@ BOOST_AUTO_TEST_CASE(vector_barycentric_rational)
     test_interpolation_condition_std_array<double>();
     test_interpolation_condition_high_order<double>();
     test_agreement_with_1d<double>();
+    test_batch<double>();
+    test_caller_storage<double>();
 }
@@ -897,6 +897,92 @@ void test_mode()
     BOOST_TEST_EQ(ref, modes[0]);
 }
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+template<class Real>
+void test_execution_policies()
+{
+    using std::abs;
+    using boost::math::statistics::detail::parallel_central_sums;
+    Real tol = 1000*std::numeric_limits<Real>::epsilon();
+    // Large enough to be split between threads:
+    std::vector<Real> v = generate_random_vector<Real>(100003, 12803);
+    for (auto & x : v)
+    {
+        x = 3 + x*x;
+    }
+
+    // Merging the partial sums must agree with the sequential computation, whatever the number of threads:
+    Real M1, M2, M3, M4;
+    std::tie(M1, M2, M3, M4) = boost::math::statistics::first_four_moments(v);
+    for (std::size_t threads : {1, 2, 3, 6})
+    {
+        auto [N1, N2, N3, N4, n] = parallel_central_sums<Real, 4>(v.begin(), v.end(), threads);
+        BOOST_TEST_EQ(n, Real(v.size()));
+        BOOST_TEST(abs(N1 - M1) < tol*abs(M1));
+        BOOST_TEST(abs(N2/n - M2) < tol*abs(M2));
+        BOOST_TEST(abs(N3/n - M3) < tol*abs(M3));
+        BOOST_TEST(abs(N4/n - M4) < tol*abs(M4));
+    }
+
+    auto check = [&](auto const & exec)
+    {
+        Real mu = boost::math::statistics::mean(exec, v);
+        BOOST_TEST(abs(mu - M1) < tol*abs(M1));
+        Real var = boost::math::statistics::variance(exec, v.cbegin(), v.cend());
+        BOOST_TEST(abs(var - M2) < tol*abs(M2));
+        Real svar = boost::math::statistics::sample_variance(exec, v);
+        BOOST_TEST(abs(svar - boost::math::statistics::sample_variance(v)) < tol*abs(svar));
+        Real skew = boost::math::statistics::skewness(exec, v);
+        BOOST_TEST(abs(skew - boost::math::statistics::skewness(v)) < tol*abs(skew));
+        Real kurt = boost::math::statistics::kurtosis(exec, v);
+        BOOST_TEST(abs(kurt - boost::math::statistics::kurtosis(v)) < tol*abs(kurt));
+        auto [P1, P2, P3, P4] = boost::math::statistics::first_four_moments(exec, v);
+        BOOST_TEST(abs(P4 - M4) < tol*abs(M4));
+    };
+    check(std::execution::par);
+    check(std::execution::par_unseq);
+    // The sequential policy gives the sequential algorithm:
+    BOOST_TEST_EQ(boost::math::statistics::variance(std::execution::seq, v), boost::math::statistics::variance(v));
+    // Forward iterators can be split too:
+    std::forward_list<Real> l(v.begin(), v.end());
+    Real mu = boost::math::statistics::mean(std::execution::par, l.begin(), l.end());
+    BOOST_TEST(abs(mu - M1) < tol*abs(M1));
+    // A constant dataset has no skewness:
+    std::vector<Real> c(v.size(), Real(2));
+    BOOST_TEST_EQ(boost::math::statistics::skewness(std::execution::par, c), Real(0));
+
+    std::vector<Real> w = v;
+    Real m = boost::math::statistics::median(std::execution::par, w);
+    w = v;
+    BOOST_TEST_EQ(m, boost::math::statistics::median(w));
+    w.pop_back();
+    m = boost::math::statistics::median(std::execution::par, w.begin(), w.end());
+    BOOST_TEST_EQ(m, boost::math::statistics::median(w));
+
+    w = v;
+    Real gini = boost::math::statistics::gini_coefficient(std::execution::par, w);
+    w = v;
+    BOOST_TEST(abs(gini - boost::math::statistics::gini_coefficient(w)) < tol*abs(gini));
+}
+
+template<class Z>
+void test_integer_execution_policies()
+{
+    std::vector<Z> v = generate_random_vector<Z>(100003, 12803);
+    double tol = 1000*std::numeric_limits<double>::epsilon();
+    double mu = boost::math::statistics::mean(std::execution::par, v);
+    BOOST_TEST(abs(mu - boost::math::statistics::mean(v)) < tol*abs(mu));
+    double var = boost::math::statistics::variance(std::execution::par, v);
+    BOOST_TEST(abs(var - boost::math::statistics::variance(v)) < tol*var);
+    double kurt = boost::math::statistics::kurtosis(std::execution::par_unseq, v);
+    BOOST_TEST(abs(kurt - boost::math::statistics::kurtosis(v)) < tol*kurt);
+    std::vector<Z> w = v;
+    double gini = boost::math::statistics::gini_coefficient(std::execution::par, w);
+    w = v;
+    BOOST_TEST(abs(gini - boost::math::statistics::gini_coefficient(w)) < tol*abs(gini));
+}
+#endif
+
 int main()
 {
     test_mean<float>();
@@ -972,5 +1058,14 @@ int main()
     test_mode<int64_t>();
     test_mode<uint32_t>();
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+    test_execution_policies<float>();
+    test_execution_policies<double>();
+    test_execution_policies<long double>();
+
+    test_integer_execution_policies<int>();
+    test_integer_execution_policies<unsigned>();
+#endif
+
     return boost::report_errors();
 }
@@ -270,6 +270,8 @@ int main(int argc, char* argv[])
 
    parameter_info<mp_t> arg1, arg2;
    test_data<mp_t> data;
+   // The generators are pure functions, so evaluate the points in parallel:
+   data.set_threads(0).set_progress(&std::cerr);
 
    int functype = 0;
    std::string letter = "J";
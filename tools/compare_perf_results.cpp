@@ -0,0 +1,327 @@
+//  Copyright the Boost.Math authors, 2020
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Compares two sets of machine readable performance results, as written by the
+// programs in reporting/performance when BOOST_MATH_PERFORMANCE_RESULTS is set,
+// and reports the functions which have become slower:
+//
+//    compare_perf_results baseline current [--threshold=0.05] [--noise=3]
+//
+// A result is a regression when the current time per call exceeds the baseline
+// by more than the threshold (a fraction of the baseline), *and* the difference
+// is more than "noise" times the combined median absolute deviations of the two
+// timings.  Results are matched on their table, function, implementation and
+// domain, whose names don't include the compiler or library versions, so that
+// results from before and after an upgrade can be compared.  A baseline result
+// with no match in the current results can't be checked, and counts as a failure.
+// The program returns 1 if there are any regressions or unmatched baseline
+// results, 2 on error, and 0 otherwise.
+//
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::string> record;
+
+//
+// Parses one line of JSON as written by table_helper.cpp: a flat object whose
+// values are all strings or numbers.
+//
+std::string parse_json_string(const std::string& line, std::string::size_type& pos)
+{
+   if(line[pos] != '"')
+      throw std::runtime_error("Expected a string in: " + line);
+   std::string result;
+   for(++pos; pos < line.size(); ++pos)
+   {
+      if(line[pos] == '"')
+      {
+         ++pos;
+         return result;
+      }
+      if((line[pos] == '\\') && (pos + 1 < line.size()))
+      {
+         ++pos;
+         switch(line[pos])
+         {
+         case 'n': result += '\n'; break;
+         case 't': result += '\t'; break;
+         default: result += line[pos];
+         }
+      }
+      else
+         result += line[pos];
+   }
+   throw std::runtime_error("Unterminated string in: " + line);
+}
+
+void skip_space(const std::string& line, std::string::size_type& pos)
+{
+   while((pos < line.size()) && std::isspace(static_cast<unsigned char>(line[pos])))
+      ++pos;
+}
+
+record parse_json(const std::string& line)
+{
+   record r;
+   std::string::size_type pos = 0;
+   skip_space(line, pos);
+   if((pos >= line.size()) || (line[pos] != '{'))
+      throw std::runtime_error("Expected a JSON object: " + line);
+   ++pos;
+   for(;;)
+   {
+      skip_space(line, pos);
+      if(pos >= line.size())
+         throw std::runtime_error("Unterminated JSON object: " + line);
+      if(line[pos] == '}')
+         return r;
+      std::string key = parse_json_string(line, pos);
+      skip_space(line, pos);
+      if((pos >= line.size()) || (line[pos] != ':'))
+         throw std::runtime_error("Expected ':' in: " + line);
+      ++pos;
+      skip_space(line, pos);
+      std::string value;
+      if((pos < line.size()) && (line[pos] == '"'))
+         value = parse_json_string(line, pos);
+      else
+      {
+         std::string::size_type end = line.find_first_of(",}", pos);
+         if(end == std::string::npos)
+            throw std::runtime_error("Unterminated JSON object: " + line);
+         value = line.substr(pos, end - pos);
+         while(!value.empty() && std::isspace(static_cast<unsigned char>(value[value.size() - 1])))
+            value.erase(value.size() - 1);
+         pos = end;
+      }
+      r[key] = value;
+      skip_space(line, pos);
+      if((pos < line.size()) && (line[pos] == ','))
+         ++pos;
+   }
+}
+
+std::vector<std::string> parse_csv(const std::string& line)
+{
+   std::vector<std::string> fields(1);
+   bool quoted = false;
+   for(std::string::size_type pos = 0; pos < line.size(); ++pos)
+   {
+      char c = line[pos];
+      if(quoted)
+      {
+         if(c == '"')
+         {
+            if((pos + 1 < line.size()) && (line[pos + 1] == '"'))
+            {
+               fields.back() += '"';
+               ++pos;
+            }
+            else
+               quoted = false;
+         }
+         else
+            fields.back() += c;
+      }
+      else if(c == '"')
+         quoted = true;
+      else if(c == ',')
+         fields.push_back(std::string());
+      else if(c != '\r')
+         fields.back() += c;
+   }
+   return fields;
+}
+
+std::string key_of(const record& r)
+{
+   record::const_iterator t = r.find("table"), f = r.find("function"), i = r.find("implementation");
+   if((t == r.end()) || (f == r.end()) || (i == r.end()))
+      throw std::runtime_error("Result is missing the table, function or implementation field.");
+   std::string key = t->second + " | " + f->second + " | " + i->second;
+   record::const_iterator d = r.find("domain");
+   if((d != r.end()) && !d->second.empty())
+      key += " | " + d->second;
+   return key;
+}
+
+double number_of(const record& r, const char* name)
+{
+   record::const_iterator i = r.find(name);
+   if((i == r.end()) || i->second.empty())
+      return 0;
+   return std::strtod(i->second.c_str(), 0);
+}
+
+std::string field_of(const record& r, const char* name)
+{
+   record::const_iterator i = r.find(name);
+   return i == r.end() ? std::string() : i->second;
+}
+
+//
+// Loads a results file, later results for the same key replace earlier ones
+// so that a file may be appended to by successive runs:
+//
+std::map<std::string, record> load_results(const std::string& filename)
+{
+   std::ifstream is(filename.c_str());
+   if(!is)
+      throw std::runtime_error("Unable to open file " + filename);
+   std::map<std::string, record> results;
+   std::vector<std::string> header;
+   std::string line;
+   while(std::getline(is, line))
+   {
+      if(line.find_first_not_of(" \t\r") == std::string::npos)
+         continue;
+      record r;
+      if(line[line.find_first_not_of(" \t")] == '{')
+         r = parse_json(line);
+      else if(header.empty())
+      {
+         header = parse_csv(line);
+         continue;
+      }
+      else
+      {
+         std::vector<std::string> fields = parse_csv(line);
+         if(fields.size() != header.size())
+            throw std::runtime_error("Wrong number of fields in: " + line);
+         for(std::size_t i = 0; i < fields.size(); ++i)
+            r[header[i]] = fields[i];
+      }
+      results[key_of(r)] = r;
+   }
+   return results;
+}
+
+void check_environment(const std::map<std::string, record>& baseline, const std::map<std::string, record>& current, const char* field)
+{
+   std::set<std::string> b, c;
+   for(std::map<std::string, record>::const_iterator i = baseline.begin(); i != baseline.end(); ++i)
+      b.insert(field_of(i->second, field));
+   for(std::map<std::string, record>::const_iterator i = current.begin(); i != current.end(); ++i)
+      c.insert(field_of(i->second, field));
+   if(b != c)
+      std::cout << "Warning: the results were recorded with a different " << field << ", the comparison may not be meaningful." << std::endl;
+}
+
+//
+// The versions are expected to differ, since checking an upgrade is what the comparison is for:
+//
+void report_versions(const std::map<std::string, record>& baseline, const std::map<std::string, record>& current, const char* field)
+{
+   std::set<std::string> b, c;
+   for(std::map<std::string, record>::const_iterator i = baseline.begin(); i != baseline.end(); ++i)
+      b.insert(field_of(i->second, field));
+   for(std::map<std::string, record>::const_iterator i = current.begin(); i != current.end(); ++i)
+      c.insert(field_of(i->second, field));
+   if(b != c)
+   {
+      std::cout << "Comparing " << field << ":";
+      for(std::set<std::string>::const_iterator i = b.begin(); i != b.end(); ++i)
+         std::cout << " \"" << *i << "\"";
+      std::cout << " with";
+      for(std::set<std::string>::const_iterator i = c.begin(); i != c.end(); ++i)
+         std::cout << " \"" << *i << "\"";
+      std::cout << std::endl;
+   }
+}
+
+int main(int argc, char* argv[])
+{
+   double threshold = 0.05;
+   double noise = 3;
+   std::vector<std::string> files;
+   for(int i = 1; i < argc; ++i)
+   {
+      std::string arg(argv[i]);
+      if(arg.compare(0, 12, "--threshold=") == 0)
+         threshold = std::atof(arg.c_str() + 12);
+      else if(arg.compare(0, 8, "--noise=") == 0)
+         noise = std::atof(arg.c_str() + 8);
+      else
+         files.push_back(arg);
+   }
+   if((files.size() != 2) || (threshold < 0) || (noise < 0))
+   {
+      std::cerr << "Usage: compare_perf_results baseline current [--threshold=0.05] [--noise=3]" << std::endl;
+      return 2;
+   }
+
+   std::map<std::string, record> baseline, current;
+   try
+   {
+      baseline = load_results(files[0]);
+      current = load_results(files[1]);
+   }
+   catch(const std::exception& e)
+   {
+      std::cerr << e.what() << std::endl;
+      return 2;
+   }
+
+   report_versions(baseline, current, "boost");
+   report_versions(baseline, current, "compiler");
+   check_environment(baseline, current, "compiler_flags");
+   check_environment(baseline, current, "platform");
+   check_environment(baseline, current, "cpu");
+
+   unsigned regressions = 0;
+   unsigned improvements = 0;
+   std::cout << std::fixed << std::setprecision(3);
+   for(std::map<std::string, record>::const_iterator i = current.begin(); i != current.end(); ++i)
+   {
+      std::map<std::string, record>::const_iterator pos = baseline.find(i->first);
+      if(pos == baseline.end())
+      {
+         std::cout << "New:         " << i->first << std::endl;
+         continue;
+      }
+      double t_base = number_of(pos->second, "ns_per_call");
+      double t_current = number_of(i->second, "ns_per_call");
+      if((t_base <= 0) || (t_current <= 0))
+         continue;
+      double ratio = t_current / t_base;
+      double mad_base = number_of(pos->second, "mad_ns");
+      double mad_current = number_of(i->second, "mad_ns");
+      double significant = noise * std::sqrt(mad_base * mad_base + mad_current * mad_current);
+      double delta = std::fabs(t_current - t_base);
+      if((ratio > 1 + threshold) && (delta > significant))
+      {
+         std::cout << "Regression:  " << i->first << ": " << t_base << "ns -> " << t_current << "ns (x" << ratio << ")" << std::endl;
+         ++regressions;
+      }
+      else if((ratio < 1 - threshold) && (delta > significant))
+      {
+         std::cout << "Improvement: " << i->first << ": " << t_base << "ns -> " << t_current << "ns (x" << ratio << ")" << std::endl;
+         ++improvements;
+      }
+   }
+   unsigned missing = 0;
+   for(std::map<std::string, record>::const_iterator i = baseline.begin(); i != baseline.end(); ++i)
+   {
+      if(current.find(i->first) == current.end())
+      {
+         std::cout << "Missing:     " << i->first << std::endl;
+         ++missing;
+      }
+   }
+   std::cout << regressions << " regression(s) and " << improvements << " improvement(s) found in " << current.size() << " result(s)." << std::endl;
+   if(missing)
+      std::cout << "Error: " << missing << " of the " << baseline.size() << " baseline result(s) have no match in the current results, and were not checked." << std::endl;
+   return regressions || missing ? 1 : 0;
+}